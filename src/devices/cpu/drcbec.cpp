@@ -124,7 +124,9 @@ enum
 	OP_FFRI4,
 	OP_FFRI8,
 	OP_FFRFS,
-	OP_FFRFD
+	OP_FFRFD,
+	OP_CMPJMP,
+	OP_TESTJMP
 };
 
 
@@ -376,6 +378,30 @@ void drcbe_c::generate(drcuml_block &block, const instruction *instlist, uint32_
 				dst++;
 				break;
 
+			// fuse CMP/TEST with a directly following conditional JMP to save a dispatch
+			case OP_CMP:
+			case OP_TEST:
+				if (inum + 1 < numinst && instlist[inum + 1].opcode() == OP_JMP && instlist[inum + 1].condition() != COND_ALWAYS)
+				{
+					const instruction &jmp = instlist[++inum];
+					int immedbytes = 0;
+					for (int pnum = 0; pnum < 2; pnum++)
+						if (inst.param(pnum).is_mapvar() || (inst.param(pnum).is_immediate() && inst.param(pnum).immediate() != 0))
+							immedbytes += inst.size();
+					int immedwords = (immedbytes + sizeof(drcbec_instruction) - 1) / sizeof(drcbec_instruction);
+
+					// src1, src2 and the target, followed by the immediates
+					(dst++)->i = MAKE_OPCODE_FULL((opcode == OP_CMP) ? OP_CMPJMP : OP_TESTJMP, inst.size(), jmp.condition(), inst.flags(), 3 + immedwords);
+					void *immed = dst + 3;
+					output_parameter(&dst, &immed, inst.size(), inst.param(0));
+					output_parameter(&dst, &immed, inst.size(), inst.param(1));
+					dst->inst = (drcbec_instruction *)m_labels.get_codeptr(jmp.param(0).label(), m_fixup_delegate, dst);
+					dst++;
+					dst += immedwords;
+					break;
+				}
+				// fall through...
+
 			// generically handle everything else
 			default:
 
@@ -1041,6 +1067,26 @@ int drcbe_c::execute(code_handle &entry)
 				flags = FLAGS32_NZ(temp32);
 				break;
 
+			case MAKE_OPCODE_SHORT(OP_CMPJMP, 4, 1):    // CMP     src1,src2 / JMP imm,c
+				temp32 = PARAM0 - PARAM1;
+				flags = FLAGS32_NZCV_SUB(temp32, PARAM0, PARAM1);
+				if (OPCODE_FAIL_CONDITION(opcode, flags))
+					break;
+				newinst = inst[2].inst;
+				assert_in_cache(m_cache, newinst);
+				inst = newinst;
+				continue;
+
+			case MAKE_OPCODE_SHORT(OP_TESTJMP, 4, 1):   // TEST    src1,src2 / JMP imm,c
+				temp32 = PARAM0 & PARAM1;
+				flags = FLAGS32_NZ(temp32);
+				if (OPCODE_FAIL_CONDITION(opcode, flags))
+					break;
+				newinst = inst[2].inst;
+				assert_in_cache(m_cache, newinst);
+				inst = newinst;
+				continue;
+
 			case MAKE_OPCODE_SHORT(OP_OR, 4, 0):        // OR      dst,src1,src2[,f]
 				PARAM0 = PARAM1 | PARAM2;
 				break;
@@ -1581,6 +1627,16 @@ int drcbe_c::execute(code_handle &entry)
 				flags = FLAGS64_NZCV_SUB(temp64, DPARAM0, DPARAM1);
 				break;
 
+			case MAKE_OPCODE_SHORT(OP_CMPJMP, 8, 1):    // DCMP    src1,src2 / JMP imm,c
+				temp64 = DPARAM0 - DPARAM1;
+				flags = FLAGS64_NZCV_SUB(temp64, DPARAM0, DPARAM1);
+				if (OPCODE_FAIL_CONDITION(opcode, flags))
+					break;
+				newinst = inst[2].inst;
+				assert_in_cache(m_cache, newinst);
+				inst = newinst;
+				continue;
+
 			case MAKE_OPCODE_SHORT(OP_MULU, 8, 0):      // DMULU   dst,edst,src1,src2[,f]
 				dmulu(*inst[0].puint64, *inst[1].puint64, DPARAM2, DPARAM3, false);
 				break;
@@ -1650,10 +1706,20 @@ int drcbe_c::execute(code_handle &entry)
 				break;
 
 			case MAKE_OPCODE_SHORT(OP_TEST, 8, 1):      // DTEST   src1,src2[,f]
-				temp64 = DPARAM1 & DPARAM2;
+				temp64 = DPARAM0 & DPARAM1;
 				flags = FLAGS64_NZ(temp64);
 				break;
 
+			case MAKE_OPCODE_SHORT(OP_TESTJMP, 8, 1):   // DTEST   src1,src2 / JMP imm,c
+				temp64 = DPARAM0 & DPARAM1;
+				flags = FLAGS64_NZ(temp64);
+				if (OPCODE_FAIL_CONDITION(opcode, flags))
+					break;
+				newinst = inst[2].inst;
+				assert_in_cache(m_cache, newinst);
+				inst = newinst;
+				continue;
+
 			case MAKE_OPCODE_SHORT(OP_OR, 8, 0):        // DOR     dst,src1,src2[,f]
 				DPARAM0 = DPARAM1 | DPARAM2;
 				break;
@@ -3744,6 +3744,45 @@ void drcbe_x64::op_read(x86code *&dst, const instruction &inst)
 	// pick a target register for the general case
 	int dstreg = dstp.select_register(REG_EAX);
 
+	// try the space's direct page table first on byte-addressed spaces; an
+	// unresolved or non-memory page falls through to the handler call below,
+	// which fills in the table entry for next time
+	address_space &space = *m_space[spacesizep.space()];
+	read_page_table table;
+	emit_link slow1 = { nullptr }, slow2 = { nullptr }, done = { nullptr };
+	bool const fast = space.addr_shift() == 0 && (1 << spacesizep.size()) <= space.data_width() / 8 && space.get_read_page_table(table);
+	if (fast)
+	{
+		u32 const nativebytes = space.data_width() / 8;
+		u32 const bytes = 1 << spacesizep.size();
+		emit_mov_r32_p32(dst, REG_EAX, addrp);                                          // mov    eax,addrp
+		emit_and_r32_imm(dst, REG_EAX, space.addrmask() & ~(bytes - 1));                // and    eax,addrmask & ~(bytes - 1)
+		if (space.endianness() != ENDIANNESS_LITTLE && bytes < nativebytes)
+			emit_xor_r32_imm(dst, REG_EAX, nativebytes - bytes);                        // xor    eax,nativebytes - bytes
+		emit_mov_r32_r32(dst, REG_EDX, REG_EAX);                                        // mov    edx,eax
+		if (table.shift != 0)
+			emit_shr_r32_imm(dst, REG_EDX, table.shift);                                // shr    edx,shift
+		emit_mov_r64_imm(dst, REG_RCX, (uintptr_t)table.pages);                         // mov    rcx,pages
+		emit_mov_r64_m64(dst, REG_RCX, MBISD(REG_RCX, REG_RDX, 8, 0));                  // mov    rcx,[rcx + rdx*8]
+		emit_test_r64_r64(dst, REG_RCX, REG_RCX);                                       // test   rcx,rcx
+		emit_jcc_short_link(dst, x64emit::COND_Z, slow1);                               // jz     slow
+		emit_mov_r64_imm(dst, REG_RDX, (uintptr_t)table.slow);                          // mov    rdx,slow
+		emit_cmp_r64_r64(dst, REG_RCX, REG_RDX);                                        // cmp    rcx,rdx
+		emit_jcc_short_link(dst, x64emit::COND_E, slow2);                               // je     slow
+		emit_and_r32_imm(dst, REG_EAX, table.mask);                                     // and    eax,mask
+		if (spacesizep.size() == SIZE_BYTE)
+			emit_movzx_r32_m8(dst, dstreg, MBISD(REG_RCX, REG_RAX, 1, 0));              // movzx  dstreg,[rcx + rax]
+		else if (spacesizep.size() == SIZE_WORD)
+			emit_movzx_r32_m16(dst, dstreg, MBISD(REG_RCX, REG_RAX, 1, 0));             // movzx  dstreg,[rcx + rax]
+		else if (spacesizep.size() == SIZE_DWORD)
+			emit_mov_r32_m32(dst, dstreg, MBISD(REG_RCX, REG_RAX, 1, 0));               // mov    dstreg,[rcx + rax]
+		else if (spacesizep.size() == SIZE_QWORD)
+			emit_mov_r64_m64(dst, dstreg, MBISD(REG_RCX, REG_RAX, 1, 0));               // mov    dstreg,[rcx + rax]
+		emit_jmp_short_link(dst, done);                                                 // jmp    done
+		resolve_link(dst, slow1);                                                       // slow:
+		resolve_link(dst, slow2);
+	}
+
 	// set up a call to the read byte handler
 	emit_mov_r64_imm(dst, REG_PARAM1, (uintptr_t)(m_space[spacesizep.space()]));             // mov    param1,space
 	emit_mov_r32_p32(dst, REG_PARAM2, addrp);                                           // mov    param2,addrp
@@ -3773,6 +3812,8 @@ void drcbe_x64::op_read(x86code *&dst, const instruction &inst)
 		if (dstreg != REG_RAX)
 			emit_mov_r64_r64(dst, dstreg, REG_RAX);                                     // mov    dstreg,rax
 	}
+	if (fast)
+		resolve_link(dst, done);                                                        // done:
 
 	// store result
 	if (inst.size() == 4)
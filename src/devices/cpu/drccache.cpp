@@ -32,13 +32,14 @@
 //-------------------------------------------------
 
 drc_cache::drc_cache(size_t bytes)
-	: m_near((drccodeptr)osd_alloc_executable(bytes)),
+	: m_near((drccodeptr)osd_alloc_executable(bytes * CACHE_RESERVE_FACTOR)),
 		m_neartop(m_near),
 		m_base(m_near + NEAR_CACHE_SIZE),
 		m_top(m_base),
-		m_end(m_near + bytes),
+		m_end(m_near + bytes * CACHE_RESERVE_FACTOR),
+		m_limit(m_near + bytes),
 		m_codegen(nullptr),
-		m_size(bytes)
+		m_size(bytes * CACHE_RESERVE_FACTOR)
 {
 	memset(m_free, 0, sizeof(m_free));
 	memset(m_nearfree, 0, sizeof(m_nearfree));
@@ -66,6 +67,10 @@ void drc_cache::flush()
 	// can't flush in the middle of codegen
 	assert(m_codegen == nullptr);
 
+	// if we ran out of space, give the code more room next time around
+	if ((m_top - m_base) >= (code_end() - m_base) / 4 * 3 && m_limit < m_end)
+		m_limit = std::min(m_limit + (m_limit - m_base), m_end);
+
 	// just reset the top back to the base and re-seed
 	m_top = m_base;
 }
@@ -147,7 +152,7 @@ void *drc_cache::alloc_temporary(size_t bytes)
 
 	// if no space, we just fail
 	drccodeptr ptr = m_top;
-	if (ptr + bytes >= m_end)
+	if (ptr + bytes >= code_end())
 		return nullptr;
 
 	// otherwise, update the cache top
@@ -192,7 +197,7 @@ drccodeptr *drc_cache::begin_codegen(uint32_t reserve_bytes)
 
 	// if still no space, we just fail
 	drccodeptr ptr = m_top;
-	if (ptr + reserve_bytes >= m_end)
+	if (ptr + reserve_bytes >= code_end())
 		return nullptr;
 
 	// otherwise, return a pointer to the cache top
@@ -80,12 +80,25 @@ private:
 	// size of "near" area at the base of the cache
 	static const size_t NEAR_CACHE_SIZE = 131072;
 
+	// address space reserved per requested byte; the code area starts at
+	// the requested size and doubles on flushes of a nearly full cache,
+	// pages beyond what was touched are never committed by the host
+#ifdef PTR64
+	static const size_t CACHE_RESERVE_FACTOR = 4;
+#else
+	static const size_t CACHE_RESERVE_FACTOR = 1;
+#endif
+
+	// end of the space currently usable for code
+	drccodeptr code_end() const { return std::min(m_limit, m_end); }
+
 	// core parameters
 	drccodeptr          m_near;             // pointer to the near part of the cache
 	drccodeptr          m_neartop;          // top of the near part of the cache
 	drccodeptr          m_base;             // base pointer to the compiler cache
 	drccodeptr          m_top;              // current top of cache
 	drccodeptr          m_end;              // end of cache memory
+	drccodeptr          m_limit;            // end of the current code area
 	drccodeptr          m_codegen;          // start of generated code
 	size_t              m_size;             // size of the cache in bytes
 
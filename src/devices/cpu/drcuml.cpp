@@ -39,7 +39,10 @@
 #include "drcbex86.h"
 #include "drcbex64.h"
 
+#include <algorithm>
 #include <fstream>
+#include <map>
+#include <set>
 
 
 
@@ -76,6 +79,24 @@ struct bevalidate_test
 
 
 
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  shared_perf_map - the process-wide perf map
+//  (one "start size name" line per code range,
+//  read by Linux perf and compatible profilers)
+//-------------------------------------------------
+
+static std::ostream &shared_perf_map()
+{
+	static std::ofstream file(util::string_format("/tmp/perf-%d.map", osd_getpid()));
+	return file;
+}
+
+
+
 //**************************************************************************
 //  DRC BACKEND INTERFACE
 //**************************************************************************
@@ -143,6 +164,7 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 	, m_umllog(device.machine().options().drc_log_uml()
 			? new std::ofstream(util::string_format("drcuml_%s.asm", device.shortname()))
 			: nullptr)
+	, m_perfmap(device.machine().options().drc_perf_map() ? &shared_perf_map() : nullptr)
 	, m_blocklist()
 	, m_handlelist()
 	, m_symlist()
@@ -273,6 +295,21 @@ const char *drcuml_state::symbol_find(void *base, u32 *offset)
 }
 
 
+//-------------------------------------------------
+//  perf_map_add - describe a range of generated
+//  code in the perf map
+//-------------------------------------------------
+
+void drcuml_state::perf_map_add(drccodeptr start, drccodeptr end, std::string const &name)
+{
+	if (m_perfmap && (end > start))
+	{
+		util::stream_format(*m_perfmap, "%x %x %s\n", uintptr_t(start), end - start, name);
+		m_perfmap->flush();
+	}
+}
+
+
 //-------------------------------------------------
 //  log_vprintf - directly printf to the UML log
 //  if generated
@@ -340,14 +377,20 @@ void drcuml_block::end()
 
 	// optimize the resulting code first
 	optimize();
+	link_local_hashjmps();
 
 	// if we have a logfile, generate a disassembly of the block
 	if (m_drcuml.logging())
 		disassemble();
 
 	// generate the code via the back-end
+	drccodeptr const start = m_drcuml.cache().top();
 	m_drcuml.generate(*this, &m_inst[0], m_nextinst);
 
+	// tell host profilers what the new code is
+	if (m_drcuml.perf_map())
+		map_symbols(start, m_drcuml.cache().top());
+
 	// block is no longer in use
 	m_inuse = false;
 }
@@ -392,6 +435,8 @@ uml::instruction &drcuml_block::append()
 void drcuml_block::optimize()
 {
 	u32 mapvar[uml::MAPVAR_COUNT] = { 0 };
+	u64 regvalue[uml::REG_I_COUNT] = { 0 };
+	u8 regsize[uml::REG_I_COUNT] = { 0 };
 
 	// iterate over instructions
 	for (int instnum = 0; instnum < m_nextinst; instnum++)
@@ -425,12 +470,85 @@ void drcuml_block::optimize()
 				if (inst.param(pnum).is_mapvar())
 					inst.set_mapvar(pnum, mapvar[inst.param(pnum).mapvar() - uml::MAPVAR_M0]);
 
+		// substitute registers holding known immediates within straight-line code
+		inst.propagate_constants(regvalue, regsize);
+
 		// now that flags are correct, simplify the instruction
 		inst.simplify();
+		inst.track_constants(regvalue, regsize);
 	}
 }
 
 
+//-------------------------------------------------
+//  link_local_hashjmps - turn hash jumps to a
+//  mode/PC hashed within this block into local
+//  jumps, so loops closing through the hash
+//  table stay inside the block
+//-------------------------------------------------
+
+void drcuml_block::link_local_hashjmps()
+{
+	// blocks with handles may run code below the top-level stack frame,
+	// where a hash jump also unwinds subroutine calls
+	std::set<u32> labels;
+	std::map<std::pair<u64, u64>, int> hashes;
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction const &inst(m_inst[instnum]);
+		if (inst.opcode() == uml::OP_HANDLE)
+			return;
+		else if (inst.opcode() == uml::OP_LABEL)
+			labels.insert(inst.param(0).label().label());
+		else if (inst.opcode() == uml::OP_HASH)
+			hashes.emplace(std::make_pair(inst.param(0).immediate(), inst.param(1).immediate()), instnum);
+	}
+
+	// give the first hash of each mode/PC jumped to a label not otherwise in use
+	std::map<int, u32> hashlabel;
+	u32 nextlabel = 0x40000000;
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction const &inst(m_inst[instnum]);
+		if (inst.opcode() != uml::OP_HASHJMP || !inst.param(0).is_immediate() || !inst.param(1).is_immediate())
+			continue;
+		auto const found = hashes.find(std::make_pair(inst.param(0).immediate(), inst.param(1).immediate()));
+		if (found == hashes.end() || hashlabel.find(found->second) != hashlabel.end())
+			continue;
+		while (labels.find(nextlabel) != labels.end())
+			nextlabel++;
+		hashlabel.emplace(found->second, nextlabel++);
+	}
+	if (hashlabel.empty() || m_nextinst + hashlabel.size() > m_maxinst)
+		return;
+
+	// rebuild back to front, adding the labels after their hashes
+	int dest = m_nextinst + hashlabel.size();
+	for (int instnum = m_nextinst - 1; instnum >= 0; instnum--)
+	{
+		uml::instruction inst(m_inst[instnum]);
+		if (inst.opcode() == uml::OP_HASHJMP && inst.param(0).is_immediate() && inst.param(1).is_immediate())
+		{
+			auto const found = hashes.find(std::make_pair(inst.param(0).immediate(), inst.param(1).immediate()));
+			if (found != hashes.end())
+			{
+				auto const label = hashlabel.find(found->second);
+				if (label != hashlabel.end())
+					inst.jmp(uml::code_label(label->second));
+			}
+		}
+		else if (inst.opcode() == uml::OP_HASH)
+		{
+			auto const label = hashlabel.find(instnum);
+			if (label != hashlabel.end())
+				m_inst[--dest].label(uml::code_label(label->second));
+		}
+		m_inst[--dest] = inst;
+	}
+	m_nextinst += hashlabel.size();
+}
+
+
 //-------------------------------------------------
 //  disassemble - disassemble a block of
 //  instructions to the log
@@ -497,6 +615,40 @@ void drcuml_block::disassemble()
 }
 
 
+//-------------------------------------------------
+//  map_symbols - name the code generated for the
+//  block after its first mode/PC and each handle
+//  it contains
+//-------------------------------------------------
+
+void drcuml_block::map_symbols(drccodeptr start, drccodeptr end)
+{
+	std::string const tag(m_drcuml.device().tag());
+	std::string blockname;
+	std::vector<std::pair<drccodeptr, std::string> > marks;
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction const &inst(m_inst[instnum]);
+		if (inst.opcode() == uml::OP_HASH && blockname.empty())
+			blockname = util::string_format("%s %X:%08X", tag, inst.param(0).immediate(), inst.param(1).immediate());
+		else if (inst.opcode() == uml::OP_HANDLE)
+		{
+			drccodeptr const code(inst.param(0).handle().codeptr());
+			if ((code >= start) && (code < end))
+				marks.emplace_back(code, tag + ' ' + inst.param(0).handle().string());
+		}
+	}
+
+	// anything ahead of the first handle belongs to the block itself
+	std::sort(marks.begin(), marks.end());
+	if (marks.empty() || (marks.front().first != start))
+		marks.emplace(marks.begin(), start, blockname.empty() ? (tag + " block") : blockname);
+
+	for (auto it = marks.begin(); marks.end() != it; ++it)
+		m_drcuml.perf_map_add(it->first, (std::next(it) != marks.end()) ? std::next(it)->first : end, it->second);
+}
+
+
 //-------------------------------------------------
 //  get_comment_text - determine the text
 //  associated with a comment or mapvar
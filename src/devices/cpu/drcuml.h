@@ -113,7 +113,9 @@ public:
 private:
 	// internal helpers
 	void optimize();
+	void link_local_hashjmps();
 	void disassemble();
+	void map_symbols(drccodeptr start, drccodeptr end);
 	char const *get_comment_text(uml::instruction const &inst, std::string &comment);
 
 	// internal state
@@ -196,6 +198,10 @@ public:
 	void log_flush() { if (logging()) m_umllog->flush(); }
 	bool logging_native() const { return m_beintf->logging(); }
 
+	// host profiler symbol map
+	bool perf_map() const { return m_perfmap != nullptr; }
+	void perf_map_add(drccodeptr start, drccodeptr end, std::string const &name);
+
 private:
 	// symbol class
 	class symbol
@@ -225,6 +231,7 @@ private:
 	drc_cache &                             m_cache;            // pointer to the codegen cache
 	std::unique_ptr<drcbe_interface> const  m_beintf;           // backend interface pointer
 	std::unique_ptr<std::ostream> const     m_umllog;           // handle to the UML logfile
+	std::ostream *                          m_perfmap;          // shared perf map, or nullptr
 	std::list<drcuml_block>                 m_blocklist;        // list of active blocks
 	std::list<uml::code_handle>             m_handlelist;       // list of active handles
 	std::list<symbol>                       m_symlist;          // list of symbols
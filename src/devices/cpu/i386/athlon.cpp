@@ -27,6 +27,8 @@ athlonxp_device::athlonxp_device(const machine_config &mconfig, const char *tag,
 void athlonxp_device::device_start()
 {
 	i386_common_init();
+	// opcode fetches go through the modelled cache
+	m_fetch_direct = false;
 	register_state_i386_x87_xmm();
 	m_data = &space(AS_DATA);
 	m_opcodes = &space(AS_OPCODES);
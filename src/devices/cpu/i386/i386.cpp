@@ -324,15 +324,37 @@ void i386_device::NEAR_BRANCH(int32_t offs)
 	m_pc += offs;
 }
 
+// remember where the current code page lives in host memory, if it is
+// plain RAM or ROM, so that following fetches skip translation and dispatch
+void i386_device::fetch_page_update(uint32_t physical)
+{
+	m_fetch_page = ~0;
+	if (!m_fetch_direct)
+		return;
+	const uint8_t *ptr = static_cast<const uint8_t *>(m_program->get_read_page_ptr(physical & ~0xfff));
+	if (ptr == nullptr)
+		return;
+	m_fetch_ptr = ptr;
+	m_fetch_page = m_pc & ~0xfff;
+	m_fetch_cpl = m_CPL;
+	m_fetch_cr0 = m_cr[0];
+}
+
 uint8_t i386_device::FETCH()
 {
 	uint8_t value;
 	uint32_t address = m_pc, error;
 
-	if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
-		PF_THROW(error);
+	if (fetch_page_hit())
+		value = fetch_page_byte(address);
+	else
+	{
+		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
+			PF_THROW(error);
 
-	value = mem_pr8(address & m_a20_mask);
+		value = mem_pr8(address & m_a20_mask);
+		fetch_page_update(address & m_a20_mask);
+	}
 #ifdef DEBUG_MISSING_OPCODE
 	m_opcode_bytes[m_opcode_bytes_length] = value;
 	m_opcode_bytes_length = (m_opcode_bytes_length + 1) & 15;
@@ -349,6 +371,10 @@ uint16_t i386_device::FETCH16()
 	if( !WORD_ALIGNED(address) ) {       /* Unaligned read */
 		value = (FETCH() << 0);
 		value |= (FETCH() << 8);
+	} else if (fetch_page_hit()) {
+		value = fetch_page_byte(address) | (fetch_page_byte(address + 1) << 8);
+		m_eip += 2;
+		m_pc += 2;
 	} else {
 		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
 			PF_THROW(error);
@@ -369,6 +395,10 @@ uint32_t i386_device::FETCH32()
 		value |= (FETCH() << 8);
 		value |= (FETCH() << 16);
 		value |= (FETCH() << 24);
+	} else if (fetch_page_hit()) {
+		value = fetch_page_byte(address) | (fetch_page_byte(address + 1) << 8) | (fetch_page_byte(address + 2) << 16) | (fetch_page_byte(address + 3) << 24);
+		m_eip += 4;
+		m_pc += 4;
 	} else {
 		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
 			PF_THROW(error);
@@ -1901,6 +1931,7 @@ void i386_device::i386_postload()
 	for (i = 0; i < 6; i++)
 		i386_load_segment_descriptor(i);
 	CHANGE_PC(m_eip);
+	m_fetch_page = ~0;
 }
 
 void i386_device::i386_common_init()
@@ -1941,6 +1972,13 @@ void i386_device::i386_common_init()
 		macache32 = m_program->cache<2, 0, ENDIANNESS_LITTLE>();
 	}
 
+	read_page_table table;
+	m_fetch_direct = m_program->get_read_page_table(table) && table.shift >= 12;
+	m_fetch_page = ~0;
+	m_fetch_ptr = nullptr;
+	m_fetch_xor = NATIVE_ENDIAN_VALUE_LE_BE(0, m_program->data_width() / 8 - 1);
+	m_program->add_change_notifier([this](read_or_write mode) { m_fetch_page = ~0; });
+
 	m_io = &space(AS_IO);
 	m_smi = false;
 	m_debugger_temp = 0;
@@ -311,6 +311,15 @@ protected:
 	memory_access_cache<1, 0, ENDIANNESS_LITTLE> *macache16;
 	memory_access_cache<2, 0, ENDIANNESS_LITTLE> *macache32;
 
+	// instruction fetch page: host memory behind the linear page m_pc is in,
+	// valid while CPL and CR0 match and the TLB and memory map are unchanged
+	bool m_fetch_direct;
+	uint32_t m_fetch_page;
+	uint8_t m_fetch_cpl;
+	uint32_t m_fetch_cr0;
+	const uint8_t *m_fetch_ptr;
+	uint32_t m_fetch_xor;
+
 	int m_cpuid_max_input_value_eax; // Highest CPUID standard function available
 	uint32_t m_cpuid_id0, m_cpuid_id1, m_cpuid_id2;
 	uint32_t m_cpu_version;
@@ -399,6 +408,11 @@ protected:
 	bool translate_address(int pl, int type, uint32_t *address, uint32_t *error);
 	void CHANGE_PC(uint32_t pc);
 	inline void NEAR_BRANCH(int32_t offs);
+	inline bool fetch_page_hit() const { return (m_pc & ~0xfff) == m_fetch_page && m_CPL == m_fetch_cpl && m_cr[0] == m_fetch_cr0; }
+	inline uint8_t fetch_page_byte(uint32_t pc) const { return m_fetch_ptr[(pc & 0xfff) ^ m_fetch_xor]; }
+	void fetch_page_update(uint32_t physical);
+	void vtlb_flush_dynamic() { device_vtlb_interface::vtlb_flush_dynamic(); m_fetch_page = ~0; }
+	void vtlb_flush_address(offs_t address) { device_vtlb_interface::vtlb_flush_address(address); m_fetch_page = ~0; }
 	inline uint8_t FETCH();
 	inline uint16_t FETCH16();
 	inline uint32_t FETCH32();
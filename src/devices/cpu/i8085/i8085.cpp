@@ -351,7 +351,7 @@ void i8085a_cpu_device::device_start()
 	m_io = &space(AS_IO);
 
 	/* resolve callbacks */
-	m_out_status_func.resolve_safe();
+	m_out_status_func.resolve(); // left unresolved when unbound, so set_status() can skip it
 	m_out_inte_func.resolve_safe();
 	m_in_sid_func.resolve_safe(0);
 	m_out_sod_func.resolve_safe();
@@ -645,7 +645,7 @@ void i8085a_cpu_device::set_inte(int state)
 
 void i8085a_cpu_device::set_status(u8 status)
 {
-	if (status != m_status)
+	if (status != m_status && m_out_status_func)
 		m_out_status_func(status);
 
 	m_status = status;
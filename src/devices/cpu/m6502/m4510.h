@@ -22,6 +22,7 @@ public:
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 
 	virtual void do_exec_full() override;
+	virtual void do_exec_fast() override;
 	virtual void do_exec_partial() override;
 
 	bool get_nomap() const { return nomap; }
@@ -56,7 +57,7 @@ protected:
 		return adr;
 	}
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	// 4510 opcodes
 	O(eom_imp);
@@ -25,7 +25,7 @@ m6502_device::m6502_device(const machine_config &mconfig, device_type type, cons
 	sync_w(*this),
 	program_config("program", ENDIANNESS_LITTLE, 8, 16),
 	sprogram_config("decrypted_opcodes", ENDIANNESS_LITTLE, 8, 16), PPC(0), NPC(0), PC(0), SP(0), TMP(0), TMP2(0), A(0), X(0), Y(0), P(0), IR(0), inst_state_base(0), mintf(nullptr),
-	inst_state(0), inst_substate(0), icount(0), nmi_state(false), irq_state(false), apu_irq_state(false), v_state(false), irq_taken(false), sync(false), inhibit_interrupts(false)
+	inst_state(0), inst_substate(0), icount(0), nmi_state(false), irq_state(false), apu_irq_state(false), v_state(false), irq_taken(false), sync(false), inhibit_interrupts(false), atomic_instructions(false)
 {
 }
 
@@ -394,7 +394,10 @@ void m6502_device::execute_run()
 			if(machine().debug_flags & DEBUG_FLAG_ENABLED)
 				debugger_instruction_hook(pc_to_external(NPC));
 		}
-		do_exec_full();
+		if(atomic_instructions)
+			do_exec_fast();
+		else
+			do_exec_full();
 	}
 }
 
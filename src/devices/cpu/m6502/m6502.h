@@ -26,6 +26,11 @@ public:
 
 	auto sync_cb() { return sync_w.bind(); }
 
+	// run each instruction to completion instead of stopping at the exact
+	// cycle the timeslice ends; only valid when nothing else in the system
+	// depends on bus timing within an instruction
+	void set_atomic_instructions(bool atomic) { atomic_instructions = atomic; }
+
 	devcb_write_line sync_w;
 
 protected:
@@ -115,6 +120,7 @@ protected:
 	int icount, bcount, count_before_instruction_step;
 	bool nmi_state, irq_state, apu_irq_state, v_state;
 	bool irq_taken, sync, inhibit_interrupts;
+	bool atomic_instructions;
 
 	uint8_t read(uint16_t adr) { return mintf->read(adr); }
 	uint8_t read_9(uint16_t adr) { return mintf->read_9(adr); }
@@ -130,6 +136,7 @@ protected:
 	u32 XPC;
 	virtual offs_t pc_to_external(u16 pc); // For paged PCs
 	virtual void do_exec_full();
+	virtual void do_exec_fast();
 	virtual void do_exec_partial();
 
 	// inline helpers
@@ -158,7 +165,7 @@ protected:
 	uint8_t do_rol(uint8_t v);
 	uint8_t do_asr(uint8_t v);
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	// NMOS 6502 opcodes
 	//   documented opcodes
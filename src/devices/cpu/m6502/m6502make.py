@@ -82,6 +82,20 @@ FULL_NONE="""\
 %(ins)s
 """
 
+FAST_PROLOG="""\
+void %(device)s_device::%(opcode)s_fast()
+{
+"""
+
+FAST_EPILOG="""\
+}
+"""
+
+FAST_MEMORY="""\
+%(ins)s
+\ticount--;
+"""
+
 PARTIAL_PROLOG="""\
 void %(device)s_device::%(opcode)s_partial()
 {
@@ -141,6 +155,24 @@ def save_opcodes(f, device, opcodes):
                 emit(f, FULL_NONE %d)
         emit(f, FULL_EPILOG % d)
 
+        # same as full, but the instruction always completes and may
+        # overrun the timeslice; only eat-all-cycles can still suspend it
+        emit(f, FAST_PROLOG % d)
+        substate = 1
+        for ins in instructions:
+            d["substate"] = str(substate)
+            d["ins"] =  ins
+            line_type = identify_line_type(ins)
+            if line_type == "EAT":
+                emit(f, FULL_EAT_ALL % d)
+                substate += 1
+            elif line_type == "MEMORY":
+                emit(f, FAST_MEMORY % d)
+                substate += 1
+            else:
+                emit(f, FULL_NONE %d)
+        emit(f, FAST_EPILOG % d)
+
         emit(f, PARTIAL_PROLOG % d)
         substate = 1
         for ins in instructions:
@@ -169,6 +201,17 @@ DO_EXEC_FULL_EPILOG="""\
 }
 """
 
+DO_EXEC_FAST_PROLOG="""\
+void %(device)s_device::do_exec_fast()
+{
+\tswitch(inst_state) {
+"""
+
+DO_EXEC_FAST_EPILOG="""\
+\t}
+}
+"""
+
 DO_EXEC_PARTIAL_PROLOG="""\
 void %(device)s_device::do_exec_partial()
 {
@@ -204,6 +247,15 @@ def save_tables(f, device, states):
             emit(f, "\tcase %s: %s_full(); break;" % ("STATE_RESET", state))
     emit(f, DO_EXEC_FULL_EPILOG % d)
 
+    emit(f, DO_EXEC_FAST_PROLOG % d)
+    for n, state in enumerate(states):
+        if state == ".": continue
+        if n < total_states - 1:
+            emit(f, "\tcase 0x%02x: %s_fast(); break;" % (n, state))
+        else:
+            emit(f, "\tcase %s: %s_fast(); break;" % ("STATE_RESET", state))
+    emit(f, DO_EXEC_FAST_EPILOG % d)
+
     emit(f, DO_EXEC_PARTIAL_PROLOG % d)
     for n, state in enumerate(states):
         if state == ".": continue
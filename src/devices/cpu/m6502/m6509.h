@@ -19,6 +19,7 @@ public:
 
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 	virtual void do_exec_full() override;
+	virtual void do_exec_fast() override;
 	virtual void do_exec_partial() override;
 
 protected:
@@ -50,7 +51,7 @@ protected:
 	uint32_t adr_in_bank_i(uint16_t adr) { return adr | ((bank_i & 0xf) << 16); }
 	uint32_t adr_in_bank_y(uint16_t adr) { return adr | ((bank_y & 0xf) << 16); }
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	// 6509 opcodes
 	O(lda_9_idy);
@@ -26,6 +26,7 @@ public:
 
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 	virtual void do_exec_full() override;
+	virtual void do_exec_fast() override;
 	virtual void do_exec_partial() override;
 
 protected:
@@ -59,7 +60,7 @@ protected:
 	void init_port();
 	void update_port();
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	// 6510 undocumented instructions in a C64 context
 	// implementation follows what the test suites expect (usually an extra and)
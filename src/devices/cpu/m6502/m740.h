@@ -46,13 +46,14 @@ public:
 
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 	virtual void do_exec_full() override;
+	virtual void do_exec_fast() override;
 	virtual void do_exec_partial() override;
 	virtual void execute_set_input(int inputnum, int state) override;
 
 protected:
 	m740_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	virtual u32 get_state_base() const override;
 
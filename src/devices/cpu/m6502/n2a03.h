@@ -22,6 +22,7 @@ public:
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 
 	virtual void do_exec_full() override;
+	virtual void do_exec_fast() override;
 	virtual void do_exec_partial() override;
 
 	READ8_MEMBER(psg1_4014_r);
@@ -31,7 +32,7 @@ public:
 
 	void n2a03_map(address_map &map);
 protected:
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	// n2a03 opcodes - same as 6502 with D disabled
 	O(adc_nd_aba); O(adc_nd_abx); O(adc_nd_aby); O(adc_nd_idx); O(adc_nd_idy); O(adc_nd_imm); O(adc_nd_zpg); O(adc_nd_zpx);
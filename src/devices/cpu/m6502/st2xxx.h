@@ -85,6 +85,7 @@ protected:
 	virtual void device_reset() override;
 
 	virtual void do_exec_full() override;
+	virtual void do_exec_fast() override;
 	virtual void do_exec_partial() override;
 
 	virtual u16 st2xxx_ireq_mask() const = 0;
@@ -219,7 +220,7 @@ protected:
 	u8 bdiv_r();
 	void bdiv_w(u8 data);
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _fast(); void o ## _partial()
 
 	O(brk_st_imp);
 	O(rti_st_imp);
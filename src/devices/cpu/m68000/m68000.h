@@ -269,8 +269,18 @@ protected:
 	void init32(address_space &space, address_space &ospace);
 	void init32mmu(address_space &space, address_space &ospace);
 	void init32hmmu(address_space &space, address_space &ospace);
+	void init_opcode_page(address_space &ospace, bool direct);
+	void opcode_page_update(offs_t address);
 
 	std::function<u16 (offs_t)> m_readimm16;      // Immediate read 16 bit
+
+	// direct view of the opcode page last fetched from, when it is plain
+	// memory; m_opage_base is ~0 when there is none
+	bool m_opage_direct;
+	u32 m_opage_base;
+	u32 m_opage_mask;
+	u32 m_opage_xor;
+	const u16 *m_opage_ptr;
 	std::function<u8  (offs_t)> m_read8;
 	std::function<u16 (offs_t)> m_read16;
 	std::function<u32 (offs_t)> m_read32;
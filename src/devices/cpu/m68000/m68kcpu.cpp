@@ -1302,6 +1302,36 @@ void m68000_base_device::set_fpu_enable(int enable)
 	m_has_fpu = enable;
 }
 
+/****************************************************************************
+ * Direct opcode page
+ ****************************************************************************/
+
+/* Opcode fetches from plain RAM/ROM with a 16 or 32-bit bus read the */
+/* memory directly, page by page, instead of going through m_readimm16. */
+/* Without it, the mask makes the page check in m68ki_ic_readimm16 fail. */
+void m68000_base_device::init_opcode_page(address_space &ospace, bool direct)
+{
+	read_page_table table;
+	m_opage_base = ~0;
+	m_opage_mask = ~0;
+	m_opage_ptr = nullptr;
+	m_opage_direct = direct && (ospace.data_width() == 16 || ospace.data_width() == 32) && ospace.get_read_page_table(table);
+	if (!m_opage_direct)
+		return;
+	m_opage_mask = table.mask;
+	m_opage_xor = ospace.data_width() == 32 ? NATIVE_ENDIAN_VALUE_LE_BE(1, 0) : 0;
+	ospace.add_change_notifier([this](read_or_write mode) { m_opage_base = ~0; });
+}
+
+void m68000_base_device::opcode_page_update(offs_t address)
+{
+	const u16 *ptr = static_cast<const u16 *>(m_ospace->get_read_page_ptr(address & ~m_opage_mask));
+	if (ptr == nullptr)
+		return;
+	m_opage_ptr = ptr;
+	m_opage_base = address & ~m_opage_mask;
+}
+
 /****************************************************************************
  * 8-bit data memory interface
  ****************************************************************************/
@@ -1310,6 +1340,7 @@ void m68000_base_device::init8(address_space &space, address_space &ospace)
 {
 	m_space = &space;
 	m_ospace = &ospace;
+	init_opcode_page(ospace, false);
 	auto ocache = ospace.cache<0, 0, ENDIANNESS_BIG>();
 
 	m_readimm16 = [ocache](offs_t address) -> u16 { return ocache->read_word(address); };
@@ -1329,6 +1360,7 @@ void m68000_base_device::init16(address_space &space, address_space &ospace)
 {
 	m_space = &space;
 	m_ospace = &ospace;
+	init_opcode_page(ospace, true);
 	auto ocache = ospace.cache<1, 0, ENDIANNESS_BIG>();
 
 	m_readimm16 = [ocache](offs_t address) -> u16 { return ocache->read_word(address); };
@@ -1353,6 +1385,7 @@ void m68000_base_device::init32(address_space &space, address_space &ospace)
 {
 	m_space = &space;
 	m_ospace = &ospace;
+	init_opcode_page(ospace, true);
 	auto ocache = ospace.cache<2, 0, ENDIANNESS_BIG>();
 
 	m_readimm16 = [ocache](offs_t address) -> u16 { return ocache->read_word(address); };
@@ -1411,6 +1444,7 @@ void m68000_base_device::init32mmu(address_space &space, address_space &ospace)
 {
 	m_space = &space;
 	m_ospace = &ospace;
+	init_opcode_page(ospace, false);
 	auto ocache = ospace.cache<2, 0, ENDIANNESS_BIG>();
 
 	m_readimm16 = [this, ocache](offs_t address) -> u16 {
@@ -1580,6 +1614,7 @@ void m68000_base_device::init32hmmu(address_space &space, address_space &ospace)
 {
 	m_space = &space;
 	m_ospace = &ospace;
+	init_opcode_page(ospace, false);
 	auto ocache = ospace.cache<2, 0, ENDIANNESS_BIG>();
 
 	m_readimm16 = [this, ocache](offs_t address) -> u16 {
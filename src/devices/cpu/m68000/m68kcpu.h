@@ -581,6 +581,10 @@ inline u32 m68ki_ic_readimm16(u32 address)
 		}
 	}
 
+	if ((address & ~m_opage_mask) == m_opage_base)
+		return m_opage_ptr[((address & m_opage_mask) >> 1) ^ m_opage_xor];
+	if (m_opage_direct)
+		opcode_page_update(address);
 	return m_readimm16(address);
 }
 
@@ -173,6 +173,7 @@ mips3_device::mips3_device(const machine_config &mconfig, device_type type, cons
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
 	, m_drc_cache_dirty(0)
+	, m_code_watch(nullptr)
 	, m_entry(nullptr)
 	, m_nocode(nullptr)
 	, m_out_of_cycles(nullptr)
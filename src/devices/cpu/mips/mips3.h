@@ -476,6 +476,8 @@ protected:
 
 												/* internal stuff */
 	uint8_t         m_drc_cache_dirty;          /* true if we need to flush the cache */
+	std::vector<uint32_t> m_code_pages;         /* bitmap of physical pages holding translated code */
+	memory_passthrough_handler *m_code_watch;   /* write taps on those pages */
 
 												/* tables */
 	uint8_t         m_fpmode[4];                /* FPU mode table */
@@ -621,6 +623,8 @@ private:
 	void generate_update_mode(drcuml_block &block);
 	void generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param, bool allow_exception);
 	void generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
+	void watch_code_page(offs_t physpc);
+	void watch_code_pages(const opcode_desc *seqhead, const opcode_desc *seqlast);
 	void generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
 	void generate_delay_slot_and_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint8_t linkreg);
 
@@ -974,6 +978,7 @@ COMPILER-SPECIFIC OPTIONS
 #define MIPS3DRC_FLUSH_PC           0x0010          /* flush the PC value before each memory access */
 #define MIPS3DRC_CHECK_OVERFLOWS    0x0020          /* actually check overflows on add/sub instructions */
 #define MIPS3DRC_ACCURATE_DIVZERO   0x0040          /* load correct values into HI/LO on integer divide-by-zero */
+#define MIPS3DRC_WATCH_CODE_WRITES  0x0080          /* flush on writes to code pages instead of checksumming each sequence */
 
 #define MIPS3DRC_COMPATIBLE_OPTIONS (MIPS3DRC_STRICT_VERIFY | MIPS3DRC_STRICT_COP1 | MIPS3DRC_STRICT_COP0 | MIPS3DRC_STRICT_COP2 | MIPS3DRC_FLUSH_PC)
 #define MIPS3DRC_FASTEST_OPTIONS    (0)
@@ -154,6 +154,8 @@ void mips3_device::mips3drc_set_options(uint32_t options)
 {
 	if (!allow_drc()) return;
 	m_drcoptions = options;
+	// Set cache to dirty so that the new options apply to all code
+	m_drc_cache_dirty = true;
 }
 
 /*-------------------------------------------------
@@ -224,6 +226,12 @@ void mips3_device::code_flush_cache()
 	/* empty the transient cache contents */
 	m_drcuml->reset();
 
+	/* forget the code pages; they are watched again as code is recompiled */
+	if (m_code_watch != nullptr)
+		m_code_watch->remove();
+	if (m_drcoptions & MIPS3DRC_WATCH_CODE_WRITES)
+		m_code_pages.assign(((m_program->addrmask() >> 12) >> 5) + 1, 0);
+
 	try
 	{
 		/* generate the entry point and out-of-cycles handlers */
@@ -341,7 +349,12 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 
 				/* validate this code block if we're not pointing into ROM */
 				if (m_program->get_write_ptr(seqhead->physpc) != nullptr)
-					generate_checksum_block(block, compiler, seqhead, seqlast);
+				{
+					if (m_drcoptions & MIPS3DRC_WATCH_CODE_WRITES)
+						watch_code_pages(seqhead, seqlast);
+					else
+						generate_checksum_block(block, compiler, seqhead, seqlast);
+				}
 
 				/* label this instruction, if it may be jumped to locally */
 				if (seqhead->flags & OPFLAG_IS_BRANCH_TARGET)
@@ -863,7 +876,8 @@ void mips3_device::static_generate_memory_accessor(int mode, int size, int iswri
 
 	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
 		for (ramnum = 0; ramnum < m_fastram_select; ramnum++)
-			if (!(iswrite && m_fastram[ramnum].readonly))
+			/* with watched code pages, writes have to pass through the taps */
+			if (!(iswrite && (m_fastram[ramnum].readonly || (m_drcoptions & MIPS3DRC_WATCH_CODE_WRITES))))
 			{
 				void *fastbase = (uint8_t *)m_fastram[ramnum].base - m_fastram[ramnum].start;
 				uint32_t skip = label++;
@@ -1181,6 +1195,47 @@ void mips3_device::generate_checksum_block(drcuml_block &block, compiler_state &
 }
 
 
+/*-------------------------------------------------
+    watch_code_page - install a write tap on the
+    physical page holding physpc, unless there
+    already is one; a write to it flushes the
+    cache before the next timeslice
+-------------------------------------------------*/
+
+void mips3_device::watch_code_page(offs_t physpc)
+{
+	offs_t page = (physpc & m_program->addrmask()) >> 12;
+	if (m_code_pages[page >> 5] & (1 << (page & 31)))
+		return;
+	m_code_pages[page >> 5] |= 1 << (page & 31);
+
+	offs_t start = page << 12;
+	offs_t end = start | 0xfff;
+	auto written = [this]() { m_drc_cache_dirty = true; abort_timeslice(); };
+	if (m_data_bits == 64)
+		m_code_watch = m_program->install_write_tap(start, end, "smc", [written](offs_t offset, u64 &data, u64 mem_mask) { written(); }, m_code_watch);
+	else
+		m_code_watch = m_program->install_write_tap(start, end, "smc", [written](offs_t offset, u32 &data, u32 mem_mask) { written(); }, m_code_watch);
+}
+
+
+/*-------------------------------------------------
+    watch_code_pages - watch all pages a sequence
+    of opcodes was translated from, as the
+    alternative to generate_checksum_block
+-------------------------------------------------*/
+
+void mips3_device::watch_code_pages(const opcode_desc *seqhead, const opcode_desc *seqlast)
+{
+	for (const opcode_desc *curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+	{
+		watch_code_page(curdesc->physpc);
+		if (curdesc->delay.first() != nullptr)
+			watch_code_page(curdesc->delay.first()->physpc);
+	}
+}
+
+
 /*-------------------------------------------------
     generate_sequence_instruction - generate code
     for a single instruction in a sequence
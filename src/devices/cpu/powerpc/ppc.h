@@ -152,6 +152,7 @@ enum
 #define PPCDRC_STRICT_VERIFY        0x0001          /* verify all instructions */
 #define PPCDRC_FLUSH_PC             0x0002          /* flush the PC value before each memory access */
 #define PPCDRC_ACCURATE_SINGLES     0x0004          /* do excessive rounding to make single-precision results "accurate" */
+#define PPCDRC_SKIP_FPRF            0x0008          /* don't update FPSCR[FPRF] after floating-point operations */
 
 
 /* common sets of options */
@@ -1897,8 +1897,9 @@ void ppc_device::generate_shift_flags(drcuml_block &block, const opcode_desc *de
 
 void ppc_device::generate_fp_flags(drcuml_block &block, const opcode_desc *desc, int updatefprf)
 {
-	/* for now, only handle the FPRF field */
-	if (updatefprf)
+	/* for now, only handle the FPRF field; drivers whose code never reads it */
+	/* can opt out of the per-operation helper call with PPCDRC_SKIP_FPRF */
+	if (updatefprf && !(m_drcoptions & PPCDRC_SKIP_FPRF))
 	{
 		int regnum = G_RD(desc->opptr.l[0]);
 		if (m_fdregmap[regnum].is_float_register())
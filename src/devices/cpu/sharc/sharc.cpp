@@ -648,6 +648,7 @@ void adsp21062_device::device_start()
 
 	m_core->fp0 = 0.0f;
 	m_core->fp1 = 1.0f;
+	m_core->fp2 = 2.0f;
 
 	save_item(NAME(m_core->pc));
 	save_pointer(NAME(&m_core->r[0].r), ARRAY_LENGTH(m_core->r));
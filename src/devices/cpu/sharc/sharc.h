@@ -415,6 +415,7 @@ private:
 
 		float fp0;
 		float fp1;
+		float fp2;
 
 		uint32_t force_recompile;
 		uint32_t cache_dirty;
@@ -3805,15 +3805,12 @@ void adsp21062_device::generate_compute(drcuml_block &block, compiler_state &com
 					case 0x09:      // Rn = (Rx + Ry) / 2
 					case 0x63:      // Rn = CLIP Rx BY Ry
 					case 0x92:      // Fn = ABS(Fx - Fy)
-					case 0x89:      // Fn = (Fx + Fy) / 2
 					case 0xdd:      // Rn = TRUNC Fx BY Ry
 					case 0xe0:      // Fn = Fx COPYSIGN Fy
-					case 0x05:      // Rn = Rx + Ry + CI
 					case 0x06:      // Rn = Rx - Ry + CI - 1
 					case 0x25:      // Rn = Rx + CI
 					case 0x26:      // Rn = Rx + CI - 1
 					case 0x30:      // Rn = ABS Rx
-					case 0x43:      // Rn = NOT Rx
 					case 0xa5:      // Fn = RND Fx
 					case 0xad:      // Rn = MANT Fx
 					case 0xcd:      // Rn = TRUNC Fx
@@ -3840,6 +3837,17 @@ void adsp21062_device::generate_compute(drcuml_block &block, compiler_state &com
 						if (AI_CALC_REQUIRED) UML_MOV(block, ASTAT_AI, 0);
 						return;
 
+					case 0x05:      // Rn = Rx + Ry + CI
+						UML_CARRY(block, ASTAT_AC, 0);
+						UML_ADDC(block, REG(rn), REG(rx), REG(ry));
+						if (AZ_CALC_REQUIRED) UML_SETc(block, COND_Z, ASTAT_AZ);
+						if (AN_CALC_REQUIRED) UML_SETc(block, COND_S, ASTAT_AN);
+						if (AV_CALC_REQUIRED) UML_SETc(block, COND_V, ASTAT_AV);
+						if (AC_CALC_REQUIRED) UML_SETc(block, COND_C, ASTAT_AC);
+						if (AS_CALC_REQUIRED) UML_MOV(block, ASTAT_AS, 0);
+						if (AI_CALC_REQUIRED) UML_MOV(block, ASTAT_AI, 0);
+						return;
+
 					case 0x0a:      // COMP(Rx, Ry)
 						UML_CMP(block, REG(rx), REG(ry));
 						UML_SETc(block, COND_Z, I0);
@@ -3934,6 +3942,16 @@ void adsp21062_device::generate_compute(drcuml_block &block, compiler_state &com
 						if (AI_CALC_REQUIRED) UML_MOV(block, ASTAT_AI, 0);
 						return;
 
+					case 0x43:      // Rn = NOT Rx
+						UML_XOR(block, REG(rn), REG(rx), 0xffffffff);
+						if (AZ_CALC_REQUIRED) UML_SETc(block, COND_Z, ASTAT_AZ);
+						if (AN_CALC_REQUIRED) UML_SETc(block, COND_S, ASTAT_AN);
+						if (AV_CALC_REQUIRED) UML_MOV(block, ASTAT_AV, 0);
+						if (AC_CALC_REQUIRED) UML_MOV(block, ASTAT_AC, 0);
+						if (AS_CALC_REQUIRED) UML_MOV(block, ASTAT_AS, 0);
+						if (AI_CALC_REQUIRED) UML_MOV(block, ASTAT_AI, 0);
+						return;
+
 					case 0x61:      // Rn = MIN(Rx, Ry)
 						UML_MOV(block, REG(rn), REG(rx));
 						UML_CMP(block, REG(rx), REG(ry));
@@ -4019,6 +4037,23 @@ void adsp21062_device::generate_compute(drcuml_block &block, compiler_state &com
 						UML_ICOPYFS(block, REG(rn), F0);
 						return;
 
+					case 0x89:      // Fn = (Fx + Fy) / 2
+						// TODO: denormals
+						UML_FSCOPYI(block, F0, REG(rx));
+						UML_FSCOPYI(block, F1, REG(ry));
+						UML_FSADD(block, F0, F0, F1);
+						UML_FSDIV(block, F0, F0, mem(&m_core->fp2));
+						if (AZ_CALC_REQUIRED || AN_CALC_REQUIRED)
+							UML_FSCMP(block, F0, mem(&m_core->fp0));
+						if (AZ_CALC_REQUIRED) UML_SETc(block, COND_Z, ASTAT_AZ);
+						if (AN_CALC_REQUIRED) UML_SETc(block, COND_C, ASTAT_AN);
+						if (AV_CALC_REQUIRED) UML_MOV(block, ASTAT_AV, 0);  // TODO
+						if (AC_CALC_REQUIRED) UML_MOV(block, ASTAT_AC, 0);
+						if (AS_CALC_REQUIRED) UML_MOV(block, ASTAT_AS, 0);
+						if (AI_CALC_REQUIRED) UML_MOV(block, ASTAT_AI, 0);  // TODO
+						UML_ICOPYFS(block, REG(rn), F0);
+						return;
+
 					case 0x8a:      // COMP(Fx, Fy)
 						UML_FSCOPYI(block, F0, REG(rx));
 						UML_FSCOPYI(block, F1, REG(ry));
@@ -84,6 +84,7 @@ tms340x0_device::tms340x0_device(const machine_config &mconfig, device_type type
 	, m_executing(0)
 	, m_program(nullptr)
 	, m_cache(nullptr)
+	, m_data_cache(nullptr)
 	, m_pixclock(0)
 	, m_pixperclock(0)
 	, m_scantimer(nullptr)
@@ -644,6 +645,7 @@ void tms340x0_device::device_start()
 
 	m_program = &space(AS_PROGRAM);
 	m_cache = m_program->cache<1, 3, ENDIANNESS_LITTLE>();
+	m_data_cache = m_program->cache<1, 3, ENDIANNESS_LITTLE>();
 
 	/* set up the state table */
 	{
@@ -320,6 +320,7 @@ protected:
 	uint8_t            m_executing;
 	address_space *m_program;
 	memory_access_cache<1, 3, ENDIANNESS_LITTLE> *m_cache;
+	memory_access_cache<1, 3, ENDIANNESS_LITTLE> *m_data_cache;   /* separate from m_cache so field accesses don't evict the code range */
 	uint32_t  m_pixclock;                           /* the pixel clock (0 means don't adjust screen size) */
 	int     m_pixperclock;                        /* pixels per clock */
 	emu_timer *m_scantimer;
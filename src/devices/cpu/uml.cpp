@@ -836,6 +836,72 @@ u8 uml::instruction::modified_flags() const
 }
 
 
+//-------------------------------------------------
+//  propagate_constants - replace integer register
+//  inputs that are known to hold an immediate of
+//  at least the size being read
+//-------------------------------------------------
+
+void uml::instruction::propagate_constants(u64 const *regvalue, u8 const *regsize)
+{
+	opcode_info const &opinfo = s_opcode_info_table[m_opcode];
+	for (int pnum = 0; pnum < m_numparams; pnum++)
+	{
+		opcode_info::parameter_info const &pinfo = opinfo.param[pnum];
+		if (pinfo.output != PIO_IN || !(pinfo.typemask & PTYPES_IMM) || !m_param[pnum].is_int_register())
+			continue;
+
+		// 32-bit writes leave the upper half undefined, so only narrower or equal reads qualify
+		u8 const size = (pinfo.size == PSIZE_OP) ? m_size : (pinfo.size == PSIZE_4) ? 4 : (pinfo.size == PSIZE_8) ? 8 : 0;
+		int const regnum = m_param[pnum].ireg() - REG_I0;
+		if (size == 0 || size > regsize[regnum])
+			continue;
+		m_param[pnum] = (size == 4) ? u64(u32(regvalue[regnum])) : regvalue[regnum];
+	}
+}
+
+
+//-------------------------------------------------
+//  track_constants - update the set of integer
+//  registers known to hold immediates after this
+//  instruction; anything that may be reached
+//  from elsewhere or calls out forgets them all
+//-------------------------------------------------
+
+void uml::instruction::track_constants(u64 *regvalue, u8 *regsize) const
+{
+	switch (m_opcode)
+	{
+	case OP_HANDLE:
+	case OP_HASH:
+	case OP_LABEL:
+	case OP_DEBUG:
+	case OP_HASHJMP:
+	case OP_EXH:
+	case OP_CALLH:
+	case OP_RET:
+	case OP_CALLC:
+	case OP_RESTORE:
+		std::fill_n(regsize, REG_I_COUNT, 0);
+		return;
+
+	default:
+		break;
+	}
+
+	opcode_info const &opinfo = s_opcode_info_table[m_opcode];
+	for (int pnum = 0; pnum < m_numparams; pnum++)
+		if ((opinfo.param[pnum].output & PIO_OUT) && m_param[pnum].is_int_register())
+			regsize[m_param[pnum].ireg() - REG_I0] = 0;
+
+	if (m_opcode == OP_MOV && m_condition == COND_ALWAYS && m_param[0].is_int_register() && m_param[1].is_immediate())
+	{
+		regvalue[m_param[0].ireg() - REG_I0] = m_param[1].immediate();
+		regsize[m_param[0].ireg() - REG_I0] = m_size;
+	}
+}
+
+
 //-------------------------------------------------
 //  disasm - disassemble an instruction to the
 //  given buffer
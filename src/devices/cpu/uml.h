@@ -412,6 +412,8 @@ namespace uml
 		u8 output_flags() const;
 		u8 modified_flags() const;
 		void simplify();
+		void propagate_constants(u64 const *regvalue, u8 const *regsize);
+		void track_constants(u64 *regvalue, u8 *regsize) const;
 
 		// compile-time opcodes
 		void handle(code_handle &hand) { configure(OP_HANDLE, 4, hand); }
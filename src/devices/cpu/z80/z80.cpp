@@ -481,9 +481,12 @@ inline uint8_t z80_device::rop()
 	unsigned pc = PCD;
 	PC++;
 	uint8_t res = m_opcodes_cache->read_byte(pc);
-	m_icount -= 2;
-	m_refresh_cb((m_i << 8) | (m_r2 & 0x80) | ((m_r-1) & 0x7f), 0x00, 0xff);
-	m_icount += 2;
+	if (m_refresh_cb)
+	{
+		m_icount -= 2;
+		m_refresh_cb((m_i << 8) | (m_r2 & 0x80) | ((m_r-1) & 0x7f), 0x00, 0xff);
+		m_icount += 2;
+	}
 	return res;
 }
 
@@ -3458,7 +3461,8 @@ void z80_device::device_start()
 	m_cc_ex = cc_ex;
 
 	m_irqack_cb.resolve_safe();
-	m_refresh_cb.resolve_safe();
+	/* left unresolved when unbound, so rop() can skip it on every fetch */
+	m_refresh_cb.resolve();
 	m_halt_cb.resolve_safe();
 }
 
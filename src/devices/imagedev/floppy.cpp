@@ -194,6 +194,8 @@ floppy_image_device::floppy_image_device(const machine_config &mconfig, device_t
 		revolution_count(0),
 		cyl(0),
 		subcyl(0),
+		cache_next_buf(nullptr),
+		cache_next_index(0),
 		image_dirty(false),
 		ready_counter(0),
 		m_make_sound(false),
@@ -283,6 +285,7 @@ void floppy_image_device::set_rpm(float _rpm)
 
 	rpm = _rpm;
 	rev_time = attotime::from_double(60/rpm);
+	cache_next_buf = nullptr;
 	floppy_ratio_1 = int(1000.0f*rpm/300.0f+0.5f);
 }
 
@@ -372,6 +375,12 @@ void floppy_image_device::device_start()
 	save_item(NAME(ready_counter));
 }
 
+void floppy_image_device::device_post_load()
+{
+	// the restored zone didn't come from stepping along the current buffer
+	cache_next_buf = nullptr;
+}
+
 void floppy_image_device::device_reset()
 {
 	if (m_make_sound)
@@ -840,6 +849,8 @@ void floppy_image_device::cache_fill_index(const std::vector<uint32_t> &buf, int
 	}
 
 	cache_end_time = position_to_time(base, buf[index] & floppy_image::TIME_MASK);
+	cache_next_index = index;
+	cache_next_base = base;
 }
 
 void floppy_image_device::cache_clear()
@@ -848,12 +859,14 @@ void floppy_image_device::cache_clear()
 	cache_index = 0;
 	cache_entry = 0;
 	cache_weak = false;
+	cache_next_buf = nullptr;
 }
 
 void floppy_image_device::cache_fill(const attotime &when)
 {
 	std::vector<uint32_t> &buf = image->get_buffer(cyl, ss, subcyl);
 	uint32_t cells = buf.size();
+	cache_next_buf = nullptr;
 	if(cells <= 1) {
 		cache_start_time = attotime::zero;
 		cache_end_time = attotime::never;
@@ -878,6 +891,7 @@ void floppy_image_device::cache_fill(const attotime &when)
 		return;
 	}
 
+	cache_next_buf = &buf;
 	for(;;) {
 		cache_fill_index(buf, index, base);
 		if(cache_end_time > when) {
@@ -887,6 +901,25 @@ void floppy_image_device::cache_fill(const attotime &when)
 	}
 }
 
+void floppy_image_device::cache_advance(const attotime &when)
+{
+	// Controllers walk the track in order, so the wanted zone is usually
+	// one of the next few; step there instead of searching the whole track
+	std::vector<uint32_t> &buf = image->get_buffer(cyl, ss, subcyl);
+	if(cache_next_buf == &buf && when >= cache_end_time) {
+		for(int step = 0; step != 8; step++) {
+			int index = cache_next_index;
+			attotime base = cache_next_base;
+			cache_fill_index(buf, index, base);
+			if(cache_end_time > when) {
+				cache_weakness_setup();
+				return;
+			}
+		}
+	}
+	cache_fill(when);
+}
+
 void floppy_image_device::cache_weakness_setup()
 {
 	u32 type = cache_entry & floppy_image::MG_MASK;
@@ -910,7 +943,7 @@ attotime floppy_image_device::get_next_transition(const attotime &from_when)
 		return attotime::never;
 
 	if(from_when < cache_start_time || (!cache_end_time.is_never() && from_when >= cache_end_time))
-		cache_fill(from_when);
+		cache_advance(from_when);
 
 	if(!cache_weak)
 		return cache_end_time;
@@ -141,6 +141,7 @@ protected:
 	// device-level overrides
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_post_load() override;
 	virtual void device_timer(emu_timer &timer, device_timer_id id, int param, void *ptr) override;
 
 	virtual void device_add_mconfig(machine_config &config) override;
@@ -198,6 +199,11 @@ protected:
 	u32 cache_entry;
 	bool cache_weak;
 
+	/* Where the cached zone ends, so in-order reads can step to the next one */
+	const std::vector<uint32_t> *cache_next_buf;
+	int cache_next_index;
+	attotime cache_next_base;
+
 	bool image_dirty;
 	int ready_counter;
 
@@ -222,6 +228,7 @@ protected:
 	void cache_clear();
 	void cache_fill_index(const std::vector<uint32_t> &buf, int &index, attotime &base);
 	void cache_fill(const attotime &when);
+	void cache_advance(const attotime &when);
 	void cache_weakness_setup();
 
 	// Sound
@@ -242,6 +242,9 @@ void bus_master_ide_controller_device::device_start()
 	/* find the bus master space */
 	m_dma_address_xor = (m_dma_space->endianness() == ENDIANNESS_LITTLE) ? 0 : 3;
 
+	/* one descriptor's worth of data read from the drive */
+	m_dma_data = std::make_unique<uint32_t[]>(0x10000 / 4);
+
 	save_item(NAME(m_dma_address));
 	save_item(NAME(m_dma_bytes_left));
 	save_item(NAME(m_dma_descriptor));
@@ -406,12 +409,24 @@ void bus_master_ide_controller_device::execute_dma()
 
 		if (m_bus_master_command & 8)
 		{
-			// read from ata bus
-			uint16_t data = read_dma();
+			// read from ata bus until the descriptor is full or the drive pauses
+			uint32_t bytes = 0;
+			do
+			{
+				uint16_t data = read_dma();
+				uint32_t &dword = m_dma_data[bytes >> 2];
+				if (!(bytes & 3))
+					dword = 0;
+				dword |= uint32_t(data & 0xff) << (8 * ((bytes & 3) ^ m_dma_address_xor));
+				dword |= uint32_t(data >> 8) << (8 * (((bytes + 1) & 3) ^ m_dma_address_xor));
+				bytes += 2;
+			}
+			while (m_dmarq && bytes < m_dma_bytes_left);
 
 			// write to memory
-			m_dma_space->write_byte(m_dma_address++, data & 0xff);
-			m_dma_space->write_byte(m_dma_address++, data >> 8);
+			write_dma_data(m_dma_address, bytes);
+			m_dma_address += bytes;
+			m_dma_bytes_left -= bytes;
 		}
 		else
 		{
@@ -421,9 +436,9 @@ void bus_master_ide_controller_device::execute_dma()
 
 			// write to ata bus
 			write_dma(data);
-		}
 
-		m_dma_bytes_left -= 2;
+			m_dma_bytes_left -= 2;
+		}
 
 		if (m_dma_bytes_left == 0 && m_dma_last_buffer)
 		{
@@ -438,3 +453,18 @@ void bus_master_ide_controller_device::execute_dma()
 
 	write_dmack(CLEAR_LINE);
 }
+
+void bus_master_ide_controller_device::write_dma_data(offs_t address, uint32_t bytes)
+{
+	// whole dwords go to memory as one block when the buffer lines up with the bus
+	uint32_t done = 0;
+	if (!(address & 3))
+	{
+		done = bytes & ~3;
+		if (done)
+			m_dma_space->write_block(address, m_dma_data.get(), done / 4);
+	}
+
+	for ( ; done < bytes; done++)
+		m_dma_space->write_byte(address + done, m_dma_data[done >> 2] >> (8 * ((done & 3) ^ m_dma_address_xor)));
+}
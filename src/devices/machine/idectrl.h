@@ -139,6 +139,7 @@ protected:
 
 private:
 	void execute_dma();
+	void write_dma_data(offs_t address, uint32_t bytes);
 
 	required_address_space m_dma_space;
 	uint8_t m_dma_address_xor;
@@ -152,6 +153,8 @@ private:
 	uint32_t m_bus_master_descriptor;
 	int m_irq;
 	int m_dmarq;
+
+	std::unique_ptr<uint32_t[]> m_dma_data;     // drive to memory data in native bus order
 };
 
 DECLARE_DEVICE_TYPE(BUS_MASTER_IDE_CONTROLLER, bus_master_ide_controller_device)
@@ -76,6 +76,10 @@ laserdisc_device::laserdisc_device(const machine_config &mconfig, device_type ty
 		m_readresult(CHDERR_NONE),
 		m_chdtracks(0),
 		m_work_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO)),
+		m_queued_hunknum(~0U),
+		m_prefetch_samples(0),
+		m_prefetch_hunknum(~0U),
+		m_prefetch_ready(~0U),
 		m_audiosquelch(0),
 		m_videosquelch(0),
 		m_fieldnum(0),
@@ -97,6 +101,8 @@ laserdisc_device::laserdisc_device(const machine_config &mconfig, device_type ty
 		m_overindex(0),
 		m_overtex(nullptr)
 {
+	m_readhistory[0] = m_readhistory[1] = ~0U;
+
 	// initialize overlay_config
 	m_orig_config.m_overposx = m_orig_config.m_overposy = 0.0f;
 	m_orig_config.m_overscalex = m_orig_config.m_overscaley = 1.0f;
@@ -724,6 +730,10 @@ void laserdisc_device::init_video()
 	m_emptyframe.set_palette(m_videopalette);
 	fillbitmap_yuy16(m_emptyframe, 0, 128, 128);
 
+	// allocate a single field for decoding ahead
+	m_prefetch_bitmap.allocate(m_width, m_height);
+	m_prefetch_config.video.wrap(&m_prefetch_bitmap.pix16(0), m_prefetch_bitmap.width(), m_prefetch_bitmap.height(), m_prefetch_bitmap.rowpixels());
+
 	// allocate texture for rendering
 	m_videoenable = true;
 	m_videotex = machine().render().texture_alloc();
@@ -769,6 +779,15 @@ void laserdisc_device::init_audio()
 	m_audiobufsize = m_audiomaxsamples * 4;
 	m_audiobuffer[0].resize(m_audiobufsize);
 	m_audiobuffer[1].resize(m_audiobufsize);
+
+	// allocate buffers for decoding ahead
+	for (int chnum = 0; chnum < 2; chnum++)
+	{
+		m_prefetch_audio[chnum].resize(m_audiomaxsamples);
+		m_prefetch_config.audio[chnum] = m_prefetch_audio[chnum].data();
+	}
+	m_prefetch_config.maxsamples = m_audiomaxsamples;
+	m_prefetch_config.actsamples = &m_prefetch_samples;
 }
 
 
@@ -957,17 +976,59 @@ void laserdisc_device::read_track_data()
 	m_readresult = CHDERR_FILE_NOT_FOUND;
 	if (m_disc != nullptr && !m_videosquelch)
 	{
-		m_readresult = m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &m_avhuff_config);
-		if (m_readresult == CHDERR_NONE)
+		m_prefetch_hunknum = predict_next_hunk(readhunk);
+		if (m_prefetch_ready == readhunk)
 		{
-			m_queued_hunknum = readhunk;
-			m_readresult = CHDERR_OPERATION_PENDING;
-			osd_work_item_queue(m_work_queue, read_async_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+			// the field was decoded ahead of time; just copy it into place
+			for (int y = 0; y < m_prefetch_bitmap.height(); y++)
+				memcpy(&m_avhuff_config.video.pix16(y), &m_prefetch_bitmap.pix16(y), m_prefetch_bitmap.width() * 2);
+			for (int chnum = 0; chnum < 2; chnum++)
+				memcpy(m_avhuff_config.audio[chnum], m_prefetch_audio[chnum].data(), m_prefetch_samples * 2);
+			m_audiocursamples = m_prefetch_samples;
+			m_readresult = CHDERR_NONE;
+			m_queued_hunknum = ~0U;
+		}
+		else
+		{
+			m_readresult = m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &m_avhuff_config);
+			if (m_readresult == CHDERR_NONE)
+			{
+				m_queued_hunknum = readhunk;
+				m_readresult = CHDERR_OPERATION_PENDING;
+			}
 		}
+		m_prefetch_ready = ~0U;
+		if (m_readresult == CHDERR_OPERATION_PENDING || m_prefetch_hunknum != ~0U)
+			osd_work_item_queue(m_work_queue, read_async_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
 	}
 }
 
 
+//-------------------------------------------------
+//  predict_next_hunk - guess which hunk the
+//  following field will read, or ~0 if unknown
+//-------------------------------------------------
+
+uint32_t laserdisc_device::predict_next_hunk(uint32_t readhunk)
+{
+	// assume the stride between fields repeats every two fields; this covers
+	// normal play and scanning in both directions as well as still frames
+	uint32_t const older = m_readhistory[0];
+	uint32_t const previous = m_readhistory[1];
+	m_readhistory[0] = previous;
+	m_readhistory[1] = readhunk;
+	if (older == ~0U || previous == ~0U)
+		return ~0U;
+
+	uint32_t const predicted = previous + (readhunk - older);
+
+	// the next field always has the opposite parity, and must be on the disc
+	if (predicted >= m_chdtracks * 2 || ((predicted ^ readhunk) & 1) == 0)
+		return ~0U;
+	return predicted;
+}
+
+
 //-------------------------------------------------
 //  read_async_static - work item callback for
 //  asynchronous reads
@@ -976,7 +1037,19 @@ void laserdisc_device::read_track_data()
 void *laserdisc_device::read_async_static(void *param, int threadid)
 {
 	laserdisc_device &ld = *reinterpret_cast<laserdisc_device *>(param);
-	ld.m_readresult = ld.m_disc->read_hunk(ld.m_queued_hunknum, nullptr);
+	if (ld.m_queued_hunknum != ~0U)
+		ld.m_readresult = ld.m_disc->read_hunk(ld.m_queued_hunknum, nullptr);
+
+	// decode the predicted next field while the emulation runs this one
+	if (ld.m_prefetch_hunknum != ~0U)
+	{
+		ld.m_prefetch_samples = 0;
+		chd_error err = ld.m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &ld.m_prefetch_config);
+		if (err == CHDERR_NONE)
+			err = ld.m_disc->read_hunk(ld.m_prefetch_hunknum, nullptr);
+		if (err == CHDERR_NONE)
+			ld.m_prefetch_ready = ld.m_prefetch_hunknum;
+	}
 	return nullptr;
 }
 
@@ -988,9 +1061,10 @@ void *laserdisc_device::read_async_static(void *param, int threadid)
 
 void laserdisc_device::process_track_data()
 {
-	// wait for the async operation to complete
-	if (m_readresult == CHDERR_OPERATION_PENDING)
+	// wait for the async operation to complete, including any prefetch
+	if (m_readresult == CHDERR_OPERATION_PENDING || m_prefetch_hunknum != ~0U)
 		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+	m_prefetch_hunknum = ~0U;
 	assert(m_readresult != CHDERR_OPERATION_PENDING);
 
 	// remove the video if we had an error
@@ -258,6 +258,7 @@ private:
 	void vblank_state_changed(screen_device &screen, bool vblank_state);
 	frame_data &current_frame();
 	void read_track_data();
+	uint32_t predict_next_hunk(uint32_t readhunk);
 	static void *read_async_static(void *param, int threadid);
 	void process_track_data();
 	void config_load(config_type cfg_type, util::xml::data_node const *parentnode);
@@ -285,7 +286,16 @@ private:
 
 	// async operations
 	osd_work_queue *    m_work_queue;           // work queue
-	uint32_t              m_queued_hunknum;       // queued hunk
+	uint32_t              m_queued_hunknum;       // queued hunk, or ~0 if only prefetching
+	uint32_t              m_readhistory[2];       // previous two hunks read, oldest first
+
+	// field prefetch
+	avhuff_decompress_config m_prefetch_config; // decompression configuration for prefetch
+	bitmap_yuy16        m_prefetch_bitmap;      // field decoded ahead of time
+	std::vector<int16_t>       m_prefetch_audio[2];    // audio samples decoded ahead of time
+	uint32_t              m_prefetch_samples;     // number of samples in the prefetch buffers
+	uint32_t              m_prefetch_hunknum;     // hunk queued for prefetch, or ~0
+	uint32_t              m_prefetch_ready;       // hunk held in the prefetch buffers, or ~0
 
 	// core states
 	uint8_t               m_audiosquelch;         // audio squelch state: bit 0 = audio 1, bit 1 = audio 2
@@ -25,6 +25,7 @@
 #include "emuopts.h"
 
 #include <cmath>
+#include <fstream>
 #include <memory>
 #include <string>
 #include <utility>
@@ -166,7 +167,7 @@ namespace {
 // analog_callback
 // ----------------------------------------------------------------------------------------
 
-class NETLIB_NAME(analog_callback) : public netlist::device_t
+class NETLIB_NAME(analog_callback) : public netlist::device_t, public netlist_mame_cpu_device::buffered_output_t
 {
 public:
 	NETLIB_NAME(analog_callback)(netlist::netlist_state_t &anetlist, const pstring &name)
@@ -174,15 +175,18 @@ public:
 		, m_in(*this, "IN")
 		, m_cpu_device(nullptr)
 		, m_last(*this, "m_last", 0)
+		, m_buffer_pos(0)
 	{
+		// not a netlist CPU for sound and analog-only netlists
 		auto *nl = dynamic_cast<netlist_mame_device::netlist_mame_t *>(&state());
 		if (nl != nullptr)
-			m_cpu_device = downcast<netlist_mame_cpu_device *>(&nl->parent());
+			m_cpu_device = dynamic_cast<netlist_mame_cpu_device *>(&nl->parent());
 	}
 
 	void reset() override
 	{
 		m_last = 0.0;
+		m_buffer_pos = 0;
 	}
 
 	void register_callback(netlist_mame_analog_output_device::output_delegate &&callback)
@@ -190,6 +194,23 @@ public:
 		m_callback.reset(new netlist_mame_analog_output_device::output_delegate(std::move(callback)));
 	}
 
+	void set_buffer_size(std::size_t entries)
+	{
+		// buffers are flushed at the end of each netlist CPU timeslice
+		if (m_cpu_device == nullptr)
+			throw emu_fatalerror("%s: buffered analog outputs require a netlist CPU device\n", name().c_str());
+		m_buffer.resize(entries);
+		m_buffer_pos = 0;
+		m_cpu_device->register_buffered_output(this);
+	}
+
+	void flush() override
+	{
+		for (std::size_t i = 0; i < m_buffer_pos; i++)
+			(*m_callback)(m_buffer[i].first, m_buffer[i].second);
+		m_buffer_pos = 0;
+	}
+
 	NETLIB_UPDATEI()
 	{
 		nl_fptype cur = m_in();
@@ -199,7 +220,14 @@ public:
 		if (plib::abs(cur - m_last) > 1e-6)
 		{
 			m_cpu_device->update_icount(exec().time());
-			(*m_callback)(cur, m_cpu_device->local_time());
+			if (m_buffer.empty())
+				(*m_callback)(cur, m_cpu_device->local_time());
+			else
+			{
+				m_buffer[m_buffer_pos++] = {cur, m_cpu_device->local_time()};
+				if (m_buffer_pos == m_buffer.size())
+					flush();
+			}
 			m_cpu_device->check_mame_abort_slice();
 			m_last = cur;
 		}
@@ -210,6 +238,8 @@ private:
 	std::unique_ptr<netlist_mame_analog_output_device::output_delegate> m_callback; // TODO: change to std::optional for C++17
 	netlist_mame_cpu_device *m_cpu_device;
 	netlist::state_var<nl_fptype> m_last;
+	std::vector<std::pair<double, attotime>> m_buffer;
+	std::size_t m_buffer_pos;
 };
 
 // ----------------------------------------------------------------------------------------
@@ -761,6 +791,7 @@ netlist_mame_analog_output_device::netlist_mame_analog_output_device(const machi
 	, netlist_mame_sub_interface(*owner)
 	, m_in("")
 	, m_delegate(*this)
+	, m_buffer_size(0)
 {
 }
 
@@ -777,6 +808,8 @@ void netlist_mame_analog_output_device::custom_netlist_additions(netlist::netlis
 	auto dev = nlstate.make_object<NETLIB_NAME(analog_callback)>(nlstate, dfqn);
 	//static_cast<NETLIB_NAME(analog_callback) *>(dev.get())->register_callback(std::move(m_delegate));
 	dev->register_callback(std::move(m_delegate));
+	if (m_buffer_size > 0 && owner()->has_running_machine())
+		dev->set_buffer_size(m_buffer_size);
 	nlstate.register_device(dfqn, std::move(dev));
 	nlstate.setup().register_link(dname + ".IN", pin);
 }
@@ -1077,6 +1110,9 @@ void netlist_mame_device::common_dev_start(netlist::netlist_state_t *lnetlist) c
 		else
 			lnetlist->exec().enable_stats(v);
 	}
+	// Writing statistics to a file implies statistics
+	if (plib::util::environment("NL_STATS_FILE", "") != "")
+		lnetlist->exec().enable_stats(true);
 
 	// register additional devices
 
@@ -1206,6 +1242,20 @@ void netlist_mame_device::device_stop()
 {
 	LOGDEVCALLS("device_stop\n");
 	netlist().exec().stop();
+
+	// Write statistics in collapsed stack format, e.g. for flame graphs
+	pstring fname = plib::util::environment("NL_STATS_FILE", "");
+	if (fname != "")
+	{
+		std::ofstream strm(plib::filesystem::u8path(fname + plib::replace_all(pstring(tag()), pstring(":"), pstring("_")) + ".txt"));
+		if (strm.fail())
+			netlist().log().warning("NL_STATS_FILE: unable to open {1}", fname);
+		else
+		{
+			strm.imbue(std::locale::classic());
+			netlist().exec().write_stats_collapsed(strm);
+		}
+	}
 }
 
 void netlist_mame_device::device_post_load()
@@ -1356,6 +1406,13 @@ void netlist_mame_cpu_device::execute_run()
 		netlist().exec().process_queue(nltime_ext_from_clocks(m_icount));
 		update_icount(netlist().exec().time());
 	}
+	flush_buffered_outputs();
+}
+
+void netlist_mame_cpu_device::flush_buffered_outputs()
+{
+	for (auto *o : m_buffered_outputs)
+		o->flush();
 }
 
 std::unique_ptr<util::disasm_interface> netlist_mame_cpu_device::create_disassembler()
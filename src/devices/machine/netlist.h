@@ -176,6 +176,16 @@ public:
 		return *this;
 	}
 
+	// buffered outputs are flushed at the end of each time slice
+	class buffered_output_t
+	{
+	public:
+		virtual ~buffered_output_t() = default;
+		virtual void flush() = 0;
+	};
+
+	void register_buffered_output(buffered_output_t *output) { m_buffered_outputs.push_back(output); }
+
 protected:
 	// netlist_mame_device
 	virtual void nl_register_devices(netlist::setup_t &lsetup) const override;
@@ -201,7 +211,10 @@ protected:
 	address_space_config m_program_config;
 
 private:
+	void flush_buffered_outputs();
+
 	offs_t m_genPC;
+	std::vector<buffered_output_t *> m_buffered_outputs;
 };
 
 // ----------------------------------------------------------------------------------------
@@ -354,6 +367,20 @@ public:
 		m_delegate.set(std::forward<T>(args)...);
 	}
 
+	/// \brief Buffer output changes
+	///
+	/// Changes are stored with their time and the delegate is called for
+	/// all of them at the end of the netlist time slice or once entries
+	/// changes are buffered. This reduces call overhead for outputs
+	/// changing very often, e.g. video. The delegate is called late, it
+	/// must only use the time passed. 0 (default) calls the delegate on
+	/// each change. Only available for netlist cpu devices.
+	///
+	netlist_mame_analog_output_device &set_buffer_size(uint32_t entries)
+	{
+		m_buffer_size = entries;
+		return *this;
+	}
 
 protected:
 	// device-level overrides
@@ -363,6 +390,7 @@ protected:
 private:
 	const char *m_in;
 	output_delegate m_delegate;
+	uint32_t m_buffer_size;
 };
 
 // ----------------------------------------------------------------------------------------
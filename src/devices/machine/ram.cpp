@@ -162,12 +162,13 @@ void ram_device::device_start()
 		m_size = defsize;
 
 	// allocate space for the ram
-	m_pointer = std::make_unique<u8 []>(m_size);
-	std::fill_n(m_pointer.get(), m_size, m_default_value);
+	m_pointer.allocate(m_size, size_t(machine().options().large_pages()) << 20);
+	if (m_default_value)
+		std::fill_n(m_pointer.data(), m_size, m_default_value);
 
 	// register for state saving
 	save_item(NAME(m_size));
-	save_pointer(NAME(m_pointer), m_size);
+	save_pointer(m_pointer.data(), "m_pointer", m_size);
 }
 
 
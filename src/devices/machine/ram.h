@@ -41,7 +41,7 @@ public:
 	// accessors
 	u32 size() const { return m_size; }
 	u32 mask() const { return m_size - 1; }
-	u8 *pointer() { return &m_pointer[0]; }
+	u8 *pointer() { return m_pointer.data(); }
 	char const *default_size_string() const { return m_default_size; };
 	u32 default_size() const;
 	extra_option_vector const &extra_options() const;
@@ -69,7 +69,7 @@ private:
 
 	// device state
 	u32                         m_size;
-	std::unique_ptr<u8 []>      m_pointer;
+	large_buffer                m_pointer;
 
 	// device config
 	char const *                m_default_size;
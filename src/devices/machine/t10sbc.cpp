@@ -276,6 +276,19 @@ void t10sbc::ReadData( uint8_t *data, int dataLength )
 		if ((m_disk) && (m_blocks))
 		{
 			m_device->logerror("T10SBC: Reading %d bytes from HD\n", dataLength);
+			// fetch every whole sector of the transfer in one go
+			uint32_t count = (dataLength > 0) ? std::min<uint32_t>(dataLength / m_sector_bytes, m_blocks) : 0;
+			if (count > 0)
+			{
+				if (!hard_disk_read(m_disk, m_lba, data, count))
+				{
+					m_device->logerror("T10SBC: HD read error!\n");
+				}
+				m_lba += count;
+				m_blocks -= count;
+				dataLength -= count * m_sector_bytes;
+				data += count * m_sector_bytes;
+			}
 			while (dataLength > 0)
 			{
 				if (!hard_disk_read(m_disk, m_lba,  data))
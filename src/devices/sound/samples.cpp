@@ -343,7 +343,7 @@ void samples_device::sound_stream_update(sound_stream &stream, stream_sample_t *
 				{
 					// do a linear interp on the sample
 					int32_t sample1 = sample[pos];
-					int32_t sample2 = sample[(pos + 1) % sample_length];
+					int32_t sample2 = sample[(pos + 1 < sample_length) ? (pos + 1) : 0];
 					int32_t fracmult = frac >> (FRAC_BITS - 14);
 					*buffer++ = ((0x4000 - fracmult) * sample1 + fracmult * sample2) >> 14;
 
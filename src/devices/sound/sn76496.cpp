@@ -239,6 +239,7 @@ void sn76496_base_device::device_start()
 	m_ready_handler.resolve_safe();
 
 	m_sound = machine().sound().stream_alloc(*this, 0, (m_stereo? 2:1), sample_rate);
+	m_sound->set_write_callback(stream_write_delegate(&sn76496_base_device::register_w, this));
 
 	for (i = 0; i < 4; i++) m_volume[i] = 0;
 
@@ -298,8 +299,7 @@ void sn76496_base_device::device_clock_changed()
 
 void sn76496_base_device::stereo_w(u8 data)
 {
-	m_sound->update();
-	if (m_stereo) m_stereo_mask = data;
+	if (m_stereo) m_sound->queue_write(1, data);
 	else fatalerror("sn76496_base_device: Call to stereo write with mono chip!\n");
 }
 
@@ -309,11 +309,23 @@ void sn76496_base_device::device_timer(emu_timer &timer, device_timer_id id, int
 }
 
 void sn76496_base_device::write(u8 data)
+{
+	// the registers change when the stream reaches this point in time
+	m_sound->queue_write(0, data);
+
+	m_ready_handler(CLEAR_LINE);
+	m_ready_timer->adjust(attotime::from_hz(clock()/(4*m_clock_divider)));
+}
+
+void sn76496_base_device::register_w(offs_t offset, u32 data)
 {
 	int n, r, c;
 
-	// update the output buffer before changing the registers
-	m_sound->update();
+	if (offset == 1)
+	{
+		m_stereo_mask = data;
+		return;
+	}
 
 	if (data & 0x80)
 	{
@@ -362,9 +374,6 @@ void sn76496_base_device::write(u8 data)
 			}
 			break;
 	}
-
-	m_ready_handler(CLEAR_LINE);
-	m_ready_timer->adjust(attotime::from_hz(clock()/(4*m_clock_divider)));
 }
 
 inline bool sn76496_base_device::in_noise_mode()
@@ -924,6 +924,7 @@ void ym2151_device::device_start()
 	m_portwritehandler.resolve_safe();
 
 	m_stream = stream_alloc(0, 2, clock() / 64);
+	m_stream->set_parallel_safe();
 
 	timer_A_irq_off = timer_alloc(TIMER_IRQ_A_OFF);
 	timer_B_irq_off = timer_alloc(TIMER_IRQ_B_OFF);
@@ -1071,6 +1072,20 @@ int ym2151_device::op_calc1(YM2151Operator * OP, unsigned int env, signed int pm
 
 #define volume_calc(OP) ((OP)->tl + ((uint32_t)(OP)->volume) + (AM & (OP)->AMmask))
 
+/* true if chan_calc() would produce nothing and leave no state behind:
+   all four operators finished their release and nothing is fed back or delayed */
+bool ym2151_device::chan_silent(unsigned int chan) const
+{
+	const YM2151Operator *op = &oper[chan*4];
+
+	if (op->fb_out_prev || op->fb_out_curr || op->mem_value)
+		return false;
+	for (int i = 0; i < 4; i++)
+		if (op[i].state != EG_OFF)
+			return false;
+	return true;
+}
+
 void ym2151_device::chan_calc(unsigned int chan)
 {
 	YM2151Operator *op;
@@ -1816,7 +1831,8 @@ void ym2151_device::sound_stream_update(sound_stream &stream, stream_sample_t **
 			chanout[ch] = 0;
 
 		for(int ch=0; ch<7; ch++)
-			chan_calc(ch);
+			if (!chan_silent(ch))
+				chan_calc(ch);
 		chan7_calc();
 
 		int outl = 0;
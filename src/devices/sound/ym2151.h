@@ -256,6 +256,7 @@ private:
 	void advance();
 	void advance_eg();
 	void write_reg(int r, int v);
+	bool chan_silent(unsigned int chan) const;
 	void chan_calc(unsigned int chan);
 	void chan7_calc();
 	int op_calc(YM2151Operator * OP, unsigned int env, signed int pm);
@@ -8,6 +8,14 @@
 
 #define DEBUG_VRAM_VIEWER 0 // VRAM viewer for debug
 
+// process four pixels at a time where SSE2 is available, same conditions as rgbutil.h
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define EPIC12_SIMD 1
+#include <emmintrin.h>
+#else
+#define EPIC12_SIMD 0
+#endif
+
 class epic12_device : public device_t, public device_video_interface
 {
 public:
@@ -799,6 +807,69 @@ protected:
 		clr->b  =   b>>2;
 	};
 
+#if EPIC12_SIMD
+	// four pixels with each channel widened to 16 bits, b g r t order in each half
+	struct clr4_t
+	{
+		__m128i lo, hi;
+	};
+
+	static inline clr4_t pen4_to_clr(__m128i pen)
+	{
+		const __m128i clr = _mm_and_si128(_mm_srli_epi32(pen, 3), _mm_set1_epi32(0x001f1f1f));
+		return clr4_t{ _mm_unpacklo_epi8(clr, _mm_setzero_si128()), _mm_unpackhi_epi8(clr, _mm_setzero_si128()) };
+	}
+
+	static inline __m128i clr4_to_pen(const clr4_t &clr)
+	{
+		return _mm_and_si128(_mm_slli_epi32(_mm_packus_epi16(clr.lo, clr.hi), 3), _mm_set1_epi32(0x00f8f8f8));
+	}
+
+	static inline clr4_t clr4_fill(u8 val)
+	{
+		return clr4_t{ _mm_set1_epi16(val), _mm_set1_epi16(val) };
+	}
+
+	static inline clr4_t clr4_from_clr(const clr_t &clr)
+	{
+		const __m128i val = _mm_set_epi16(0, clr.r, clr.g, clr.b, 0, clr.r, clr.g, clr.b);
+		return clr4_t{ val, val };
+	}
+
+	// same as colrtable: min(x * y / 0x1f, 0x1f), the division is exact for x < 0x20 and y < 0x40
+	static inline __m128i clr4_mul_half(__m128i x, __m128i y)
+	{
+		return _mm_min_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(x, y), _mm_set1_epi16(2115)), _mm_set1_epi16(0x1f));
+	}
+
+	static inline clr4_t clr4_mul(const clr4_t &x, const clr4_t &y)
+	{
+		return clr4_t{ clr4_mul_half(x.lo, y.lo), clr4_mul_half(x.hi, y.hi) };
+	}
+
+	// same as colrtable_rev
+	static inline clr4_t clr4_mul_rev(const clr4_t &x, const clr4_t &y)
+	{
+		const __m128i rev = _mm_set1_epi16(0x1f);
+		return clr4_t{ clr4_mul_half(_mm_xor_si128(x.lo, rev), y.lo), clr4_mul_half(_mm_xor_si128(x.hi, rev), y.hi) };
+	}
+
+	// same as colrtable_add
+	static inline clr4_t clr4_add(const clr4_t &x, const clr4_t &y)
+	{
+		const __m128i max = _mm_set1_epi16(0x1f);
+		return clr4_t{ _mm_min_epi16(_mm_add_epi16(x.lo, y.lo), max), _mm_min_epi16(_mm_add_epi16(x.hi, y.hi), max) };
+	}
+
+	// red in every channel, as clr_t::add_with_clr_square uses it
+	static inline clr4_t clr4_red(const clr4_t &x)
+	{
+		return clr4_t{
+				_mm_shufflehi_epi16(_mm_shufflelo_epi16(x.lo, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 2, 2, 2)),
+				_mm_shufflehi_epi16(_mm_shufflelo_epi16(x.hi, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 2, 2, 2)) };
+	}
+#endif
+
 	// (1|s|d) * s_factor * s + (1|s|d) * d_factor * d
 	// 0: +alpha
 	// 1: +source
@@ -112,6 +112,10 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 #endif
 #endif
 
+#if EPIC12_SIMD && REALLY_SIMPLE == 0 && TINT == 1
+	const clr4_t tint_clr4 = clr4_from_clr(*tint_clr);
+#endif
+
 	for (int y = starty; y < dimy; y++)
 	{
 		bmp = &bitmap->pix(dst_y_start + y, dst_x_start+startx);
@@ -124,30 +128,14 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 			gfx2 += (src_x + startx);
 		#endif
 
-#if 1
 		const u32* end = bmp + (dimx - startx);
-#else
-		// maybe we can do some SSE type optimizations on larger blocks? right now this just results in more code and slower compiling tho.
-
-		const int width = dimx-startx;
-		const u32* end = bmp+(width);
 
-		if (width<0) return;
-
-		int bigblocks = width>>3;
-
-		while (bigblocks)
+#if EPIC12_SIMD
+		// four pixels at a time, the loop below finishes off the row
+		const u32* end4 = bmp + ((dimx - startx) & ~3);
+		while (bmp < end4)
 		{
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-			#include "epic12pixel.hxx"
-
-			bigblocks--;
+			#include "epic12pixel4.hxx"
 		}
 #endif
 		while (bmp < end)
@@ -0,0 +1,130 @@
+// license:BSD-3-Clause
+// copyright-holders:David Haywood
+/* Four pixel version of the inner-most loop, see epic12pixel.hxx for what each mode is doing */
+
+		{
+#if FLIPX == 1
+			const __m128i pen4 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(gfx2 - 3)), _MM_SHUFFLE(0, 1, 2, 3));
+#else
+			const __m128i pen4 = _mm_loadu_si128((const __m128i *)gfx2);
+#endif
+
+#if TRANSPARENT == 1
+			const __m128i trans4 = _mm_set1_epi32(0x20000000);
+			const __m128i opaque4 = _mm_cmpeq_epi32(_mm_and_si128(pen4, trans4), trans4);
+
+			// bullet sprites are mostly empty, so skip groups without a single opaque pixel
+			if (_mm_movemask_epi8(opaque4))
+			{
+#endif
+
+#if REALLY_SIMPLE == 1
+				__m128i out4 = pen4;
+#if TRANSPARENT == 1
+				const __m128i dst4 = _mm_loadu_si128((const __m128i *)bmp);
+#endif
+
+#else // NOT REALLY_SIMPLE
+
+				clr4_t s_clr4 = pen4_to_clr(pen4);
+
+#if TINT == 1
+				s_clr4 = clr4_mul(s_clr4, tint_clr4);
+#endif
+
+#if BLENDED == 1 || TRANSPARENT == 1
+				const __m128i dst4 = _mm_loadu_si128((const __m128i *)bmp);
+#endif
+
+#if BLENDED == 1
+				const clr4_t d_clr4 = pen4_to_clr(dst4);
+
+#if _SMODE == 0
+#if _DMODE == 0
+				s_clr4 = clr4_add(clr4_mul(clr4_fill(s_alpha), s_clr4), clr4_mul(clr4_fill(d_alpha), d_clr4));
+#elif _DMODE == 1
+				s_clr4 = clr4_add(clr4_mul(clr4_fill(s_alpha), s_clr4), clr4_mul(s_clr4, d_clr4));
+#elif _DMODE == 2
+				s_clr4 = clr4_add(clr4_red(clr4_mul(clr4_fill(s_alpha), s_clr4)), clr4_mul(d_clr4, d_clr4));
+#elif _DMODE == 3 || _DMODE == 7
+				s_clr4 = clr4_add(clr4_mul(clr4_fill(s_alpha), s_clr4), d_clr4);
+#elif _DMODE == 4
+				s_clr4 = clr4_add(clr4_mul(clr4_fill(s_alpha), s_clr4), clr4_mul_rev(clr4_fill(d_alpha), d_clr4));
+#elif _DMODE == 5
+				s_clr4 = clr4_add(clr4_mul(clr4_fill(s_alpha), s_clr4), clr4_mul_rev(s_clr4, d_clr4));
+#elif _DMODE == 6
+				s_clr4 = clr4_add(clr4_mul(clr4_fill(s_alpha), s_clr4), clr4_mul_rev(d_clr4, d_clr4));
+#endif
+
+#elif _SMODE == 2
+#if _DMODE == 0
+				s_clr4 = clr4_add(clr4_mul(d_clr4, s_clr4), clr4_mul(clr4_fill(d_alpha), d_clr4));
+#elif _DMODE == 1
+				s_clr4 = clr4_add(clr4_mul(d_clr4, s_clr4), clr4_mul(s_clr4, d_clr4));
+#elif _DMODE == 2
+				s_clr4 = clr4_add(clr4_red(clr4_mul(d_clr4, s_clr4)), clr4_mul(d_clr4, d_clr4));
+#elif _DMODE == 3 || _DMODE == 7
+				s_clr4 = clr4_add(clr4_mul(d_clr4, s_clr4), d_clr4);
+#elif _DMODE == 4
+				s_clr4 = clr4_add(clr4_mul(d_clr4, s_clr4), clr4_mul_rev(clr4_fill(d_alpha), d_clr4));
+#elif _DMODE == 5
+				s_clr4 = clr4_add(clr4_mul(d_clr4, s_clr4), clr4_mul_rev(s_clr4, d_clr4));
+#elif _DMODE == 6
+				s_clr4 = clr4_add(clr4_mul(d_clr4, s_clr4), clr4_mul_rev(d_clr4, d_clr4));
+#endif
+
+#else // _SMODE != 0 && _SMODE != 2
+
+#if _SMODE == 1
+				const clr4_t clr04 = clr4_mul(s_clr4, s_clr4);
+#elif _SMODE == 3 || _SMODE == 7
+				const clr4_t clr04 = s_clr4;
+#elif _SMODE == 4
+				const clr4_t clr04 = clr4_mul_rev(clr4_fill(s_alpha), s_clr4);
+#elif _SMODE == 5
+				const clr4_t clr04 = clr4_mul_rev(s_clr4, s_clr4);
+#elif _SMODE == 6
+				const clr4_t clr04 = clr4_mul_rev(d_clr4, s_clr4);
+#endif
+
+#if _DMODE == 0
+				s_clr4 = clr4_add(clr04, clr4_mul(d_clr4, clr4_fill(d_alpha)));
+#elif _DMODE == 1
+				s_clr4 = clr4_add(clr04, clr4_mul(s_clr4, d_clr4));
+#elif _DMODE == 2
+				s_clr4 = clr4_add(clr4_red(clr04), clr4_mul(d_clr4, d_clr4));
+#elif _DMODE == 3 || _DMODE == 7
+				s_clr4 = clr4_add(clr04, d_clr4);
+#elif _DMODE == 4
+				s_clr4 = clr4_add(clr04, clr4_mul_rev(clr4_fill(d_alpha), d_clr4));
+#elif _DMODE == 5
+				s_clr4 = clr4_add(clr04, clr4_mul_rev(s_clr4, d_clr4));
+#elif _DMODE == 6
+				s_clr4 = clr4_add(clr04, clr4_mul_rev(d_clr4, d_clr4));
+#endif
+
+#endif // _SMODE
+
+#endif // BLENDED
+
+				__m128i out4 = _mm_or_si128(clr4_to_pen(s_clr4), _mm_and_si128(pen4, _mm_set1_epi32(0x20000000)));
+
+#endif // END NOT REALLY SIMPLE
+
+#if TRANSPARENT == 1
+				// keep the destination where the source is transparent
+				out4 = _mm_or_si128(_mm_and_si128(opaque4, out4), _mm_andnot_si128(opaque4, dst4));
+#endif
+				_mm_storeu_si128((__m128i *)bmp, out4);
+
+#if TRANSPARENT == 1
+			}
+#endif
+
+			bmp += 4;
+#if FLIPX == 1
+			gfx2 -= 4;
+#else
+			gfx2 += 4;
+#endif
+		}
@@ -67,7 +67,13 @@ void fixedfreq_monitor_state::update_sync_channel(const time_type &time, const d
 	const int last_vsync = m_sig_vsync;
 	const int last_comp = m_sig_composite;
 
-	m_vsync_filter += ((double) last_comp - m_vsync_filter) * (1.0 - exp(-delta_time * m_desc.vsync_filter_timeconst()));
+	// Skip the exp once the filter has fully settled. Sync changes
+	// between long stable periods are the common case.
+	const double filter_arg = delta_time * m_desc.vsync_filter_timeconst();
+	if (filter_arg > 40.0)
+		m_vsync_filter = (double) last_comp;
+	else
+		m_vsync_filter += ((double) last_comp - m_vsync_filter) * (1.0 - exp(-filter_arg));
 	m_sig_composite = (newval < m_desc.m_sync_threshold) ? 1 : 0 ;
 
 	m_sig_vsync = (m_vsync_filter > m_desc.m_vsync_threshold) ? 1 : 0;
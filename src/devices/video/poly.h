@@ -389,14 +389,10 @@ void *poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::work_item_cal
 			if (prevunit.count_next != 0)
 			{
 				uint32_t unitnum = polygon.m_owner->m_unit.indexof(unit);
-				uint32_t new_count_next;
 
-				// attempt to atomically swap in this new value
-				do
-				{
-					orig_count_next = prevunit.count_next;
-					new_count_next = orig_count_next | (unitnum << 16);
-				} while (!prevunit.count_next.compare_exchange_weak(orig_count_next, new_count_next, std::memory_order_release, std::memory_order_relaxed));
+				// atomically chain ourselves onto the previous unit; a single
+				// read-modify-write can't fail and retry under contention
+				orig_count_next = prevunit.count_next.fetch_or(unitnum << 16, std::memory_order_acq_rel);
 
 #if KEEP_POLY_STATISTICS
 				// track resolved conflicts
@@ -414,11 +410,8 @@ void *poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::work_item_cal
 		for (int curscan = 0; curscan < count; curscan++)
 			polygon.m_callback(unit.scanline + curscan, unit.extent[curscan], *polygon.m_object, threadid);
 
-		// set our count to 0 and re-fetch the original count value
-		do
-		{
-			orig_count_next = unit.count_next;
-		} while (!unit.count_next.compare_exchange_weak(orig_count_next, 0, std::memory_order_release, std::memory_order_relaxed));
+		// set our count to 0 and fetch the original count value
+		orig_count_next = unit.count_next.exchange(0, std::memory_order_acq_rel);
 
 		// if we have no more work to do, do nothing
 		orig_count_next >>= 16;
@@ -233,6 +233,18 @@ void snes_ppu_device::device_start()
 		}
 	}
 
+	m_rgb_table = std::make_unique<rgb_t[]>(32768);
+	for (int c = 0; c < 32768; c++)
+		m_rgb_table[c] = rgb_t(pal5bit(c & 0x1f), pal5bit((c >> 5) & 0x1f), pal5bit((c >> 10) & 0x1f));
+
+	m_tile_cache = std::make_unique<uint64_t[]>(3 * 32768);
+	m_tile_cache_valid = std::make_unique<uint8_t[]>(32768);
+	invalidate_tile_cache();
+
+	for (auto &layer : m_window_cache)
+		for (auto &cache : layer)
+			cache.key = ~uint64_t(0);
+
 	for (int i = 0; i < ARRAY_LENGTH(m_scanlines); i++)
 	{
 		save_item(NAME(m_scanlines[i].enable), i);
@@ -354,6 +366,11 @@ void snes_ppu_device::device_start()
 	save_pointer(NAME(m_cgram), SNES_CGRAM_SIZE/2);
 }
 
+void snes_ppu_device::device_post_load()
+{
+	invalidate_tile_cache();
+}
+
 void snes_ppu_device::device_reset()
 {
 #if SNES_LAYER_DEBUG
@@ -390,6 +407,7 @@ void snes_ppu_device::device_reset()
 
 	/* Init VRAM */
 	memset(m_vram.get(), 0, SNES_VRAM_SIZE);
+	invalidate_tile_cache();
 
 	/* Init Palette RAM */
 	memset((uint8_t *)m_cgram.get(), 0, SNES_CGRAM_SIZE);
@@ -457,13 +475,29 @@ void snes_ppu_device::device_reset()
  * XNOR: ###...##...###     ...###..###...
  *****************************************/
 
-void snes_ppu_device::render_window(uint16_t layer_idx, uint8_t enable, uint8_t *output)
+inline uint64_t snes_ppu_device::window_key(const layer_t &self) const
+{
+	return uint64_t(1) << 40 |
+			uint64_t(m_window2_right) << 32 | uint64_t(m_window2_left) << 24 | uint64_t(m_window1_right) << 16 | uint64_t(m_window1_left) << 8 |
+			(self.wlog_mask & 3) << 4 | (self.window2_invert & 1) << 3 | (self.window1_invert & 1) << 2 | (self.window2_enabled & 1) << 1 | (self.window1_enabled & 1);
+}
+
+const uint8_t *snes_ppu_device::render_window(uint16_t layer_idx, uint8_t enable, int screen)
 {
 	layer_t &self = m_layer[layer_idx];
-	if (!enable || (!self.window1_enabled && !self.window2_enabled))
+	window_cache_t &cache = m_window_cache[layer_idx][screen];
+	uint8_t *const output = cache.mask;
+
+	// windows rarely move mid-frame, so reuse the last mask when nothing it depends on has changed
+	const uint64_t key = (enable && (self.window1_enabled || self.window2_enabled)) ? window_key(self) : 0;
+	if (key == cache.key)
+		return output;
+	cache.key = key;
+
+	if (!key)
 	{
 		memset(output, 0, 256);
-		return;
+		return output;
 	}
 
 	if (self.window1_enabled && !self.window2_enabled)
@@ -474,7 +508,7 @@ void snes_ppu_device::render_window(uint16_t layer_idx, uint8_t enable, uint8_t
 		{
 			output[x] = (x >= m_window1_left && x <= m_window1_right) ? set : clear;
 		}
-		return;
+		return output;
 	}
 
 	if (self.window2_enabled && !self.window1_enabled)
@@ -485,7 +519,7 @@ void snes_ppu_device::render_window(uint16_t layer_idx, uint8_t enable, uint8_t
 		{
 			output[x] = (x >= m_window2_left && x <= m_window2_right) ? set : clear;
 		}
-		return;
+		return output;
 	}
 
 	for (uint16_t x = 0; x < 256; x++)
@@ -500,6 +534,7 @@ void snes_ppu_device::render_window(uint16_t layer_idx, uint8_t enable, uint8_t
 			case 3: output[x] = 1 - (one_mask ^ two_mask); break;
 		}
 	}
+	return output;
 }
 
 /*************************************************************************************************
@@ -572,6 +607,64 @@ inline void snes_ppu_device::plot_below( uint16_t x, uint8_t source, uint8_t pri
 	}
 }
 
+/*********************************************
+ * get_tile_row()
+ *
+ * Fetch one row of a BG tile as eight color
+ * indices, leftmost pixel in the low byte.
+ * Rows are decoded from the bit planes once
+ * and kept until VRAM under them is written.
+ *********************************************/
+
+inline uint64_t snes_ppu_device::get_tile_row( uint8_t depth, uint16_t address )
+{
+	const uint32_t row = address >> 1;
+	uint64_t &entry = m_tile_cache[depth << 15 | row];
+	if (BIT(m_tile_cache_valid[row], depth))
+		return entry;
+
+	uint64_t data;
+	data  = (uint64_t)m_vram[(address +  0) & 0xffff] <<  0;
+	data |= (uint64_t)m_vram[(address +  1) & 0xffff] <<  8;
+	data |= (uint64_t)m_vram[(address + 16) & 0xffff] << 16;
+	data |= (uint64_t)m_vram[(address + 17) & 0xffff] << 24;
+	data |= (uint64_t)m_vram[(address + 32) & 0xffff] << 32;
+	data |= (uint64_t)m_vram[(address + 33) & 0xffff] << 40;
+	data |= (uint64_t)m_vram[(address + 48) & 0xffff] << 48;
+	data |= (uint64_t)m_vram[(address + 49) & 0xffff] << 56;
+
+	uint64_t result = 0;
+	for (uint32_t x = 0; x < 8; x++)
+	{
+		uint32_t color, shift = 7 - x;
+		{
+			color  = data >> (shift +  0) & 0x01;
+			color |= data >> (shift +  7) & 0x02;
+		}
+		if (depth >= SNES_COLOR_DEPTH_4BPP)
+		{
+			color |= data >> (shift + 14) & 0x04;
+			color |= data >> (shift + 21) & 0x08;
+		}
+		if (depth >= SNES_COLOR_DEPTH_8BPP)
+		{
+			color |= data >> (shift + 28) & 0x10;
+			color |= data >> (shift + 35) & 0x20;
+			color |= data >> (shift + 42) & 0x40;
+			color |= data >> (shift + 49) & 0x80;
+		}
+		result |= (uint64_t)color << (x << 3);
+	}
+
+	m_tile_cache_valid[row] |= 1 << depth;
+	return entry = result;
+}
+
+void snes_ppu_device::invalidate_tile_cache()
+{
+	memset(m_tile_cache_valid.get(), 0, 32768);
+}
+
 /*********************************************
  * update_line()
  *
@@ -597,10 +690,8 @@ void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t
 		return;
 	}
 
-	uint8_t window_above[256];
-	uint8_t window_below[256];
-	render_window(layer_idx, layer.main_window_enabled, window_above);
-	render_window(layer_idx, layer.sub_window_enabled, window_below);
+	const uint8_t *const window_above = render_window(layer_idx, layer.main_window_enabled, SNES_MAINSCREEN);
+	const uint8_t *const window_below = render_window(layer_idx, layer.sub_window_enabled, SNES_SUBSCREEN);
 
 	bool hires = m_mode == 5 || m_mode == 6;
 	bool opt_mode = m_mode == 2 || m_mode == 4 || m_mode == 6;
@@ -690,39 +781,14 @@ void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t
 		tile_number = ((tile_number & 0x03ff) + tiledata_index) & tile_mask;
 
 		uint16_t address = (((tile_number << color_shift) + ((voffset & 7) ^ mirrory)) & 0x7fff) << 1;
-
-		uint64_t data;
-		data  = (uint64_t)m_vram[address +   0] <<  0;
-		data |= (uint64_t)m_vram[address +   1] <<  8;
-		data |= (uint64_t)m_vram[address +  16] << 16;
-		data |= (uint64_t)m_vram[address +  17] << 24;
-		data |= (uint64_t)m_vram[address +  32] << 32;
-		data |= (uint64_t)m_vram[address +  33] << 40;
-		data |= (uint64_t)m_vram[address +  48] << 48;
-		data |= (uint64_t)m_vram[address +  49] << 56;
+		uint64_t row = get_tile_row(layer.tile_mode, address);
 
 		for (uint32_t tilex = 0; tilex < 8; tilex++, x++)
 		{
 			if (x & width) continue;
 			if (!layer.mosaic_enabled || --mosaic_counter == 0)
 			{
-				uint32_t color, shift = mirrorx ? tilex : 7 - tilex;
-				{
-					color  = data >> (shift +  0) & 0x01;
-					color |= data >> (shift +  7) & 0x02;
-				}
-				if (layer.tile_mode >= SNES_COLOR_DEPTH_4BPP)
-				{
-					color |= data >> (shift + 14) & 0x04;
-					color |= data >> (shift + 21) & 0x08;
-				}
-				if (layer.tile_mode >= SNES_COLOR_DEPTH_8BPP)
-				{
-					color |= data >> (shift + 28) & 0x10;
-					color |= data >> (shift + 35) & 0x20;
-					color |= data >> (shift + 42) & 0x40;
-					color |= data >> (shift + 49) & 0x80;
-				}
+				uint32_t color = row >> ((mirrorx ? 7 - tilex : tilex) << 3) & 0xff;
 
 				mosaic_counter = 1 + m_mosaic_size;
 				mosaic_palette = color;
@@ -791,10 +857,8 @@ void snes_ppu_device::update_line_mode7( uint16_t curline, uint8_t layer_idx )
 	int origin_x = (a * MODE7_CLIP(hoffset - hcenter) & ~63) + (b * MODE7_CLIP(voffset - vcenter) & ~63) + (b * y & ~63) + (hcenter << 8);
 	int origin_y = (c * MODE7_CLIP(hoffset - hcenter) & ~63) + (d * MODE7_CLIP(voffset - vcenter) & ~63) + (d * y & ~63) + (vcenter << 8);
 
-	uint8_t window_above[256];
-	uint8_t window_below[256];
-	render_window(layer_idx, self.main_window_enabled, window_above);
-	render_window(layer_idx, self.sub_window_enabled,  window_below);
+	const uint8_t *const window_above = render_window(layer_idx, self.main_window_enabled, SNES_MAINSCREEN);
+	const uint8_t *const window_below = render_window(layer_idx, self.sub_window_enabled,  SNES_SUBSCREEN);
 
 	for (int _x = 0; _x < 256; _x++)
 	{
@@ -857,10 +921,8 @@ void snes_ppu_device::update_objects( uint16_t curline )
 	if (!m_layer[SNES_OAM].main_bg_enabled && !m_layer[SNES_OAM].sub_bg_enabled)
 		return;
 
-	uint8_t window_above[256];
-	uint8_t window_below[256];
-	render_window(SNES_OAM, m_layer[SNES_OAM].main_window_enabled, window_above);
-	render_window(SNES_OAM, m_layer[SNES_OAM].sub_window_enabled, window_below);
+	const uint8_t *const window_above = render_window(SNES_OAM, m_layer[SNES_OAM].main_window_enabled, SNES_MAINSCREEN);
+	const uint8_t *const window_below = render_window(SNES_OAM, m_layer[SNES_OAM].sub_window_enabled, SNES_SUBSCREEN);
 
 	uint32_t item_count = 0;
 	uint32_t tile_count = 0;
@@ -1162,22 +1224,30 @@ void snes_ppu_device::draw_screens( uint16_t curline )
  * XNOR: ###...##...###     ...###..###...
  *********************************************/
 
-void snes_ppu_device::update_color_windowmasks( uint8_t mask, uint8_t *output )
+const uint8_t *snes_ppu_device::update_color_windowmasks( uint8_t mask, int screen )
 {
 	layer_t &self = m_layer[SNES_COLOR];
+	window_cache_t &cache = m_window_cache[SNES_COLOR][screen];
+	uint8_t *const output = cache.mask;
+
+	const uint64_t key = uint64_t(mask & 3) << 41 | ((mask == 1 || mask == 2) ? window_key(self) : 0);
+	if (key == cache.key)
+		return output;
+	cache.key = key;
+
 	uint8_t set = 0, clear = 0;
 	switch (mask)
 	{
-		case 0: memset(output, 1, 256); return; // always
+		case 0: memset(output, 1, 256); return output; // always
 		case 1: set = 1; clear = 0; break;
 		case 2: set = 0; clear = 1; break;
-		case 3: memset(output, 0, 256); return; // never
+		case 3: memset(output, 0, 256); return output; // never
 	}
 
 	if (!self.window1_enabled && !self.window2_enabled)
 	{
 		memset(output, clear, 256);
-		return;
+		return output;
 	}
 
 	if (self.window1_enabled && !self.window2_enabled)
@@ -1191,7 +1261,7 @@ void snes_ppu_device::update_color_windowmasks( uint8_t mask, uint8_t *output )
 		{
 			output[x] = (x >= m_window1_left && x <= m_window1_right) ? set : clear;
 		}
-		return;
+		return output;
 	}
 
 	if (self.window2_enabled && !self.window1_enabled)
@@ -1205,7 +1275,7 @@ void snes_ppu_device::update_color_windowmasks( uint8_t mask, uint8_t *output )
 		{
 			output[x] = (x >= m_window2_left && x <= m_window2_right) ? set : clear;
 		}
-		return;
+		return output;
 	}
 
 	for (uint16_t x = 0; x < 256; x++)
@@ -1220,6 +1290,7 @@ void snes_ppu_device::update_color_windowmasks( uint8_t mask, uint8_t *output )
 			case 3: output[x] = (one_mask ^ two_mask) == 0 ? set : clear; break;
 		}
 	}
+	return output;
 }
 
 /*********************************************
@@ -1254,9 +1325,6 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 			bitmap.pix32(0, x) = rgb_t::black();
 	else
 	{
-		uint8_t window_above[256];
-		uint8_t window_below[256];
-
 		/* Clear priority */
 		memset(m_scanlines[SNES_MAINSCREEN].priority, 0, SNES_SCR_WIDTH);
 		memset(m_scanlines[SNES_SUBSCREEN].priority, 0, SNES_SCR_WIDTH);
@@ -1300,8 +1368,8 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 			below->layer[x] = SNES_COLOR;
 		}
 
-		update_color_windowmasks(m_clip_to_black, window_above);
-		update_color_windowmasks(m_prevent_color_math, window_below);
+		const uint8_t *const window_above = update_color_windowmasks(m_clip_to_black, SNES_MAINSCREEN);
+		const uint8_t *const window_below = update_color_windowmasks(m_prevent_color_math, SNES_SUBSCREEN);
 
 		/* Draw backgrounds */
 		draw_screens(curline);
@@ -1309,56 +1377,47 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 		/* Draw OAM */
 		update_objects(curline);
 
-		/* Draw the scanline to screen */
-		uint16_t prev = 0;
-
+		/* Apply color math to the whole line first, so the output pass below is a plain table lookup */
 		uint16_t *luma = &m_light_table[m_screen_brightness][0];
+		uint16_t main_colors[SNES_SCR_WIDTH];
+		uint16_t sub_colors[SNES_SCR_WIDTH];
 		for (int x = 0; x < SNES_SCR_WIDTH; x++)
 		{
-			/* in hires, the first pixel (of 512) is subscreen pixel, then the first mainscreen pixel follows, and so on... */
-			if (!hires)
-			{
-				const uint16_t c = luma[pixel(x, above, below, window_above, window_below)];
-				const int r = (c & 0x1f);
-				const int g = (c & 0x3e0) >> 5;
-				const int b = (c & 0x7c00) >> 10;
+			/* the subscreen pixel must be resolved first, as it may clear the buffer the mainscreen pixel blends with */
+			if (hires)
+				sub_colors[x] = luma[pixel(x, below, above, window_above, window_below)];
+			main_colors[x] = luma[pixel(x, above, below, window_above, window_below)];
+		}
 
-				bitmap.pix32(0, x * 2 + 0) = rgb_t(pal5bit(r), pal5bit(g), pal5bit(b));
-				bitmap.pix32(0, x * 2 + 1) = rgb_t(pal5bit(r), pal5bit(g), pal5bit(b));
-			}
-			else if (!blurring)
+		/* Draw the scanline to screen */
+		const rgb_t *const rgb = m_rgb_table.get();
+		uint32_t *const dest = &bitmap.pix32(0);
+
+		/* in hires, the first pixel (of 512) is subscreen pixel, then the first mainscreen pixel follows, and so on... */
+		if (!hires)
+		{
+			for (int x = 0; x < SNES_SCR_WIDTH; x++)
+				dest[x * 2 + 0] = dest[x * 2 + 1] = rgb[main_colors[x]];
+		}
+		else if (!blurring)
+		{
+			for (int x = 0; x < SNES_SCR_WIDTH; x++)
 			{
-				const uint16_t c0 = luma[pixel(x, below, above, window_above, window_below)];
-				const uint16_t c1 = luma[pixel(x, above, below, window_above, window_below)];
-				const int r0 = (c0 & 0x1f);
-				const int r1 = (c1 & 0x1f);
-				const int g0 = (c0 & 0x3e0) >> 5;
-				const int g1 = (c1 & 0x3e0) >> 5;
-				const int b0 = (c0 & 0x7c00) >> 10;
-				const int b1 = (c1 & 0x7c00) >> 10;
-
-				bitmap.pix32(0, x * 2 + 0) = rgb_t(pal5bit(r0), pal5bit(g0), pal5bit(b0));
-				bitmap.pix32(0, x * 2 + 1) = rgb_t(pal5bit(r1), pal5bit(g1), pal5bit(b1));
+				dest[x * 2 + 0] = rgb[sub_colors[x]];
+				dest[x * 2 + 1] = rgb[main_colors[x]];
 			}
-			else
+		}
+		else
+		{
+			uint16_t prev = 0;
+			for (int x = 0; x < SNES_SCR_WIDTH; x++)
 			{
-				uint16_t curr = luma[pixel(x, below, above, window_above, window_below)];
-
-				uint16_t c0 = (prev + curr - ((prev ^ curr) & 0x0421)) >> 1;
-				const int r0 = (c0 & 0x1f);
-				const int g0 = (c0 & 0x3e0) >> 5;
-				const int b0 = (c0 & 0x7c00) >> 10;
-				bitmap.pix32(0, x * 2 + 0) = rgb_t(pal5bit(r0), pal5bit(g0), pal5bit(b0));
-
+				uint16_t curr = sub_colors[x];
+				dest[x * 2 + 0] = rgb[(prev + curr - ((prev ^ curr) & 0x0421)) >> 1];
 				prev = curr;
-				curr = luma[pixel(x, above, below, window_above, window_below)];
-
-				uint16_t c1 = (prev + curr - ((prev ^ curr) & 0x0421)) >> 1;
-				const int r1 = (c1 & 0x1f);
-				const int g1 = (c1 & 0x3e0) >> 5;
-				const int b1 = (c1 & 0x7c00) >> 10;
-				bitmap.pix32(0, x * 2 + 1) = rgb_t(pal5bit(r1), pal5bit(g1), pal5bit(b1));
 
+				curr = main_colors[x];
+				dest[x * 2 + 1] = rgb[(prev + curr - ((prev ^ curr) & 0x0421)) >> 1];
 				prev = curr;
 			}
 		}
@@ -1367,7 +1426,7 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 	g_profiler.stop();
 }
 
-uint16_t snes_ppu_device::pixel(uint16_t x, SNES_SCANLINE *above, SNES_SCANLINE *below, uint8_t *window_above, uint8_t *window_below)
+inline uint16_t snes_ppu_device::pixel(uint16_t x, SNES_SCANLINE *above, SNES_SCANLINE *below, const uint8_t *window_above, const uint8_t *window_below)
 {
 	if (!window_above[x]) above->buffer[x] = 0;
 	if (!window_below[x]) return above->buffer[x];
@@ -1517,12 +1576,27 @@ READ8_MEMBER( snes_ppu_device::vram_read )
 	return res;
 }
 
+inline void snes_ppu_device::write_vram(uint16_t offset, uint8_t data)
+{
+	if (m_vram[offset] == data)
+		return;
+	m_vram[offset] = data;
+
+	// drop every decoded tile row that has a bit plane in this byte:
+	// rows of 2bpp tiles cover 2 bytes, 4bpp 18 and 8bpp 50
+	const uint16_t row = offset >> 1;
+	m_tile_cache_valid[row] = 0;
+	m_tile_cache_valid[(row - 8) & 0x7fff] &= ~((1 << SNES_COLOR_DEPTH_4BPP) | (1 << SNES_COLOR_DEPTH_8BPP));
+	m_tile_cache_valid[(row - 16) & 0x7fff] &= ~(1 << SNES_COLOR_DEPTH_8BPP);
+	m_tile_cache_valid[(row - 24) & 0x7fff] &= ~(1 << SNES_COLOR_DEPTH_8BPP);
+}
+
 WRITE8_MEMBER( snes_ppu_device::vram_write )
 {
 	offset &= 0xffff; // only 64KB are present on SNES, Robocop 3 relies on this
 
 	if (m_screen_disabled)
-		m_vram[offset] = data;
+		write_vram(offset, data);
 	else
 	{
 		uint16_t v = screen().vpos();
@@ -1530,9 +1604,9 @@ WRITE8_MEMBER( snes_ppu_device::vram_write )
 		if (v == 0)
 		{
 			if (h <= 4)
-				m_vram[offset] = data;
+				write_vram(offset, data);
 			else if (h == 6)
-				m_vram[offset] = m_openbus_cb(space, 0);
+				write_vram(offset, m_openbus_cb(space, 0));
 			else
 			{
 				//printf("%d %d VRAM write, CHECK!\n",h,v);
@@ -1552,10 +1626,10 @@ WRITE8_MEMBER( snes_ppu_device::vram_write )
 				//no write
 			}
 			else
-				m_vram[offset] = data;
+				write_vram(offset, data);
 		}
 		else
-			m_vram[offset] = data;
+			write_vram(offset, data);
 	}
 }
 
@@ -281,18 +281,22 @@ protected:
 	void update_mode_6(uint16_t curline);
 	void update_mode_7(uint16_t curline);
 	void draw_screens(uint16_t curline);
-	void render_window(uint16_t layer_idx, uint8_t enable, uint8_t *output);
+	inline uint64_t window_key(const layer_t &self) const;
+	const uint8_t *render_window(uint16_t layer_idx, uint8_t enable, int screen);
 	inline void plot_above(uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception = 0);
 	inline void plot_below(uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception = 0);
-	void update_color_windowmasks(uint8_t mask, uint8_t *output);
+	const uint8_t *update_color_windowmasks(uint8_t mask, int screen);
 	void update_video_mode(void);
 	void cache_background();
-	uint16_t pixel(uint16_t x, SNES_SCANLINE *above, SNES_SCANLINE *below, uint8_t *window_above, uint8_t *window_below);
+	inline uint16_t pixel(uint16_t x, SNES_SCANLINE *above, SNES_SCANLINE *below, const uint8_t *window_above, const uint8_t *window_below);
 	uint16_t direct_color(uint16_t palette, uint16_t group);
 	inline uint16_t blend(uint16_t x, uint16_t y, bool halve);
 
 	void dynamic_res_change();
 	inline uint32_t get_vram_address();
+	inline void write_vram(uint16_t offset, uint8_t data);
+	inline uint64_t get_tile_row(uint8_t depth, uint16_t address);
+	void invalidate_tile_cache();
 
 	uint8_t read_oam(uint16_t address);
 	void write_oam(uint16_t address, uint8_t data);
@@ -307,10 +311,21 @@ protected:
 	std::unique_ptr<uint16_t[]> m_cgram;   /* Palette RAM */
 	std::unique_ptr<uint8_t[]> m_vram;    /* Video RAM (TODO: Should be 16-bit, but it's easier this way) */
 	std::unique_ptr<std::unique_ptr<uint16_t[]>[]> m_light_table; /* Luma ramp */
+	std::unique_ptr<rgb_t[]> m_rgb_table;          /* BGR555 to output colour */
+	std::unique_ptr<uint64_t[]> m_tile_cache;      /* Decoded tile rows, one pixel per byte, for each colour depth */
+	std::unique_ptr<uint8_t[]> m_tile_cache_valid; /* One bit per colour depth for each tile row */
+
+	struct window_cache_t
+	{
+		uint64_t key;
+		uint8_t mask[SNES_SCR_WIDTH];
+	};
+	window_cache_t m_window_cache[6][2]; /* Last window masks computed per layer, for main and sub screens */
 
 	// device-level overrides
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_post_load() override;
 
 private:
 	devcb_read16  m_openbus_cb;
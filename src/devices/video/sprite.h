@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <mutex>
+
 
 // ======================> sparse_dirty_rect
 
@@ -78,6 +80,8 @@ class sprite_device : public device_t
 {
 	// constants
 	static const int BITMAP_SLOP = 16;
+	static const int MAX_DRAW_BANDS = 8;
+	static const int MIN_BAND_HEIGHT = 16;
 
 protected:
 	// construction/destruction - only for subclasses
@@ -88,6 +92,9 @@ protected:
 		, m_spriteram(nullptr)
 		, m_spriteram_bytes(0)
 		, m_dirty(dirty_granularity)
+		, m_draw_bands(1)
+		, m_band_queue(nullptr)
+		, m_banded(false)
 	{
 		force_clear();
 	}
@@ -152,8 +159,11 @@ public:
 		rectangle adjusted = cliprect;
 		adjusted.offset(m_xorigin, m_yorigin);
 
-		// render
-		draw(wrapped, adjusted);
+		// render, split into horizontal bands if the subclass allows it
+		if (m_draw_bands > 1 && adjusted.height() >= m_draw_bands * MIN_BAND_HEIGHT)
+			draw_bands(wrapped, adjusted);
+		else
+			draw(wrapped, adjusted);
 	}
 
 protected:
@@ -171,14 +181,80 @@ protected:
 		}
 	}
 
+	virtual void device_stop() override
+	{
+		if (m_band_queue != nullptr)
+			osd_work_queue_free(m_band_queue);
+		m_band_queue = nullptr;
+	}
+
 	// subclass overrides
 	virtual void draw(_BitmapType &bitmap, const rectangle &cliprect) = 0;
 
 	// subclass helpers
 	void mark_dirty(const rectangle &rect) { mark_dirty(rect.left(), rect.right(), rect.top(), rect.bottom()); }
-	void mark_dirty(int32_t left, int32_t right, int32_t top, int32_t bottom) { m_dirty.dirty(left - m_xorigin, right - m_xorigin, top - m_yorigin, bottom - m_yorigin); }
+	void mark_dirty(int32_t left, int32_t right, int32_t top, int32_t bottom)
+	{
+		if (m_banded)
+		{
+			std::lock_guard<std::mutex> lock(m_dirty_lock);
+			m_dirty.dirty(left - m_xorigin, right - m_xorigin, top - m_yorigin, bottom - m_yorigin);
+		}
+		else
+			m_dirty.dirty(left - m_xorigin, right - m_xorigin, top - m_yorigin, bottom - m_yorigin);
+	}
+
+	// let draw() run on several horizontal bands at once; only for subclasses
+	// whose draw() walks the whole list each time and writes nothing but
+	// pixels inside the cliprect it is given
+	void set_draw_bands(int bands) { m_draw_bands = std::max(1, std::min(bands, int(MAX_DRAW_BANDS))); }
 
 private:
+	// one band of a split draw
+	struct band_job
+	{
+		sprite_device *     device;
+		_BitmapType *       bitmap;
+		rectangle           clip;
+	};
+
+	static void *draw_band_callback(void *param, int threadid)
+	{
+		band_job &job = *reinterpret_cast<band_job *>(param);
+		job.device->draw(*job.bitmap, job.clip);
+		return nullptr;
+	}
+
+	void draw_bands(_BitmapType &bitmap, const rectangle &cliprect)
+	{
+		if (m_band_queue == nullptr)
+			m_band_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+		if (m_band_queue == nullptr)
+		{
+			draw(bitmap, cliprect);
+			return;
+		}
+
+		// each band draws every sprite in list order, clipped to its own rows
+		band_job jobs[MAX_DRAW_BANDS];
+		int top = cliprect.top();
+		for (int band = 0; band < m_draw_bands; band++)
+		{
+			int bottom = cliprect.top() + (cliprect.height() * (band + 1)) / m_draw_bands - 1;
+			jobs[band].device = this;
+			jobs[band].bitmap = &bitmap;
+			jobs[band].clip.set(cliprect.left(), cliprect.right(), top, bottom);
+			top = bottom + 1;
+		}
+
+		// the first band runs here while the workers take the rest
+		m_banded = true;
+		osd_work_item_queue_multiple(m_band_queue, draw_band_callback, m_draw_bands - 1, &jobs[1], sizeof(jobs[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		draw_band_callback(&jobs[0], 0);
+		osd_work_queue_wait(m_band_queue, osd_ticks_per_second() * 10);
+		m_banded = false;
+	}
+
 	// configuration
 	int32_t                           m_xorigin;              // X origin for drawing
 	int32_t                           m_yorigin;              // Y origin for drawing
@@ -191,6 +267,12 @@ private:
 	// bitmaps
 	_BitmapType                     m_bitmap;               // live bitmap
 	sparse_dirty_bitmap             m_dirty;                // dirty bitmap
+
+	// banded drawing
+	int                             m_draw_bands;           // number of bands to split drawing into
+	osd_work_queue *                m_band_queue;           // workers drawing the bands
+	bool                            m_banded;               // true while bands are drawing
+	std::mutex                      m_dirty_lock;           // serialises dirty marking between bands
 };
 
 typedef sprite_device<uint8_t, bitmap_ind16> sprite8_device_ind16;
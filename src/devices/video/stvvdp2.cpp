@@ -6271,6 +6271,10 @@ void saturn_state::stv_vdp2_exit ( void )
 {
 	m_vdp2.roz_bitmap[0].reset();
 	m_vdp2.roz_bitmap[1].reset();
+
+	if (m_sprite_queue)
+		osd_work_queue_free(m_sprite_queue);
+	m_sprite_queue = nullptr;
 }
 
 int saturn_state::stv_vdp2_start ( void )
@@ -6281,6 +6285,7 @@ int saturn_state::stv_vdp2_start ( void )
 	m_vdp2_vram = make_unique_clear<uint32_t[]>(0x100000/4 );
 	m_vdp2_cram = make_unique_clear<uint32_t[]>(0x080000/4 );
 	m_vdp2.gfx_decode = std::make_unique<uint8_t[]>(0x100000 );
+	m_sprite_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
 
 //  m_gfxdecode->gfx(0)->granularity()=4;
 //  m_gfxdecode->gfx(1)->granularity()=4;
@@ -6612,7 +6617,7 @@ int saturn_state::stv_vdp2_apply_window_on_layer(rectangle &cliprect)
 	}
 }
 
-void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect, uint8_t pri)
+bool saturn_state::draw_sprites_band(bitmap_rgb32 &bitmap, const rectangle &cliprect, uint8_t pri)
 {
 	int x,y,r,g,b;
 	int i;
@@ -6644,7 +6649,7 @@ void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect,
 	int sprite_color_mode = STV_VDP2_SPCLMD;
 
 	if ( (stv_sprite_priorities_usage_valid == 1) && (stv_sprite_priorities_used[pri] == 0) )
-		return;
+		return false;
 
 	sprite_priorities[0] = STV_VDP2_S0PRIN;
 	sprite_priorities[1] = STV_VDP2_S1PRIN;
@@ -6673,7 +6678,7 @@ void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect,
 	sprite_shadow = shadow_mask_table[sprite_type];
 
 	for ( i = 0; i < (sprite_priority_mask+1); i++ ) if ( sprite_priorities[i] == pri ) break;
-	if ( i == (sprite_priority_mask+1) ) return;
+	if ( i == (sprite_priority_mask+1) ) return false;
 
 	/* color offset (RGB brightness) */
 	color_offset_pal = 0;
@@ -6715,17 +6720,6 @@ void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect,
 	else
 		double_x = 0;
 
-	/* window control */
-	stv2_current_tilemap.window_control.logic = STV_VDP2_SPLOG;
-	stv2_current_tilemap.window_control.enabled[0] = STV_VDP2_SPW0E;
-	stv2_current_tilemap.window_control.enabled[1] = STV_VDP2_SPW1E;
-//  stv2_current_tilemap.window_control.? = STV_VDP2_SPSWE;
-	stv2_current_tilemap.window_control.area[0] = STV_VDP2_SPW0A;
-	stv2_current_tilemap.window_control.area[1] = STV_VDP2_SPW1A;
-//  stv2_current_tilemap.window_control.? = STV_VDP2_SPSWA;
-
-//  stv_vdp2_apply_window_on_layer(mycliprect);
-
 	if (interlace_framebuffer == 0 && double_x == 0 )
 	{
 		if ( alpha_enabled == 0 )
@@ -6749,7 +6743,7 @@ void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect,
 					{
 						if ( sprite_priorities[0] != pri )
 						{
-							stv_sprite_priorities_used[sprite_priorities[0]] = 1;
+							if ( !stv_sprite_priorities_usage_valid ) stv_sprite_priorities_used[sprite_priorities[0]] = 1;
 							stv_sprite_priorities_in_fb_line[y][sprite_priorities[0]] = 1;
 							continue;
 						};
@@ -6772,7 +6766,7 @@ void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect,
 						priority = sprite_priorities[(pix >> sprite_priority_shift) & sprite_priority_mask];
 						if ( priority != pri )
 						{
-							stv_sprite_priorities_used[priority] = 1;
+							if ( !stv_sprite_priorities_usage_valid ) stv_sprite_priorities_used[priority] = 1;
 							stv_sprite_priorities_in_fb_line[y][priority] = 1;
 							continue;
 						};
@@ -6842,7 +6836,7 @@ void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect,
 					{
 						if ( sprite_priorities[0] != pri )
 						{
-							stv_sprite_priorities_used[sprite_priorities[0]] = 1;
+							if ( !stv_sprite_priorities_usage_valid ) stv_sprite_priorities_used[sprite_priorities[0]] = 1;
 							stv_sprite_priorities_in_fb_line[y][sprite_priorities[0]] = 1;
 							continue;
 						};
@@ -6869,7 +6863,7 @@ void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect,
 						priority = sprite_priorities[(pix >> sprite_priority_shift) & sprite_priority_mask];
 						if ( priority != pri )
 						{
-							stv_sprite_priorities_used[priority] = 1;
+							if ( !stv_sprite_priorities_usage_valid ) stv_sprite_priorities_used[priority] = 1;
 							stv_sprite_priorities_in_fb_line[y][priority] = 1;
 							continue;
 						};
@@ -6959,7 +6953,7 @@ void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect,
 				{
 					if ( sprite_priorities[0] != pri )
 					{
-						stv_sprite_priorities_used[sprite_priorities[0]] = 1;
+						if ( !stv_sprite_priorities_usage_valid ) stv_sprite_priorities_used[sprite_priorities[0]] = 1;
 						stv_sprite_priorities_in_fb_line[y][sprite_priorities[0]] = 1;
 						continue;
 					};
@@ -7027,7 +7021,7 @@ void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect,
 					priority = sprite_priorities[(pix >> sprite_priority_shift) & sprite_priority_mask];
 					if ( priority != pri )
 					{
-						stv_sprite_priorities_used[priority] = 1;
+						if ( !stv_sprite_priorities_usage_valid ) stv_sprite_priorities_used[priority] = 1;
 						stv_sprite_priorities_in_fb_line[y][priority] = 1;
 						continue;
 					};
@@ -7140,7 +7134,57 @@ void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect,
 		}
 	}
 
-	stv_sprite_priorities_usage_valid = 1;
+	return true;
+}
+
+/* sprites are composited in horizontal bands on the work queue once the first
+   pass has recorded which priorities the framebuffer uses */
+void *saturn_state::draw_sprites_callback(void *param, int threadid)
+{
+	sprite_band const &band = *reinterpret_cast<sprite_band const *>(param);
+	band.state->draw_sprites_band(*band.bitmap, band.clip, band.pri);
+	return nullptr;
+}
+
+void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect, uint8_t pri)
+{
+	if ( (stv_sprite_priorities_usage_valid == 1) && (stv_sprite_priorities_used[pri] == 0) )
+		return;
+
+	/* window control */
+	stv2_current_tilemap.window_control.logic = STV_VDP2_SPLOG;
+	stv2_current_tilemap.window_control.enabled[0] = STV_VDP2_SPW0E;
+	stv2_current_tilemap.window_control.enabled[1] = STV_VDP2_SPW1E;
+//  stv2_current_tilemap.window_control.? = STV_VDP2_SPSWE;
+	stv2_current_tilemap.window_control.area[0] = STV_VDP2_SPW0A;
+	stv2_current_tilemap.window_control.area[1] = STV_VDP2_SPW1A;
+//  stv2_current_tilemap.window_control.? = STV_VDP2_SPSWA;
+
+//  stv_vdp2_apply_window_on_layer(mycliprect);
+
+	/* the first pass fills in the priority usage tables, and the interlaced
+	   framebuffer path folds two bitmap lines into one, so both run here */
+	if ( !m_sprite_queue || !stv_sprite_priorities_usage_valid || cliprect.height() < SPRITE_BANDS ||
+		((STV_VDP2_LSMD == 3) && m_vdp1.framebuffer_double_interlace == 0) )
+	{
+		if ( draw_sprites_band(bitmap, cliprect, pri) )
+			stv_sprite_priorities_usage_valid = 1;
+		return;
+	}
+
+	sprite_band bands[SPRITE_BANDS];
+	int const height = cliprect.height();
+	for ( int i = 0; i < SPRITE_BANDS; i++ )
+	{
+		bands[i].state = this;
+		bands[i].bitmap = &bitmap;
+		bands[i].clip = cliprect;
+		bands[i].clip.min_y = cliprect.min_y + (height * i) / SPRITE_BANDS;
+		bands[i].clip.max_y = cliprect.min_y + (height * (i + 1)) / SPRITE_BANDS - 1;
+		bands[i].pri = pri;
+	}
+	osd_work_item_queue_multiple(m_sprite_queue, draw_sprites_callback, SPRITE_BANDS, bands, sizeof(bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(m_sprite_queue, osd_ticks_per_second() * 10);
 }
 
 uint32_t saturn_state::screen_update_stv_vdp2(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
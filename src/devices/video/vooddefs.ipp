@@ -2635,6 +2635,14 @@ void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *
 {                                                                               \
 	const poly_extra_data *extra = (const poly_extra_data *)extradata;          \
 	voodoo_device *vd = extra->device; \
+	/* latch the modes once; constant for table entries, registers for the */      \
+	/* generic rasterizers, which would otherwise reload them per pixel */         \
+	const uint32_t r_fbzcolorpath = (FBZCOLORPATH);                                \
+	const uint32_t r_fbzmode = (FBZMODE);                                          \
+	const uint32_t r_alphamode = (ALPHAMODE);                                      \
+	const uint32_t r_fogmode = (FOGMODE);                                          \
+	const uint32_t r_texmode0 = (TEXMODE0);                                        \
+	const uint32_t r_texmode1 = (TEXMODE1);                                        \
 	stats_block *stats = &vd->thread_stats[threadid];                            \
 	DECLARE_DITHER_POINTERS;                                                    \
 	int32_t startx = extent->startx;                                              \
@@ -2652,14 +2660,14 @@ void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *
 																				\
 	/* determine the screen Y */                                                \
 	scry = y;                                                                   \
-	if (FBZMODE_Y_ORIGIN(FBZMODE))                                              \
+	if (FBZMODE_Y_ORIGIN(r_fbzmode))                                              \
 		scry = (vd->fbi.yorigin - y);                                    \
 																				\
 	/* compute dithering */                                                     \
-	COMPUTE_DITHER_POINTERS(FBZMODE, y, FOGMODE);                               \
+	COMPUTE_DITHER_POINTERS(r_fbzmode, y, r_fogmode);                               \
 																				\
 	/* apply clipping */                                                        \
-	if (FBZMODE_ENABLE_CLIPPING(FBZMODE))                                       \
+	if (FBZMODE_ENABLE_CLIPPING(r_fbzmode))                                       \
 	{                                                                           \
 		int32_t tempclip;                                                         \
 																				\
@@ -2735,10 +2743,10 @@ void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *
 		rgbaint_t color, preFog;                                                \
 																				\
 		/* pixel pipeline part 1 handles depth setup and stippling */         \
-		PIXEL_PIPELINE_BEGIN(vd, stats, x, y, FBZCOLORPATH, FBZMODE, iterz, iterw); \
+		PIXEL_PIPELINE_BEGIN(vd, stats, x, y, r_fbzcolorpath, r_fbzmode, iterz, iterw); \
 		/* depth testing */         \
-		if (FBZMODE_ENABLE_DEPTHBUF(FBZMODE))                                                  \
-			if (!depthTest((uint16_t) vd->reg[zaColor].u, stats, depth[x], FBZMODE, biasdepth)) \
+		if (FBZMODE_ENABLE_DEPTHBUF(r_fbzmode))                                                  \
+			if (!depthTest((uint16_t) vd->reg[zaColor].u, stats, depth[x], r_fbzmode, biasdepth)) \
 				goto skipdrawdepth; \
 																				\
 		/* run the texture pipeline on TMU1 to produce a value in texel */      \
@@ -2746,9 +2754,9 @@ void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *
 		if (TMUS >= 2 && vd->tmu[1].lodmin < (8 << 8))                    {       \
 			int32_t tmp; \
 			const rgbaint_t texelZero(0);  \
-			texel = vd->tmu[1].genTexture(x, dither4, TEXMODE1, vd->tmu[1].lookup, extra->lodbase1, \
+			texel = vd->tmu[1].genTexture(x, dither4, r_texmode1, vd->tmu[1].lookup, extra->lodbase1, \
 														iterstw1, tmp); \
-			texel = vd->tmu[1].combineTexture(TEXMODE1, texel, texelZero, tmp); \
+			texel = vd->tmu[1].combineTexture(r_texmode1, texel, texelZero, tmp); \
 		} \
 		/* run the texture pipeline on TMU0 to produce a final */               \
 		/* result in texel */                                                   \
@@ -2759,9 +2767,9 @@ void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *
 			{                                                                   \
 				int32_t lod0; \
 				rgbaint_t texelT0;                                                \
-				texelT0 = vd->tmu[0].genTexture(x, dither4, TEXMODE0, vd->tmu[0].lookup, extra->lodbase0, \
+				texelT0 = vd->tmu[0].genTexture(x, dither4, r_texmode0, vd->tmu[0].lookup, extra->lodbase0, \
 																iterstw0, lod0); \
-				texel = vd->tmu[0].combineTexture(TEXMODE0, texelT0, texel, lod0); \
+				texel = vd->tmu[0].combineTexture(r_texmode0, texelT0, texel, lod0); \
 			}                                                                   \
 			else                                                                \
 			{                                                                   \
@@ -2770,25 +2778,25 @@ void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *
 		}                                                                   \
 																				\
 		/* colorpath pipeline selects source colors and does blending */        \
-		color = clampARGB(iterargb, FBZCOLORPATH);                                      \
-		if (!combineColor(vd, stats, FBZCOLORPATH, FBZMODE, texel, iterz, iterw, color)) \
+		color = clampARGB(iterargb, r_fbzcolorpath);                                      \
+		if (!combineColor(vd, stats, r_fbzcolorpath, r_fbzmode, texel, iterz, iterw, color)) \
 			goto skipdrawdepth;                                                          \
 		/* handle alpha test */                                                          \
-		if (ALPHAMODE_ALPHATEST(ALPHAMODE))                                              \
-			if (!alphaTest(vd->reg[alphaMode].rgb.a, stats, ALPHAMODE, color.get_a()))   \
+		if (ALPHAMODE_ALPHATEST(r_alphamode))                                              \
+			if (!alphaTest(vd->reg[alphaMode].rgb.a, stats, r_alphamode, color.get_a()))   \
 				goto skipdrawdepth;                                                      \
 																						 \
 		/* perform fogging */                                                            \
 		preFog.set(color);                                                               \
-		if (FOGMODE_ENABLE_FOG(FOGMODE))                                                                         \
-			applyFogging(vd, FBZMODE, FOGMODE, FBZCOLORPATH, x, dither4, wfloat, color, iterz, iterw, iterargb); \
+		if (FOGMODE_ENABLE_FOG(r_fogmode))                                                                         \
+			applyFogging(vd, r_fbzmode, r_fogmode, r_fbzcolorpath, x, dither4, wfloat, color, iterz, iterw, iterargb); \
 																												 \
 		/* perform alpha blending */                                                \
-		if (ALPHAMODE_ALPHABLEND(ALPHAMODE))                                                            \
-			alphaBlend(FBZMODE, ALPHAMODE, x, dither, dest[x], depth, preFog, color, vd->fbi.rgb565); \
+		if (ALPHAMODE_ALPHABLEND(r_alphamode))                                                            \
+			alphaBlend(r_fbzmode, r_alphamode, x, dither, dest[x], depth, preFog, color, vd->fbi.rgb565); \
 																				\
 		/* pixel pipeline part 2 handles final output */        \
-		PIXEL_PIPELINE_END(stats, dither_lookup, x, dest, depth, FBZMODE);  \
+		PIXEL_PIPELINE_END(stats, dither_lookup, x, dest, depth, r_fbzmode);  \
 																				\
 		/* update the iterated parameters */                                    \
 		iterargb += iterargbDelta;                                              \
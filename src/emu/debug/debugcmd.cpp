@@ -2838,6 +2838,7 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 	const char *action = nullptr;
 	bool detect_loops = true;
 	bool logerror = false;
+	bool binary = false;
 	device_t *cpu;
 	FILE *f = nullptr;
 	const char *mode;
@@ -2861,6 +2862,8 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 				detect_loops = false;
 			else if (!core_stricmp(flag.c_str(), "logerror"))
 				logerror = true;
+			else if (!core_stricmp(flag.c_str(), "binary"))
+				binary = true;
 			else
 			{
 				m_console.printf("Invalid flag '%s'\n", flag.c_str());
@@ -2874,12 +2877,12 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 	/* open the file */
 	if (core_stricmp(filename.c_str(), "off") != 0)
 	{
-		mode = "w";
+		mode = binary ? "wb" : "w";
 
 		/* opening for append? */
 		if ((filename[0] == '>') && (filename[1] == '>'))
 		{
-			mode = "a";
+			mode = binary ? "ab" : "a";
 			filename = filename.substr(2);
 		}
 
@@ -2892,7 +2895,7 @@ void debugger_commands::execute_trace_internal(int ref, const std::vector<std::s
 	}
 
 	/* do it */
-	cpu->debug()->trace(f, trace_over, detect_loops, logerror, action);
+	cpu->debug()->trace(f, trace_over, detect_loops, logerror, binary, action);
 	if (f)
 		m_console.printf("Tracing CPU '%s' to file %s\n", cpu->tag(), filename.c_str());
 	else
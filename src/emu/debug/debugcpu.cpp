@@ -40,6 +40,7 @@ debugger_cpu::debugger_cpu(running_machine &machine)
 	, m_breakcpu(nullptr)
 	, m_symtable(nullptr)
 	, m_vblank_occurred(false)
+	, m_memory_generation(0)
 	, m_execution_state(exec_state::STOPPED)
 	, m_stop_when_not_device(nullptr)
 	, m_bpindex(1)
@@ -430,6 +431,7 @@ void debugger_cpu::write_byte(address_space &space, offs_t address, u8 data, boo
 	space.write_byte(address, data);
 
 	m_memory_modified = true;
+	m_memory_generation++;
 }
 
 
@@ -456,6 +458,7 @@ void debugger_cpu::write_word(address_space &space, offs_t address, u16 data, bo
 	space.write_word_unaligned(address, data);
 
 	m_memory_modified = true;
+	m_memory_generation++;
 }
 
 
@@ -482,6 +485,7 @@ void debugger_cpu::write_dword(address_space &space, offs_t address, u32 data, b
 	space.write_dword_unaligned(address, data);
 
 	m_memory_modified = true;
+	m_memory_generation++;
 }
 
 
@@ -508,6 +512,7 @@ void debugger_cpu::write_qword(address_space &space, offs_t address, u64 data, b
 	space.write_qword_unaligned(address, data);
 
 	m_memory_modified = true;
+	m_memory_generation++;
 }
 
 
@@ -617,10 +622,17 @@ void debugger_cpu::reset_transient_flags()
 
 device_t* debugger_cpu::expression_get_device(const char *tag)
 {
+	// the device tree doesn't change, so remember what each tag resolved to
+	auto found = m_expression_devices.find(tag);
+	if (found != m_expression_devices.end())
+		return found->second;
+
 	// convert to lowercase then lookup the name (tags are enforced to be all lower case)
 	std::string fullname(tag);
 	strmakelower(fullname);
-	return m_machine.root_device().subdevice(fullname.c_str());
+	device_t *const device = m_machine.root_device().subdevice(fullname.c_str());
+	m_expression_devices.emplace(tag, device);
+	return device;
 }
 
 
@@ -971,6 +983,7 @@ void debugger_cpu::expression_write_program_direct(address_space &space, int opc
 			else
 				base[BYTE8_XOR_BE(address) & lowmask] = data;
 			m_memory_modified = true;
+			m_memory_generation++;
 		}
 	}
 }
@@ -1029,6 +1042,7 @@ void debugger_cpu::expression_write_memory_region(const char *rgntag, offs_t add
 				base[BYTE8_XOR_BE(address) & lowmask] = data;
 			}
 			m_memory_modified = true;
+			m_memory_generation++;
 		}
 	}
 }
@@ -1298,11 +1312,14 @@ device_debug::device_debug(device_t &device)
 	, m_last_total_cycles(0)
 	, m_pc_history_index(0)
 	, m_bplist()
+	, m_bpaddrs()
+	, m_bpfilter()
 	, m_rplist()
 	, m_triggered_breakpoint(nullptr)
 	, m_triggered_watchpoint(nullptr)
 	, m_trace(nullptr)
 	, m_hotspot_threshhold(0)
+	, m_wpinstalling(false)
 	, m_track_pc_set()
 	, m_track_pc(false)
 	, m_comment_set()
@@ -1323,6 +1340,7 @@ device_debug::device_debug(device_t &device)
 		int count = m_memory->max_space_count();
 		m_phr.resize(count, nullptr);
 		m_phw.resize(count, nullptr);
+		m_wptaps.resize(count);
 		for (int i=0; i != count; i++)
 			if (m_memory->has_space(i)) {
 				address_space &space = m_memory->space(i);
@@ -1445,12 +1463,18 @@ void device_debug::reinstall(address_space &space, read_or_write mode)
 		if (m_track_mem)
 			switch (space.data_width())
 			{
-			case  8: m_phw[id] = space.install_read_tap(0, space.addrmask(), "track_mem", [this, &space](offs_t address, u8  &data, u8 ) { write_tracking(space, address, data); }, m_phw[id]); break;
-			case 16: m_phw[id] = space.install_read_tap(0, space.addrmask(), "track_mem", [this, &space](offs_t address, u16 &data, u16) { write_tracking(space, address, data); }, m_phw[id]); break;
-			case 32: m_phw[id] = space.install_read_tap(0, space.addrmask(), "track_mem", [this, &space](offs_t address, u32 &data, u32) { write_tracking(space, address, data); }, m_phw[id]); break;
-			case 64: m_phw[id] = space.install_read_tap(0, space.addrmask(), "track_mem", [this, &space](offs_t address, u64 &data, u64) { write_tracking(space, address, data); }, m_phw[id]); break;
+			case  8: m_phw[id] = space.install_write_tap(0, space.addrmask(), "track_mem", [this, &space](offs_t address, u8  &data, u8 ) { write_tracking(space, address, data); }, m_phw[id]); break;
+			case 16: m_phw[id] = space.install_write_tap(0, space.addrmask(), "track_mem", [this, &space](offs_t address, u16 &data, u16) { write_tracking(space, address, data); }, m_phw[id]); break;
+			case 32: m_phw[id] = space.install_write_tap(0, space.addrmask(), "track_mem", [this, &space](offs_t address, u32 &data, u32) { write_tracking(space, address, data); }, m_phw[id]); break;
+			case 64: m_phw[id] = space.install_write_tap(0, space.addrmask(), "track_mem", [this, &space](offs_t address, u64 &data, u64) { write_tracking(space, address, data); }, m_phw[id]); break;
 			}
 	}
+
+	// watchpoints have their own taps on just the watched ranges
+	if (u32(mode) & u32(read_or_write::READ))
+		watchpoint_install_taps(space, 0);
+	if (u32(mode) & u32(read_or_write::WRITE))
+		watchpoint_install_taps(space, 1);
 }
 
 void device_debug::reinstall_all(read_or_write mode)
@@ -1461,6 +1485,147 @@ void device_debug::reinstall_all(read_or_write mode)
 			reinstall(m_memory->space(i), mode);
 }
 
+//-------------------------------------------------
+//  watchpoint_attach - add the ranges of a
+//  watchpoint to the taps of its space
+//-------------------------------------------------
+
+void device_debug::watchpoint_attach(watchpoint &wp)
+{
+	watchpoint_taps &taps = m_wptaps[wp.m_space.spacenum()];
+	for (int rw = 0; rw != 2; rw++)
+		if (u32(wp.m_type) & u32(rw ? read_or_write::WRITE : read_or_write::READ))
+		{
+			// the list may be in use by a tap, so build a new one
+			auto ranges = taps.m_ranges[rw] ? std::make_shared<watchpoint_range_list>(*taps.m_ranges[rw]) : std::make_shared<watchpoint_range_list>();
+			for (int i = 0; i != 3; i++)
+				if (wp.m_masks[i])
+					ranges->push_back(watchpoint_range{ wp.m_start_address[i], wp.m_end_address[i], wp.m_masks[i], &wp });
+			taps.m_ranges[rw] = std::move(ranges);
+			watchpoint_install_taps(wp.m_space, rw);
+		}
+}
+
+
+//-------------------------------------------------
+//  watchpoint_detach - remove the ranges of a
+//  watchpoint from the taps of its space
+//-------------------------------------------------
+
+void device_debug::watchpoint_detach(watchpoint &wp)
+{
+	watchpoint_taps &taps = m_wptaps[wp.m_space.spacenum()];
+	for (int rw = 0; rw != 2; rw++)
+		if (taps.m_ranges[rw])
+		{
+			auto ranges = std::make_shared<watchpoint_range_list>();
+			for (watchpoint_range const &range : *taps.m_ranges[rw])
+				if (range.m_wp != &wp)
+					ranges->push_back(range);
+			if (ranges->size() != taps.m_ranges[rw]->size())
+			{
+				taps.m_ranges[rw] = std::move(ranges);
+				watchpoint_install_taps(wp.m_space, rw);
+			}
+		}
+}
+
+
+//-------------------------------------------------
+//  watchpoint_install_taps - install taps
+//  covering the union of the watched ranges,
+//  so each address is tapped at most once no
+//  matter how many watchpoints cover it
+//-------------------------------------------------
+
+void device_debug::watchpoint_install_taps(address_space &space, int rw)
+{
+	if (m_wpinstalling)
+		return;
+	m_wpinstalling = true;
+
+	int const spacenum = space.spacenum();
+	watchpoint_taps &taps = m_wptaps[spacenum];
+	memory_passthrough_handler *&ph = taps.m_ph[rw];
+	if (ph)
+		ph->remove();
+
+	// merge overlapping and adjacent ranges
+	std::vector<std::pair<offs_t, offs_t> > spans;
+	if (taps.m_ranges[rw])
+		for (watchpoint_range const &range : *taps.m_ranges[rw])
+			spans.emplace_back(range.m_start, range.m_end);
+	std::sort(spans.begin(), spans.end());
+	std::vector<std::pair<offs_t, offs_t> > merged;
+	for (auto const &span : spans)
+	{
+		if (!merged.empty() && (span.first <= merged.back().second || span.first == merged.back().second + 1))
+			merged.back().second = std::max(merged.back().second, span.second);
+		else
+			merged.push_back(span);
+	}
+
+	for (auto const &span : merged)
+	{
+		switch (space.data_width())
+		{
+		case  8:
+			if (rw)
+				ph = space.install_write_tap(span.first, span.second, "watchpoints", [this, spacenum](offs_t offset, u8  &data, u8  mem_mask) { watchpoint_dispatch(spacenum, 1, offset, data, mem_mask); }, ph);
+			else
+				ph = space.install_read_tap(span.first, span.second, "watchpoints", [this, spacenum](offs_t offset, u8  &data, u8  mem_mask) { watchpoint_dispatch(spacenum, 0, offset, data, mem_mask); }, ph);
+			break;
+		case 16:
+			if (rw)
+				ph = space.install_write_tap(span.first, span.second, "watchpoints", [this, spacenum](offs_t offset, u16 &data, u16 mem_mask) { watchpoint_dispatch(spacenum, 1, offset, data, mem_mask); }, ph);
+			else
+				ph = space.install_read_tap(span.first, span.second, "watchpoints", [this, spacenum](offs_t offset, u16 &data, u16 mem_mask) { watchpoint_dispatch(spacenum, 0, offset, data, mem_mask); }, ph);
+			break;
+		case 32:
+			if (rw)
+				ph = space.install_write_tap(span.first, span.second, "watchpoints", [this, spacenum](offs_t offset, u32 &data, u32 mem_mask) { watchpoint_dispatch(spacenum, 1, offset, data, mem_mask); }, ph);
+			else
+				ph = space.install_read_tap(span.first, span.second, "watchpoints", [this, spacenum](offs_t offset, u32 &data, u32 mem_mask) { watchpoint_dispatch(spacenum, 0, offset, data, mem_mask); }, ph);
+			break;
+		case 64:
+			if (rw)
+				ph = space.install_write_tap(span.first, span.second, "watchpoints", [this, spacenum](offs_t offset, u64 &data, u64 mem_mask) { watchpoint_dispatch(spacenum, 1, offset, data, mem_mask); }, ph);
+			else
+				ph = space.install_read_tap(span.first, span.second, "watchpoints", [this, spacenum](offs_t offset, u64 &data, u64 mem_mask) { watchpoint_dispatch(spacenum, 0, offset, data, mem_mask); }, ph);
+			break;
+		}
+	}
+
+	m_wpinstalling = false;
+}
+
+
+//-------------------------------------------------
+//  watchpoint_dispatch - pass an access seen by
+//  a tap to the watchpoints covering it
+//-------------------------------------------------
+
+void device_debug::watchpoint_dispatch(int spacenum, int rw, offs_t address, u64 data, u64 mem_mask)
+{
+	// hold on to the list in case an action changes the watchpoints
+	std::shared_ptr<watchpoint_range_list const> const ranges = m_wptaps[spacenum].m_ranges[rw];
+	if (!ranges)
+		return;
+
+	read_or_write const type = rw ? read_or_write::WRITE : read_or_write::READ;
+	for (watchpoint_range const &range : *ranges)
+	{
+		if (address >= range.m_start && address <= range.m_end && (mem_mask & range.m_mask))
+		{
+			range.m_wp->triggered(type, address, data, mem_mask);
+
+			// the watchpoints we still have to look at may be gone
+			if (m_wptaps[spacenum].m_ranges[rw] != ranges)
+				break;
+		}
+	}
+}
+
 //-------------------------------------------------
 //  start_hook - the scheduler calls this hook
 //  before beginning execution for the given device
@@ -1652,6 +1817,9 @@ void device_debug::instruction_hook(offs_t curpc)
 		// remember the last visible CPU in the debugger
 		debugcpu.set_visible_cpu(&m_device);
 
+		// anything may have changed while we were running
+		debugcpu.bump_memory_generation();
+
 		// update all views
 		machine.debug_view().update_all();
 		machine.debugger().refresh_display();
@@ -1928,11 +2096,12 @@ void device_debug::halt_on_next_instruction_impl(util::format_argument_pack<std:
 
 const device_debug::breakpoint *device_debug::breakpoint_find(offs_t address) const
 {
-	for (const breakpoint &bp : m_bplist)
-		if (bp.address() == address)
-			return &bp;
-
-	return nullptr;
+	auto const found = std::lower_bound(
+			m_bpaddrs.begin(),
+			m_bpaddrs.end(),
+			address,
+			[] (std::pair<offs_t, breakpoint *> const &entry, offs_t addr) { return entry.first < addr; });
+	return ((found != m_bpaddrs.end()) && (found->first == address)) ? found->second : nullptr;
 }
 
 //-------------------------------------------------
@@ -2397,14 +2566,14 @@ u32 device_debug::compute_opcode_crc32(offs_t pc) const
 //  trace - trace execution of a given device
 //-------------------------------------------------
 
-void device_debug::trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action)
+void device_debug::trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, bool binary, const char *action)
 {
 	// delete any existing tracers
 	m_trace = nullptr;
 
 	// if we have a new file, make a new tracer
 	if (file != nullptr)
-		m_trace = std::make_unique<tracer>(*this, *file, trace_over, detect_loops, logerror, action);
+		m_trace = std::make_unique<tracer>(*this, *file, trace_over, detect_loops, logerror, binary, action);
 }
 
 
@@ -2506,6 +2675,19 @@ void device_debug::prepare_for_step_overout(offs_t pc)
 
 void device_debug::breakpoint_update_flags()
 {
+	// rebuild the address index, keeping list order for breakpoints at the same address
+	m_bpaddrs.clear();
+	m_bpfilter.fill(0);
+	for (breakpoint &bp : m_bplist)
+	{
+		m_bpaddrs.emplace_back(bp.m_address, &bp);
+		m_bpfilter[(bp.m_address >> 6) & 0x3f] |= u64(1) << (bp.m_address & 0x3f);
+	}
+	std::stable_sort(
+			m_bpaddrs.begin(),
+			m_bpaddrs.end(),
+			[] (std::pair<offs_t, breakpoint *> const &lhs, std::pair<offs_t, breakpoint *> const &rhs) { return lhs.first < rhs.first; });
+
 	// see if there are any enabled breakpoints
 	m_flags &= ~DEBUG_FLAG_LIVE_BP;
 	for (breakpoint &bp : m_bplist)
@@ -2542,8 +2724,19 @@ void device_debug::breakpoint_check(offs_t pc)
 {
 	debugger_cpu& debugcpu = m_device.machine().debugger().cpu();
 
-	// see if we match
-	for (breakpoint &bp : m_bplist)
+	// see if we match; most addresses are ruled out by the filter alone
+	auto bpaddr = m_bpaddrs.end();
+	if (BIT(m_bpfilter[(pc >> 6) & 0x3f], pc & 0x3f))
+	{
+		bpaddr = std::lower_bound(
+				m_bpaddrs.begin(),
+				m_bpaddrs.end(),
+				pc,
+				[] (std::pair<offs_t, breakpoint *> const &entry, offs_t addr) { return entry.first < addr; });
+	}
+	for ( ; (bpaddr != m_bpaddrs.end()) && (bpaddr->first == pc); ++bpaddr)
+	{
+		breakpoint &bp(*bpaddr->second);
 		if (bp.hit(pc))
 		{
 			// halt in the debugger by default
@@ -2561,6 +2754,7 @@ void device_debug::breakpoint_check(offs_t pc)
 			}
 			break;
 		}
+	}
 
 	// see if we have any matching registerpoints
 	for (registerpoint &rp : m_rplist)
@@ -2706,6 +2900,7 @@ void device_debug::set_state(symbol_table &table, int index, u64 value)
 {
 	device_t *device = reinterpret_cast<device_t *>(table.globalref());
 	device->debug()->m_state->set_state_int(index, value);
+	device->machine().debugger().cpu().bump_memory_generation();
 }
 
 
@@ -2784,8 +2979,6 @@ device_debug::watchpoint::watchpoint(device_debug* debugInterface,
 										const char *condition,
 										const char *action)
 	: m_debugInterface(debugInterface),
-	  m_phr(nullptr),
-	  m_phw(nullptr),
 	  m_space(space),
 	  m_index(index),
 	  m_enabled(true),
@@ -2793,8 +2986,7 @@ device_debug::watchpoint::watchpoint(device_debug* debugInterface,
 	  m_address(address & space.addrmask()),
 	  m_length(length),
 	  m_condition(&symbols, (condition != nullptr) ? condition : "1"),
-	  m_action((action != nullptr) ? action : ""),
-	  m_installing(false)
+	  m_action((action != nullptr) ? action : "")
 {
 	std::fill(std::begin(m_start_address), std::end(m_start_address), 0);
 	std::fill(std::begin(m_end_address), std::end(m_end_address), 0);
@@ -2865,22 +3057,13 @@ device_debug::watchpoint::watchpoint(device_debug* debugInterface,
 		}
 	}
 
-	install(read_or_write::READWRITE);
-	m_notifier = m_space.add_change_notifier([this](read_or_write mode) {
-												 if (m_enabled)
-												 {
-													 install(mode);
-												 }
-											 });
+	m_debugInterface->watchpoint_attach(*this);
 }
 
 device_debug::watchpoint::~watchpoint()
 {
-	m_space.remove_change_notifier(m_notifier);
-	if (m_phr)
-		m_phr->remove();
-	if (m_phw)
-		m_phw->remove();
+	if (m_enabled)
+		m_debugInterface->watchpoint_detach(*this);
 }
 
 void device_debug::watchpoint::setEnabled(bool value)
@@ -2889,105 +3072,10 @@ void device_debug::watchpoint::setEnabled(bool value)
 	{
 		m_enabled = value;
 		if (m_enabled)
-			install(read_or_write::READWRITE);
+			m_debugInterface->watchpoint_attach(*this);
 		else
-		{
-			m_installing = true;
-			if(m_phr)
-				m_phr->remove();
-			if(m_phw)
-				m_phw->remove();
-			m_installing = false;
-		}
-	}
-}
-
-void device_debug::watchpoint::install(read_or_write mode)
-{
-	if (m_installing)
-		return;
-	m_installing = true;
-	if ((u32(mode) & u32(read_or_write::READ)) && m_phr)
-		m_phr->remove();
-	if ((u32(mode) & u32(read_or_write::WRITE)) && m_phw)
-		m_phw->remove();
-	std::string name = util::string_format("wp@%x", m_address);
-	switch (m_space.data_width())
-	{
-	case  8:
-		if (u32(m_type) & u32(mode) & u32(read_or_write::READ))
-			m_phr = m_space.install_read_tap(m_start_address[0], m_end_address[0], name,
-											 [this](offs_t offset, u8 &data, u8 mem_mask) {
-												 triggered(read_or_write::READ, offset, data, mem_mask);
-											 }, m_phr);
-		if (u32(m_type) & u32(mode) & u32(read_or_write::WRITE))
-			m_phw = m_space.install_write_tap(m_start_address[0], m_end_address[0], name,
-											  [this](offs_t offset, u8 &data, u8 mem_mask) {
-												  triggered(read_or_write::WRITE, offset, data, mem_mask);
-											  }, m_phw);
-		break;
-
-	case 16:
-		for (int i=0; i != 3; i++)
-			if (m_masks[i])
-			{
-				u16 mask = m_masks[i];
-				if (u32(m_type) & u32(mode) & u32(read_or_write::READ))
-					m_phr = m_space.install_read_tap(m_start_address[i], m_end_address[i], name,
-													 [this, mask](offs_t offset, u16 &data, u16 mem_mask) {
-														 if (mem_mask & mask)
-															 triggered(read_or_write::READ, offset, data, mem_mask);
-													 }, m_phr);
-				if (u32(m_type) & u32(mode) & u32(read_or_write::WRITE))
-					m_phw = m_space.install_write_tap(m_start_address[i], m_end_address[i], name,
-													  [this, mask](offs_t offset, u16 &data, u16 mem_mask) {
-														  if (mem_mask & mask)
-															  triggered(read_or_write::WRITE, offset, data, mem_mask);
-													  }, m_phw);
-			}
-		break;
-
-	case 32:
-		for (int i=0; i != 3; i++)
-			if (m_masks[i])
-			{
-				u32 mask = m_masks[i];
-				if (u32(m_type) & u32(mode) & u32(read_or_write::READ))
-					m_phr = m_space.install_read_tap(m_start_address[i], m_end_address[i], name,
-													 [this, mask](offs_t offset, u32 &data, u32 mem_mask) {
-														 if (mem_mask & mask)
-															 triggered(read_or_write::READ, offset, data, mem_mask);
-													 }, m_phr);
-				if (u32(m_type) & u32(mode) & u32(read_or_write::WRITE))
-					m_phw = m_space.install_write_tap(m_start_address[i], m_end_address[i], name,
-													  [this, mask](offs_t offset, u32 &data, u32 mem_mask) {
-														  if (mem_mask & mask)
-															  triggered(read_or_write::WRITE, offset, data, mem_mask);
-													  }, m_phw);
-			}
-		break;
-
-	case 64:
-		for (int i=0; i != 3; i++)
-			if (m_masks[i])
-			{
-				u64 mask = m_masks[i];
-				if (u32(m_type) & u32(mode) & u32(read_or_write::READ))
-					m_phr = m_space.install_read_tap(m_start_address[i], m_end_address[i], name,
-													 [this, mask](offs_t offset, u64 &data, u64 mem_mask) {
-														 if (mem_mask & mask)
-															 triggered(read_or_write::READ, offset, data, mem_mask);
-													 }, m_phr);
-				if (u32(m_type) & u32(mode) & u32(read_or_write::WRITE))
-					m_phw = m_space.install_write_tap(m_start_address[i], m_end_address[i], name,
-													  [this, mask](offs_t offset, u64 &data, u64 mem_mask) {
-														  if (mem_mask & mask)
-															  triggered(read_or_write::WRITE, offset, data, mem_mask);
-													  }, m_phw);
-			}
-		break;
+			m_debugInterface->watchpoint_detach(*this);
 	}
-	m_installing = false;
 }
 
 void device_debug::watchpoint::triggered(read_or_write type, offs_t address, u64 data, u64 mem_mask)
@@ -3136,7 +3224,7 @@ bool device_debug::registerpoint::hit()
 //  tracer - constructor
 //-------------------------------------------------
 
-device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action)
+device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, bool binary, const char *action)
 	: m_debug(debug)
 	, m_file(file)
 	, m_action((action != nullptr) ? action : "")
@@ -3146,8 +3234,23 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, b
 	, m_nextdex(0)
 	, m_trace_over(trace_over)
 	, m_trace_over_target(~0)
+	, m_binary(binary)
+	, m_binary_queue(nullptr)
 {
 	memset(m_history, 0, sizeof(m_history));
+
+	if (m_binary)
+	{
+		// records are accumulated in blocks and written out by a background thread
+		m_binary_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+		m_binary_buffer.reserve(BINARY_BLOCK_SIZE + 256);
+
+		// header: signature, version and the number of hex digits in a PC
+		static const char signature[] = "MAMETRC";
+		m_binary_buffer.insert(m_binary_buffer.end(), std::begin(signature), std::end(signature) - 1);
+		m_binary_buffer.push_back(1);
+		m_binary_buffer.push_back(u8(m_debug.logaddrchars()));
+	}
 }
 
 
@@ -3157,6 +3260,14 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, b
 
 device_debug::tracer::~tracer()
 {
+	if (m_binary)
+	{
+		// write out anything still pending before the file goes away
+		flush();
+		if (m_binary_queue)
+			osd_work_queue_free(m_binary_queue);
+	}
+
 	// make sure we close the file if we can
 	fclose(&m_file);
 }
@@ -3194,7 +3305,15 @@ void device_debug::tracer::update(offs_t pc)
 
 		// if we just finished looping, indicate as much
 		if (m_loops != 0)
-			fprintf(&m_file, "\n   (loops for %d instructions)\n\n", m_loops);
+		{
+			if (m_binary)
+			{
+				std::string const text = string_format("\n   (loops for %d instructions)\n\n", m_loops);
+				binary_text(text.c_str(), text.length());
+			}
+			else
+				fprintf(&m_file, "\n   (loops for %d instructions)\n\n", m_loops);
+		}
 		m_loops = 0;
 	}
 
@@ -3203,13 +3322,50 @@ void device_debug::tracer::update(offs_t pc)
 		m_debug.m_device.machine().debugger().console().execute_command(m_action, false);
 
 	debug_disasm_buffer buffer(m_debug.device());
-	std::string instruction;
-	offs_t next_pc, size;
 	u32 dasmresult;
-	buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
+	if (m_binary)
+	{
+		// reuse the previous decode of this PC as long as the opcode bytes haven't changed
+		auto cached = m_dasm_cache.find(pc);
+		if (cached != m_dasm_cache.end())
+		{
+			m_binary_bytes.clear();
+			buffer.data_get(pc, cached->second.m_info & util::disasm_interface::LENGTHMASK, true, m_binary_bytes);
+			if (m_binary_bytes != cached->second.m_bytes)
+				cached = m_dasm_cache.end();
+		}
+		if (cached == m_dasm_cache.end())
+		{
+			if (m_dasm_cache.size() >= DASM_CACHE_LIMIT)
+				m_dasm_cache.clear();
+			cached_instruction &entry = m_dasm_cache[pc];
+			entry.m_info = buffer.disassemble_info(pc);
+			entry.m_bytes.clear();
+			buffer.data_get(pc, entry.m_info & util::disasm_interface::LENGTHMASK, true, entry.m_bytes);
+			cached = m_dasm_cache.find(pc);
+		}
+		dasmresult = cached->second.m_info;
+
+		// output a record: 'I', PC, byte count and opcode bytes
+		std::vector<u8> const &bytes = cached->second.m_bytes;
+		m_binary_buffer.push_back('I');
+		for (int i = 0; i < 4; i++)
+			m_binary_buffer.push_back(u8(pc >> (8 * i)));
+		m_binary_buffer.push_back(u8(bytes.size()));
+		m_binary_buffer.push_back(u8(bytes.size() >> 8));
+		m_binary_buffer.insert(m_binary_buffer.end(), bytes.begin(), bytes.end());
+		if (m_binary_buffer.size() >= BINARY_BLOCK_SIZE)
+			binary_submit();
+	}
+	else
+	{
+		std::string instruction;
+		offs_t next_pc, size;
+		buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
 
-	// output the result
-	fprintf(&m_file, "%s: %s\n", buffer.pc_to_string(pc).c_str(), instruction.c_str());
+		// output the result
+		fprintf(&m_file, "%s: %s\n", buffer.pc_to_string(pc).c_str(), instruction.c_str());
+	}
 
 	// do we need to step the trace over this instruction?
 	if (m_trace_over && (dasmresult & util::disasm_interface::SUPPORTED) != 0 && (dasmresult & util::disasm_interface::STEP_OVER) != 0)
@@ -3227,7 +3383,8 @@ void device_debug::tracer::update(offs_t pc)
 	// log this PC
 	m_nextdex = (m_nextdex + 1) % TRACE_LOOPS;
 	m_history[m_nextdex] = pc;
-	fflush(&m_file);
+	if (!m_binary)
+		fflush(&m_file);
 }
 
 
@@ -3237,6 +3394,22 @@ void device_debug::tracer::update(offs_t pc)
 
 void device_debug::tracer::vprintf(const char *format, va_list va)
 {
+	if (m_binary)
+	{
+		// wrap it in a text record
+		va_list vc;
+		va_copy(vc, va);
+		int const length = vsnprintf(nullptr, 0, format, vc);
+		va_end(vc);
+		if (length > 0)
+		{
+			std::vector<char> text(length + 1);
+			vsnprintf(&text[0], text.size(), format, va);
+			binary_text(&text[0], length);
+		}
+		return;
+	}
+
 	// pass through to the file
 	vfprintf(&m_file, format, va);
 	fflush(&m_file);
@@ -3250,10 +3423,68 @@ void device_debug::tracer::vprintf(const char *format, va_list va)
 
 void device_debug::tracer::flush()
 {
+	if (m_binary)
+	{
+		// hand over what we have and wait for the writer to catch up
+		binary_submit();
+		if (m_binary_queue)
+			osd_work_queue_wait(m_binary_queue, osd_ticks_per_second() * 10);
+	}
 	fflush(&m_file);
 }
 
 
+//-------------------------------------------------
+//  binary_text - append a text record to the
+//  binary trace
+//-------------------------------------------------
+
+void device_debug::tracer::binary_text(const char *text, size_t length)
+{
+	m_binary_buffer.push_back('T');
+	for (int i = 0; i < 4; i++)
+		m_binary_buffer.push_back(u8(length >> (8 * i)));
+	m_binary_buffer.insert(m_binary_buffer.end(), text, text + length);
+	if (m_binary_buffer.size() >= BINARY_BLOCK_SIZE)
+		binary_submit();
+}
+
+
+//-------------------------------------------------
+//  binary_submit - hand the pending binary
+//  records to the writer thread
+//-------------------------------------------------
+
+void device_debug::tracer::binary_submit()
+{
+	if (m_binary_buffer.empty())
+		return;
+
+	auto block = std::make_unique<binary_block>();
+	block->m_file = &m_file;
+	block->m_data.reserve(BINARY_BLOCK_SIZE + 256);
+	block->m_data.swap(m_binary_buffer);
+
+	// fall back to writing in line if the queue couldn't be created
+	if (!m_binary_queue || !osd_work_item_queue(m_binary_queue, binary_write_callback, block.get(), WORK_ITEM_FLAG_AUTO_RELEASE))
+		binary_write_callback(block.get(), 0);
+	block.release();
+}
+
+
+//-------------------------------------------------
+//  binary_write_callback - write a block of
+//  binary records on the writer thread
+//-------------------------------------------------
+
+void *device_debug::tracer::binary_write_callback(void *param, int threadid)
+{
+	std::unique_ptr<binary_block> const block(reinterpret_cast<binary_block *>(param));
+	fwrite(&block->m_data[0], 1, block->m_data.size(), block->m_file);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  dasm_pc_tag - constructor
 //-------------------------------------------------
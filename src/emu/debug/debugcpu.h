@@ -15,7 +15,9 @@
 
 #include "express.h"
 
+#include <array>
 #include <set>
+#include <unordered_map>
 
 
 //**************************************************************************
@@ -115,8 +117,6 @@ public:
 
 	private:
 		device_debug * m_debugInterface;                 // the interface we were created from
-		memory_passthrough_handler *m_phr;               // passthrough handler reference, read access
-		memory_passthrough_handler *m_phw;               // passthrough handler reference, write access
 		address_space &      m_space;                    // address space
 		int                  m_index;                    // user reported index
 		bool                 m_enabled;                  // enabled?
@@ -125,13 +125,10 @@ public:
 		offs_t               m_length;                   // length of watch area
 		parsed_expression    m_condition;                // condition
 		std::string          m_action;                   // action
-		int                  m_notifier;                 // address map change notifier id
 
 		offs_t               m_start_address[3];         // the start addresses of the checks to install
 		offs_t               m_end_address[3];           // the end addresses
 		u64                  m_masks[3];                 // the access masks
-		bool                 m_installing;               // prevent recursive multiple installs
-		void install(read_or_write mode);
 		void triggered(read_or_write type, offs_t address, u64 data, u64 mem_mask);
 	};
 
@@ -272,7 +269,7 @@ public:
 	void track_mem_data_clear() { m_track_mem_set.clear(); }
 
 	// tracing
-	void trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action);
+	void trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, bool binary, const char *action);
 	void trace_printf(const char *fmt, ...) ATTR_PRINTF(2,3);
 	void trace_flush() { if (m_trace != nullptr) m_trace->flush(); }
 
@@ -297,6 +294,10 @@ private:
 	void reinstall_all(read_or_write mode);
 	void reinstall(address_space &space, read_or_write mode);
 	void write_tracking(address_space &space, offs_t address, u64 data);
+	void watchpoint_attach(watchpoint &wp);
+	void watchpoint_detach(watchpoint &wp);
+	void watchpoint_install_taps(address_space &space, int rw);
+	void watchpoint_dispatch(int spacenum, int rw, offs_t address, u64 data, u64 mem_mask);
 
 	// symbol get/set callbacks
 	static u64 get_current_pc(symbol_table &table);
@@ -338,6 +339,8 @@ private:
 
 	// breakpoints and watchpoints
 	std::forward_list<breakpoint> m_bplist;             // list of breakpoints
+	std::vector<std::pair<offs_t, breakpoint *>> m_bpaddrs; // breakpoints sorted by address, in list order within an address
+	std::array<u64, 64>     m_bpfilter;                 // one bit per low 12 bits of an address with breakpoints
 	std::vector<std::vector<std::unique_ptr<watchpoint>>> m_wplist;  // watchpoint lists for each address space
 	std::forward_list<registerpoint> m_rplist;          // list of registerpoints
 
@@ -348,7 +351,7 @@ private:
 	class tracer
 	{
 	public:
-		tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action);
+		tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, bool binary, const char *action);
 		~tracer();
 
 		void update(offs_t pc);
@@ -358,6 +361,26 @@ private:
 
 	private:
 		static const int TRACE_LOOPS = 64;
+		static constexpr size_t BINARY_BLOCK_SIZE = 65536;
+		static constexpr size_t DASM_CACHE_LIMIT = 65536;
+
+		// decoded instruction remembered for binary tracing
+		struct cached_instruction
+		{
+			u32                 m_info;                     // disassembler result flags and length
+			std::vector<u8>     m_bytes;                    // opcode bytes as seen when it was decoded
+		};
+
+		// block of binary trace data handed to the writer thread
+		struct binary_block
+		{
+			FILE *              m_file;                     // file to write to
+			std::vector<u8>     m_data;                     // records to write
+		};
+
+		void binary_text(const char *text, size_t length);
+		void binary_submit();
+		static void *binary_write_callback(void *param, int threadid);
 
 		device_debug &      m_debug;                    // reference to our owner
 		FILE &              m_file;                     // tracing file for this CPU
@@ -371,6 +394,11 @@ private:
 		offs_t              m_trace_over_target;        // target for tracing over
 														//    (0 = not tracing over,
 														//    ~0 = not currently tracing over)
+		bool                m_binary;                   // true if writing binary records for offline decoding
+		std::vector<u8>     m_binary_buffer;            // binary records not yet handed to the writer
+		std::vector<u8>     m_binary_bytes;             // scratch buffer for opcode bytes
+		std::unordered_map<offs_t, cached_instruction> m_dasm_cache; // instruction info by PC
+		osd_work_queue *    m_binary_queue;             // writer thread for binary records
 	};
 	std::unique_ptr<tracer>                m_trace;                    // tracer state
 
@@ -389,6 +417,23 @@ private:
 	std::vector<memory_passthrough_handler *> m_phw;    // passthrough handler reference for each space, write mode
 	std::vector<int>        m_notifiers;                // notifiers for each space
 
+	// watchpoint taps, merged per space and access type
+	struct watchpoint_range
+	{
+		offs_t              m_start;                    // first address of the range
+		offs_t              m_end;                      // last address of the range
+		u64                 m_mask;                     // data lanes watched within the range
+		watchpoint *        m_wp;                       // watchpoint to notify
+	};
+	using watchpoint_range_list = std::vector<watchpoint_range>;
+	struct watchpoint_taps
+	{
+		std::shared_ptr<watchpoint_range_list const> m_ranges[2];  // watched ranges, read and write
+		memory_passthrough_handler *m_ph[2];            // passthrough handler reference, read and write
+	};
+	std::vector<watchpoint_taps> m_wptaps;              // watchpoint taps for each space
+	bool                    m_wpinstalling;             // prevent recursive tap installs
+
 	// pc tracking
 	class dasm_pc_tag
 	{
@@ -560,6 +605,7 @@ public:
 	// getters
 	bool within_instruction_hook() const { return m_within_instruction_hook; }
 	bool memory_modified() const { return m_memory_modified; }
+	u32 memory_generation() const { return m_memory_generation; }
 	exec_state execution_state() const { return m_execution_state; }
 	device_t *live_cpu() { return m_livecpu; }
 	u32 get_breakpoint_index() { return m_bpindex++; }
@@ -571,6 +617,7 @@ public:
 	void set_break_cpu(device_t * breakcpu) { m_breakcpu = breakcpu; }
 	void set_within_instruction(bool within_instruction) { m_within_instruction_hook = within_instruction; }
 	void set_memory_modified(bool memory_modified) { m_memory_modified = memory_modified; }
+	void bump_memory_generation() { m_memory_generation++; }
 	void set_execution_stopped() { m_execution_state = exec_state::STOPPED; }
 	void set_execution_running() { m_execution_state = exec_state::RUNNING; }
 	void set_wpinfo(offs_t address, u64 data) { m_wpaddr = address; m_wpdata = data; }
@@ -614,10 +661,12 @@ private:
 	device_t *  m_breakcpu;
 
 	std::unique_ptr<symbol_table> m_symtable;           // global symbol table
+	std::unordered_map<std::string, device_t *> m_expression_devices; // devices looked up by expression memory accesses
 
 	bool        m_within_instruction_hook;
 	bool        m_vblank_occurred;
 	bool        m_memory_modified;
+	u32         m_memory_generation;    // bumped when memory or registers may have changed
 
 	exec_state  m_execution_state;
 	device_t *  m_stop_when_not_device; // stop execution when the device ceases to be this
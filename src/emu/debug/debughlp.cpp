@@ -859,7 +859,7 @@ static const help_item static_help_list[] =
 	{
 		"trace",
 		"\n"
-		"  trace {<filename>|OFF}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  trace {<filename>|OFF}[,<CPU>[,[noloop|logerror|binary][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing of the execution of the specified <CPU>. If <CPU> is omitted, "
 		"the currently active CPU is specified. When enabling tracing, specify the filename in the "
@@ -867,7 +867,9 @@ static const help_item static_help_list[] =
 		"<detectloops> should be either true or false. If 'noloop' is omitted, the trace "
 		"will have loops detected and condensed to a single line. If 'noloop' is specified, the trace "
 		"will contain every opcode as it is executed. If 'logerror' is specified, logerror output "
-		"will augment the trace.  If you "
+		"will augment the trace. If 'binary' is specified, compact binary records are written in the "
+		"background instead of disassembled text; use 'unidasm <filename> -arch <architecture> -trace' "
+		"to decode them.  If you "
 		"wish to log additional information on each trace, you can append an <action> parameter which "
 		"is a command that is executed before each trace is logged. Generally, this is used to include "
 		"a 'tracelog' command. Note that you may need to embed the action within braces { } in order "
@@ -890,6 +892,8 @@ static const help_item static_help_list[] =
 		"\n"
 		"trace starswep.tr,0,logerror|noloop\n"
 		"  Begin tracing the execution of CPU #0, logging output (along with logerror output) to starswep.tr, with loop detection disabled.\n"
+		"\n"		"trace starswep.trb,0,binary|noloop\n"
+		"  Begin tracing the execution of CPU #0, logging binary records to starswep.trb, with loop detection disabled.\n"
 		"\n"
 		"trace >>pigskin.tr\n"
 		"  Begin tracing the currently active CPU, appending log output to pigskin.tr.\n"
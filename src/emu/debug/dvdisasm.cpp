@@ -48,7 +48,9 @@ debug_view_disasm::debug_view_disasm(running_machine &machine, debug_view_osd_up
 		m_backwards_steps(3),
 		m_dasm_width(DEFAULT_DASM_WIDTH),
 		m_previous_pc(1),
-		m_expression(machine)
+		m_expression(machine),
+		m_dasm_cache_generation(0),
+		m_dasm_cache_valid(false)
 {
 	// fail if no available sources
 	enumerate_sources();
@@ -217,6 +219,28 @@ void debug_view_disasm::view_click(const int button, const debug_view_xy& pos)
 	end_update();
 }
 
+void debug_view_disasm::disassemble(debug_disasm_buffer &buffer, offs_t address, std::string &dasm, offs_t &next_address, offs_t &size)
+{
+	if(m_dasm_cache_valid) {
+		auto const found = m_dasm_cache.find(address);
+		if(found != m_dasm_cache.end()) {
+			dasm = found->second.m_dasm;
+			next_address = found->second.m_next_address;
+			size = found->second.m_size;
+			return;
+		}
+	}
+
+	u32 info;
+	buffer.disassemble(address, dasm, next_address, size, info);
+
+	if(m_dasm_cache_valid) {
+		if(m_dasm_cache.size() >= DASM_CACHE_LIMIT)
+			m_dasm_cache.clear();
+		m_dasm_cache.emplace(address, dasm_cache_entry{ next_address, size, dasm });
+	}
+}
+
 void debug_view_disasm::generate_from_address(debug_disasm_buffer &buffer, offs_t address)
 {
 	m_dasm.clear();
@@ -224,8 +248,7 @@ void debug_view_disasm::generate_from_address(debug_disasm_buffer &buffer, offs_
 		std::string dasm;
 		offs_t size;
 		offs_t next_address;
-		u32 info;
-		buffer.disassemble(address, dasm, next_address, size, info);
+		disassemble(buffer, address, dasm, next_address, size);
 		m_dasm.emplace_back(address, size, dasm);
 		address = next_address;
 	}
@@ -258,8 +281,7 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 			std::string dasm;
 			offs_t size;
 			offs_t next_address;
-			u32 info;
-			buffer.disassemble(address, dasm, next_address, size, info);
+			disassemble(buffer, address, dasm, next_address, size);
 			m_dasm.emplace_back(address, size, dasm);
 			if(intf.pc_real_to_linear(address) > intf.pc_real_to_linear(next_address))
 				return false;
@@ -271,8 +293,7 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 			std::string dasm;
 			offs_t size;
 			offs_t next_address;
-			u32 info;
-			buffer.disassemble(address, dasm, next_address, size, info);
+			disassemble(buffer, address, dasm, next_address, size);
 			m_dasm.emplace_back(address, size, dasm);
 			if(address > next_address)
 				return false;
@@ -290,8 +311,7 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 		std::string dasm;
 		offs_t size;
 		offs_t next_address;
-		u32 info;
-		buffer.disassemble(address, dasm, next_address, size, info);
+		disassemble(buffer, address, dasm, next_address, size);
 		m_dasm.emplace_back(address, size, dasm);
 		address = next_address;
 	}
@@ -347,7 +367,11 @@ void debug_view_disasm::generate_dasm(debug_disasm_buffer &buffer, offs_t pc)
 
 void debug_view_disasm::complete_information(const debug_view_disasm_source &source, debug_disasm_buffer &buffer, offs_t pc)
 {
-	for(auto &dasm : m_dasm) {
+	// only the visible lines are drawn, and the first line sets the address column width
+	int const first = std::max<s32>(m_topleft.y, 0);
+	int const last = std::min<s32>(m_topleft.y + m_visible.y, m_dasm.size());
+	for(int line = 0; line < last; line = std::max(line + 1, first)) {
+		dasm_line &dasm = m_dasm[line];
 		offs_t adr = dasm.m_address;
 
 		dasm.m_tadr = buffer.pc_to_string(adr);
@@ -382,6 +406,14 @@ void debug_view_disasm::view_update()
 	debug_disasm_buffer buffer(*source.device());
 	offs_t pc = source.device()->state().pcbase() & source.m_space.logaddrmask();
 
+	// cached disassembly is only good while the debugger holds everything still
+	debugger_cpu &debugcpu = machine().debugger().cpu();
+	m_dasm_cache_valid = debugcpu.is_stopped();
+	if(!m_dasm_cache_valid || m_dasm_cache_generation != debugcpu.memory_generation()) {
+		m_dasm_cache.clear();
+		m_dasm_cache_generation = debugcpu.memory_generation();
+	}
+
 	generate_dasm(buffer, pc);
 
 	complete_information(source, buffer, pc);
@@ -572,6 +604,7 @@ void debug_view_disasm::set_selected_address(offs_t address)
 void debug_view_disasm::set_source(const debug_view_source &source)
 {
 	if(&source != m_source) {
+		m_dasm_cache.clear();
 		debug_view::set_source(source);
 		m_dasm.clear();
 	}
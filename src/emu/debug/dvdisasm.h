@@ -18,6 +18,8 @@
 
 #include "vecstream.h"
 
+#include <unordered_map>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -109,7 +111,16 @@ private:
 		dasm_line(offs_t address, offs_t size, std::string dasm) : m_address(address), m_size(size), m_dasm(dasm), m_is_pc(false), m_is_bp(false), m_is_visited(false) {}
 	};
 
+	// A disassembled instruction, reused until memory or registers may
+	// have changed.
+	struct dasm_cache_entry {
+		offs_t m_next_address;                  // address of the following instruction
+		offs_t m_size;                          // size of the instruction
+		std::string m_dasm;                     // disassembly
+	};
+
 	// internal helpers
+	void disassemble(debug_disasm_buffer &buffer, offs_t address, std::string &dasm, offs_t &next_address, offs_t &size);
 	void generate_from_address(debug_disasm_buffer &buffer, offs_t address);
 	bool generate_with_pc(debug_disasm_buffer &buffer, offs_t pc);
 	int address_position(offs_t pc) const;
@@ -127,11 +138,15 @@ private:
 	offs_t                 m_previous_pc;          // previous pc, to detect whether it changed
 	debug_view_expression  m_expression;           // expression-related information
 	std::vector<dasm_line> m_dasm;                 // disassembled instructions
+	std::unordered_map<offs_t, dasm_cache_entry> m_dasm_cache; // disassembly by address
+	u32                    m_dasm_cache_generation; // memory generation the cache was built for
+	bool                   m_dasm_cache_valid;     // whether the cache may be used
 
 	// constants
 	static constexpr int DEFAULT_DASM_LINES = 1000;
 	static constexpr int DEFAULT_DASM_WIDTH = 50;
 	static constexpr int DASM_MAX_BYTES = 16;
+	static constexpr size_t DASM_CACHE_LIMIT = 16384;
 };
 
 #endif // MAME_EMU_DEBUG_DVDISASM_H
@@ -114,7 +114,8 @@ debug_view_memory::debug_view_memory(running_machine &machine, debug_view_osd_up
 		m_edit_enabled(true),
 		m_maxaddr(0),
 		m_bytes_per_row(16),
-		m_byte_offset(0)
+		m_byte_offset(0),
+		m_row_cache_generation(0)
 {
 	// hack: define some sane init values
 	// that don't hurt the initial computation of top_left
@@ -272,6 +273,15 @@ void debug_view_memory::view_update()
 	// get positional data
 	const memory_view_pos &posdata = s_memory_pos_table[m_data_format];
 
+	// rows read earlier are still good if the debugger has held everything still since
+	debugger_cpu &debugcpu = machine().debugger().cpu();
+	bool const cache_rows = debugcpu.is_stopped() && (m_data_format <= 8);
+	if (!cache_rows || (m_row_cache_generation != debugcpu.memory_generation()) || (m_row_cache.size() >= ROW_CACHE_LIMIT))
+	{
+		m_row_cache.clear();
+		m_row_cache_generation = debugcpu.memory_generation();
+	}
+
 	// loop over visible rows
 	for (u32 row = 0; row < m_visible.y; row++)
 	{
@@ -309,6 +319,20 @@ void debug_view_memory::view_update()
 				if (dest >= destmin && dest < destmax)
 					dest->byte = addrtext[ch];
 
+			// read the row, unless we already have it
+			std::pair<u64, bool> const *rowchunks = nullptr;
+			if (cache_rows)
+			{
+				std::vector<std::pair<u64, bool> > &cached = m_row_cache[address];
+				if (cached.empty())
+				{
+					cached.resize(m_chunks_per_row);
+					for (int chunknum = 0; chunknum < m_chunks_per_row; chunknum++)
+						cached[chunknum].second = read_chunk(address, chunknum, cached[chunknum].first);
+				}
+				rowchunks = &cached[0];
+			}
+
 			// generate the data and the ascii string
 			std::string chunkascii;
 			for (int chunknum = 0; chunknum < m_chunks_per_row; chunknum++)
@@ -318,7 +342,14 @@ void debug_view_memory::view_update()
 
 				if (m_data_format <= 8) {
 					u64 chunkdata;
-					bool ismapped = read_chunk(address, chunknum, chunkdata);
+					bool ismapped;
+					if (rowchunks)
+					{
+						chunkdata = rowchunks[chunknum].first;
+						ismapped = rowchunks[chunknum].second;
+					}
+					else
+						ismapped = read_chunk(address, chunknum, chunkdata);
 					dest = destrow + m_section[1].m_pos + 1 + chunkindex * spacing;
 					for (int ch = 0; ch < posdata.m_spacing; ch++, dest++)
 						if (dest >= destmin && dest < destmax)
@@ -557,6 +588,9 @@ void debug_view_memory::recompute()
 	// get the current cursor position
 	cursor_pos pos = get_cursor_pos(m_cursor);
 
+	// the layout is changing, so rows read before no longer line up
+	m_row_cache.clear();
+
 	// determine the maximum address and address format string from the raw information
 	int addrchars;
 	u64 maxbyte;
@@ -916,6 +950,7 @@ void debug_view_memory::write(u8 size, offs_t offs, u64 data)
 	if (offs >= (source.m_blocklength * source.m_numblocks))
 		return;
 	*(reinterpret_cast<u8 *>(source.m_base) + (offs / source.m_blocklength * source.m_blockstride) + (offs % source.m_blocklength)) = data;
+	machine().debugger().cpu().bump_memory_generation();
 
 // hack for FD1094 editing
 #ifdef FD1094_HACK
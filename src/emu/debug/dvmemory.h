@@ -17,6 +17,10 @@
 
 #include "softfloat3/source/include/softfloat.h"
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -119,6 +123,8 @@ private:
 	u32                 m_bytes_per_row;        // (derived) number of bytes displayed per line
 	u32                 m_byte_offset;          // (derived) offset of starting visible byte
 	std::string         m_addrformat;           // (derived) format string to use to print addresses
+	std::unordered_map<offs_t, std::vector<std::pair<u64, bool> > > m_row_cache; // chunk values and mapped flags by row address
+	u32                 m_row_cache_generation; // memory generation the row cache was read at
 
 	struct section
 	{
@@ -137,6 +143,7 @@ private:
 
 	// constants
 	static constexpr int MEM_MAX_LINE_WIDTH = 1024;
+	static constexpr size_t ROW_CACHE_LIMIT = 4096;
 };
 
 #endif // MAME_EMU_DEBUG_DVMEMORY_H
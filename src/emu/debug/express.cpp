@@ -98,7 +98,12 @@ enum
 	TVL_ASSIGNBOR,
 	TVL_COMMA,
 	TVL_MEMORYAT,
-	TVL_EXECUTEFUNC
+	TVL_EXECUTEFUNC,
+
+	// operand pushes used by compiled programs
+	TVL_PUSHNUMBER,
+	TVL_PUSHSYMBOL,
+	TVL_MEMORYADDR
 };
 
 
@@ -566,6 +571,9 @@ void parsed_expression::parse(const char *expression)
 
 	// convert the infix order to postfix order
 	infix_to_postfix();
+
+	// compile it if it's simple enough
+	compile_tokens();
 }
 
 
@@ -577,6 +585,7 @@ void parsed_expression::copy(const parsed_expression &src)
 {
 	m_symtable = src.m_symtable;
 	m_original_string.assign(src.m_original_string);
+	m_program.clear();
 	if (!m_original_string.empty())
 		parse_string_into_tokens();
 }
@@ -1654,6 +1663,293 @@ u64 parsed_expression::execute_tokens()
 
 
 
+//-------------------------------------------------
+//  compile_tokens - turn a postfix sequence of
+//  symbols, memory accesses and assignments into
+//  a flat program, so evaluating it doesn't have
+//  to push and pop whole tokens
+//-------------------------------------------------
+
+void parsed_expression::compile_tokens()
+{
+	m_program.clear();
+
+	// anything with increments, functions or strings is left to execute_tokens; for each
+	// stack slot, track the step that pushed it so assignments can turn it into an lval
+	std::vector<program_step> program;
+	std::vector<int> slots;
+	program.reserve(m_tokenlist.count());
+	int depth = 0, maxdepth = 0, side_effect_reads = 0;
+	for (parse_token &token : m_tokenlist)
+	{
+		program_step step = { 0, false, 0, EXPSPACE_PROGRAM_LOGICAL, token.offset(), 0, nullptr, nullptr };
+		if (token.is_number())
+		{
+			step.op = TVL_PUSHNUMBER;
+			step.value = token.value();
+			slots.push_back(program.size());
+			depth++;
+		}
+		else if (token.is_symbol() && !token.symbol()->is_function())
+		{
+			step.op = TVL_PUSHSYMBOL;
+			step.symbol = token.symbol();
+			slots.push_back(program.size());
+			depth++;
+		}
+		else if (token.is_operator())
+		{
+			step.op = token.optype();
+			switch (step.op)
+			{
+				case TVL_COMPLEMENT:
+				case TVL_NOT:
+				case TVL_UPLUS:
+				case TVL_UMINUS:
+					if (depth < 1)
+						return;
+					slots.back() = -1;
+					break;
+
+				case TVL_MEMORYAT:
+					// reads happen when the address is known rather than when the value is
+					// used, so only allow one read that can have side effects
+					if ((depth < 1) || (!token.memory_side_effects() && (++side_effect_reads > 1)))
+						return;
+					step.disable_se = token.memory_side_effects();
+					step.size = 1 << token.memory_size();
+					step.space = token.memory_space();
+					step.string = token.memory_source();
+					slots.back() = program.size();
+					break;
+
+				case TVL_ASSIGN:
+				case TVL_ASSIGNMULTIPLY:
+				case TVL_ASSIGNDIVIDE:
+				case TVL_ASSIGNMODULO:
+				case TVL_ASSIGNADD:
+				case TVL_ASSIGNSUBTRACT:
+				case TVL_ASSIGNLSHIFT:
+				case TVL_ASSIGNRSHIFT:
+				case TVL_ASSIGNBAND:
+				case TVL_ASSIGNBXOR:
+				case TVL_ASSIGNBOR:
+				{
+					if ((depth < 2) || (slots[depth - 2] < 0))
+						return;
+
+					// a read left beneath the operands would happen before this write instead of after it
+					for (int slot = 0; slot < depth - 2; slot++)
+						if ((slots[slot] >= 0) && (program[slots[slot]].op == TVL_MEMORYAT))
+							return;
+
+					// the target keeps only what the write needs on the stack
+					program_step &target = program[slots[depth - 2]];
+					if (target.op == TVL_PUSHSYMBOL && target.symbol->is_lval())
+					{
+						step.symbol = target.symbol;
+						target.op = TVL_PUSHNUMBER;
+						target.value = 0;
+						target.symbol = nullptr;
+					}
+					else if (target.op == TVL_MEMORYAT)
+					{
+						step.disable_se = target.disable_se;
+						step.size = target.size;
+						step.space = target.space;
+						step.string = target.string;
+						target.op = TVL_MEMORYADDR;
+					}
+					else
+					{
+						return;
+					}
+					slots.pop_back();
+					slots.back() = -1;
+					depth--;
+					break;
+				}
+
+				case TVL_COMMA:
+					if (token.is_function_separator())
+						return;
+					// fall through
+				case TVL_MULTIPLY:
+				case TVL_DIVIDE:
+				case TVL_MODULO:
+				case TVL_ADD:
+				case TVL_SUBTRACT:
+				case TVL_LSHIFT:
+				case TVL_RSHIFT:
+				case TVL_LESS:
+				case TVL_LESSOREQUAL:
+				case TVL_GREATER:
+				case TVL_GREATEROREQUAL:
+				case TVL_EQUAL:
+				case TVL_NOTEQUAL:
+				case TVL_BAND:
+				case TVL_BXOR:
+				case TVL_BOR:
+				case TVL_LAND:
+				case TVL_LOR:
+					if (depth < 2)
+						return;
+					slots.pop_back();
+					slots.back() = -1;
+					depth--;
+					break;
+
+				default:
+					return;
+			}
+		}
+		else
+		{
+			return;
+		}
+		maxdepth = std::max(depth, maxdepth);
+		program.push_back(step);
+	}
+
+	// the program must leave exactly one result
+	if (depth != 1)
+		return;
+	m_program = std::move(program);
+	m_program_stack.resize(maxdepth);
+}
+
+
+//-------------------------------------------------
+//  execute_program - run a compiled expression
+//-------------------------------------------------
+
+u64 parsed_expression::execute_program()
+{
+	u64 *const base = &m_program_stack[0];
+	u64 *sp = base;
+	for (const program_step &step : m_program)
+	{
+		switch (step.op)
+		{
+			case TVL_PUSHNUMBER:        *sp++ = step.value;                         break;
+			case TVL_PUSHSYMBOL:        *sp++ = step.symbol->value();               break;
+
+			case TVL_COMPLEMENT:        sp[-1] = !sp[-1];                           break;
+			case TVL_NOT:               sp[-1] = ~sp[-1];                           break;
+			case TVL_UPLUS:                                                         break;
+			case TVL_UMINUS:            sp[-1] = -sp[-1];                           break;
+
+			case TVL_MEMORYAT:
+				sp[-1] = m_symtable ? m_symtable->memory_value(step.string, step.space, u32(sp[-1]), step.size, step.disable_se) : 0;
+				break;
+
+			case TVL_MEMORYADDR:                                                    break;
+
+			case TVL_ASSIGN:
+				sp--;
+				set_program_lval(step, sp[-1], sp[0]);
+				sp[-1] = sp[0];
+				break;
+
+			case TVL_ASSIGNMULTIPLY:
+			case TVL_ASSIGNDIVIDE:
+			case TVL_ASSIGNMODULO:
+			case TVL_ASSIGNADD:
+			case TVL_ASSIGNSUBTRACT:
+			case TVL_ASSIGNLSHIFT:
+			case TVL_ASSIGNRSHIFT:
+			case TVL_ASSIGNBAND:
+			case TVL_ASSIGNBXOR:
+			case TVL_ASSIGNBOR:
+			{
+				sp--;
+				u64 const rval = sp[0];
+				if ((rval == 0) && (step.op == TVL_ASSIGNDIVIDE || step.op == TVL_ASSIGNMODULO))
+					throw expression_error(expression_error::DIVIDE_BY_ZERO, step.offset);
+				u64 result = get_program_lval(step, sp[-1]);
+				switch (step.op)
+				{
+					case TVL_ASSIGNMULTIPLY:    result *= rval;     break;
+					case TVL_ASSIGNDIVIDE:      result /= rval;     break;
+					case TVL_ASSIGNMODULO:      result %= rval;     break;
+					case TVL_ASSIGNADD:         result += rval;     break;
+					case TVL_ASSIGNSUBTRACT:    result -= rval;     break;
+					case TVL_ASSIGNLSHIFT:      result <<= rval;    break;
+					case TVL_ASSIGNRSHIFT:      result >>= rval;    break;
+					case TVL_ASSIGNBAND:        result &= rval;     break;
+					case TVL_ASSIGNBXOR:        result ^= rval;     break;
+					case TVL_ASSIGNBOR:         result |= rval;     break;
+				}
+				set_program_lval(step, sp[-1], result);
+				sp[-1] = result;
+				break;
+			}
+
+			case TVL_DIVIDE:
+				if (sp[-1] == 0)
+					throw expression_error(expression_error::DIVIDE_BY_ZERO, step.offset);
+				sp--; sp[-1] = sp[-1] / sp[0];
+				break;
+
+			case TVL_MODULO:
+				if (sp[-1] == 0)
+					throw expression_error(expression_error::DIVIDE_BY_ZERO, step.offset);
+				sp--; sp[-1] = sp[-1] % sp[0];
+				break;
+
+			case TVL_MULTIPLY:          sp--; sp[-1] = sp[-1] * sp[0];              break;
+			case TVL_ADD:               sp--; sp[-1] = sp[-1] + sp[0];              break;
+			case TVL_SUBTRACT:          sp--; sp[-1] = sp[-1] - sp[0];              break;
+			case TVL_LSHIFT:            sp--; sp[-1] = sp[-1] << sp[0];             break;
+			case TVL_RSHIFT:            sp--; sp[-1] = sp[-1] >> sp[0];             break;
+			case TVL_LESS:              sp--; sp[-1] = sp[-1] < sp[0];              break;
+			case TVL_LESSOREQUAL:       sp--; sp[-1] = sp[-1] <= sp[0];             break;
+			case TVL_GREATER:           sp--; sp[-1] = sp[-1] > sp[0];              break;
+			case TVL_GREATEROREQUAL:    sp--; sp[-1] = sp[-1] >= sp[0];             break;
+			case TVL_EQUAL:             sp--; sp[-1] = sp[-1] == sp[0];             break;
+			case TVL_NOTEQUAL:          sp--; sp[-1] = sp[-1] != sp[0];             break;
+			case TVL_BAND:              sp--; sp[-1] = sp[-1] & sp[0];              break;
+			case TVL_BXOR:              sp--; sp[-1] = sp[-1] ^ sp[0];              break;
+			case TVL_BOR:               sp--; sp[-1] = sp[-1] | sp[0];              break;
+			case TVL_LAND:              sp--; sp[-1] = sp[-1] && sp[0];             break;
+			case TVL_LOR:               sp--; sp[-1] = sp[-1] || sp[0];             break;
+			case TVL_COMMA:             sp--; sp[-1] = sp[0];                       break;
+		}
+	}
+
+	assert(sp == base + 1);
+	return base[0];
+}
+
+
+//-------------------------------------------------
+//  get_program_lval - read the target of a
+//  compiled assignment
+//-------------------------------------------------
+
+inline u64 parsed_expression::get_program_lval(const program_step &step, u64 address)
+{
+	if (step.symbol != nullptr)
+		return step.symbol->value();
+	return m_symtable ? m_symtable->memory_value(step.string, step.space, u32(address), step.size, step.disable_se) : 0;
+}
+
+
+//-------------------------------------------------
+//  set_program_lval - write the target of a
+//  compiled assignment
+//-------------------------------------------------
+
+inline void parsed_expression::set_program_lval(const program_step &step, u64 address, u64 value)
+{
+	if (step.symbol != nullptr)
+		step.symbol->set_value(value);
+	else if (m_symtable != nullptr)
+		m_symtable->set_memory_value(step.string, step.space, u32(address), step.size, value, step.disable_se);
+}
+
+
+
 //**************************************************************************
 //  PARSE TOKEN
 //**************************************************************************
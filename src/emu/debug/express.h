@@ -19,6 +19,7 @@
 #include <functional>
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 
 
@@ -228,7 +229,7 @@ public:
 
 	// execution
 	void parse(const char *string);
-	u64 execute() { return execute_tokens(); }
+	u64 execute() { return m_program.empty() ? execute_tokens() : execute_program(); }
 
 private:
 	// a single token
@@ -292,6 +293,7 @@ private:
 		expression_space memory_space() const { assert(m_type == OPERATOR || m_type == MEMORY); return expression_space((m_flags & TIN_MEMORY_SPACE_MASK) >> TIN_MEMORY_SPACE_SHIFT); }
 		int memory_size() const { assert(m_type == OPERATOR || m_type == MEMORY); return (m_flags & TIN_MEMORY_SIZE_MASK) >> TIN_MEMORY_SIZE_SHIFT; }
 		bool memory_side_effects() const { assert(m_type == OPERATOR || m_type == MEMORY); return (m_flags & TIN_SIDE_EFFECT_MASK) >> TIN_SIDE_EFFECT_SHIFT; }
+		const char *memory_source() const { assert(m_type == OPERATOR || m_type == MEMORY); return m_string; }
 
 		// setters
 		parse_token &set_offset(int offset) { m_offset = offset; return *this; }
@@ -326,6 +328,19 @@ private:
 		symbol_entry *          m_symbol;           // symbol pointer
 	};
 
+	// a single step of a compiled expression
+	struct program_step
+	{
+		u8                  op;                 // operator, or one of the operand pushes
+		bool                disable_se;         // memory accesses: side effects disabled
+		int                 size;               // memory accesses: access size in bytes
+		expression_space    space;              // memory accesses: address space
+		int                 offset;             // offset within the string
+		u64                 value;              // numbers: the value
+		symbol_entry *      symbol;             // symbols and symbol assignments: the symbol
+		const char *        string;             // memory accesses: source name
+	};
+
 	// internal helpers
 	void copy(const parsed_expression &src);
 	void print_tokens(FILE *out);
@@ -347,6 +362,10 @@ private:
 	void pop_token_rval(parse_token &token);
 	u64 execute_tokens();
 	void execute_function(parse_token &token);
+	void compile_tokens();
+	u64 execute_program();
+	u64 get_program_lval(const program_step &step, u64 address);
+	void set_program_lval(const program_step &step, u64 address, u64 value);
 
 	// constants
 	static const int MAX_FUNCTION_PARAMS = 16;
@@ -357,6 +376,8 @@ private:
 	simple_list<parse_token> m_tokenlist;               // token list
 	std::list<std::string> m_stringlist;                // string list
 	std::deque<parse_token> m_token_stack;              // token stack (used during execution)
+	std::vector<program_step> m_program;                // compiled steps, if the expression could be compiled
+	std::vector<u64>    m_program_stack;                // value stack for the compiled steps
 };
 
 #endif // MAME_EMU_DEBUG_EXPRESS_H
@@ -841,7 +841,7 @@ private:
 		bool m_used = false;
 	};
 
-	std::vector<func_t> m_functions;
+	func_t m_function;
 	std::vector<typename creator::ptr> m_creators;
 
 public:
@@ -859,8 +859,8 @@ public:
 	Result operator()(offs_t offset, std::make_unsigned_t<Result> mem_mask = DefaultMask);
 	Result operator()();
 
-	bool isnull() const { return m_functions.empty() && m_creators.empty(); }
-	explicit operator bool() const { return !m_functions.empty(); }
+	bool isnull() const { return !m_function && m_creators.empty(); }
+	explicit operator bool() const { return bool(m_function); }
 };
 
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
@@ -878,14 +878,14 @@ typename devcb_read<Result, DefaultMask>::binder devcb_read<Result, DefaultMask>
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 void devcb_read<Result, DefaultMask>::reset()
 {
-	assert(m_functions.empty());
+	assert(!m_function);
 	m_creators.clear();
 }
 
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 void devcb_read<Result, DefaultMask>::validity_check(validity_checker &valid) const
 {
-	assert(m_functions.empty());
+	assert(!m_function);
 	devcb_read_base::validity_check(valid);
 	for (typename std::vector<typename creator::ptr>::const_iterator i = m_creators.begin(); m_creators.end() != i; ++i)
 	{
@@ -903,11 +903,30 @@ void devcb_read<Result, DefaultMask>::validity_check(validity_checker &valid) co
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 void devcb_read<Result, DefaultMask>::resolve()
 {
-	assert(m_functions.empty());
+	assert(!m_function);
 	devcb_read_base::resolve();
-	m_functions.reserve(m_creators.size());
-	for (typename creator::ptr const &c : m_creators)
-		m_functions.emplace_back(c->create());
+
+	// collapse the targets into a single callable so invocation is one indirect call
+	if (m_creators.size() == 1)
+	{
+		m_function = m_creators.front()->create();
+	}
+	else if (!m_creators.empty())
+	{
+		std::vector<func_t> functions;
+		functions.reserve(m_creators.size());
+		for (typename creator::ptr const &c : m_creators)
+			functions.emplace_back(c->create());
+		m_function =
+				[functions = std::move(functions)] (address_space &space, offs_t offset, std::make_unsigned_t<Result> mem_mask)
+				{
+					typename std::vector<func_t>::const_iterator it(functions.begin());
+					std::make_unsigned_t<Result> result((*it)(space, offset, mem_mask));
+					while (functions.end() != ++it)
+						result |= (*it)(space, offset, mem_mask);
+					return result;
+				};
+	}
 	m_creators.clear();
 }
 
@@ -915,19 +934,15 @@ template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 void devcb_read<Result, DefaultMask>::resolve_safe(Result dflt)
 {
 	resolve();
-	if (m_functions.empty())
-		m_functions.emplace_back([dflt] (address_space &space, offs_t offset, std::make_unsigned_t<Result> mem_mask) { return dflt; });
+	if (!m_function)
+		m_function = [dflt] (address_space &space, offs_t offset, std::make_unsigned_t<Result> mem_mask) { return dflt; };
 }
 
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 Result devcb_read<Result, DefaultMask>::operator()(address_space &space, offs_t offset, std::make_unsigned_t<Result> mem_mask)
 {
-	assert(m_creators.empty() && !m_functions.empty());
-	typename std::vector<func_t>::const_iterator it(m_functions.begin());
-	std::make_unsigned_t<Result> result((*it)(space, offset, mem_mask));
-	while (m_functions.end() != ++it)
-		result |= (*it)(space, offset, mem_mask);
-	return result;
+	assert(m_creators.empty() && m_function);
+	return m_function(space, offset, mem_mask);
 }
 
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
@@ -2306,7 +2321,7 @@ private:
 		bool m_used = false;
 	};
 
-	std::vector<func_t> m_functions;
+	func_t m_function;
 	std::vector<typename creator::ptr> m_creators;
 
 public:
@@ -2325,8 +2340,8 @@ public:
 	void operator()(offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask = DefaultMask);
 	void operator()(Input data);
 
-	bool isnull() const { return m_functions.empty() && m_creators.empty(); }
-	explicit operator bool() const { return !m_functions.empty(); }
+	bool isnull() const { return !m_function && m_creators.empty(); }
+	explicit operator bool() const { return bool(m_function); }
 };
 
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
@@ -2344,14 +2359,14 @@ typename devcb_write<Input, DefaultMask>::binder devcb_write<Input, DefaultMask>
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::reset()
 {
-	assert(m_functions.empty());
+	assert(!m_function);
 	m_creators.clear();
 }
 
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::validity_check(validity_checker &valid) const
 {
-	assert(m_functions.empty());
+	assert(!m_function);
 	devcb_write_base::validity_check(valid);
 	for (typename creator::ptr const &c : m_creators)
 		c->validity_check(valid);
@@ -2360,11 +2375,27 @@ void devcb_write<Input, DefaultMask>::validity_check(validity_checker &valid) co
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::resolve()
 {
-	assert(m_functions.empty());
+	assert(!m_function);
 	devcb_write_base::resolve();
-	m_functions.reserve(m_creators.size());
-	for (typename creator::ptr const &c : m_creators)
-		m_functions.emplace_back(c->create());
+
+	// collapse the targets into a single callable so invocation is one indirect call
+	if (m_creators.size() == 1)
+	{
+		m_function = m_creators.front()->create();
+	}
+	else if (!m_creators.empty())
+	{
+		std::vector<func_t> functions;
+		functions.reserve(m_creators.size());
+		for (typename creator::ptr const &c : m_creators)
+			functions.emplace_back(c->create());
+		m_function =
+				[functions = std::move(functions)] (address_space &space, offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask)
+				{
+					for (func_t const &f : functions)
+						f(space, offset, data, mem_mask);
+				};
+	}
 	m_creators.clear();
 }
 
@@ -2372,18 +2403,15 @@ template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::resolve_safe()
 {
 	resolve();
-	if (m_functions.empty())
-		m_functions.emplace_back([] (address_space &space, offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask) { });
+	if (!m_function)
+		m_function = [] (address_space &space, offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask) { };
 }
 
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::operator()(address_space &space, offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask)
 {
-	assert(m_creators.empty() && !m_functions.empty());
-	typename std::vector<func_t>::const_iterator it(m_functions.begin());
-	(*it)(space, offset, data, mem_mask);
-	while (m_functions.end() != ++it)
-		(*it)(space, offset, data, mem_mask);
+	assert(m_creators.empty() && m_function);
+	m_function(space, offset, data, mem_mask);
 }
 
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
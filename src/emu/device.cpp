@@ -104,6 +104,9 @@ device_t::device_t(const machine_config &mconfig, device_type type, const char *
 	, m_config_complete(false)
 	, m_started(false)
 	, m_auto_finder_list(nullptr)
+	, m_log_second(0)
+	, m_log_count(0)
+	, m_log_suppressed(0)
 {
 	if (owner != nullptr)
 		m_tag.assign((owner->owner() == nullptr) ? "" : owner->tag()).append(":").append(tag);
@@ -946,6 +949,36 @@ void device_t::register_callback(devcb_base &callback)
 }
 
 
+//-------------------------------------------------
+//  log_rate_check - count a logerror message
+//  against the per-device limit; returns false
+//  if it should be dropped
+//-------------------------------------------------
+
+bool device_t::log_rate_check() const
+{
+	// start a new window each emulated second
+	u32 const second = u32(machine().time().seconds());
+	if (second != m_log_second)
+	{
+		u32 const suppressed = m_log_suppressed;
+		m_log_second = second;
+		m_log_count = 0;
+		m_log_suppressed = 0;
+		if (suppressed)
+			logerror("%u messages suppressed by -lograte\n", suppressed);
+	}
+
+	if (m_log_count >= machine().log_rate())
+	{
+		m_log_suppressed++;
+		return false;
+	}
+	m_log_count++;
+	return true;
+}
+
+
 //**************************************************************************
 //  LIVE DEVICE INTERFACES
 //**************************************************************************
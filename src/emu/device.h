@@ -645,6 +645,9 @@ public:
 	template <typename Format, typename... Params> void logerror(Format &&fmt, Params &&... args) const;
 
 protected:
+	// log rate limiting
+	bool log_rate_check() const;
+
 	// miscellaneous helpers
 	void set_machine(running_machine &machine);
 	void resolve_pre_map();
@@ -839,6 +842,11 @@ private:
 
 	// string formatting buffer for logerror
 	mutable util::ovectorstream m_string_buffer;
+
+	// logerror rate limiting
+	mutable u32             m_log_second;           // emulated second being counted
+	mutable u32             m_log_count;            // messages logged during that second
+	mutable u32             m_log_suppressed;       // messages dropped during that second
 };
 
 
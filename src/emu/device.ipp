@@ -88,16 +88,25 @@ inline void device_t::logerror(Format &&fmt, Params &&... args) const
 {
 	if (m_machine != nullptr && m_machine->allow_logging())
 	{
-		g_profiler.start(PROFILER_LOGERROR);
+		if (m_machine->log_rate() && !log_rate_check())
+			return;
 
-		// dump to the buffer
-		m_string_buffer.clear();
-		m_string_buffer.seekp(0);
-		util::stream_format(m_string_buffer, "[%s] ", tag());
-		util::stream_format(m_string_buffer, std::forward<Format>(fmt), std::forward<Params>(args)...);
-		m_string_buffer.put('\0');
+		g_profiler.start(PROFILER_LOGERROR);
 
-		m_machine->strlog(&m_string_buffer.vec()[0]);
+		// capture for the log file without formatting if possible
+		log_queue *const queue = m_machine->deferred_log();
+		bool const deferred = queue && queue->push(tag(), fmt, args...);
+		if (!deferred || m_machine->immediate_logging())
+		{
+			// dump to the buffer
+			m_string_buffer.clear();
+			m_string_buffer.seekp(0);
+			util::stream_format(m_string_buffer, "[%s] ", tag());
+			util::stream_format(m_string_buffer, std::forward<Format>(fmt), std::forward<Params>(args)...);
+			m_string_buffer.put('\0');
+
+			m_machine->strlog(&m_string_buffer.vec()[0], deferred);
+		}
 
 		g_profiler.stop();
 	}
@@ -93,11 +93,20 @@ device_execute_interface::~device_execute_interface()
 //-------------------------------------------------
 
 void device_execute_interface::abort_timeslice() noexcept
+{
+	abort_timeslice(device_scheduler::ABORT_OTHER);
+}
+
+void device_execute_interface::abort_timeslice(device_scheduler::abort_cause cause) noexcept
 {
 	// ignore if not the executing device
 	if (!executing())
 		return;
 
+	// note why the execution was cut short
+	if (UNEXPECTED(m_scheduler->m_stats))
+		m_scheduler->record_abort(cause);
+
 	// swallow the remaining cycles
 	if (m_icountptr != nullptr)
 	{
@@ -119,7 +128,7 @@ void device_execute_interface::suspend_resume_changed()
 	m_scheduler->suspend_resume_changed();
 
 	// if we're active, synchronize
-	abort_timeslice();
+	abort_timeslice(device_scheduler::ABORT_SUSPEND);
 }
 
 
@@ -169,6 +178,80 @@ void device_execute_interface::spin_until_time(const attotime &duration)
 }
 
 
+//-------------------------------------------------
+//  install_idle_poll - spin until an interrupt or
+//  a write to the location once the device keeps
+//  reading the same value from the same PC; only
+//  for RAM mailboxes which another device writes
+//  through the same address space, as nothing
+//  else wakes the device: not for vblank, status
+//  or other handler-driven flags
+//-------------------------------------------------
+
+namespace {
+
+template <typename T>
+void install_idle_poll_taps(device_execute_interface &exec, address_space &space, offs_t start, offs_t end, int threshold)
+{
+	struct poll_state
+	{
+		T data = 0;
+		offs_t pc = 0;
+		int count = 0;
+	};
+	auto state = std::make_shared<poll_state>();
+	device_state_interface *pcstate = nullptr;
+	exec.device().interface(pcstate);
+	std::string const name = string_format("%s idle poll", exec.device().tag());
+
+	space.install_read_tap(start, end, name,
+			[&exec, pcstate, state, threshold] (offs_t offset, T &data, T mem_mask)
+			{
+				// other devices may poll the same location
+				if (!exec.executing())
+					return;
+
+				offs_t const pc = pcstate ? pcstate->pcbase() : 0;
+				if (state->count == 0 || (data & mem_mask) != state->data || pc != state->pc)
+				{
+					state->data = data & mem_mask;
+					state->pc = pc;
+					state->count = 1;
+				}
+				else if (++state->count >= threshold)
+				{
+					state->count = 0;
+					exec.spin_until_interrupt();
+				}
+			});
+	space.install_write_tap(start, end, name,
+			[&exec, state] (offs_t offset, T &data, T mem_mask)
+			{
+				state->count = 0;
+				exec.signal_interrupt_trigger();
+			});
+}
+
+} // anonymous namespace
+
+void device_execute_interface::install_idle_poll(address_space &space, offs_t address, int threshold)
+{
+	// taps cover whole bus units
+	offs_t const lowbits = (space.data_width() >> (3 - space.addr_shift())) - 1;
+	offs_t const start = address & ~lowbits;
+	offs_t const end = address | lowbits;
+
+	switch (space.data_width())
+	{
+	case 8:  install_idle_poll_taps<u8>(*this, space, start, end, threshold); break;
+	case 16: install_idle_poll_taps<u16>(*this, space, start, end, threshold); break;
+	case 32: install_idle_poll_taps<u32>(*this, space, start, end, threshold); break;
+	case 64: install_idle_poll_taps<u64>(*this, space, start, end, threshold); break;
+	default: throw emu_fatalerror("%s: install_idle_poll: unsupported data width %d\n", device().tag(), space.data_width());
+	}
+}
+
+
 //-------------------------------------------------
 //  suspend_until_trigger - suspend execution
 //  until the given trigger fires
@@ -191,7 +274,7 @@ void device_execute_interface::suspend_until_trigger(int trigid, bool eatcycles)
 void device_execute_interface::trigger(int trigid)
 {
 	// if we're executing, for an immediate abort
-	abort_timeslice();
+	abort_timeslice(device_scheduler::ABORT_TRIGGER);
 
 	// see if this is a matching trigger
 	if ((m_nextsuspend & SUSPEND_REASON_TRIGGER) != 0 && m_trigger == trigid)
@@ -380,8 +463,9 @@ void device_execute_interface::interface_pre_start()
 
 	// fill in the initial states
 	int const index = device_iterator(device().machine().root_device()).indexof(*this);
+	int const execindex = execute_interface_iterator(device().machine().root_device()).indexof(*this);
 	m_suspend = SUSPEND_REASON_RESET;
-	m_profiler = profile_type(index + PROFILER_DEVICE_FIRST);
+	m_profiler = (execindex <= PROFILER_DEVICE_MAX - PROFILER_DEVICE_FIRST) ? profile_type(execindex + PROFILER_DEVICE_FIRST) : g_profiler.register_scope(device().tag());
 	m_inttrigger = index + TRIGGER_INT;
 
 	// allocate timers if we need them
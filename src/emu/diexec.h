@@ -176,6 +176,7 @@ public:
 	void spin_until_trigger(int trigid) { suspend_until_trigger(trigid, true); }
 	void spin_until_time(const attotime &duration);
 	void spin_until_interrupt() { spin_until_trigger(m_inttrigger); }
+	void install_idle_poll(address_space &space, offs_t address, int threshold = 16);
 
 	// triggers
 	void suspend_until_trigger(int trigid, bool eatcycles);
@@ -334,6 +335,7 @@ private:
 	TIMER_CALLBACK_MEMBER(trigger_periodic_interrupt);
 	TIMER_CALLBACK_MEMBER(irq_pulse_clear) { set_input_line(int(param), CLEAR_LINE); }
 	void suspend_resume_changed();
+	void abort_timeslice(device_scheduler::abort_cause cause) noexcept;
 
 	attoseconds_t minimum_quantum() const;
 
@@ -35,10 +35,15 @@ device_vtlb_interface::device_vtlb_interface(const machine_config &mconfig, devi
 		m_dynamic(0),
 		m_fixed(0),
 		m_dynindex(0),
+		m_dynused(0),
 		m_pageshift(0),
 		m_addrwidth(0),
-		m_table_base(nullptr)
+		m_table_base(nullptr),
+		m_generation(1),
+		m_victimindex(0)
 {
+	for (victim_entry &victim : m_victims)
+		victim = victim_entry{ 0, 0, 0 };
 }
 
 
@@ -133,6 +138,18 @@ void device_vtlb_interface::interface_pre_reset()
 }
 
 
+//-------------------------------------------------
+//  interface_post_load - the restored table may
+//  not match what the victims were evicted from
+//-------------------------------------------------
+
+void device_vtlb_interface::interface_post_load()
+{
+	m_dynused = m_dynamic;
+	flush_victims();
+}
+
+
 //**************************************************************************
 //  FILLING
 //**************************************************************************
@@ -164,6 +181,24 @@ bool device_vtlb_interface::vtlb_fill(offs_t address, int intention)
 		return false;
 	}
 
+	// an entry evicted since the last flush is still a valid translation, so put it back
+	if ((entry & VTLB_FLAGS_MASK) == 0)
+	{
+		entry = recover_victim(tableindex);
+		if (entry != 0)
+		{
+			claim_dynamic(tableindex);
+			m_table[tableindex] = entry;
+			if (entry & (1 << (intention & (TRANSLATE_TYPE_MASK | TRANSLATE_USER_MASK))))
+			{
+#if PRINTF_TLB
+				osd_printf_debug("success (%08X), victim entry\n", entry & ~VTLB_FLAGS_MASK);
+#endif
+				return true;
+			}
+		}
+	}
+
 	// ask the CPU core to translate for us
 	taddress = address;
 	if (!device().memory().translate(m_space, intention, taddress))
@@ -177,21 +212,8 @@ bool device_vtlb_interface::vtlb_fill(offs_t address, int intention)
 	// if this is the first successful translation for this address, allocate a new entry
 	if ((entry & VTLB_FLAGS_MASK) == 0)
 	{
-		int liveindex = m_dynindex++ % m_dynamic;
-
-
-		// if an entry already exists at this index, free it
-		if (m_live[liveindex] != 0)
-		{
-			if (m_refcnt[m_live[liveindex] - 1] <= 1)
-				m_table[m_live[liveindex] - 1] = 0;
-			else
-				m_refcnt[m_live[liveindex] - 1]--;
-		}
-
-
-		// claim this new entry
-		m_live[liveindex] = tableindex + 1;
+		// claim a dynamic entry, freeing the oldest one
+		claim_dynamic(tableindex);
 
 		// form a new blank entry
 		entry = (taddress >> m_pageshift) << m_pageshift;
@@ -254,6 +276,9 @@ void device_vtlb_interface::vtlb_load(int entrynum, int numpages, offs_t address
 	m_live[liveindex] = tableindex + 1;
 	m_refcnt[tableindex]++;
 
+	// victims may cover the pages being replaced
+	flush_victims();
+
 	// store the raw value, making sure the "fixed" flag is set
 	value |= VTLB_FLAG_FIXED;
 	m_fixedpages[entrynum] = numpages;
@@ -278,6 +303,8 @@ void device_vtlb_interface::vtlb_dynload(u32 index, offs_t address, vtlb_entry v
 	}
 
 	int liveindex = m_dynindex++ % m_dynamic;
+	if (m_dynused < m_dynamic)
+		m_dynused++;
 	// is entry already live?
 	if (!(entry & VTLB_FLAG_VALID))
 	{
@@ -298,6 +325,76 @@ void device_vtlb_interface::vtlb_dynload(u32 index, offs_t address, vtlb_entry v
 	m_table[index] = entry;
 }
 
+//-------------------------------------------------
+//  claim_dynamic - take the next dynamic entry
+//  for a table index, retiring its old contents
+//  to the victims
+//-------------------------------------------------
+
+void device_vtlb_interface::claim_dynamic(offs_t tableindex)
+{
+	int liveindex = m_dynindex++ % m_dynamic;
+	if (m_dynused < m_dynamic)
+		m_dynused++;
+
+	// if an entry already exists at this index, free it
+	if (m_live[liveindex] != 0)
+	{
+		offs_t const oldindex = m_live[liveindex] - 1;
+		if (m_refcnt[oldindex] <= 1)
+		{
+			vtlb_entry const old = m_table[oldindex];
+			if ((old & (VTLB_FLAG_VALID | VTLB_FLAG_FIXED)) == VTLB_FLAG_VALID)
+			{
+				victim_entry &victim = m_victims[m_victimindex++ % VTLB_VICTIM_ENTRIES];
+				victim.index = oldindex;
+				victim.entry = old;
+				victim.generation = m_generation;
+			}
+			m_table[oldindex] = 0;
+		}
+		else
+			m_refcnt[oldindex]--;
+	}
+
+	// claim this new entry
+	m_live[liveindex] = tableindex + 1;
+}
+
+
+//-------------------------------------------------
+//  recover_victim - find an entry evicted from a
+//  table index since the last flush
+//-------------------------------------------------
+
+vtlb_entry device_vtlb_interface::recover_victim(offs_t tableindex)
+{
+	for (victim_entry &victim : m_victims)
+		if (victim.index == tableindex && victim.generation == m_generation)
+		{
+			victim.generation = 0;
+			return victim.entry;
+		}
+	return 0;
+}
+
+
+//-------------------------------------------------
+//  flush_victims - invalidate all victim entries
+//  by moving to a new generation
+//-------------------------------------------------
+
+void device_vtlb_interface::flush_victims()
+{
+	if (++m_generation == 0)
+	{
+		for (victim_entry &victim : m_victims)
+			victim.generation = 0;
+		m_generation = 1;
+	}
+}
+
+
 //**************************************************************************
 //  FLUSHING
 //**************************************************************************
@@ -313,14 +410,19 @@ void device_vtlb_interface::vtlb_flush_dynamic()
 	osd_printf_debug("vtlb_flush_dynamic\n");
 #endif
 
-	// loop over live entries and release them from the table
-	for (int liveindex = 0; liveindex < m_dynamic; liveindex++)
+	// entries are claimed in order after a flush, so only those used since can be live
+	for (int liveindex = 0; liveindex < m_dynused; liveindex++)
 		if (m_live[liveindex] != 0)
 		{
 			offs_t tableindex = m_live[liveindex] - 1;
 			m_table[tableindex] = 0;
 			m_live[liveindex] = 0;
 		}
+	m_dynindex = 0;
+	m_dynused = 0;
+
+	// retire every victim at once
+	flush_victims();
 }
 
 
@@ -339,20 +441,11 @@ void device_vtlb_interface::vtlb_flush_address(offs_t address)
 
 	// free the entry in the table; for speed, we leave the entry in the live array
 	m_table[tableindex] = 0;
-}
 
+	// make sure it can't come back from the victims
+	for (victim_entry &victim : m_victims)
+		if (victim.index == tableindex)
+			victim.generation = 0;
+}
 
 
-//**************************************************************************
-//  ACCESSORS
-//**************************************************************************
-
-//-------------------------------------------------
-//  vtlb_table - return a pointer to the base of
-//  the linear VTLB lookup table
-//-------------------------------------------------
-
-const vtlb_entry *device_vtlb_interface::vtlb_table() const
-{
-	return m_table_base;
-}
@@ -30,6 +30,8 @@ constexpr u32 VTLB_USER_WRITE_ALLOWED   = 0x20;     /* (1 << TRANSLATE_WRITE_USE
 constexpr u32 VTLB_USER_FETCH_ALLOWED   = 0x40;     /* (1 << TRANSLATE_FETCH_USER) */
 constexpr u32 VTLB_FLAG_FIXED           = 0x80;
 
+constexpr int VTLB_VICTIM_ENTRIES       = 8;        /* evicted dynamic entries kept for refilling */
+
 
 
 /***************************************************************************
@@ -62,8 +64,11 @@ public:
 	void vtlb_flush_dynamic();
 	void vtlb_flush_address(offs_t address);
 
-	// accessors
-	const vtlb_entry *vtlb_table() const;
+	// accessors; the table is flat and indexed by address >> page shift, so DRC
+	// backends can load entries directly from generated code
+	const vtlb_entry *vtlb_table() const { return m_table_base; }
+	int vtlb_page_shift() const { return m_pageshift; }
+	vtlb_entry vtlb_lookup(offs_t address) const { return m_table_base[address >> m_pageshift]; }
 
 protected:
 	// interface-level overrides
@@ -71,13 +76,27 @@ protected:
 	virtual void interface_pre_start() override;
 	virtual void interface_post_start() override;
 	virtual void interface_pre_reset() override;
+	virtual void interface_post_load() override;
 
 private:
+	// a dynamic entry evicted to make room, valid until the next flush
+	struct victim_entry
+	{
+		offs_t          index;              // table index
+		vtlb_entry      entry;              // entry as it was in the table
+		u32             generation;         // flush generation it belongs to
+	};
+
+	void claim_dynamic(offs_t tableindex);
+	vtlb_entry recover_victim(offs_t tableindex);
+	void flush_victims();
+
 	// private state
 	int    m_space;            // address space
 	int                 m_dynamic;          // number of dynamic entries
 	int                 m_fixed;            // number of fixed entries
 	int                 m_dynindex;         // index of next dynamic entry
+	int                 m_dynused;          // dynamic entries claimed since the last flush
 	int                 m_pageshift;        // bits to shift to get page index
 	int                 m_addrwidth;        // logical address bus width
 	std::vector<offs_t> m_live;             // array of live entries by table index
@@ -85,6 +104,9 @@ private:
 	std::vector<vtlb_entry> m_table;        // table of entries by address
 	std::vector<offs_t> m_refcnt;           // table of entry reference counts by address
 	vtlb_entry          *m_table_base;      // pointer to m_table[0]
+	u32                 m_generation;       // bumped on every dynamic flush
+	int                 m_victimindex;      // next victim entry to replace
+	victim_entry        m_victims[VTLB_VICTIM_ENTRIES];
 };
 
 
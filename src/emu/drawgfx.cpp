@@ -392,9 +392,9 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 			return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
 	}
 
-	// render
+	// render; the unconditional store lets the compiler vectorize this as a blend
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { destp = (srcp != trans_pen) ? u16(color + srcp) : destp; });
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -440,8 +440,8 @@ void gfx_element::transpen_raw(bitmap_ind16 &dest, const rectangle &cliprect,
 	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
 		return;
 
-	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	// render; the unconditional store lets the compiler vectorize this as a blend
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { destp = (srcp != trans_pen) ? u16(color + srcp) : destp; });
 }
 
 void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -490,6 +490,9 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 		// non-flipped 8bpp case
 		if (!flipx)
 		{
+			// a plain indexed loop lets the compiler vectorize simple pixel ops
+			s32 const numpixels = destendx + 1 - destx;
+
 			// iterate over pixels in Y
 			for (s32 cury = desty; cury <= destendy; cury++)
 			{
@@ -497,25 +500,8 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 				const u8 *srcptr = srcdata;
 				srcdata += dy;
 
-				// iterate over unrolled blocks of 4
-				for (s32 curx = 0; curx < numblocks; curx++)
-				{
-					pixel_op(destptr[0], srcptr[0]);
-					pixel_op(destptr[1], srcptr[1]);
-					pixel_op(destptr[2], srcptr[2]);
-					pixel_op(destptr[3], srcptr[3]);
-
-					srcptr += 4;
-					destptr += 4;
-				}
-
-				// iterate over leftover pixels
-				for (s32 curx = 0; curx < leftovers; curx++)
-				{
-					pixel_op(destptr[0], srcptr[0]);
-					srcptr++;
-					destptr++;
-				}
+				for (s32 curx = 0; curx < numpixels; curx++)
+					pixel_op(destptr[curx], srcptr[curx]);
 			}
 		}
 
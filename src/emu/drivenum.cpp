@@ -13,6 +13,7 @@
 #include "softlist_dev.h"
 
 #include <algorithm>
+#include <mutex>
 
 #include <cctype>
 
@@ -66,6 +67,42 @@ bool driver_list::matches(const char *wildstring, const char *string)
 }
 
 
+//-------------------------------------------------
+//  searchable - get the strings approximate
+//  matching uses for a driver, normalising them
+//  for all drivers on first use
+//-------------------------------------------------
+
+const driver_list::search_strings &driver_list::searchable(std::size_t index)
+{
+	static std::once_flag s_once;
+	static std::vector<search_strings> s_strings;
+	std::call_once(
+			s_once,
+			[] ()
+			{
+				s_strings.resize(s_driver_count);
+				std::string composed;
+				for (std::size_t drvnum = 0; drvnum < s_driver_count; drvnum++)
+				{
+					game_driver const &drv(*s_drivers_sorted[drvnum]);
+					search_strings &strings(s_strings[drvnum]);
+
+					// cheat on the shortname as it's always lowercase ASCII
+					strings.shortname.assign(drv.name, drv.name + std::strlen(drv.name));
+					strings.description = ustr_from_utf8(normalize_unicode(drv.type.fullname(), unicode_normalization_form::D, true));
+					composed.assign(drv.manufacturer);
+					composed.append(1, ' ');
+					composed.append(drv.type.fullname());
+					strings.manufacturer_description = ustr_from_utf8(normalize_unicode(composed, unicode_normalization_form::D, true));
+				}
+			});
+
+	assert(index < s_strings.size());
+	return s_strings[index];
+}
+
+
 
 //**************************************************************************
 //  DRIVER ENUMERATOR
@@ -259,8 +296,6 @@ void driver_enumerator::find_approximate_matches(std::string const &string, std:
 		std::vector<std::pair<double, int> > penalty;
 		penalty.reserve(count);
 		std::u32string const search(ustr_from_utf8(normalize_unicode(string, unicode_normalization_form::D, true)));
-		std::string composed;
-		std::u32string candidate;
 
 		// scan the entire drivers array
 		for (int index = 0; index < s_driver_count; index++)
@@ -268,18 +303,13 @@ void driver_enumerator::find_approximate_matches(std::string const &string, std:
 			// skip things that can't run
 			if (m_included[index])
 			{
-				// cheat on the shortname as it's always lowercase ASCII
-				game_driver const &drv(*s_drivers_sorted[index]);
-				std::size_t const namelen(std::strlen(drv.name));
-				candidate.resize(namelen);
-				std::copy_n(drv.name, namelen, candidate.begin());
-				double curpenalty(util::edit_distance(search, candidate));
+				search_strings const &candidate(searchable(index));
+				double curpenalty(util::edit_distance(search, candidate.shortname));
 
 				// if it's not a perfect match, try the description
 				if (curpenalty)
 				{
-					candidate = ustr_from_utf8(normalize_unicode(drv.type.fullname(), unicode_normalization_form::D, true));
-					double p(util::edit_distance(search, candidate));
+					double p(util::edit_distance(search, candidate.description));
 					if (p < curpenalty)
 						curpenalty = p;
 				}
@@ -287,11 +317,7 @@ void driver_enumerator::find_approximate_matches(std::string const &string, std:
 				// also check "<manufacturer> <description>"
 				if (curpenalty)
 				{
-					composed.assign(drv.manufacturer);
-					composed.append(1, ' ');
-					composed.append(drv.type.fullname());
-					candidate = ustr_from_utf8(normalize_unicode(composed, unicode_normalization_form::D, true));
-					double p(util::edit_distance(search, candidate));
+					double p(util::edit_distance(search, candidate.manufacturer_description));
 					if (p < curpenalty)
 						curpenalty = p;
 				}
@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <string>
 
 
 //**************************************************************************
@@ -41,6 +42,14 @@ protected:
 	driver_list();
 
 public:
+	// normalised UCS-4 strings that approximate matching compares against
+	struct search_strings
+	{
+		std::u32string shortname;
+		std::u32string description;
+		std::u32string manufacturer_description;
+	};
+
 	// getters
 	static std::size_t total() { return s_driver_count; }
 
@@ -61,6 +70,7 @@ public:
 
 	// static helpers
 	static bool matches(const char *wildstring, const char *string);
+	static const search_strings &searchable(std::size_t index);
 
 protected:
 	static std::size_t const            s_driver_count;
@@ -86,6 +86,7 @@
 
 // the running machine
 #include "main.h"
+#include "logqueue.h"
 #include "machine.h"
 #include "driver.h"
 
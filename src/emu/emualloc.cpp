@@ -205,3 +205,141 @@ void resource_pool::clear()
 	while (m_ordered_head != nullptr)
 		remove(m_ordered_head->m_ptr);
 }
+
+
+
+//**************************************************************************
+//  MEMORY ARENA
+//**************************************************************************
+
+//-------------------------------------------------
+//  memory_arena - constructor
+//-------------------------------------------------
+
+memory_arena::memory_arena(std::size_t blocksize)
+	: m_blocksize(blocksize),
+		m_ptr(nullptr),
+		m_remaining(0),
+		m_destructors(nullptr)
+{
+}
+
+
+//-------------------------------------------------
+//  ~memory_arena - destructor; destroy all
+//  objects and release the blocks
+//-------------------------------------------------
+
+memory_arena::~memory_arena()
+{
+	clear();
+}
+
+
+//-------------------------------------------------
+//  allocate - carve uninitialised storage out of
+//  the current block
+//-------------------------------------------------
+
+void *memory_arena::allocate(std::size_t size, std::size_t align)
+{
+	// large requests get a block of their own so they don't waste the current one
+	if (size > m_blocksize / 4)
+	{
+		m_blocks.emplace_back(new std::uint8_t[size + align]);
+		std::uintptr_t const base = reinterpret_cast<std::uintptr_t>(m_blocks.back().get());
+		return reinterpret_cast<void *>((base + align - 1) & ~std::uintptr_t(align - 1));
+	}
+
+	// start a new block if this one can't hold the aligned request
+	std::size_t pad = (align - (reinterpret_cast<std::uintptr_t>(m_ptr) & (align - 1))) & (align - 1);
+	if (m_ptr == nullptr || pad + size > m_remaining)
+	{
+		m_blocks.emplace_back(new std::uint8_t[m_blocksize]);
+		m_ptr = m_blocks.back().get();
+		m_remaining = m_blocksize;
+		pad = (align - (reinterpret_cast<std::uintptr_t>(m_ptr) & (align - 1))) & (align - 1);
+	}
+
+	void *const result = m_ptr + pad;
+	m_ptr += pad + size;
+	m_remaining -= pad + size;
+	return result;
+}
+
+
+//-------------------------------------------------
+//  add_destructor - remember to destroy an
+//  object when the arena is cleared
+//-------------------------------------------------
+
+void memory_arena::add_destructor(void *object, void (*destroy)(void *))
+{
+	destructor_entry *const entry = new (allocate(sizeof(destructor_entry), alignof(destructor_entry))) destructor_entry;
+	entry->m_next = m_destructors;
+	entry->m_destroy = destroy;
+	entry->m_object = object;
+	m_destructors = entry;
+}
+
+
+//-------------------------------------------------
+//  clear - destroy all objects, latest first,
+//  and release the blocks in one go
+//-------------------------------------------------
+
+void memory_arena::clear()
+{
+	for (destructor_entry *entry = m_destructors; entry != nullptr; entry = entry->m_next)
+		(*entry->m_destroy)(entry->m_object);
+	m_destructors = nullptr;
+
+	m_blocks.clear();
+	m_ptr = nullptr;
+	m_remaining = 0;
+}
+
+
+
+//**************************************************************************
+//  LARGE BUFFER
+//**************************************************************************
+
+//-------------------------------------------------
+//  allocate - allocate a zero-filled buffer,
+//  using large pages if it is at least threshold
+//  bytes long (0 disables them)
+//-------------------------------------------------
+
+void large_buffer::allocate(std::size_t size, std::size_t threshold)
+{
+	release();
+	if (!size)
+		return;
+
+	if (threshold && (size >= threshold))
+	{
+		m_data = reinterpret_cast<std::uint8_t *>(osd_alloc_large(size, m_huge));
+		m_large = m_data != nullptr;
+	}
+	if (!m_data)
+		m_data = new std::uint8_t[size]();
+	m_size = size;
+}
+
+
+//-------------------------------------------------
+//  release - free the buffer
+//-------------------------------------------------
+
+void large_buffer::release()
+{
+	if (m_large)
+		osd_free_large(m_data, m_size);
+	else
+		delete [] m_data;
+	m_data = nullptr;
+	m_size = 0;
+	m_large = false;
+	m_huge = false;
+}
@@ -16,9 +16,14 @@
 #include "osdcore.h"
 #include "coretmpl.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 //**************************************************************************
@@ -143,4 +148,84 @@ private:
 };
 
 
+// a memory_arena carves objects out of large blocks and releases them all at once; it is
+// not thread safe, and objects in it must not be deleted individually
+class memory_arena
+{
+private:
+	memory_arena(const memory_arena &) = delete;
+	memory_arena &operator=(const memory_arena &) = delete;
+
+public:
+	memory_arena(std::size_t blocksize = 65536);
+	~memory_arena();
+
+	void *allocate(std::size_t size, std::size_t align);
+	void clear();
+
+	// construct an object in the arena; it is destroyed when the arena is cleared
+	template <class ObjectClass, typename... Params> ObjectClass *create(Params &&... args)
+	{
+		ObjectClass *const object = new (allocate(sizeof(ObjectClass), alignof(ObjectClass))) ObjectClass(std::forward<Params>(args)...);
+		if (!std::is_trivially_destructible<ObjectClass>::value)
+			add_destructor(object, [] (void *ptr) { reinterpret_cast<ObjectClass *>(ptr)->~ObjectClass(); });
+		return object;
+	}
+
+	// construct a value-initialised array in the arena
+	template <class ObjectClass> ObjectClass *create_array(std::size_t count)
+	{
+		static_assert(std::is_trivially_destructible<ObjectClass>::value, "arena arrays must be trivially destructible");
+		ObjectClass *const array = reinterpret_cast<ObjectClass *>(allocate(sizeof(ObjectClass) * count, alignof(ObjectClass)));
+		for (std::size_t index = 0; index < count; index++)
+			new (&array[index]) ObjectClass();
+		return array;
+	}
+
+private:
+	// a destructor to run when the arena is cleared
+	struct destructor_entry
+	{
+		destructor_entry *  m_next;
+		void                (*m_destroy)(void *);
+		void *              m_object;
+	};
+
+	void add_destructor(void *object, void (*destroy)(void *));
+
+	std::size_t             m_blocksize;
+	std::vector<std::unique_ptr<std::uint8_t []>> m_blocks;
+	std::uint8_t *          m_ptr;
+	std::size_t             m_remaining;
+	destructor_entry *      m_destructors;
+};
+
+
+// a large_buffer is a zero-filled byte array for big RAM and ROM regions; above the
+// threshold it asks the OSD for large-page backed memory to cut TLB misses
+class large_buffer
+{
+private:
+	large_buffer(const large_buffer &) = delete;
+	large_buffer &operator=(const large_buffer &) = delete;
+
+public:
+	large_buffer() : m_data(nullptr), m_size(0), m_large(false), m_huge(false) { }
+	~large_buffer() { release(); }
+
+	void allocate(std::size_t size, std::size_t threshold = 0);
+	void release();
+
+	std::uint8_t *data() const { return m_data; }
+	std::size_t size() const { return m_size; }
+	bool huge() const { return m_huge; }
+	std::uint8_t &operator[](std::size_t index) const { return m_data[index]; }
+
+private:
+	std::uint8_t *          m_data;
+	std::size_t             m_size;
+	bool                    m_large;    // m_data came from osd_alloc_large
+	bool                    m_huge;     // ... and is backed by large pages
+};
+
 #endif // MAME_EMU_EMUALLOC_H
@@ -503,6 +503,17 @@ public:
 			case 32: m_root_read = new handler_entry_read_dispatch<32, Width, AddrShift, Endian>(this, r, nullptr); m_root_write = new handler_entry_write_dispatch<32, Width, AddrShift, Endian>(this, r, nullptr); break;
 			default: fatalerror("Unhandled address bus width %d\n", address_width);
 		}
+
+		if (UNIT_SHIFT >= 0) {
+			m_read_page_shift = std::max(address_width - READ_PAGE_TABLE_BITS, UNIT_SHIFT);
+			m_read_page_mask = make_bitmask<offs_t>(m_read_page_shift);
+			m_read_pages.resize(size_t(1) << std::max(address_width - m_read_page_shift, 0), nullptr);
+			m_read_page_index_mask = m_read_pages.size() - 1;
+			add_change_notifier([this](read_or_write mode) {
+									if (u32(mode) & u32(read_or_write::READ))
+										std::fill(m_read_pages.begin(), m_read_pages.end(), nullptr);
+								});
+		}
 	}
 
 	void *create_cache() override {
@@ -558,6 +569,32 @@ public:
 		accessors.write_qword_masked = reinterpret_cast<void (*)(address_space &, offs_t, u64, u64)>(&write_qword_masked_static);
 	}
 
+	// describe the read page table; false when the bus is narrower than
+	// the address unit and there is none
+	virtual bool get_read_page_table(read_page_table &table) const override
+	{
+		if (UNIT_SHIFT < 0)
+			return false;
+		table.pages = reinterpret_cast<void * const *>(m_read_pages.data());
+		table.slow = &m_read_page_slow;
+		table.shift = m_read_page_shift;
+		table.mask = m_read_page_mask;
+		return true;
+	}
+
+	// direct pointer to the native unit at address, valid for the whole
+	// read page around it, or nullptr when the page needs handler dispatch
+	virtual void *get_read_page_ptr(offs_t address) override
+	{
+		if (UNIT_SHIFT < 0)
+			return nullptr;
+		address &= m_addrmask;
+		uX *page = read_page(address);
+		if (page == &m_read_page_slow)
+			return nullptr;
+		return &page[(address & m_read_page_mask) >> UNIT_SHIFT];
+	}
+
 	// return a pointer to the read bank, or nullptr if none
 	virtual void *get_read_ptr(offs_t address) const override
 	{
@@ -575,7 +612,12 @@ public:
 	{
 		g_profiler.start(PROFILER_MEMREAD);
 
-		uX result = m_root_read->read(offset, mask);
+		uX result;
+		uX *page = read_page(offset);
+		if (page != &m_read_page_slow)
+			result = page[(offset & m_read_page_mask) >> UNIT_SHIFT];
+		else
+			result = m_root_read->read(offset, mask);
 
 		g_profiler.stop();
 		return result;
@@ -586,12 +628,131 @@ public:
 	{
 		g_profiler.start(PROFILER_MEMREAD);
 
-		uX result = m_root_read->read(offset, uX(0xffffffffffffffffU));
+		uX result;
+		uX *page = read_page(offset);
+		if (page != &m_read_page_slow)
+			result = page[(offset & m_read_page_mask) >> UNIT_SHIFT];
+		else
+			result = m_root_read->read(offset, uX(0xffffffffffffffffU));
 
 		g_profiler.stop();
 		return result;
 	}
 
+	// read a block of native values, memcpy'ing over plain memory spans
+	void read_block(offs_t address, void *dst, u32 count) override
+	{
+		uX *d = static_cast<uX *>(dst);
+		address &= m_addrmask & ~NATIVE_MASK;
+		while (count) {
+			u32 units = count;
+			uX *p = read_span(address, units);
+			if (p)
+				memcpy(d, p, units * NATIVE_BYTES);
+			else
+				for (u32 i = 0; i != units; i++)
+					d[i] = read_native((address + i * NATIVE_STEP) & m_addrmask);
+			d += units;
+			count -= units;
+			address = (address + units * NATIVE_STEP) & m_addrmask;
+		}
+	}
+
+	// write a block of native values, memcpy'ing over plain memory spans
+	void write_block(offs_t address, const void *src, u32 count) override
+	{
+		const uX *s = static_cast<const uX *>(src);
+		address &= m_addrmask & ~NATIVE_MASK;
+		while (count) {
+			u32 units = count;
+			uX *p = write_span(address, units);
+			if (p)
+				memcpy(p, s, units * NATIVE_BYTES);
+			else
+				for (u32 i = 0; i != units; i++)
+					write_native((address + i * NATIVE_STEP) & m_addrmask, s[i]);
+			s += units;
+			count -= units;
+			address = (address + units * NATIVE_STEP) & m_addrmask;
+		}
+	}
+
+	// copy between two ranges of the space, which must not overlap
+	void copy_block(offs_t srcaddress, offs_t dstaddress, u32 count) override
+	{
+		uX buffer[256];
+		while (count) {
+			u32 units = std::min<u32>(count, ARRAY_LENGTH(buffer));
+			read_block(srcaddress, buffer, units);
+			write_block(dstaddress, buffer, units);
+			count -= units;
+			srcaddress += units * NATIVE_STEP;
+			dstaddress += units * NATIVE_STEP;
+		}
+	}
+
+	// direct pointer to the memory behind a run of native units starting
+	// at address, shrinking units to what a single RAM/ROM or bank handler
+	// covers contiguously; nullptr when the handlers have to be called
+	uX *read_span(offs_t address, u32 &units) const
+	{
+		offs_t start, end;
+		handler_entry_read<Width, AddrShift, Endian> *handler;
+		m_root_read->lookup(address, start, end, handler);
+		units = std::min<u64>(units, (u64(end - address) >> UNIT_SHIFT) + 1);
+		if (UNIT_SHIFT < 0 || (!dynamic_cast<handler_entry_read_memory<Width, AddrShift, Endian> *>(handler) && !dynamic_cast<handler_entry_read_memory_bank<Width, AddrShift, Endian> *>(handler)))
+			return nullptr;
+		uX *first = static_cast<uX *>(handler->get_ptr(address));
+		uX *last = static_cast<uX *>(handler->get_ptr(address + (units - 1) * NATIVE_STEP));
+		return last - first == units - 1 ? first : nullptr;
+	}
+
+	uX *write_span(offs_t address, u32 &units) const
+	{
+		offs_t start, end;
+		handler_entry_write<Width, AddrShift, Endian> *handler;
+		m_root_write->lookup(address, start, end, handler);
+		units = std::min<u64>(units, (u64(end - address) >> UNIT_SHIFT) + 1);
+		if (UNIT_SHIFT < 0 || (!dynamic_cast<handler_entry_write_memory<Width, AddrShift, Endian> *>(handler) && !dynamic_cast<handler_entry_write_memory_bank<Width, AddrShift, Endian> *>(handler)))
+			return nullptr;
+		uX *first = static_cast<uX *>(handler->get_ptr(address));
+		uX *last = static_cast<uX *>(handler->get_ptr(address + (units - 1) * NATIVE_STEP));
+		return last - first == units - 1 ? first : nullptr;
+	}
+
+	// direct memory pointer for the read page containing offset, or
+	// &m_read_page_slow when the page needs the full handler dispatch
+	uX *read_page(offs_t offset)
+	{
+		if (UNIT_SHIFT < 0)
+			return &m_read_page_slow;
+		uX *&page = m_read_pages[(offset >> m_read_page_shift) & m_read_page_index_mask];
+		if (!page)
+			page = resolve_read_page(offset & ~m_read_page_mask);
+		return page;
+	}
+
+	// a page goes direct only when one plain RAM/ROM handler covers all
+	// of it with contiguous backing memory; banks, taps, mirrors smaller
+	// than a page and device handlers all stay on the dispatch path
+	uX *resolve_read_page(offs_t pagestart)
+	{
+		offs_t start, end;
+		handler_entry_read<Width, AddrShift, Endian> *handler;
+		m_root_read->lookup(pagestart, start, end, handler);
+
+		offs_t pageend = pagestart | m_read_page_mask;
+		auto mem = dynamic_cast<handler_entry_read_memory<Width, AddrShift, Endian> *>(handler);
+		if (!mem || start > pagestart || end < pageend)
+			return &m_read_page_slow;
+
+		uX *first = static_cast<uX *>(mem->get_ptr(pagestart));
+		uX *last = static_cast<uX *>(mem->get_ptr(pageend & ~NATIVE_MASK));
+		if (last - first != (pageend >> UNIT_SHIFT) - (pagestart >> UNIT_SHIFT))
+			return &m_read_page_slow;
+		return first;
+	}
+
 	// native write
 	void write_native(offs_t offset, NativeType data, NativeType mask)
 	{
@@ -662,6 +823,15 @@ public:
 
 	std::unordered_set<handler_entry *> m_delayed_unrefs;
 
+	// lazily filled read page table, cleared whenever the read map changes
+	static constexpr int UNIT_SHIFT = Width + AddrShift;
+	static constexpr int READ_PAGE_TABLE_BITS = 12;
+	std::vector<uX *> m_read_pages;
+	int m_read_page_shift;
+	offs_t m_read_page_mask;
+	offs_t m_read_page_index_mask;
+	uX m_read_page_slow;
+
 private:
 	template<typename READ>
 	void install_read_handler_impl(offs_t addrstart, offs_t addrend, offs_t addrmask, offs_t addrmirror, offs_t addrselect, u64 unitmask, int cswidth, READ &handler_r)
@@ -719,7 +889,7 @@ private:
 		auto hand_r = new handler_entry_read_delegate<Width, AddrShift, Endian, READ>(this, handler_r);
 		hand_r->set_address_info(nstart, nmask);
 		m_root_read->populate(nstart, nend, nmirror, hand_r);
-		invalidate_caches(read_or_write::READ);
+		invalidate_caches(read_or_write::READ, nstart, nend | nmirror);
 	}
 
 	template<int AccessWidth, typename READ> std::enable_if_t<(Width > AccessWidth)>
@@ -742,7 +912,7 @@ private:
 		hand_r->set_address_info(descriptor.get_handler_start(), descriptor.get_handler_mask());
 		m_root_read->populate_mismatched(nstart, nend, nmirror, descriptor);
 		hand_r->unref();
-		invalidate_caches(read_or_write::READ);
+		invalidate_caches(read_or_write::READ, nstart, nend | nmirror);
 	}
 
 
@@ -771,7 +941,7 @@ private:
 		auto hand_w = new handler_entry_write_delegate<Width, AddrShift, Endian, WRITE>(this, handler_w);
 		hand_w->set_address_info(nstart, nmask);
 		m_root_write->populate(nstart, nend, nmirror, hand_w);
-		invalidate_caches(read_or_write::WRITE);
+		invalidate_caches(read_or_write::WRITE, nstart, nend | nmirror);
 	}
 
 	template<int AccessWidth, typename WRITE> std::enable_if_t<(Width > AccessWidth)>
@@ -794,7 +964,7 @@ private:
 		hand_w->set_address_info(descriptor.get_handler_start(), descriptor.get_handler_mask());
 		m_root_write->populate_mismatched(nstart, nend, nmirror, descriptor);
 		hand_w->unref();
-		invalidate_caches(read_or_write::WRITE);
+		invalidate_caches(read_or_write::WRITE, nstart, nend | nmirror);
 	}
 
 
@@ -831,7 +1001,7 @@ private:
 		hand_w->set_address_info(nstart, nmask);
 		m_root_write->populate(nstart, nend, nmirror, hand_w);
 
-		invalidate_caches(read_or_write::READWRITE);
+		invalidate_caches(read_or_write::READWRITE, nstart, nend | nmirror);
 	}
 
 	template<int AccessWidth, typename READ, typename WRITE> std::enable_if_t<(Width > AccessWidth)>
@@ -862,7 +1032,7 @@ private:
 		m_root_write->populate_mismatched(nstart, nend, nmirror, descriptor);
 		hand_w->unref();
 
-		invalidate_caches(read_or_write::READWRITE);
+		invalidate_caches(read_or_write::READWRITE, nstart, nend | nmirror);
 	}
 
 
@@ -887,7 +1057,8 @@ private:
 
 memory_manager::memory_manager(running_machine &machine)
 	: m_machine(machine),
-	  m_initialized(false)
+	  m_initialized(false),
+	  m_heatmap_sample(0)
 {
 }
 
@@ -1040,6 +1211,128 @@ void memory_manager::initialize()
 }
 
 
+//-------------------------------------------------
+//  install_heatmap_taps - count sampled accesses
+//  per page of a space
+//-------------------------------------------------
+
+namespace {
+
+template <typename T>
+void install_heatmap_taps(memory_manager::heatmap_space &heat, u32 sample)
+{
+	address_space &space = *heat.m_space;
+	offs_t const mask = space.addrmask();
+	space.install_readwrite_tap(0, mask, "heatmap",
+			[&heat, mask, sample] (offs_t offset, T &data, T mem_mask)
+			{
+				if (--heat.m_countdown)
+					return;
+				heat.m_countdown = sample;
+				heat.m_reads[(offset & mask) >> heat.m_page_shift] += sample;
+			},
+			[&heat, mask, sample] (offs_t offset, T &data, T mem_mask)
+			{
+				if (--heat.m_countdown)
+					return;
+				heat.m_countdown = sample;
+				heat.m_writes[(offset & mask) >> heat.m_page_shift] += sample;
+			});
+}
+
+} // anonymous namespace
+
+
+//-------------------------------------------------
+//  start_heatmap - trace accesses to every
+//  address space, counting one in sample, and
+//  report them on exit
+//-------------------------------------------------
+
+void memory_manager::start_heatmap(u32 sample)
+{
+	if (m_heatmap_sample || !sample)
+		return;
+	m_heatmap_sample = sample;
+
+	for (device_memory_interface &memory : memory_interface_iterator(machine().root_device()))
+		for (int spacenum = 0; spacenum < memory.max_space_count(); spacenum++)
+			if (memory.has_space(spacenum))
+			{
+				address_space &space = memory.space(spacenum);
+				auto heat = std::make_unique<heatmap_space>();
+				heat->m_space = &space;
+				heat->m_page_shift = std::max(space.addr_width() - 12, 0);
+				heat->m_countdown = sample;
+				heat->m_reads.resize((space.addrmask() >> heat->m_page_shift) + 1, 0);
+				heat->m_writes.resize(heat->m_reads.size(), 0);
+
+				switch (space.data_width())
+				{
+				case 8:  install_heatmap_taps<u8>(*heat, sample); break;
+				case 16: install_heatmap_taps<u16>(*heat, sample); break;
+				case 32: install_heatmap_taps<u32>(*heat, sample); break;
+				case 64: install_heatmap_taps<u64>(*heat, sample); break;
+				}
+				m_heatmap.emplace_back(std::move(heat));
+			}
+
+	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&memory_manager::heatmap_report, this));
+}
+
+
+//-------------------------------------------------
+//  heatmap_report - print accesses per handler
+//  and the busiest pages of each space
+//-------------------------------------------------
+
+void memory_manager::heatmap_report()
+{
+	osd_printf_info("Memory heat map, sampling 1 in %u accesses:\n", m_heatmap_sample);
+	for (auto const &heat : m_heatmap)
+	{
+		address_space &space = *heat->m_space;
+		u64 reads = 0, writes = 0;
+		std::map<std::string, std::pair<u64, u64>> handlers;
+		std::vector<std::pair<u64, offs_t>> pages;
+		for (offs_t page = 0; page < heat->m_reads.size(); page++)
+		{
+			if (!heat->m_reads[page] && !heat->m_writes[page])
+				continue;
+			offs_t const address = offs_t(page) << heat->m_page_shift;
+			reads += heat->m_reads[page];
+			writes += heat->m_writes[page];
+			if (heat->m_reads[page])
+				handlers[space.get_handler_string(read_or_write::READ, address)].first += heat->m_reads[page];
+			if (heat->m_writes[page])
+				handlers[space.get_handler_string(read_or_write::WRITE, address)].second += heat->m_writes[page];
+			pages.emplace_back(heat->m_reads[page] + heat->m_writes[page], page);
+		}
+		if (!reads && !writes)
+			continue;
+
+		osd_printf_info("  %s '%s': %u reads, %u writes\n", space.device().tag(), space.name(), reads, writes);
+		osd_printf_info("    %-40s %14s %14s\n", "handler", "reads", "writes");
+		for (auto const &handler : handlers)
+			osd_printf_info("    %-40s %14u %14u\n", handler.first, handler.second.first, handler.second.second);
+
+		// the busiest pages, handlers named by where the page starts
+		std::sort(pages.begin(), pages.end(), [] (auto const &a, auto const &b) { return a.first > b.first; });
+		if (pages.size() > 16)
+			pages.resize(16);
+		osd_printf_info("    %-17s %14s %14s\n", "page", "reads", "writes");
+		for (auto const &page : pages)
+		{
+			offs_t const start = page.second << heat->m_page_shift;
+			offs_t const end = start | make_bitmask<offs_t>(heat->m_page_shift);
+			osd_printf_info("    %0*X-%0*X %*s%14u %14u\n",
+					space.addrchars(), start, space.addrchars(), end, std::max(16 - 2 * space.addrchars(), 0), "",
+					heat->m_reads[page.second], heat->m_writes[page.second]);
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  region_alloc - allocates memory for a region
 //-------------------------------------------------
@@ -1938,7 +2231,7 @@ template<int Width, int AddrShift, endianness_t Endian> void address_space_speci
 		m_root_write->populate(nstart, nend, nmirror, handler);
 	}
 
-	invalidate_caches(readorwrite);
+	invalidate_caches(readorwrite, nstart, nend | nmirror);
 }
 
 //-------------------------------------------------
@@ -1958,7 +2251,7 @@ template<int Width, int AddrShift, endianness_t Endian> memory_passthrough_handl
 	m_root_read->populate_passthrough(nstart, nend, nmirror, handler);
 	handler->unref();
 
-	invalidate_caches(read_or_write::READ);
+	invalidate_caches(read_or_write::READ, nstart, nend | nmirror);
 
 	return mph;
 }
@@ -1980,7 +2273,7 @@ template<int Width, int AddrShift, endianness_t Endian> memory_passthrough_handl
 	m_root_write->populate_passthrough(nstart, nend, nmirror, handler);
 	handler->unref();
 
-	invalidate_caches(read_or_write::WRITE);
+	invalidate_caches(read_or_write::WRITE, nstart, nend | nmirror);
 
 	return mph;
 }
@@ -2005,7 +2298,7 @@ template<int Width, int AddrShift, endianness_t Endian> memory_passthrough_handl
 	m_root_write->populate_passthrough(nstart, nend, nmirror, whandler);
 	whandler->unref();
 
-	invalidate_caches(read_or_write::READWRITE);
+	invalidate_caches(read_or_write::READWRITE, nstart, nend | nmirror);
 
 	return mph;
 }
@@ -2069,7 +2362,7 @@ template<int Width, int AddrShift, endianness_t Endian> void address_space_speci
 		m_root_write->populate(nstart, nend, nmirror, hand_w);
 	}
 
-	invalidate_caches(rtag != "" ? wtag != "" ? read_or_write::READWRITE : read_or_write::READ : read_or_write::WRITE);
+	invalidate_caches(rtag != "" ? wtag != "" ? read_or_write::READWRITE : read_or_write::READ : read_or_write::WRITE, nstart, nend | nmirror);
 }
 
 
@@ -2110,7 +2403,7 @@ template<int Width, int AddrShift, endianness_t Endian> void address_space_speci
 		m_root_write->populate(nstart, nend, nmirror, hand_w);
 	}
 
-	invalidate_caches(rtag != "" ? wtag != "" ? read_or_write::READWRITE : read_or_write::READ : read_or_write::WRITE);
+	invalidate_caches(rtag != "" ? wtag != "" ? read_or_write::READWRITE : read_or_write::READ : read_or_write::WRITE, nstart, nend | nmirror);
 }
 
 
@@ -2140,7 +2433,7 @@ template<int Width, int AddrShift, endianness_t Endian> void address_space_speci
 		m_root_write->populate(nstart, nend, nmirror, hand_w);
 	}
 
-	invalidate_caches(rbank ? wbank ? read_or_write::READWRITE : read_or_write::READ : read_or_write::WRITE);
+	invalidate_caches(rbank ? wbank ? read_or_write::READWRITE : read_or_write::READ : read_or_write::WRITE, nstart, nend | nmirror);
 }
 
 
@@ -2240,7 +2533,7 @@ template<int Width, int AddrShift, endianness_t Endian> void address_space_speci
 		m_root_write->populate(nstart, nend, nmirror, hand_w);
 	}
 
-	invalidate_caches(readorwrite);
+	invalidate_caches(readorwrite, nstart, nend | nmirror);
 }
 
 
@@ -2321,7 +2614,14 @@ bool address_space::needs_backing_store(const address_map_entry &entry)
 int address_space::add_change_notifier(std::function<void (read_or_write)> n)
 {
 	int id = m_notifier_id++;
-	m_notifiers.emplace_back(notifier_t{ n, id });
+	m_notifiers.emplace_back(notifier_t{ n, nullptr, id });
+	return id;
+}
+
+int address_space::add_range_change_notifier(std::function<void (read_or_write, offs_t, offs_t)> n)
+{
+	int id = m_notifier_id++;
+	m_notifiers.emplace_back(notifier_t{ nullptr, n, id });
 	return id;
 }
 
@@ -2384,24 +2684,56 @@ template<int Width, int AddrShift, int Endian> memory_access_cache<Width, AddrSh
 	  m_addrend_w(0),
 	  m_cache_r(nullptr),
 	  m_cache_w(nullptr),
+	  m_victim_next_r(0),
+	  m_victim_next_w(0),
 	  m_root_read(root_read),
 	  m_root_write(root_write)
 {
-	m_notifier_id = space.add_change_notifier([this](read_or_write mode) {
-												  if(u32(mode) & u32(read_or_write::READ)) {
+	invalidate_victims(read_or_write::READWRITE, 0, ~offs_t(0));
+
+	// only forget ranges overlapping the change, the handlers of the
+	// others are still mapped there
+	m_notifier_id = space.add_range_change_notifier([this](read_or_write mode, offs_t start, offs_t end) {
+												  if((u32(mode) & u32(read_or_write::READ)) && m_addrstart_r <= end && m_addrend_r >= start) {
 													  m_addrend_r = 0;
 													  m_addrstart_r = 1;
 													  m_cache_r = nullptr;
 												  }
-												  if(u32(mode) & u32(read_or_write::WRITE)) {
+												  if((u32(mode) & u32(read_or_write::WRITE)) && m_addrstart_w <= end && m_addrend_w >= start) {
 													  m_addrend_w = 0;
 													  m_addrstart_w = 1;
 													  m_cache_w = nullptr;
 												  }
+												  invalidate_victims(mode, start, end);
 											  });
 }
 
 
+//-------------------------------------------------
+//  invalidate_victims - forget previously cached
+//  ranges overlapping start-end for the given
+//  direction(s)
+//-------------------------------------------------
+
+template<int Width, int AddrShift, int Endian> void memory_access_cache<Width, AddrShift, Endian>::invalidate_victims(read_or_write mode, offs_t start, offs_t end)
+{
+	if(u32(mode) & u32(read_or_write::READ))
+		for(auto &v : m_victims_r)
+			if(v.m_addrstart <= end && v.m_addrend >= start) {
+				v.m_addrend = 0;
+				v.m_addrstart = 1;
+				v.m_cache = nullptr;
+			}
+	if(u32(mode) & u32(read_or_write::WRITE))
+		for(auto &v : m_victims_w)
+			if(v.m_addrstart <= end && v.m_addrend >= start) {
+				v.m_addrend = 0;
+				v.m_addrstart = 1;
+				v.m_cache = nullptr;
+			}
+}
+
+
 //-------------------------------------------------
 //  ~memory_access_cache - destructor
 //-------------------------------------------------
@@ -2660,10 +2992,12 @@ void memory_bank::configure_entries(int startentry, int numentries, void *base,
 memory_region::memory_region(running_machine &machine, const char *name, u32 length, u8 width, endianness_t endian)
 	: m_machine(machine),
 		m_name(name),
-		m_buffer(length),
 		m_endianness(endian),
 		m_bitwidth(width * 8),
 		m_bytewidth(width)
 {
 	assert(width == 1 || width == 2 || width == 4 || width == 8);
+	m_buffer.allocate(length, size_t(machine.options().large_pages()) << 20);
+	if (m_buffer.huge())
+		osd_printf_verbose("Region '%s' (%u bytes) is backed by large pages\n", name, length);
 }
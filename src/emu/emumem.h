@@ -79,6 +79,16 @@ struct data_accessors
 	void    (*write_qword_masked)(address_space &space, offs_t address, u64 data, u64 mask);
 };
 
+// direct read page table, for use by generated code; an entry is null until
+// the page was first read, or equal to slow when it needs handler dispatch
+struct read_page_table
+{
+	void * const *  pages;      // one host pointer per page, indexed by address >> shift
+	const void *    slow;       // sentinel for pages that are not plain memory
+	int             shift;      // log2 of the page size in addresses
+	offs_t          mask;       // offset within a page
+};
+
 // a line in the memory structure dump
 struct memory_entry {
 	offs_t start, end;
@@ -965,13 +975,13 @@ public:
 	void check_address_r(offs_t address) {
 		if(address >= m_addrstart_r && address <= m_addrend_r)
 			return;
-		m_root_read->lookup(address, m_addrstart_r, m_addrend_r, m_cache_r);
+		miss_r(address);
 	}
 
 	void check_address_w(offs_t address) {
 		if(address >= m_addrstart_w && address <= m_addrend_w)
 			return;
-		m_root_write->lookup(address, m_addrstart_w, m_addrend_w, m_cache_w);
+		miss_w(address);
 	}
 
 	// accessor methods
@@ -1010,6 +1020,17 @@ public:
 	void write_qword_unaligned(offs_t address, u64 data, u64 mask) { address &= m_addrmask; memory_write_generic<Width, AddrShift, Endian, 3, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, mask); }
 
 private:
+	// ranges evicted from the current entry, probed before walking the
+	// decode tree so that code alternating between a few regions (rom
+	// fetches and ram data, typically) stays off the slow path
+	static constexpr int VICTIM_ENTRIES = 3;
+
+	template<typename Handler> struct victim_entry {
+		offs_t      m_addrstart;
+		offs_t      m_addrend;
+		Handler *   m_cache;
+	};
+
 	address_space &             m_space;
 
 	int                         m_notifier_id;             // id to remove the notifier on destruction
@@ -1022,9 +1043,18 @@ private:
 	handler_entry_read<Width, AddrShift, Endian> *m_cache_r;   // read cache
 	handler_entry_write<Width, AddrShift, Endian> *m_cache_w;  // write cache
 
+	victim_entry<handler_entry_read <Width, AddrShift, Endian>> m_victims_r[VICTIM_ENTRIES];  // previous read ranges
+	victim_entry<handler_entry_write<Width, AddrShift, Endian>> m_victims_w[VICTIM_ENTRIES];  // previous write ranges
+	int                         m_victim_next_r;           // next read victim slot to replace
+	int                         m_victim_next_w;           // next write victim slot to replace
+
 	handler_entry_read <Width, AddrShift, Endian> *m_root_read;  // decode tree roots
 	handler_entry_write<Width, AddrShift, Endian> *m_root_write;
 
+	void miss_r(offs_t address);
+	void miss_w(offs_t address);
+	void invalidate_victims(read_or_write mode, offs_t start, offs_t end);
+
 	NativeType read_native(offs_t address, NativeType mask = ~NativeType(0));
 	void write_native(offs_t address, NativeType data, NativeType mask = ~NativeType(0));
 };
@@ -1091,6 +1121,7 @@ class address_space
 
 	struct notifier_t {
 		std::function<void (read_or_write)> m_notifier;
+		std::function<void (read_or_write, offs_t, offs_t)> m_range_notifier;
 		int m_id;
 	};
 
@@ -1120,14 +1151,22 @@ public:
 	}
 
 	int add_change_notifier(std::function<void (read_or_write)> n);
+	int add_range_change_notifier(std::function<void (read_or_write, offs_t, offs_t)> n);
 	void remove_change_notifier(int id);
 
-	void invalidate_caches(read_or_write mode) {
+	void invalidate_caches(read_or_write mode) { invalidate_caches(mode, 0, ~offs_t(0)); }
+
+	// range notifiers only hear about changes to addresses start-end,
+	// the others are told about every change
+	void invalidate_caches(read_or_write mode, offs_t start, offs_t end) {
 		if(u32(mode) & ~m_in_notification) {
 			u32 old = m_in_notification;
 			m_in_notification |= u32(mode);
 			for(const auto &n : m_notifiers)
-				n.m_notifier(mode);
+				if(n.m_range_notifier)
+					n.m_range_notifier(mode, start, end);
+				else
+					n.m_notifier(mode);
 			m_in_notification = old;
 		}
 	}
@@ -1158,6 +1197,8 @@ public:
 
 	// general accessors
 	virtual void accessors(data_accessors &accessors) const = 0;
+	virtual bool get_read_page_table(read_page_table &table) const = 0;
+	virtual void *get_read_page_ptr(offs_t address) = 0;
 	virtual void *get_read_ptr(offs_t address) const = 0;
 	virtual void *get_write_ptr(offs_t address) const = 0;
 
@@ -1191,6 +1232,12 @@ public:
 	virtual void write_qword_unaligned(offs_t address, u64 data) = 0;
 	virtual void write_qword_unaligned(offs_t address, u64 data, u64 mask) = 0;
 
+	// block accessors; count is in native bus units, address is aligned
+	// down to the bus width and buffers hold native values in host order
+	virtual void read_block(offs_t address, void *dst, u32 count) = 0;
+	virtual void write_block(offs_t address, const void *src, u32 count) = 0;
+	virtual void copy_block(offs_t srcaddress, offs_t dstaddress, u32 count) = 0;
+
 	// address-to-byte conversion helpers
 	offs_t address_to_byte(offs_t address) const { return m_config.addr2byte(address); }
 	offs_t address_to_byte_end(offs_t address) const { return m_config.addr2byte_end(address); }
@@ -1645,7 +1692,7 @@ public:
 
 	// getters
 	running_machine &machine() const { return m_machine; }
-	u8 *base() { return (m_buffer.size() > 0) ? &m_buffer[0] : nullptr; }
+	u8 *base() { return m_buffer.data(); }
 	u8 *end() { return base() + m_buffer.size(); }
 	u32 bytes() const { return m_buffer.size(); }
 	const char *name() const { return m_name.c_str(); }
@@ -1665,7 +1712,7 @@ private:
 	// internal data
 	running_machine &       m_machine;
 	std::string             m_name;
-	std::vector<u8>         m_buffer;
+	large_buffer            m_buffer;
 	endianness_t            m_endianness;
 	u8                      m_bitwidth;
 	u8                      m_bytewidth;
@@ -1701,8 +1748,24 @@ public:
 	memory_bank *find(address_space &space, offs_t addrstart, offs_t addrend) const;
 	memory_bank *allocate(address_space &space, offs_t addrstart, offs_t addrend, const char *tag = nullptr);
 
+	// access heat map, per space and page
+	struct heatmap_space
+	{
+		address_space *     m_space;                // space being traced
+		int                 m_page_shift;           // address bits per page
+		u32                 m_countdown;            // accesses left before the next sample
+		std::vector<u64>    m_reads;                // sampled reads per page, scaled
+		std::vector<u64>    m_writes;               // sampled writes per page, scaled
+	};
+
+	// heat map collection; nullptr unless started
+	const std::vector<std::unique_ptr<heatmap_space>> *heatmap() const { return m_heatmap_sample ? &m_heatmap : nullptr; }
+	u32 heatmap_sample() const { return m_heatmap_sample; }
+	void start_heatmap(u32 sample);
+
 private:
 	void allocate(device_memory_interface &memory);
+	void heatmap_report();
 
 	// internal state
 	running_machine &           m_machine;              // reference to the machine
@@ -1713,6 +1776,9 @@ private:
 	std::unordered_map<std::string, std::unique_ptr<memory_bank>>    m_banklist;             // data gathered for each bank
 	std::unordered_map<std::string, std::unique_ptr<memory_share>>   m_sharelist;            // map for share lookups
 	std::unordered_map<std::string, std::unique_ptr<memory_region>>  m_regionlist;           // list of memory regions
+
+	std::vector<std::unique_ptr<heatmap_space>> m_heatmap;            // heat map per traced space
+	u32                         m_heatmap_sample;       // count every Nth access, 0 when off
 };
 
 
@@ -1795,6 +1861,42 @@ private:
 #define QWORD_ALIGNED(a)                (((a) & 7) == 0)
 
 
+template<int Width, int AddrShift, int Endian> void memory_access_cache<Width, AddrShift, Endian>::miss_r(offs_t address)
+{
+	for(auto &v : m_victims_r)
+		if(address >= v.m_addrstart && address <= v.m_addrend) {
+			std::swap(v.m_addrstart, m_addrstart_r);
+			std::swap(v.m_addrend, m_addrend_r);
+			std::swap(v.m_cache, m_cache_r);
+			return;
+		}
+
+	auto &v = m_victims_r[m_victim_next_r];
+	m_victim_next_r = m_victim_next_r == VICTIM_ENTRIES - 1 ? 0 : m_victim_next_r + 1;
+	v.m_addrstart = m_addrstart_r;
+	v.m_addrend = m_addrend_r;
+	v.m_cache = m_cache_r;
+	m_root_read->lookup(address, m_addrstart_r, m_addrend_r, m_cache_r);
+}
+
+template<int Width, int AddrShift, int Endian> void memory_access_cache<Width, AddrShift, Endian>::miss_w(offs_t address)
+{
+	for(auto &v : m_victims_w)
+		if(address >= v.m_addrstart && address <= v.m_addrend) {
+			std::swap(v.m_addrstart, m_addrstart_w);
+			std::swap(v.m_addrend, m_addrend_w);
+			std::swap(v.m_cache, m_cache_w);
+			return;
+		}
+
+	auto &v = m_victims_w[m_victim_next_w];
+	m_victim_next_w = m_victim_next_w == VICTIM_ENTRIES - 1 ? 0 : m_victim_next_w + 1;
+	v.m_addrstart = m_addrstart_w;
+	v.m_addrend = m_addrend_w;
+	v.m_cache = m_cache_w;
+	m_root_write->lookup(address, m_addrstart_w, m_addrend_w, m_cache_w);
+}
+
 template<int Width, int AddrShift, int Endian> typename emu::detail::handler_entry_size<Width>::uX memory_access_cache<Width, AddrShift, Endian>::read_native(offs_t address, typename emu::detail::handler_entry_size<Width>::uX mask)
 {
 	check_address_r(address);
@@ -76,6 +76,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SNAPSIZE,                                   "auto",      OPTION_STRING,     "specify snapshot/movie resolution (<width>x<height>) or 'auto' to use minimal size " },
 	{ OPTION_SNAPVIEW,                                   "internal",  OPTION_STRING,     "specify snapshot/movie view or 'internal' to use internal pixel-aspect views" },
 	{ OPTION_SNAPBILINEAR,                               "1",         OPTION_BOOLEAN,    "specify if the snapshot/movie should have bilinear filtering applied" },
+	{ OPTION_ASYNCRECORD,                                "0",         OPTION_BOOLEAN,    "encode and write AVI/MNG movie frames on a separate thread" },
 	{ OPTION_STATENAME,                                  "%g",        OPTION_STRING,     "override of the default state subfolder naming; %g == gamename" },
 	{ OPTION_BURNIN,                                     "0",         OPTION_BOOLEAN,    "create burn-in snapshots for each screen" },
 
@@ -89,6 +90,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       OPTION_FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         OPTION_BOOLEAN,    "automatically adjust emulation speed to keep the emulated refresh rate slower than the host screen" },
 	{ OPTION_LOWLATENCY ";lolat",                        "0",         OPTION_BOOLEAN,    "draws new frame before throttling to reduce input latency" },
+	{ OPTION_VRR,                                        "0",         OPTION_BOOLEAN,    "present each frame as soon as it is complete and let the throttle pace presentation, for variable refresh rate displays" },
+	{ OPTION_TILEMAPTHREADS,                             "0",         OPTION_BOOLEAN,    "draw large tilemap layers in horizontal bands on multiple threads" },
 
 	// render options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE RENDER OPTIONS" },
@@ -137,6 +140,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SAMPLERATE ";sr(1000-1000000)",             "48000",     OPTION_INTEGER,    "set sound output sample rate" },
 	{ OPTION_SAMPLES,                                    "1",         OPTION_BOOLEAN,    "enable the use of external samples if available" },
 	{ OPTION_VOLUME ";vol",                              "0",         OPTION_INTEGER,    "sound volume in decibels (-32 min, 0 max)" },
+	{ OPTION_HQRESAMPLE,                                 "0",         OPTION_BOOLEAN,    "interpolate low-rate streams with a windowed-sinc kernel instead of linearly" },
 
 	// input options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE INPUT OPTIONS" },
@@ -172,10 +176,17 @@ const options_entry emu_options::s_option_entries[] =
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE DEBUGGING OPTIONS" },
 	{ OPTION_VERBOSE ";v",                               "0",         OPTION_BOOLEAN,    "display additional diagnostic information" },
 	{ OPTION_LOG,                                        "0",         OPTION_BOOLEAN,    "generate an error.log file" },
+	{ OPTION_LOG_DEFER,                                  "0",         OPTION_BOOLEAN,    "format error.log messages in the background instead of as they are logged" },
+	{ OPTION_LOG_RATE "(0-1000000)",                     "0",         OPTION_INTEGER,    "maximum error log messages per device per emulated second (0 = unlimited)" },
 	{ OPTION_OSLOG,                                      "0",         OPTION_BOOLEAN,    "output error.log data to system diagnostic output (debugger or standard error)" },
 	{ OPTION_DEBUG ";d",                                 "0",         OPTION_BOOLEAN,    "enable/disable debugger" },
 	{ OPTION_UPDATEINPAUSE,                              "0",         OPTION_BOOLEAN,    "keep calling video updates while in pause" },
 	{ OPTION_DEBUGSCRIPT,                                nullptr,     OPTION_STRING,     "script for debugger" },
+	{ OPTION_SCHEDSTATS,                                 "0",         OPTION_BOOLEAN,    "collect scheduler statistics and report them on exit" },
+	{ OPTION_MEMHEAT,                                    "0",         OPTION_INTEGER,    "count every Nth memory access per handler and page and report on exit (0 = off)" },
+	{ OPTION_PCPROFILE,                                  "0",         OPTION_INTEGER,    "sample the PC of every CPU N times per emulated second and report on exit (0 = off)" },
+	{ OPTION_SOUNDSTATS,                                 "0",         OPTION_BOOLEAN,    "collect per-stream sound update statistics and report them on exit" },
+	{ OPTION_PROFILE_TRACE,                              nullptr,     OPTION_STRING,     "record profiler scopes and write them to the given file as a Chrome trace on exit" },
 
 	// comm options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE COMM OPTIONS" },
@@ -191,6 +202,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DRC_USE_C,                                  "0",         OPTION_BOOLEAN,    "force DRC to use C backend" },
 	{ OPTION_DRC_LOG_UML,                                "0",         OPTION_BOOLEAN,    "write DRC UML disassembly log" },
 	{ OPTION_DRC_LOG_NATIVE,                             "0",         OPTION_BOOLEAN,    "write DRC native disassembly log" },
+	{ OPTION_DRC_PERF_MAP,                               "0",         OPTION_BOOLEAN,    "describe DRC generated code to host profilers in /tmp/perf-<pid>.map" },
 	{ OPTION_BIOS,                                       nullptr,     OPTION_STRING,     "select the system BIOS to use" },
 	{ OPTION_CHEAT ";c",                                 "0",         OPTION_BOOLEAN,    "enable cheat subsystem" },
 	{ OPTION_SKIP_GAMEINFO,                              "0",         OPTION_BOOLEAN,    "skip displaying the system information screen at startup" },
@@ -201,6 +213,9 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_UI_MOUSE,                                   "1",         OPTION_BOOLEAN,    "display UI mouse cursor" },
 	{ OPTION_LANGUAGE ";lang",                           "English",   OPTION_STRING,     "set UI display language" },
 	{ OPTION_NVRAM_SAVE ";nvwrite",                      "1",         OPTION_BOOLEAN,    "save NVRAM data on exit" },
+	{ OPTION_HASH_CACHE,                                 "0",         OPTION_BOOLEAN,    "remember ROM hashes in the cfg directory and skip re-hashing unchanged files" },
+	{ OPTION_OUTPUT_BATCH,                               "0",         OPTION_BOOLEAN,    "send output changes to listeners once per frame instead of on every write" },
+	{ OPTION_LARGE_PAGES,                                "32",        OPTION_INTEGER,    "back memory regions of at least this many megabytes with large pages where the host supports it (0 = never)" },
 
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "SCRIPTING OPTIONS" },
 	{ OPTION_AUTOBOOT_COMMAND ";ab",                     nullptr,     OPTION_STRING,     "command to execute after machine boot" },
@@ -215,6 +230,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_HTTP,                                       "0",         OPTION_BOOLEAN,    "enable HTTP server" },
 	{ OPTION_HTTP_PORT,                                  "8080",      OPTION_INTEGER,    "HTTP server port" },
 	{ OPTION_HTTP_ROOT,                                  "web",       OPTION_STRING,     "HTTP server document root" },
+	{ OPTION_HTTP_STREAM "(0-120)",                      "0",         OPTION_INTEGER,    "frames per second sent to /stream WebSocket clients (0 = disabled)" },
 
 	{ nullptr }
 };
@@ -64,6 +64,7 @@
 #define OPTION_SNAPSIZE             "snapsize"
 #define OPTION_SNAPVIEW             "snapview"
 #define OPTION_SNAPBILINEAR         "snapbilinear"
+#define OPTION_ASYNCRECORD          "asyncrecord"
 #define OPTION_STATENAME            "statename"
 #define OPTION_BURNIN               "burnin"
 
@@ -76,6 +77,8 @@
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
 #define OPTION_LOWLATENCY           "lowlatency"
+#define OPTION_VRR                  "vrr"
+#define OPTION_TILEMAPTHREADS       "tilemapthreads"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -118,6 +121,7 @@
 #define OPTION_SAMPLERATE           "samplerate"
 #define OPTION_SAMPLES              "samples"
 #define OPTION_VOLUME               "volume"
+#define OPTION_HQRESAMPLE           "hqresample"
 
 // core input options
 #define OPTION_COIN_LOCKOUT         "coin_lockout"
@@ -149,17 +153,25 @@
 
 // core debugging options
 #define OPTION_LOG                  "log"
+#define OPTION_LOG_DEFER            "logdefer"
+#define OPTION_LOG_RATE             "lograte"
 #define OPTION_DEBUG                "debug"
 #define OPTION_VERBOSE              "verbose"
 #define OPTION_OSLOG                "oslog"
 #define OPTION_UPDATEINPAUSE        "update_in_pause"
 #define OPTION_DEBUGSCRIPT          "debugscript"
+#define OPTION_SCHEDSTATS           "schedstats"
+#define OPTION_MEMHEAT              "memheat"
+#define OPTION_PCPROFILE            "pcprofile"
+#define OPTION_SOUNDSTATS           "soundstats"
+#define OPTION_PROFILE_TRACE        "profile_trace"
 
 // core misc options
 #define OPTION_DRC                  "drc"
 #define OPTION_DRC_USE_C            "drc_use_c"
 #define OPTION_DRC_LOG_UML          "drc_log_uml"
 #define OPTION_DRC_LOG_NATIVE       "drc_log_native"
+#define OPTION_DRC_PERF_MAP         "drc_perf_map"
 #define OPTION_BIOS                 "bios"
 #define OPTION_CHEAT                "cheat"
 #define OPTION_SKIP_GAMEINFO        "skip_gameinfo"
@@ -167,6 +179,9 @@
 #define OPTION_UI                   "ui"
 #define OPTION_RAMSIZE              "ramsize"
 #define OPTION_NVRAM_SAVE           "nvram_save"
+#define OPTION_HASH_CACHE           "hashcache"
+#define OPTION_OUTPUT_BATCH         "output_batch"
+#define OPTION_LARGE_PAGES          "largepages"
 
 // core comm options
 #define OPTION_COMM_LOCAL_HOST      "comm_localhost"
@@ -192,6 +207,7 @@
 #define OPTION_HTTP                 "http"
 #define OPTION_HTTP_PORT            "http_port"
 #define OPTION_HTTP_ROOT            "http_root"
+#define OPTION_HTTP_STREAM          "http_stream"
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -342,6 +358,7 @@ public:
 	const char *snap_size() const { return value(OPTION_SNAPSIZE); }
 	const char *snap_view() const { return value(OPTION_SNAPVIEW); }
 	bool snap_bilinear() const { return bool_value(OPTION_SNAPBILINEAR); }
+	bool async_record() const { return bool_value(OPTION_ASYNCRECORD); }
 	const char *state_name() const { return value(OPTION_STATENAME); }
 	bool burnin() const { return bool_value(OPTION_BURNIN); }
 
@@ -354,6 +371,8 @@ public:
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
 	bool low_latency() const { return bool_value(OPTION_LOWLATENCY); }
+	bool vrr() const { return bool_value(OPTION_VRR); }
+	bool tilemap_threads() const { return bool_value(OPTION_TILEMAPTHREADS); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -396,6 +415,7 @@ public:
 	int sample_rate() const { return int_value(OPTION_SAMPLERATE); }
 	bool samples() const { return bool_value(OPTION_SAMPLES); }
 	int volume() const { return int_value(OPTION_VOLUME); }
+	bool hq_resample() const { return bool_value(OPTION_HQRESAMPLE); }
 
 	// core input options
 	bool coin_lockout() const { return bool_value(OPTION_COIN_LOCKOUT); }
@@ -425,17 +445,25 @@ public:
 
 	// core debugging options
 	bool log() const { return bool_value(OPTION_LOG); }
+	bool log_defer() const { return bool_value(OPTION_LOG_DEFER); }
+	int log_rate() const { return int_value(OPTION_LOG_RATE); }
 	bool debug() const { return bool_value(OPTION_DEBUG); }
 	bool verbose() const { return bool_value(OPTION_VERBOSE); }
 	bool oslog() const { return bool_value(OPTION_OSLOG); }
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
+	bool sched_stats() const { return bool_value(OPTION_SCHEDSTATS); }
+	int mem_heat() const { return int_value(OPTION_MEMHEAT); }
+	int pc_profile() const { return int_value(OPTION_PCPROFILE); }
+	bool sound_stats() const { return bool_value(OPTION_SOUNDSTATS); }
+	const char *profile_trace() const { return value(OPTION_PROFILE_TRACE); }
 
 	// core misc options
 	bool drc() const { return bool_value(OPTION_DRC); }
 	bool drc_use_c() const { return bool_value(OPTION_DRC_USE_C); }
 	bool drc_log_uml() const { return bool_value(OPTION_DRC_LOG_UML); }
 	bool drc_log_native() const { return bool_value(OPTION_DRC_LOG_NATIVE); }
+	bool drc_perf_map() const { return bool_value(OPTION_DRC_PERF_MAP); }
 	const char *bios() const { return value(OPTION_BIOS); }
 	bool cheat() const { return bool_value(OPTION_CHEAT); }
 	bool skip_gameinfo() const { return bool_value(OPTION_SKIP_GAMEINFO); }
@@ -443,6 +471,9 @@ public:
 	ui_option ui() const { return m_ui; }
 	const char *ram_size() const { return value(OPTION_RAMSIZE); }
 	bool nvram_save() const { return bool_value(OPTION_NVRAM_SAVE); }
+	bool hash_cache() const { return bool_value(OPTION_HASH_CACHE); }
+	bool output_batch() const { return bool_value(OPTION_OUTPUT_BATCH); }
+	int large_pages() const { return int_value(OPTION_LARGE_PAGES); }
 
 	// core comm options
 	const char *comm_localhost() const { return value(OPTION_COMM_LOCAL_HOST); }
@@ -472,6 +503,7 @@ public:
 	bool  http() const { return bool_value(OPTION_HTTP); }
 	short http_port() const { return int_value(OPTION_HTTP_PORT); }
 	const char *http_root() const { return value(OPTION_HTTP_ROOT); }
+	int http_stream() const { return int_value(OPTION_HTTP_STREAM); }
 
 	// slots and devices - the values for these are stored outside of the core_options
 	// structure
@@ -267,6 +267,28 @@ util::hash_collection &emu_file::hashes(const char *types)
 }
 
 
+//-------------------------------------------------
+//  hash_cache_key - return a string identifying
+//  the file's contents by path, size and age,
+//  or an empty string if that isn't possible
+//-------------------------------------------------
+
+std::string emu_file::hash_cache_key()
+{
+	// archive entries were identified when they were opened
+	if (!m_zipkey.empty())
+		return m_zipkey;
+	if (m_fullpath.empty() || m_zipfile || !m_zipdata.empty())
+		return std::string();
+
+	// plain files are identified by their directory entry
+	auto const entry(osd_stat(m_fullpath));
+	if (!entry || entry->type != osd::directory::entry::entry_type::FILE)
+		return std::string();
+	return string_format("%s\t%u\t%d", m_fullpath, entry->size, entry->last_modified.time_since_epoch().count());
+}
+
+
 //-------------------------------------------------
 //  open - open a file by searching paths
 //-------------------------------------------------
@@ -392,6 +414,7 @@ void emu_file::close()
 	m_file.reset();
 
 	m_zipdata.clear();
+	m_zipkey.clear();
 
 	if (m_remove_on_close)
 		osd_file::remove(m_fullpath);
@@ -706,6 +729,21 @@ osd_file::error emu_file::attempt_zipped()
 				m_zipfile = std::move(zip);
 				m_ziplength = m_zipfile->current_uncompressed_length();
 
+				// remember enough about the archive and entry to recognise it next time
+				std::string const archivepath(m_fullpath + suffixes[i]);
+				auto const archive(osd_stat(archivepath));
+				if (archive)
+				{
+					m_zipkey = string_format("%s\t%s\t%u\t%d\t%08x\t%d\t%d",
+							archivepath,
+							m_zipfile->current_name(),
+							archive->size,
+							archive->last_modified.time_since_epoch().count(),
+							m_zipfile->current_crc(),
+							m_ziplength,
+							m_zipfile->current_last_modified().time_since_epoch().count());
+				}
+
 				// build a hash with just the CRC
 				m_hashes.reset();
 				m_hashes.add_crc(m_zipfile->current_crc());
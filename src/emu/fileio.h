@@ -96,6 +96,7 @@ public:
 	const char *fullpath() const { return m_fullpath.c_str(); }
 	u32 openflags() const { return m_openflags; }
 	util::hash_collection &hashes(const char *types);
+	std::string hash_cache_key();
 	bool restrict_to_mediapath() const { return m_restrict_to_mediapath; }
 	bool part_of_mediapath(std::string path);
 
@@ -103,6 +104,7 @@ public:
 	void remove_on_close() { m_remove_on_close = true; }
 	void set_openflags(u32 openflags) { assert(!m_file); m_openflags = openflags; }
 	void set_restrict_to_mediapath(bool rtmp = true) { m_restrict_to_mediapath = rtmp; }
+	void set_known_hashes(const util::hash_collection &hashes) { m_hashes = hashes; }
 
 	// open/close
 	osd_file::error open(const std::string &name);
@@ -164,6 +166,7 @@ private:
 	std::unique_ptr<util::archive_file> m_zipfile;  // ZIP file pointer
 	std::vector<u8>         m_zipdata;               // ZIP file data
 	u64                     m_ziplength;             // ZIP file length
+	std::string             m_zipkey;                // identifies the archive entry for hash caching
 
 	bool                    m_remove_on_close;       // flag: remove the file when closing
 	bool                    m_restrict_to_mediapath; // flag: restrict to paths inside the media-path
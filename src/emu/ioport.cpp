@@ -458,8 +458,10 @@ void digital_joystick::frame_update()
 	for (direction_t direction = JOYDIR_UP; direction < JOYDIR_COUNT; ++direction)
 		for (const std::reference_wrapper<ioport_field> &i : m_field[direction])
 		{
+			// keep the result so the field doesn't have to evaluate its sequence again
 			machine = &i.get().machine();
-			if (machine->input().seq_pressed(i.get().seq(SEQ_TYPE_STANDARD)))
+			i.get().live().joypressed = machine->input().seq_pressed(i.get().seq(SEQ_TYPE_STANDARD));
+			if (i.get().live().joypressed)
 				m_current |= 1 << direction;
 		}
 
@@ -1105,8 +1107,9 @@ void ioport_field::frame_update(ioport_value &result)
 		return;
 	}
 
-	// if the state changed, look for switch down/switch up
-	bool curstate = m_digital_value || machine().input().seq_pressed(seq());
+	// if the state changed, look for switch down/switch up; digital joystick
+	// directions were already sampled this frame when the joysticks were updated
+	bool curstate = m_digital_value || ((m_live->joystick != nullptr) ? m_live->joypressed : machine().input().seq_pressed(seq()));
 	bool changed = false;
 	if (curstate != m_live->last)
 	{
@@ -1354,6 +1357,7 @@ ioport_field_live::ioport_field_live(ioport_field &field, analog_field *analog)
 		value(field.defvalue()),
 		impulse(0),
 		last(0),
+		joypressed(false),
 		toggle(field.toggle()),
 		joydir(digital_joystick::JOYDIR_COUNT),
 		lockout(false)
@@ -2051,11 +2055,15 @@ void ioport_manager::frame_update()
 		playback_port(*port.second.get());
 		record_port(*port.second.get());
 
-		// call device line write handlers
-		ioport_value newvalue = port.second->read();
-		for (dynamic_field &dynfield : port.second->live().writelist)
-			if (dynfield.field().type() != IPT_OUTPUT)
-				dynfield.write(newvalue);
+		// call device line write handlers; most ports have none, so only
+		// assemble the port value when something will look at it
+		if (!port.second->live().writelist.empty())
+		{
+			ioport_value newvalue = port.second->read();
+			for (dynamic_field &dynfield : port.second->live().writelist)
+				if (dynfield.field().type() != IPT_OUTPUT)
+					dynfield.write(newvalue);
+		}
 	}
 
 	g_profiler.stop();
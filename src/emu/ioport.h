@@ -1167,6 +1167,7 @@ struct ioport_field_live
 	ioport_value            value;              // current value of this port
 	u8                      impulse;            // counter for impulse controls
 	bool                    last;               // were we pressed last time?
+	bool                    joypressed;         // sequence state sampled by the digital joystick this frame
 	bool                    toggle;             // current toggle setting
 	digital_joystick::direction_t joydir;       // digital joystick direction index
 	bool                    lockout;            // user lockout
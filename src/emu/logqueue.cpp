@@ -0,0 +1,146 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    logqueue.cpp
+
+    Deferred formatting of error log messages.
+
+***************************************************************************/
+
+#include "emu.h"
+
+
+//**************************************************************************
+//  LOG QUEUE
+//**************************************************************************
+
+//-------------------------------------------------
+//  log_queue - constructor
+//-------------------------------------------------
+
+log_queue::log_queue(output_func &&output, size_t capacity)
+	: m_output(std::move(output))
+	, m_capacity(record_size(capacity))
+	, m_head(0)
+	, m_tail(0)
+	, m_draining(false)
+	, m_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO))
+{
+	m_buffer = std::make_unique<u8 []>(m_capacity);
+}
+
+
+//-------------------------------------------------
+//  ~log_queue - destructor
+//-------------------------------------------------
+
+log_queue::~log_queue()
+{
+	flush(true);
+	osd_work_queue_free(m_queue);
+}
+
+
+//-------------------------------------------------
+//  flush - start rendering everything captured so
+//  far, and optionally wait until it's written
+//-------------------------------------------------
+
+void log_queue::flush(bool wait)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (m_head != m_tail)
+	{
+		start_drain();
+		if (!wait)
+			break;
+		lock.unlock();
+		osd_work_queue_wait(m_queue, osd_ticks_per_second());
+		lock.lock();
+	}
+}
+
+
+//-------------------------------------------------
+//  reserve - find room for a record of the given
+//  size, waiting for the worker if the ring is
+//  full; called with the lock held
+//-------------------------------------------------
+
+void *log_queue::reserve(std::unique_lock<std::mutex> &lock, size_t size)
+{
+	for (;;)
+	{
+		// records never wrap, so skip the tail end of the ring if needed
+		size_t const pos = m_head % m_capacity;
+		size_t const skip = (pos + size > m_capacity) ? (m_capacity - pos) : 0;
+		if (m_capacity - (m_head - m_tail) >= size + skip)
+		{
+			if (skip)
+			{
+				new (&m_buffer[pos]) record(skip, nullptr);
+				m_head += skip;
+			}
+			return &m_buffer[m_head % m_capacity];
+		}
+
+		// the worker is behind; let it catch up
+		start_drain();
+		lock.unlock();
+		osd_work_queue_wait(m_queue, osd_ticks_per_second());
+		lock.lock();
+	}
+}
+
+
+//-------------------------------------------------
+//  start_drain - queue the worker unless it's
+//  already pending
+//-------------------------------------------------
+
+void log_queue::start_drain()
+{
+	if (!m_draining.exchange(true))
+		osd_work_item_queue(m_queue, drain_callback, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+
+//-------------------------------------------------
+//  drain - render everything captured when the
+//  worker started and pass it on as one batch
+//-------------------------------------------------
+
+void log_queue::drain()
+{
+	size_t start, end;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		start = m_tail;
+		end = m_head;
+	}
+
+	// producers only write past the head, so the range is ours until the tail moves
+	m_text.clear();
+	m_text.seekp(0);
+	while (start != end)
+	{
+		record *const entry = reinterpret_cast<record *>(&m_buffer[start % m_capacity]);
+		size_t const size = entry->m_size;
+		entry->render(m_text);
+		entry->~record();
+		start += size;
+	}
+	m_text.put('\0');
+	m_output(&m_text.vec()[0]);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_tail = end;
+	m_draining = false;
+}
+
+void *log_queue::drain_callback(void *param, int threadid)
+{
+	reinterpret_cast<log_queue *>(param)->drain();
+	return nullptr;
+}
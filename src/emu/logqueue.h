@@ -0,0 +1,169 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    logqueue.h
+
+    Deferred formatting of error log messages.
+
+    Messages are captured as their format string plus copies of their
+    arguments into a ring buffer.  Text is only rendered when a batch is
+    drained on a worker thread and handed to the output function.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __EMU_H__
+#error Dont include this file directly; include emu.h instead.
+#endif
+
+#ifndef MAME_EMU_LOGQUEUE_H
+#define MAME_EMU_LOGQUEUE_H
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+//**************************************************************************
+//  HELPERS
+//**************************************************************************
+
+namespace emu { namespace detail {
+
+// how each argument is held until it's rendered
+template <typename T> struct log_capture_pointer { typedef T *type; };
+template <> struct log_capture_pointer<char> { typedef std::string type; };
+template <> struct log_capture_pointer<const char> { typedef std::string type; };
+template <typename T> struct log_capture { typedef T type; };
+template <typename T> struct log_capture<T *> { typedef typename log_capture_pointer<T>::type type; };
+template <typename T> using log_capture_t = typename log_capture<std::decay_t<T> >::type;
+
+// string literals are kept by pointer, anything else is copied
+template <typename Format> using log_format_t = std::conditional_t<
+		std::is_array<std::remove_reference_t<Format> >::value && std::is_const<std::remove_reference_t<Format> >::value,
+		const char *,
+		std::string>;
+
+// %n stores through its argument, so pointers to numbers are never deferred
+template <typename T> struct log_safe_arg : std::integral_constant<bool,
+		std::is_copy_constructible<log_capture_t<T> >::value &&
+		!(std::is_pointer<std::decay_t<T> >::value && std::is_arithmetic<std::remove_pointer_t<std::decay_t<T> > >::value && !std::is_same<std::remove_cv_t<std::remove_pointer_t<std::decay_t<T> > >, char>::value)> { };
+template <typename... T> struct log_safe_args;
+template <typename T, typename... U> struct log_safe_args<T, U...> : std::integral_constant<bool, log_safe_arg<T>::value && log_safe_args<U...>::value> { };
+template <> struct log_safe_args<> : std::true_type { };
+
+template <typename Format, typename... Params> struct log_deferrable : std::integral_constant<bool,
+		std::is_constructible<std::string, Format>::value && log_safe_args<Params...>::value> { };
+
+} } // namespace emu::detail
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> log_queue
+
+class log_queue
+{
+public:
+	typedef std::function<void (const char *)> output_func;
+
+	// construction/destruction
+	log_queue(output_func &&output, size_t capacity);
+	~log_queue();
+
+	// capture a message for later formatting; returns false if the
+	// arguments can't safely outlive the call and must be formatted now
+	template <typename Format, typename... Params>
+	bool push(const char *prefix, Format &&fmt, Params &&... args)
+	{
+		return push_deferred<Format, Params...>(std::integral_constant<bool, emu::detail::log_deferrable<Format, Params...>::value>(), prefix, fmt, args...);
+	}
+
+	// capture text that has already been formatted
+	void push_text(const char *text) { push_deferred<const char (&)[3], const char *>(std::true_type(), nullptr, "%s", text); }
+
+	// start draining anything pending; optionally wait for it to be written
+	void flush(bool wait);
+
+private:
+	// a captured message, constructed in place in the ring
+	class record
+	{
+	public:
+		record(size_t size, const char *prefix) : m_size(size), m_prefix(prefix) { }
+		virtual ~record() { }
+		virtual void render(util::ovectorstream &stream) const { }
+
+		size_t m_size;              // bytes occupied in the ring
+		const char *m_prefix;       // device tag, or nullptr
+	};
+
+	template <typename Format, typename... Params>
+	class message_record : public record
+	{
+	public:
+		template <typename F, typename... P>
+		message_record(size_t size, const char *prefix, F const &fmt, P const &... args) : record(size, prefix), m_format(fmt), m_args(args...) { }
+
+		virtual void render(util::ovectorstream &stream) const override
+		{
+			if (m_prefix)
+				util::stream_format(stream, "[%s] ", m_prefix);
+			apply(stream, std::make_index_sequence<sizeof...(Params)>());
+		}
+
+	private:
+		template <std::size_t... I>
+		void apply(util::ovectorstream &stream, std::index_sequence<I...>) const { util::stream_format(stream, m_format, std::get<I>(m_args)...); }
+
+		Format m_format;
+		std::tuple<Params...> m_args;
+	};
+
+	static constexpr size_t RECORD_ALIGN = (alignof(std::max_align_t) > sizeof(record)) ? alignof(std::max_align_t) : sizeof(record);
+	static constexpr size_t record_size(size_t size) { return (size + RECORD_ALIGN - 1) & ~(RECORD_ALIGN - 1); }
+
+	template <typename Format, typename... Params>
+	bool push_deferred(std::false_type, const char *prefix, Format const &fmt, Params const &... args) { return false; }
+
+	template <typename Format, typename... Params>
+	bool push_deferred(std::true_type, const char *prefix, Format const &fmt, Params const &... args)
+	{
+		typedef message_record<emu::detail::log_format_t<Format>, emu::detail::log_capture_t<Params>...> record_type;
+		size_t const size = record_size(sizeof(record_type));
+		std::unique_lock<std::mutex> lock(m_mutex);
+		new (reserve(lock, size)) record_type(size, prefix, fmt, args...);
+		m_head += size;
+		if (m_head - m_tail >= m_capacity / 4)
+			start_drain();
+		return true;
+	}
+
+	// internal helpers
+	void *reserve(std::unique_lock<std::mutex> &lock, size_t size);
+	void start_drain();
+	void drain();
+	static void *drain_callback(void *param, int threadid);
+
+	// internal state
+	output_func                 m_output;           // receives rendered batches
+	std::unique_ptr<u8 []>      m_buffer;           // ring of captured records
+	size_t                      m_capacity;         // size of the ring in bytes
+	size_t                      m_head;             // total bytes ever written
+	size_t                      m_tail;             // total bytes ever rendered
+	std::mutex                  m_mutex;            // guards head and tail
+	std::atomic<bool>           m_draining;         // a drain is queued or running
+	osd_work_queue *            m_queue;            // worker that renders batches
+	util::ovectorstream         m_text;             // rendering buffer, used by the worker only
+};
+
+#endif // MAME_EMU_LOGQUEUE_H
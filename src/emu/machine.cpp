@@ -95,6 +95,24 @@
 
 
 
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// a save state captured in memory and being compressed to disk on a worker
+struct running_machine::saveload_job
+{
+	saveload_job(std::unique_ptr<emu_file> &&file, std::unique_ptr<ram_state> &&state)
+		: m_file(std::move(file)), m_state(std::move(state)), m_result(STATERR_NONE), m_done(false) { }
+
+	std::unique_ptr<emu_file>   m_file;         // destination file
+	std::unique_ptr<ram_state>  m_state;        // snapshot of the machine state
+	save_error                  m_result;       // result of the write
+	std::atomic<bool>           m_done;         // set by the worker when finished
+};
+
+
+
 //**************************************************************************
 //  RUNNING MACHINE
 //**************************************************************************
@@ -123,9 +141,11 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 		m_ui_active(_config.options().ui_active()),
 		m_basename(_config.gamedrv().name),
 		m_sample_rate(_config.options().sample_rate()),
+		m_log_rate(_config.options().log_rate()),
 		m_saveload_schedule(saveload_schedule::NONE),
 		m_saveload_schedule_time(attotime::zero),
 		m_saveload_searchpath(nullptr),
+		m_saveload_queue(nullptr),
 
 		m_save(*this),
 		m_memory(*this),
@@ -156,6 +176,11 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 
 running_machine::~running_machine()
 {
+	if (m_saveload_queue)
+	{
+		while (!osd_work_queue_wait(m_saveload_queue, osd_ticks_per_second())) { }
+		osd_work_queue_free(m_saveload_queue);
+	}
 }
 
 
@@ -258,10 +283,27 @@ void running_machine::start()
 	// register callbacks for the devices, then start them
 	add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&running_machine::reset_all_devices, this));
 	add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::stop_all_devices, this));
+	if (options().sched_stats())
+		m_scheduler.start_stats();
 	save().register_presave(save_prepost_delegate(FUNC(running_machine::presave_all_devices), this));
 	start_all_devices();
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
 
+	// trace memory accesses once devices have installed their handlers
+	if (options().mem_heat() > 0)
+		m_memory.start_heatmap(options().mem_heat());
+
+	// sample program counters once every device can report one
+	if (options().pc_profile() > 0)
+		m_scheduler.start_pc_profile(options().pc_profile());
+
+	// record profiler scopes for a trace viewer
+	if (options().profile_trace() && *options().profile_trace())
+	{
+		g_profiler.start_trace(*this, options().profile_trace());
+		add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&profiler_state::stop_trace, &g_profiler));
+	}
+
 	// save outputs created before start time
 	output().register_save();
 
@@ -317,7 +359,13 @@ int running_machine::run(bool quiet)
 				throw emu_fatalerror("running_machine::run: unable to open log file");
 
 			using namespace std::placeholders;
-			add_logerror_callback(std::bind(&running_machine::logfile_callback, this, _1));
+			if (options().log_defer())
+			{
+				m_log_queue = std::make_unique<log_queue>(std::bind(&running_machine::logfile_callback, this, _1), 4 * 1024 * 1024);
+				add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&running_machine::log_frame_callback, this));
+			}
+			else
+				add_logerror_callback(std::bind(&running_machine::logfile_callback, this, _1));
 		}
 
 		// then finish setting up our local machine
@@ -377,6 +425,8 @@ int running_machine::run(bool quiet)
 			// handle save/load
 			if (m_saveload_schedule != saveload_schedule::NONE)
 				handle_saveload();
+			if (m_saveload_job)
+				finish_saveload_job(false);
 
 			g_profiler.stop();
 		}
@@ -385,11 +435,12 @@ int running_machine::run(bool quiet)
 		// and out via the exit phase
 		m_current_phase = machine_phase::EXIT;
 
-		// save the NVRAM and configuration
+		// save the NVRAM and configuration while any autosave finishes writing
 		sound().ui_mute(true);
 		if (options().nvram_save())
 			nvram_save();
 		m_configuration->save_settings();
+		finish_saveload_job(true);
 	}
 	catch (emu_fatalerror &fatal)
 	{
@@ -432,7 +483,8 @@ int running_machine::run(bool quiet)
 	call_notifiers(MACHINE_NOTIFY_EXIT);
 	util::archive_file::cache_clear();
 
-	// close the logfile
+	// write out anything still queued and close the logfile
+	m_log_queue.reset();
 	m_logfile.reset();
 	return error;
 }
@@ -658,6 +710,9 @@ void running_machine::immediate_save(const char *filename)
 
 	// jump right into the save, anonymous timers can't hurt us!
 	handle_saveload();
+
+	// callers expect the file to be complete on return
+	finish_saveload_job(true);
 }
 
 
@@ -818,14 +873,18 @@ void running_machine::add_logerror_callback(logerror_callback callback)
 
 //-------------------------------------------------
 //  strlog - send an error logging string to the
-//  debugger and any OSD-defined output streams
+//  debugger and any OSD-defined output streams;
+//  deferred strings are already in the log queue
 //-------------------------------------------------
 
-void running_machine::strlog(const char *str) const
+void running_machine::strlog(const char *str, bool deferred) const
 {
 	// log to all callbacks
 	for (auto &cb : m_logerror_list)
 		cb->m_func(str);
+
+	if (m_log_queue && !deferred)
+		m_log_queue->push_text(str);
 }
 
 
@@ -929,51 +988,44 @@ void running_machine::handle_saveload()
 		else
 		{
 			u32 const openflags = (m_saveload_schedule == saveload_schedule::LOAD) ? OPEN_FLAG_READ : (OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+			bool const load = (m_saveload_schedule == saveload_schedule::LOAD);
+
+			// only one state is written at a time, and a load may want the file being written
+			finish_saveload_job(true);
 
 			// open the file
-			emu_file file(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
-			auto const filerr = file.open(m_saveload_pending_file);
+			auto file = std::make_unique<emu_file>(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
+			auto const filerr = file->open(m_saveload_pending_file);
 			if (filerr == osd_file::error::NONE)
 			{
-				const char *const opnamed = (m_saveload_schedule == saveload_schedule::LOAD) ? "loaded" : "saved";
-
-				// read/write the save state
-				save_error saverr = (m_saveload_schedule == saveload_schedule::LOAD) ? m_save.read_file(file) : m_save.write_file(file);
-
-				// handle the result
-				switch (saverr)
+				if (load)
 				{
-				case STATERR_ILLEGAL_REGISTRATIONS:
-					popmessage("Error: Unable to %s state due to illegal registrations. See error.log for details.", opname);
-					break;
-
-				case STATERR_INVALID_HEADER:
-					popmessage("Error: Unable to %s state due to an invalid header. Make sure the save state is correct for this machine.", opname);
-					break;
-
-				case STATERR_READ_ERROR:
-					popmessage("Error: Unable to %s state due to a read error (file is likely corrupt).", opname);
-					break;
-
-				case STATERR_WRITE_ERROR:
-					popmessage("Error: Unable to %s state due to a write error. Verify there is enough disk space.", opname);
-					break;
-
-				case STATERR_NONE:
-					if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
-						popmessage("State successfully %s.\nWarning: Save states are not officially supported for this machine.", opnamed);
+					// read the save state
+					report_saveload(m_save.read_file(*file), true);
+				}
+				else
+				{
+					// snapshot the state now, and leave compressing it to disk to a worker
+					auto state = std::make_unique<ram_state>(m_save);
+					save_error const saverr = state->save();
+					if (saverr != STATERR_NONE)
+					{
+						report_saveload(saverr, false);
+						file->remove_on_close();
+					}
 					else
-						popmessage("State successfully %s.", opnamed);
-					break;
-
-				default:
-					popmessage("Error: Unknown error during state %s.", opnamed);
-					break;
+					{
+						if (!m_saveload_queue)
+							m_saveload_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+						m_saveload_job = std::make_unique<saveload_job>(std::move(file), std::move(state));
+						if (!m_saveload_queue || !osd_work_item_queue(m_saveload_queue, saveload_job_callback, m_saveload_job.get(), WORK_ITEM_FLAG_AUTO_RELEASE))
+						{
+							// no worker available, write it here
+							saveload_job_callback(m_saveload_job.get(), 0);
+							finish_saveload_job(true);
+						}
+					}
 				}
-
-				// close and perhaps delete the file
-				if (saverr != STATERR_NONE && m_saveload_schedule == saveload_schedule::SAVE)
-					file.remove_on_close();
 			}
 			else if (openflags == OPEN_FLAG_READ && filerr == osd_file::error::NOT_FOUND)
 				// attempt to load a non-existent savestate, report empty slot
@@ -990,6 +1042,88 @@ void running_machine::handle_saveload()
 }
 
 
+//-------------------------------------------------
+//  report_saveload - tell the user how a save or
+//  load went
+//-------------------------------------------------
+
+void running_machine::report_saveload(save_error saverr, bool load)
+{
+	const char *const opname = load ? "load" : "save";
+	const char *const opnamed = load ? "loaded" : "saved";
+
+	switch (saverr)
+	{
+	case STATERR_ILLEGAL_REGISTRATIONS:
+		popmessage("Error: Unable to %s state due to illegal registrations. See error.log for details.", opname);
+		break;
+
+	case STATERR_INVALID_HEADER:
+		popmessage("Error: Unable to %s state due to an invalid header. Make sure the save state is correct for this machine.", opname);
+		break;
+
+	case STATERR_READ_ERROR:
+		popmessage("Error: Unable to %s state due to a read error (file is likely corrupt).", opname);
+		break;
+
+	case STATERR_WRITE_ERROR:
+		popmessage("Error: Unable to %s state due to a write error. Verify there is enough disk space.", opname);
+		break;
+
+	case STATERR_NONE:
+		if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
+			popmessage("State successfully %s.\nWarning: Save states are not officially supported for this machine.", opnamed);
+		else
+			popmessage("State successfully %s.", opnamed);
+		break;
+
+	default:
+		popmessage("Error: Unknown error during state %s.", opnamed);
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  finish_saveload_job - report and close a
+//  background save once it has been written,
+//  optionally waiting for it
+//-------------------------------------------------
+
+void running_machine::finish_saveload_job(bool wait)
+{
+	if (!m_saveload_job)
+		return;
+
+	if (!m_saveload_job->m_done)
+	{
+		if (!wait)
+			return;
+		while (!osd_work_queue_wait(m_saveload_queue, osd_ticks_per_second())) { }
+	}
+
+	// report the result, deleting the file if it failed
+	report_saveload(m_saveload_job->m_result, false);
+	if (m_saveload_job->m_result != STATERR_NONE)
+		m_saveload_job->m_file->remove_on_close();
+	m_saveload_job.reset();
+}
+
+
+//-------------------------------------------------
+//  saveload_job_callback - write a captured state
+//  on the worker thread
+//-------------------------------------------------
+
+void *running_machine::saveload_job_callback(void *param, int threadid)
+{
+	saveload_job &job = *reinterpret_cast<saveload_job *>(param);
+	job.m_result = job.m_state->write_file(*job.m_file);
+	job.m_done = true;
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  soft_reset - actually perform a soft-reset
 //  of the system
@@ -1025,6 +1159,17 @@ void running_machine::logfile_callback(const char *buffer)
 }
 
 
+//-------------------------------------------------
+//  log_frame_callback - hand deferred log messages
+//  to the background writer once per frame
+//-------------------------------------------------
+
+void running_machine::log_frame_callback()
+{
+	m_log_queue->flush(false);
+}
+
+
 //-------------------------------------------------
 //  start_all_devices - start any unstarted devices
 //-------------------------------------------------
@@ -1269,6 +1414,8 @@ void running_machine::export_http_api()
 			response->set_content_type("application/json");
 			response->set_body(s.GetString());
 		});
+
+		m_video->export_http_api();
 	}
 }
 
@@ -169,6 +169,7 @@ public:
 	resource_pool &respool() { return m_respool; }
 	device_scheduler &scheduler() { return m_scheduler; }
 	save_manager &save() { return m_save; }
+	memory_arena &arena() { return m_arena; }
 	memory_manager &memory() { return m_memory; }
 	ioport_manager &ioport() { return m_ioport; }
 	parameters_manager &parameters() { return m_parameters; }
@@ -208,7 +209,10 @@ public:
 	emu_options &options() const { return m_config.options(); }
 	attotime time() const noexcept { return m_scheduler.time(); }
 	bool scheduled_event_pending() const { return m_exit_pending || m_hard_reset_pending; }
-	bool allow_logging() const { return !m_logerror_list.empty(); }
+	bool allow_logging() const { return !m_logerror_list.empty() || m_log_queue; }
+	bool immediate_logging() const { return !m_logerror_list.empty(); }
+	log_queue *deferred_log() const { return m_log_queue.get(); }
+	u32 log_rate() const { return m_log_rate; }
 
 	// fetch items by name
 	[[deprecated("absolute tag lookup; use subdevice or finder instead")]] inline device_t *device(const char *tag) const { return root_device().subdevice(tag); }
@@ -252,7 +256,7 @@ public:
 	void popmessage() const { popmessage(static_cast<char const *>(nullptr)); }
 	template <typename Format, typename... Params> void popmessage(Format &&fmt, Params &&... args) const;
 	template <typename Format, typename... Params> void logerror(Format &&fmt, Params &&... args) const;
-	void strlog(const char *str) const;
+	void strlog(const char *str, bool deferred = false) const;
 	u32 rand();
 	std::string describe_context() const;
 	std::string compose_saveload_filename(std::string &&base_filename, const char **searchpath = nullptr);
@@ -295,6 +299,9 @@ private:
 	void start();
 	void set_saveload_filename(std::string &&filename);
 	void handle_saveload();
+	void report_saveload(save_error saverr, bool load);
+	void finish_saveload_job(bool wait);
+	static void *saveload_job_callback(void *param, int threadid);
 	void soft_reset(void *ptr = nullptr, s32 param = 0);
 	std::string nvram_filename(device_t &device) const;
 	void nvram_load();
@@ -304,6 +311,7 @@ private:
 
 	// internal callbacks
 	void logfile_callback(const char *buffer);
+	void log_frame_callback();
 
 	// internal device helpers
 	void start_all_devices();
@@ -316,6 +324,7 @@ private:
 	const machine_config &  m_config;               // reference to the constructed machine_config
 	const game_driver &     m_system;               // reference to the definition of the game machine
 	machine_manager &       m_manager;              // reference to machine manager system
+	memory_arena            m_arena;                // storage for objects that live as long as the machine
 	// managers
 	std::unique_ptr<render_manager> m_render;          // internal data from render.cpp
 	std::unique_ptr<input_manager> m_input;            // internal data from input.cpp
@@ -348,6 +357,8 @@ private:
 	std::string             m_basename;             // basename used for game-related paths
 	int                     m_sample_rate;          // the digital audio sample rate
 	std::unique_ptr<emu_file>  m_logfile;              // pointer to the active log file
+	std::unique_ptr<log_queue> m_log_queue;         // deferred formatting for the log file
+	u32                     m_log_rate;             // per-device log messages per emulated second
 
 	// load/save management
 	enum class saveload_schedule
@@ -360,6 +371,9 @@ private:
 	attotime                m_saveload_schedule_time;
 	std::string             m_saveload_pending_file;
 	const char *            m_saveload_searchpath;
+	struct saveload_job;
+	std::unique_ptr<saveload_job> m_saveload_job;   // state being written in the background
+	osd_work_queue *        m_saveload_queue;       // worker queue for background writes
 
 	// notifier callbacks
 	struct notifier_callback_item
@@ -450,13 +464,18 @@ inline void running_machine::logerror(Format &&fmt, Params &&... args) const
 	{
 		g_profiler.start(PROFILER_LOGERROR);
 
-		// dump to the buffer
-		m_string_buffer.clear();
-		m_string_buffer.seekp(0);
-		util::stream_format(m_string_buffer, std::forward<Format>(fmt), std::forward<Params>(args)...);
-		m_string_buffer.put('\0');
-
-		strlog(&m_string_buffer.vec()[0]);
+		// capture for the log file without formatting if possible
+		bool const deferred = m_log_queue && m_log_queue->push(nullptr, fmt, args...);
+		if (!deferred || immediate_logging())
+		{
+			// dump to the buffer
+			m_string_buffer.clear();
+			m_string_buffer.seekp(0);
+			util::stream_format(m_string_buffer, std::forward<Format>(fmt), std::forward<Params>(args)...);
+			m_string_buffer.put('\0');
+
+			strlog(&m_string_buffer.vec()[0], deferred);
+		}
 
 		g_profiler.stop();
 	}
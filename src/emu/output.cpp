@@ -10,6 +10,8 @@
 #include "emu.h"
 #include "output.h"
 
+#include "emuopts.h"
+
 #include "coreutil.h"
 
 #include <algorithm>
@@ -32,6 +34,9 @@ output_manager::output_item::output_item(
 	, m_name(std::move(name))
 	, m_id(id)
 	, m_value(value)
+	, m_notified(value)
+	, m_sent(false)
+	, m_pending(false)
 	, m_notifylist()
 {
 }
@@ -43,6 +48,34 @@ void output_manager::output_item::notify(s32 value)
 		m_manager.machine().logerror("Output %s = %d (was %d)\n", m_name, value, m_value);
 	m_value = value;
 
+	// in batch mode, just remember the item changed until the next flush
+	if (m_manager.m_batch)
+	{
+		if (!m_pending)
+		{
+			m_pending = true;
+			m_manager.m_pending.emplace_back(this);
+		}
+		return;
+	}
+	send(value);
+}
+
+
+void output_manager::output_item::flush()
+{
+	// skip outputs that have ended up back where the notifiers last saw them
+	m_pending = false;
+	if (!m_sent || (m_value != m_notified))
+		send(m_value);
+}
+
+
+void output_manager::output_item::send(s32 value)
+{
+	m_notified = value;
+	m_sent = true;
+
 	// call the local notifiers first
 	for (auto const &notify : m_notifylist)
 		notify(m_name.c_str(), value);
@@ -76,6 +109,7 @@ void output_manager::item_proxy::resolve(device_t &device, std::string const &na
 
 output_manager::output_manager(running_machine &machine)
 	: m_machine(machine)
+	, m_batch(machine.options().output_batch())
 	, m_uniqueid(12345)
 {
 	// add callbacks
@@ -119,7 +153,9 @@ void output_manager::register_save()
 
 output_manager::output_item *output_manager::find_item(char const *string)
 {
-	auto item = m_itemtable.find(std::string(string));
+	// reuse the key's buffer rather than allocating a string for every lookup
+	m_lookup_key.assign(string);
+	auto item = m_itemtable.find(m_lookup_key);
 	if (item != m_itemtable.end())
 		return &item->second;
 
@@ -157,12 +193,15 @@ output_manager::output_item &output_manager::find_or_create_item(char const *out
 
 void output_manager::pause()
 {
+	// frames may not be updated while paused, so don't hold the change back
 	set_value("pause", 1);
+	flush();
 }
 
 void output_manager::resume()
 {
 	set_value("pause", 0);
+	flush();
 }
 
 
@@ -204,6 +243,24 @@ void output_manager::set_value(char const *outname, s32 value)
 }
 
 
+/*-------------------------------------------------
+    flush_pending - send the latest value of each
+    output changed since the last flush
+-------------------------------------------------*/
+
+void output_manager::flush_pending()
+{
+	// notifiers may set outputs, which get picked up by the next flush
+	std::vector<output_item *> pending;
+	pending.swap(m_pending);
+	for (output_item *item : pending)
+		item->flush();
+	pending.clear();
+	if (m_pending.empty())
+		m_pending.swap(pending);
+}
+
+
 /*-------------------------------------------------
     output_get_value - return the value of an
     output
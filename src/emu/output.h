@@ -70,14 +70,20 @@ private:
 		s32 get() const { return m_value; }
 		void set(s32 value) { if (m_value != value) { notify(value); } }
 		void notify(s32 value);
+		void flush();
 
 		void set_notifier(notifier_func callback, void *param) { m_notifylist.emplace_back(callback, param); }
 
 	private:
+		void send(s32 value);
+
 		output_manager      &m_manager;     // parent output manager
 		std::string const   m_name;         // string name of the item
 		u32 const           m_id;           // unique ID for this item
 		s32                 m_value;        // current value
+		s32                 m_notified;     // value last sent to the notifiers
+		bool                m_sent;         // have the notifiers been sent a value yet?
+		bool                m_pending;      // waiting for a flush in batch mode
 		notify_vector       m_notifylist;   // list of notifier callbacks
 	};
 
@@ -171,6 +177,9 @@ public:
 	// set the value for a given output
 	void set_value(const char *outname, s32 value);
 
+	// send changes batched since the last flush to the notifiers
+	void flush() { if (!m_pending.empty()) flush_pending(); }
+
 	// return the current value for a given output
 	s32 get_value(const char *outname);
 
@@ -194,6 +203,7 @@ private:
 	output_item *find_item(const char *string);
 	output_item &create_new_item(const char *outname, s32 value);
 	output_item &find_or_create_item(const char *outname, s32 value);
+	void flush_pending();
 
 	// event handlers
 	void pause();
@@ -204,6 +214,9 @@ private:
 	// internal state
 	running_machine &m_machine;                  // reference to our machine
 	std::unordered_map<std::string, output_item> m_itemtable;
+	std::string m_lookup_key;                    // reused buffer for looking up items by name
+	bool const m_batch;                          // notify once per frame instead of on every change
+	std::vector<output_item *> m_pending;        // items changed since the last flush in batch mode
 	notify_vector m_global_notifylist;
 	std::vector<std::reference_wrapper<output_item> > m_save_order;
 	std::unique_ptr<s32 []> m_save_data;
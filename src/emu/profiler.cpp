@@ -44,6 +44,38 @@ struct profile_string
 
 profiler_state g_profiler;
 
+static const profile_string s_profile_names[] =
+{
+	{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
+	{ PROFILER_MEM_REMAP,        "Memory Remapping" },
+	{ PROFILER_MEMREAD,          "Memory Read" },
+	{ PROFILER_MEMWRITE,         "Memory Write" },
+	{ PROFILER_VIDEO,            "Video Update" },
+	{ PROFILER_DRAWGFX,          "drawgfx" },
+	{ PROFILER_COPYBITMAP,       "copybitmap" },
+	{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
+	{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
+	{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
+	{ PROFILER_BLIT,             "OSD Blitting" },
+	{ PROFILER_SOUND,            "Sound Generation" },
+	{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
+	{ PROFILER_INPUT,            "Input Processing" },
+	{ PROFILER_MOVIE_REC,        "Movie Recording" },
+	{ PROFILER_LOGERROR,         "Error Logging" },
+	{ PROFILER_LUA,              "LUA" },
+	{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
+	{ PROFILER_USER1,            "User 1" },
+	{ PROFILER_USER2,            "User 2" },
+	{ PROFILER_USER3,            "User 3" },
+	{ PROFILER_USER4,            "User 4" },
+	{ PROFILER_USER5,            "User 5" },
+	{ PROFILER_USER6,            "User 6" },
+	{ PROFILER_USER7,            "User 7" },
+	{ PROFILER_USER8,            "User 8" },
+	{ PROFILER_PROFILER,         "Profiler" },
+	{ PROFILER_IDLE,             "Idle" }
+};
+
 
 
 //**************************************************************************
@@ -67,6 +99,16 @@ dummy_profiler_state::dummy_profiler_state()
 }
 
 
+//-------------------------------------------------
+//  start_trace - tracing needs the real profiler
+//-------------------------------------------------
+
+void dummy_profiler_state::start_trace(running_machine &machine, const char *filename)
+{
+	osd_printf_warning("Profiler tracing is not available in this build (build with PROFILER=1)\n");
+}
+
+
 
 //**************************************************************************
 //  REAL PROFILER STATE
@@ -77,6 +119,9 @@ dummy_profiler_state::dummy_profiler_state()
 //-------------------------------------------------
 
 real_profiler_state::real_profiler_state()
+	: m_calib_osd(0)
+	, m_calib_ticks(0)
+	, m_trace_machine(nullptr)
 {
 	memset(m_filo, 0, sizeof(m_filo));
 	memset(m_data, 0, sizeof(m_data));
@@ -101,6 +146,10 @@ void real_profiler_state::reset(bool enabled)
 		// set up dummy entry
 		m_filoptr->start = 0;
 		m_filoptr->type = PROFILER_TOTAL;
+
+		// remember where both clocks were so we can convert ticks to time
+		m_calib_osd = osd_ticks();
+		m_calib_ticks = get_profile_ticks();
 	}
 	else
 	{
@@ -141,38 +190,6 @@ const char *real_profiler_state::text(running_machine &machine)
 
 void real_profiler_state::update_text(running_machine &machine)
 {
-	static const profile_string names[] =
-	{
-		{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
-		{ PROFILER_MEM_REMAP,        "Memory Remapping" },
-		{ PROFILER_MEMREAD,          "Memory Read" },
-		{ PROFILER_MEMWRITE,         "Memory Write" },
-		{ PROFILER_VIDEO,            "Video Update" },
-		{ PROFILER_DRAWGFX,          "drawgfx" },
-		{ PROFILER_COPYBITMAP,       "copybitmap" },
-		{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
-		{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
-		{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
-		{ PROFILER_BLIT,             "OSD Blitting" },
-		{ PROFILER_SOUND,            "Sound Generation" },
-		{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
-		{ PROFILER_INPUT,            "Input Processing" },
-		{ PROFILER_MOVIE_REC,        "Movie Recording" },
-		{ PROFILER_LOGERROR,         "Error Logging" },
-		{ PROFILER_LUA,              "LUA" },
-		{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
-		{ PROFILER_USER1,            "User 1" },
-		{ PROFILER_USER2,            "User 2" },
-		{ PROFILER_USER3,            "User 3" },
-		{ PROFILER_USER4,            "User 4" },
-		{ PROFILER_USER5,            "User 5" },
-		{ PROFILER_USER6,            "User 6" },
-		{ PROFILER_USER7,            "User 7" },
-		{ PROFILER_USER8,            "User 8" },
-		{ PROFILER_PROFILER,         "Profiler" },
-		{ PROFILER_IDLE,             "Idle" }
-	};
-
 	// compute the total time for all bits, not including profiler or idle
 	u64 computed = 0;
 	profile_type curtype;
@@ -193,7 +210,6 @@ void real_profiler_state::update_text(running_machine &machine)
 	}
 
 	// loop over all types and generate the string
-	device_iterator iter(machine.root_device());
 	std::ostringstream stream;
 	for (curtype = PROFILER_DEVICE_FIRST; curtype < PROFILER_TOTAL; ++curtype)
 	{
@@ -212,14 +228,9 @@ void real_profiler_state::update_text(running_machine &machine)
 
 			// and then the text
 			if (curtype >= PROFILER_DEVICE_FIRST && curtype <= PROFILER_DEVICE_MAX)
-				util::stream_format(stream, "'%s'", iter.byindex(curtype - PROFILER_DEVICE_FIRST)->tag());
+				util::stream_format(stream, "'%s'", type_name(machine, curtype));
 			else
-				for (auto & name : names)
-					if (name.type == curtype)
-					{
-						stream << name.string;
-						break;
-					}
+				stream << type_name(machine, curtype);
 
 			// followed by a carriage return
 			stream << '\n';
@@ -230,3 +241,157 @@ void real_profiler_state::update_text(running_machine &machine)
 	memset(m_data, 0, sizeof(m_data));
 	m_text = stream.str();
 }
+
+
+//-------------------------------------------------
+//  type_name - return the display name for a
+//  profiler type: the device tag for executing
+//  devices, or the registered or built-in name
+//-------------------------------------------------
+
+std::string real_profiler_state::type_name(running_machine &machine, profile_type type) const
+{
+	if (type >= PROFILER_DEVICE_FIRST && type <= PROFILER_DEVICE_MAX)
+	{
+		device_execute_interface *const exec = execute_interface_iterator(machine.root_device()).byindex(type - PROFILER_DEVICE_FIRST);
+		return exec ? exec->device().tag() : std::string();
+	}
+	if (type >= PROFILER_NAMED_FIRST && type <= PROFILER_NAMED_MAX)
+		return (type - PROFILER_NAMED_FIRST < m_scope_names.size()) ? m_scope_names[type - PROFILER_NAMED_FIRST] : std::string();
+	for (auto &name : s_profile_names)
+		if (name.type == type)
+			return name.string;
+	return std::string();
+}
+
+
+//-------------------------------------------------
+//  snapshot - return the ticks accumulated for
+//  each type since the last text update, keyed
+//  by device tag or type name
+//-------------------------------------------------
+
+void real_profiler_state::snapshot(running_machine &machine, std::vector<std::pair<std::string, u64> > &result) const
+{
+	result.clear();
+	for (profile_type curtype = PROFILER_DEVICE_FIRST; curtype < PROFILER_TOTAL; ++curtype)
+		if (m_data[curtype] != 0)
+			result.emplace_back(type_name(machine, curtype), m_data[curtype]);
+}
+
+
+//-------------------------------------------------
+//  ticks_per_second - estimate the rate of the
+//  profile tick counter against osd_ticks
+//-------------------------------------------------
+
+double real_profiler_state::ticks_per_second() const
+{
+	// until we have 10ms of history, assume they run at the same rate
+	osd_ticks_t const tps = osd_ticks_per_second();
+	osd_ticks_t const elapsed = osd_ticks() - m_calib_osd;
+	if ((!enabled() && !m_trace_machine) || (elapsed < tps / 100))
+		return double(tps);
+	return double(get_profile_ticks() - m_calib_ticks) * double(tps) / double(elapsed);
+}
+
+
+//-------------------------------------------------
+//  register_scope - allocate a profiler type for
+//  a named scope, reusing an existing one with
+//  the same name; returns PROFILER_EXTRA if all
+//  named types are in use
+//-------------------------------------------------
+
+profile_type real_profiler_state::register_scope(const std::string &name)
+{
+	auto const found = std::find(m_scope_names.begin(), m_scope_names.end(), name);
+	if (found != m_scope_names.end())
+		return profile_type(PROFILER_NAMED_FIRST + (found - m_scope_names.begin()));
+	if (m_scope_names.size() > PROFILER_NAMED_MAX - PROFILER_NAMED_FIRST)
+		return PROFILER_EXTRA;
+	m_scope_names.emplace_back(name);
+	return profile_type(PROFILER_NAMED_FIRST + m_scope_names.size() - 1);
+}
+
+
+//-------------------------------------------------
+//  start_trace - enable the profiler and begin
+//  recording every scope entry and exit
+//-------------------------------------------------
+
+void real_profiler_state::start_trace(running_machine &machine, const char *filename)
+{
+	m_trace_filename = filename;
+	m_trace.clear();
+	m_trace.reserve(65536);
+	enable(true);
+	m_trace_machine = &machine;
+}
+
+
+//-------------------------------------------------
+//  stop_trace - stop recording and write out the
+//  trace
+//-------------------------------------------------
+
+void real_profiler_state::stop_trace()
+{
+	if (!m_trace_machine)
+		return;
+	write_trace();
+	m_trace_machine = nullptr;
+	m_trace.clear();
+	m_trace.shrink_to_fit();
+}
+
+
+//-------------------------------------------------
+//  write_trace - write the recorded events as a
+//  Chrome trace / Perfetto JSON file
+//-------------------------------------------------
+
+void real_profiler_state::write_trace()
+{
+	FILE *const file = fopen(m_trace_filename.c_str(), "w");
+	if (!file)
+	{
+		osd_printf_error("Error opening profiler trace file %s\n", m_trace_filename.c_str());
+		return;
+	}
+
+	// resolve every type name once up front, escaping for JSON
+	std::vector<std::string> names(PROFILER_TOTAL);
+	for (profile_type curtype = PROFILER_DEVICE_FIRST; curtype < PROFILER_TOTAL; ++curtype)
+		for (char const ch : type_name(*m_trace_machine, curtype))
+		{
+			if ((ch == '"') || (ch == '\\'))
+				names[curtype] += '\\';
+			names[curtype] += ch;
+		}
+
+	double const scale = 1000000.0 / ticks_per_second();
+	osd_ticks_t const base = m_trace.empty() ? 0 : m_trace.front().ticks;
+
+	fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+	fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"%s\"}}", m_trace_machine->basename());
+	for (trace_event const &event : m_trace)
+	{
+		if (event.type >= PROFILER_TOTAL)
+			continue;
+		char const *const category =
+				(event.type <= PROFILER_DEVICE_MAX) ? "device" :
+				(event.type >= PROFILER_NAMED_FIRST && event.type <= PROFILER_NAMED_MAX) ? "named" :
+				"core";
+		fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":1}",
+				names[event.type].c_str(),
+				category,
+				event.begin ? 'B' : 'E',
+				double(event.ticks - base) * scale);
+	}
+	fprintf(file, "\n]}\n");
+	fclose(file);
+
+	if (m_trace.size() >= MAX_TRACE_EVENTS)
+		osd_printf_warning("Profiler trace buffer filled; only the first %u events were written to %s\n", unsigned(MAX_TRACE_EVENTS), m_trace_filename.c_str());
+}
@@ -19,6 +19,14 @@
 
     the profiler handles a FILO list so calls may be nested.
 
+    Code that wants its own category can register a named scope once
+    and use the returned type like any other:
+
+        m_profile = g_profiler.register_scope("blitter");
+
+    With -profile_trace, every scope entry and exit is also recorded
+    and written out on exit in Chrome trace / Perfetto JSON format.
+
 ***************************************************************************/
 
 #ifndef MAME_EMU_PROFILER_H
@@ -65,6 +73,10 @@ enum profile_type
 	PROFILER_USER7,
 	PROFILER_USER8,
 
+	// named scopes allocated at run time by register_scope
+	PROFILER_NAMED_FIRST,
+	PROFILER_NAMED_MAX = PROFILER_NAMED_FIRST + 256,
+
 	PROFILER_PROFILER,
 	PROFILER_IDLE,
 	PROFILER_TOTAL
@@ -92,6 +104,15 @@ public:
 		return m_filoptr != nullptr;
 	}
 	const char *text(running_machine &machine);
+	void snapshot(running_machine &machine, std::vector<std::pair<std::string, u64> > &result) const;
+	double ticks_per_second() const;
+
+	// named scopes
+	profile_type register_scope(const std::string &name);
+
+	// tracing
+	void start_trace(running_machine &machine, const char *filename);
+	void stop_trace();
 
 	// enable/disable
 	void enable(bool state = true)
@@ -109,6 +130,18 @@ public:
 private:
 	void reset(bool enabled);
 	void update_text(running_machine &machine);
+	std::string type_name(running_machine &machine, profile_type type) const;
+	void write_trace();
+
+	//-------------------------------------------------
+	//  record_trace - append a scope entry or exit
+	//  to the trace buffer
+	//-------------------------------------------------
+	void record_trace(int type, osd_ticks_t ticks, bool begin)
+	{
+		if (m_trace.size() < MAX_TRACE_EVENTS)
+			m_trace.push_back(trace_event{ ticks, type, begin });
+	}
 
 	//-------------------------------------------------
 	//  real_start - mark the beginning of a
@@ -125,6 +158,8 @@ private:
 
 		// update previous entry
 		m_data[m_filoptr->type] += curticks - m_filoptr->start;
+		if (UNEXPECTED(m_trace_machine != nullptr))
+			record_trace(type, curticks, true);
 
 		// move to next entry
 		m_filoptr++;
@@ -148,6 +183,8 @@ private:
 
 		// account for the time taken
 		m_data[m_filoptr->type] += curticks - m_filoptr->start;
+		if (UNEXPECTED(m_trace_machine != nullptr))
+			record_trace(m_filoptr->type, curticks, false);
 
 		// move back an entry
 		m_filoptr--;
@@ -163,12 +200,28 @@ private:
 		osd_ticks_t     start;                      // start time
 	};
 
+	// a recorded scope entry or exit
+	struct trace_event
+	{
+		osd_ticks_t     ticks;                      // time of the event
+		int             type;                       // type of entry
+		bool            begin;                      // entry or exit
+	};
+
+	static constexpr size_t MAX_TRACE_EVENTS = 1 << 24;
+
 	// internal state
 	filo_entry *        m_filoptr;                  // current FILO index
 	std::string         m_text;                     // profiler text
 	attotime            m_text_time;                // profiler text last update
 	filo_entry          m_filo[32];                 // array of FILO entries
 	osd_ticks_t         m_data[PROFILER_TOTAL + 1]; // array of data
+	osd_ticks_t         m_calib_osd;                // osd_ticks when enabled, for calibration
+	osd_ticks_t         m_calib_ticks;              // profile ticks when enabled, for calibration
+	std::vector<std::string> m_scope_names;         // names of registered scopes
+	running_machine *   m_trace_machine;            // machine being traced, or nullptr
+	std::string         m_trace_filename;           // file to write the trace to
+	std::vector<trace_event> m_trace;               // recorded trace events
 };
 
 
@@ -183,6 +236,15 @@ public:
 	// getters
 	bool enabled() const { return false; }
 	const char *text(running_machine &machine) { return ""; }
+	void snapshot(running_machine &machine, std::vector<std::pair<std::string, u64> > &result) const { result.clear(); }
+	double ticks_per_second() const { return double(osd_ticks_per_second()); }
+
+	// named scopes
+	profile_type register_scope(const std::string &name) { return PROFILER_EXTRA; }
+
+	// tracing
+	void start_trace(running_machine &machine, const char *filename);
+	void stop_trace() { }
 
 	// enable/disable
 	void enable(bool state = true) { }
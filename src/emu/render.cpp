@@ -253,9 +253,11 @@ inline render_primitive *render_primitive_list::alloc(render_primitive::primitiv
 
 void render_primitive_list::release_all()
 {
-	// release all the live items while under the lock
-	m_primitive_allocator.reclaim_all(m_primlist);
-	m_reference_allocator.reclaim_all(m_reflist);
+	// drop the lists and reuse their storage; called under the lock
+	m_primlist.detach_all();
+	m_reflist.detach_all();
+	m_primitive_allocator.reset();
+	m_reference_allocator.reset();
 }
 
 
@@ -1015,6 +1017,7 @@ void render_target::set_view(int viewindex)
 	if (view)
 	{
 		m_curview = view;
+		view->preload();
 		view->recompute(m_layerconfig);
 	}
 }
@@ -1350,6 +1353,8 @@ render_primitive_list &render_target::get_primitives()
 			// if there is no associated element, it must be a screen element
 			if (curitem.screen() != nullptr)
 				add_container_primitives(list, root_xform, item_xform, curitem.screen()->container(), curitem.blend_mode());
+			else if (item_xform.color.a == 0.0f && (curitem.blend_mode() == BLENDMODE_ALPHA || curitem.blend_mode() == BLENDMODE_ADD))
+				continue; // fully transparent blended elements contribute nothing, so don't hand them to the OSD
 			else
 				add_element_primitives(list, item_xform, *curitem.element(), curitem.state(), curitem.blend_mode());
 		}
@@ -349,8 +349,8 @@ private:
 	simple_list<render_primitive> m_primlist;               // list of primitives
 	simple_list<reference> m_reflist;                       // list of references
 
-	fixed_allocator<render_primitive> m_primitive_allocator;// allocator for primitives
-	fixed_allocator<reference> m_reference_allocator;       // allocator for references
+	frame_allocator<render_primitive> m_primitive_allocator;// allocator for primitives
+	frame_allocator<reference> m_reference_allocator;       // allocator for references
 
 	std::recursive_mutex     m_lock;                             // lock to protect list accesses
 };
@@ -472,7 +472,7 @@ public:
 	void set_user_settings(const user_settings &settings);
 
 	// empty the item list
-	void empty() { m_item_allocator.reclaim_all(m_itemlist); }
+	void empty() { m_itemlist.detach_all(); m_item_allocator.reset(); }
 
 	// add items to the list
 	void add_line(float x0, float y0, float x1, float y1, float width, rgb_t argb, u32 flags);
@@ -532,7 +532,7 @@ private:
 	render_container *      m_next;                 // the next container in the list
 	render_manager &        m_manager;              // reference back to the owning manager
 	simple_list<item>       m_itemlist;             // head of the item list
-	fixed_allocator<item>   m_item_allocator;       // free container items
+	frame_allocator<item>   m_item_allocator;       // container items, reused wholesale
 	screen_device *         m_screen;               // the screen device
 	user_settings           m_user;                 // user settings
 	bitmap_argb32 *         m_overlaybitmap;        // overlay bitmap
@@ -572,6 +572,9 @@ public:
 	int maxstate() const { return m_maxstate; }
 	render_texture *state_texture(int state);
 
+	// operations
+	void preload();
+
 private:
 	/// \brief An image, rectangle, or disk in an element
 	///
@@ -600,6 +603,7 @@ private:
 
 		// operations
 		virtual void draw(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) = 0;
+		virtual void preload(running_machine &machine) { }
 
 	protected:
 		// helpers
@@ -822,6 +826,7 @@ public:
 
 	// operations
 	void recompute(render_layer_config layerconfig);
+	void preload();
 
 	// resolve tags, if any
 	void resolve_tags();
@@ -829,6 +834,8 @@ public:
 private:
 	struct layer_lists;
 
+	static void *preload_element(void *param, int threadid);
+
 	// add items, recursing for groups
 	void add_items(
 			layer_lists &layers,
@@ -996,8 +996,18 @@ private:
 				s32 curu = setup.startu + (y - setup.starty) * setup.dudy;
 				s32 curv = setup.startv + (y - setup.starty) * setup.dvdy;
 
+				// unscaled, unrotated no lookup case: each row is a contiguous span
+				// of the source, which the compiler can turn into a vector copy
+				if (palbase == nullptr && !_BilinearFilter && setup.dudx == 0x10000 && setup.dvdx == 0)
+				{
+					const u32 *src = reinterpret_cast<const u32 *>(prim.texture.base) + (curv >> 16) * prim.texture.rowpixels + (curu >> 16);
+					const s32 count = setup.endx - setup.startx;
+					for (s32 x = 0; x < count; x++)
+						dest[x] = source32_to_dest(src[x]);
+				}
+
 				// no lookup case
-				if (palbase == nullptr)
+				else if (palbase == nullptr)
 				{
 					// loop over cols
 					for (s32 x = setup.startx; x < setup.endx; x++)
@@ -445,6 +445,7 @@ void convert_command_glyph(std::string &str)
 
 
 const u64 render_font::CACHED_BDF_HASH_SIZE;
+const int render_font::ATLAS_SIZE;
 
 //**************************************************************************
 //  INLINE FUNCTIONS
@@ -523,7 +524,7 @@ inline render_font::glyph &render_font::get_char(char32_t chnum)
 			gl.bmwidth = int(glyph_ch.bmwidth * scale + 0.5f);
 			gl.bmheight = int(glyph_ch.bmheight * scale + 0.5f);
 
-			gl.bitmap.allocate(gl.bmwidth, gl.bmheight);
+			alloc_glyph_bitmap(gl, gl.bmwidth, gl.bmheight);
 			rectangle clip(
 					0, glyph_ch.bitmap.width() - 1,
 					0, glyph_ch.bitmap.height() - 1);
@@ -563,6 +564,9 @@ render_font::render_font(render_manager &manager, const char *filename)
 	, m_osdfont()
 	, m_height_cmd(0)
 	, m_yoffs_cmd(0)
+	, m_atlas_x(0)
+	, m_atlas_y(0)
+	, m_atlas_rowheight(0)
 {
 	memset(m_glyphs, 0, sizeof(m_glyphs));
 	memset(m_glyphs_cmd, 0, sizeof(m_glyphs_cmd));
@@ -655,8 +659,7 @@ void render_font::char_expand(char32_t chnum, glyph &gl)
 			return;
 
 		// allocate a new bitmap of the size we need
-		gl.bitmap.allocate(gl.bmwidth, m_height_cmd);
-		gl.bitmap.fill(0);
+		alloc_glyph_bitmap(gl, gl.bmwidth, m_height_cmd);
 
 		// extract the data
 		const char *ptr = gl.rawdata;
@@ -686,7 +689,8 @@ void render_font::char_expand(char32_t chnum, glyph &gl)
 			LOG("render_font::char_expand: previously failed to get bitmap from OSD font\n");
 			return;
 		}
-		if (!m_osdfont->get_bitmap(chnum, gl.bitmap, gl.width, gl.xoffs, gl.yoffs))
+		bitmap_argb32 tempbitmap;
+		if (!m_osdfont->get_bitmap(chnum, tempbitmap, gl.width, gl.xoffs, gl.yoffs))
 		{
 			// attempt to get the font bitmap failed - set bmwidth to -1
 			LOG("render_font::char_expand: get bitmap from OSD font failed\n");
@@ -696,10 +700,13 @@ void render_font::char_expand(char32_t chnum, glyph &gl)
 		}
 		else
 		{
-			// populate the bmwidth/bmheight fields
-			LOG("render_font::char_expand: got %dx%d bitmap from OSD font\n", gl.bitmap.width(), gl.bitmap.height());
-			gl.bmwidth = gl.bitmap.width();
-			gl.bmheight = gl.bitmap.height();
+			// populate the bmwidth/bmheight fields and move the bitmap into the atlas
+			LOG("render_font::char_expand: got %dx%d bitmap from OSD font\n", tempbitmap.width(), tempbitmap.height());
+			gl.bmwidth = tempbitmap.width();
+			gl.bmheight = tempbitmap.height();
+			alloc_glyph_bitmap(gl, gl.bmwidth, gl.bmheight);
+			for (int y = 0; y < gl.bmheight; y++)
+				std::copy_n(&tempbitmap.pix32(y), gl.bmwidth, &gl.bitmap.pix32(y));
 		}
 	}
 	else if (!gl.bmwidth || !gl.bmheight || !gl.rawdata)
@@ -714,8 +721,7 @@ void render_font::char_expand(char32_t chnum, glyph &gl)
 		LOG("render_font::char_expand: building bitmap from raw data\n");
 
 		// allocate a new bitmap of the size we need
-		gl.bitmap.allocate(gl.bmwidth, m_height);
-		gl.bitmap.fill(0);
+		alloc_glyph_bitmap(gl, gl.bmwidth, m_height);
 
 		// extract the data
 		const char *ptr = gl.rawdata;
@@ -780,6 +786,43 @@ void render_font::char_expand(char32_t chnum, glyph &gl)
 }
 
 
+//-------------------------------------------------
+//  alloc_glyph_bitmap - carve a cleared bitmap
+//  for a glyph out of the shared atlas pages
+//-------------------------------------------------
+
+void render_font::alloc_glyph_bitmap(glyph &gl, int width, int height)
+{
+	// oversized glyphs get a bitmap of their own
+	if (width > ATLAS_SIZE || height > ATLAS_SIZE)
+	{
+		gl.bitmap.allocate(width, height);
+		gl.bitmap.fill(0);
+		return;
+	}
+
+	// start a new shelf if this one is full, and a new page if there's no room for another shelf
+	if (m_atlas_x + width > ATLAS_SIZE)
+	{
+		m_atlas_x = 0;
+		m_atlas_y += m_atlas_rowheight;
+		m_atlas_rowheight = 0;
+	}
+	if (m_atlas.empty() || m_atlas_y + height > ATLAS_SIZE)
+	{
+		m_atlas.emplace_back(std::make_unique<bitmap_argb32>(ATLAS_SIZE, ATLAS_SIZE));
+		m_atlas.back()->fill(0);
+		m_atlas_x = m_atlas_y = m_atlas_rowheight = 0;
+	}
+
+	// wrap the glyph around its slot; pages are pre-cleared and never reused
+	bitmap_argb32 &page(*m_atlas.back());
+	gl.bitmap.wrap(&page.pix32(m_atlas_y, m_atlas_x), width, height, page.rowpixels());
+	m_atlas_x += width;
+	m_atlas_rowheight = (std::max)(m_atlas_rowheight, height);
+}
+
+
 //-------------------------------------------------
 //  get_char_texture_and_bounds - return the
 //  texture for a character and compute the
@@ -1571,6 +1614,10 @@ bool render_font::save_cached(const char *filename, u64 length, u32 hash)
 			}
 		}
 
+		// every glyph expanded above has been freed again, so drop the atlas pages holding them
+		m_atlas.clear();
+		m_atlas_x = m_atlas_y = m_atlas_rowheight = 0;
+
 		// seek back to the beginning and rewrite the table
 		if (!chartable.empty())
 		{
@@ -81,6 +81,7 @@ private:
 	// helpers
 	glyph &get_char(char32_t chnum);
 	void char_expand(char32_t chnum, glyph &ch);
+	void alloc_glyph_bitmap(glyph &gl, int width, int height);
 	bool load_cached_bdf(const char *filename);
 	bool load_bdf();
 	bool load_cached(emu_file &file, u64 length, u32 hash);
@@ -105,8 +106,14 @@ private:
 	EQUIVALENT_ARRAY(m_glyphs, glyph *) m_glyphs_cmd; // array of glyph subtables
 	std::vector<char>   m_rawdata_cmd;      // pointer to the raw data for the font
 
+	std::vector<std::unique_ptr<bitmap_argb32>> m_atlas; // shared pages holding expanded glyph bitmaps
+	int                 m_atlas_x;          // next free column on the current shelf
+	int                 m_atlas_y;          // top of the current shelf
+	int                 m_atlas_rowheight;  // height of the tallest glyph on the current shelf
+
 	// constants
 	static const u64 CACHED_BDF_HASH_SIZE   = 1024;
+	static const int ATLAS_SIZE             = 512;
 };
 
 void convert_command_glyph(std::string &s);
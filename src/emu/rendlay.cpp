@@ -1177,6 +1177,18 @@ void layout_group::resolve_bounds(
 
 
 
+//-------------------------------------------------
+//  preload - perform expensive loading upfront
+//  for all components
+//-------------------------------------------------
+
+void layout_element::preload()
+{
+	for (component::ptr const &curcomp : m_complist)
+		curcomp->preload(machine());
+}
+
+
 //-------------------------------------------------
 //  state_texture - return a pointer to a
 //  render_texture for the given state, allocating
@@ -1242,6 +1254,12 @@ public:
 
 protected:
 	// overrides
+	virtual void preload(running_machine &machine) override
+	{
+		if (!m_bitmap.valid())
+			load_bitmap();
+	}
+
 	virtual void draw(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) override
 	{
 		if (!m_bitmap.valid())
@@ -2193,6 +2211,12 @@ public:
 protected:
 	// overrides
 	virtual int maxstate() const override { return 65535; }
+	virtual void preload(running_machine &machine) override
+	{
+		for (int fruit = 0; fruit < m_numstops; fruit++)
+			if (m_file[fruit] && !m_bitmap[fruit].valid())
+				load_reel_bitmap(fruit);
+	}
 	virtual void draw(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) override
 	{
 		if (m_beltreel)
@@ -3028,6 +3052,52 @@ bool layout_view::has_screen(screen_device &screen) const
 }
 
 
+//-------------------------------------------------
+//  preload - decode artwork for all elements
+//  used by the view in parallel
+//-------------------------------------------------
+
+void layout_view::preload()
+{
+	// collect the distinct elements, since they may be shared between items
+	std::vector<layout_element *> elements;
+	for (item &curitem : m_items)
+		if (curitem.element())
+			elements.emplace_back(curitem.element());
+	std::sort(elements.begin(), elements.end());
+	elements.erase(std::unique(elements.begin(), elements.end()), elements.end());
+	if (elements.empty())
+		return;
+
+	// fall back to loading them one at a time if we can't get a work queue
+	osd_work_queue *const queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (!queue)
+	{
+		for (layout_element *elem : elements)
+			elem->preload();
+		return;
+	}
+
+	// each element owns its files and bitmaps, so they can be decoded independently
+	for (layout_element *elem : elements)
+		osd_work_item_queue(queue, &layout_view::preload_element, elem, WORK_ITEM_FLAG_AUTO_RELEASE);
+	while (!osd_work_queue_wait(queue, osd_ticks_per_second())) { }
+	osd_work_queue_free(queue);
+}
+
+
+//-------------------------------------------------
+//  preload_element - work item callback for
+//  preloading an element
+//-------------------------------------------------
+
+void *layout_view::preload_element(void *param, int threadid)
+{
+	reinterpret_cast<layout_element *>(param)->preload();
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  recompute - recompute the bounds and aspect
 //  ratio of a view and all of its contained items
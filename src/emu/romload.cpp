@@ -363,14 +363,14 @@ void rom_load_manager::dump_wrong_and_correct_checksums(const util::hash_collect
     and hash signatures of a file
 -------------------------------------------------*/
 
-void rom_load_manager::verify_length_and_hash(const char *name, u32 explength, const util::hash_collection &hashes)
+void rom_load_manager::verify_length_and_hash(emu_file *file, const char *name, u32 explength, const util::hash_collection &hashes)
 {
 	/* we've already complained if there is no file */
-	if (m_file == nullptr)
+	if (file == nullptr)
 		return;
 
 	/* verify length */
-	u32 actlength = m_file->size();
+	u32 actlength = file->size();
 	if (explength != actlength)
 	{
 		m_errorstring.append(string_format("%s WRONG LENGTH (expected: %08x found: %08x)\n", name, explength, actlength));
@@ -378,7 +378,7 @@ void rom_load_manager::verify_length_and_hash(const char *name, u32 explength, c
 	}
 
 	/* If there is no good dump known, write it */
-	util::hash_collection &acthashes = m_file->hashes(hashes.hash_types().c_str());
+	util::hash_collection &acthashes = file->hashes(hashes.hash_types().c_str());
 	if (hashes.flag(util::hash_collection::FLAG_NO_DUMP))
 	{
 		m_errorstring.append(string_format("%s NO GOOD DUMP KNOWN\n", name));
@@ -390,7 +390,7 @@ void rom_load_manager::verify_length_and_hash(const char *name, u32 explength, c
 		/* otherwise, it's just bad */
 		util::hash_collection &all_acthashes = acthashes.hash_types() == util::hash_collection::HASH_TYPES_ALL
 			? acthashes
-			: m_file->hashes(util::hash_collection::HASH_TYPES_ALL);
+			: file->hashes(util::hash_collection::HASH_TYPES_ALL);
 		m_errorstring.append(string_format("%s WRONG CHECKSUMS:\n", name));
 		dump_wrong_and_correct_checksums(hashes, all_acthashes);
 		m_warnings++;
@@ -404,6 +404,116 @@ void rom_load_manager::verify_length_and_hash(const char *name, u32 explength, c
 }
 
 
+/*-------------------------------------------------
+    verify_callback - compute the hashes for a
+    pending file on a worker thread
+-------------------------------------------------*/
+
+void *rom_load_manager::verify_callback(void *param, int threadid)
+{
+	pending_verify &verify = *reinterpret_cast<pending_verify *>(param);
+
+	/* compute what verify_length_and_hash will ask for so it finds the results cached */
+	util::hash_collection &acthashes = verify.m_file->hashes(verify.m_hashes.hash_types().c_str());
+	if (!verify.m_hashes.flag(util::hash_collection::FLAG_NO_DUMP) && verify.m_hashes != acthashes)
+		verify.m_file->hashes(util::hash_collection::HASH_TYPES_ALL);
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    flush_pending_verifies - hash the files
+    loaded so far in parallel, then verify them
+    in load order
+-------------------------------------------------*/
+
+void rom_load_manager::flush_pending_verifies()
+{
+	if (m_pending_verify.empty())
+		return;
+
+	/* hashing dominates for large files, so spread it across the processors */
+	osd_work_queue *queue = (m_pending_verify.size() > 1) ? osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI) : nullptr;
+	if (queue != nullptr)
+	{
+		osd_work_item_queue_multiple(queue, verify_callback, m_pending_verify.size(), &m_pending_verify[0], sizeof(m_pending_verify[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second())) { }
+		osd_work_queue_free(queue);
+	}
+
+	for (pending_verify &verify : m_pending_verify)
+	{
+		LOG("Verifying length (%X) and checksums for %s\n", verify.m_explength, verify.m_name.c_str());
+		verify_length_and_hash(verify.m_file.get(), verify.m_name.c_str(), verify.m_explength, verify.m_hashes);
+
+		/* remember complete hash sets for next time */
+		if (!verify.m_cachekey.empty())
+		{
+			util::hash_collection &acthashes = verify.m_file->hashes("");
+			if (acthashes.hash_types() == util::hash_collection::HASH_TYPES_ALL)
+			{
+				std::string hashes = acthashes.internal_string();
+				std::string &cached = m_hash_cache[verify.m_cachekey];
+				if (cached != hashes)
+				{
+					cached = std::move(hashes);
+					m_hash_cache_dirty = true;
+				}
+			}
+		}
+	}
+	m_pending_verify.clear();
+	m_pending_verify_size = 0;
+}
+
+
+/*-------------------------------------------------
+    load_hash_cache - read the hashes remembered
+    from previous runs
+-------------------------------------------------*/
+
+void rom_load_manager::load_hash_cache()
+{
+	emu_file file(machine().options().cfg_directory(), OPEN_FLAG_READ);
+	if (file.open("hashcache.txt") != osd_file::error::NONE)
+		return;
+
+	/* each line is the hashes, a tab, and the key */
+	char buffer[4096];
+	while (file.gets(buffer, ARRAY_LENGTH(buffer)) != nullptr)
+	{
+		std::string line(buffer);
+		while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
+			line.pop_back();
+		auto const tab = line.find('\t');
+		if (tab != std::string::npos && tab != 0)
+			m_hash_cache.emplace(line.substr(tab + 1), line.substr(0, tab));
+	}
+}
+
+
+/*-------------------------------------------------
+    save_hash_cache - write the remembered hashes
+    back out if anything changed
+-------------------------------------------------*/
+
+void rom_load_manager::save_hash_cache()
+{
+	if (!m_hash_cache_dirty)
+		return;
+
+	emu_file file(machine().options().cfg_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open("hashcache.txt") != osd_file::error::NONE)
+	{
+		osd_printf_warning("Unable to write ROM hash cache\n");
+		return;
+	}
+	for (auto const &entry : m_hash_cache)
+		file.printf("%s\t%s\n", entry.second, entry.first);
+	m_hash_cache_dirty = false;
+}
+
+
 /*-------------------------------------------------
     display_loading_rom_message - display
     messages about ROM loading to the user
@@ -846,6 +956,7 @@ void rom_load_manager::process_rom_entries(const char *regiontag, const rom_entr
 			int irrelevantbios = (ROM_GETBIOSFLAGS(romp) != 0 && ROM_GETBIOSFLAGS(romp) != device->system_bios());
 			const rom_entry *baserom = romp;
 			int explength = 0;
+			bool verify_pending = false;
 
 			/* open the file if it is a non-BIOS or matches the current BIOS */
 			LOG("Opening ROM file: %s\n", ROM_GETNAME(romp));
@@ -876,12 +987,25 @@ void rom_load_manager::process_rom_entries(const char *regiontag, const rom_entr
 				}
 				while (ROMENTRY_ISCONTINUE(romp) || ROMENTRY_ISIGNORE(romp));
 
-				/* if this was the first use of this file, verify the length and CRC */
-				if (baserom)
+				/* if this was the first use of this file, queue verification of the length and CRC */
+				if (baserom && m_file != nullptr)
 				{
-					LOG("Verifying length (%X) and checksums\n", explength);
-					verify_length_and_hash(ROM_GETNAME(baserom), explength, util::hash_collection(ROM_GETHASHDATA(baserom)));
-					LOG("Verify finished\n");
+					LOG("Queueing verification of length (%X) and checksums\n", explength);
+					m_pending_verify.emplace_back();
+					m_pending_verify.back().m_name = ROM_GETNAME(baserom);
+					m_pending_verify.back().m_explength = explength;
+					m_pending_verify.back().m_hashes.from_internal_string(ROM_GETHASHDATA(baserom));
+					verify_pending = true;
+
+					/* reuse hashes from a previous run if the file hasn't changed */
+					if (m_hash_cache_enabled)
+					{
+						std::string &key = m_pending_verify.back().m_cachekey;
+						key = m_file->hash_cache_key();
+						auto const found = key.empty() ? m_hash_cache.end() : m_hash_cache.find(key);
+						if (found != m_hash_cache.end())
+							m_file->set_known_hashes(util::hash_collection(found->second.c_str()));
+					}
 				}
 
 				/* reseek to the start and clear the baserom so we don't reverify */
@@ -892,8 +1016,15 @@ void rom_load_manager::process_rom_entries(const char *regiontag, const rom_entr
 			}
 			while (ROMENTRY_ISRELOAD(romp));
 
-			/* close the file */
-			if (m_file != nullptr)
+			/* close the file, or hand it over for verification */
+			if (verify_pending)
+			{
+				m_pending_verify_size += m_file->size();
+				m_pending_verify.back().m_file = std::move(m_file);
+				if (m_pending_verify_size >= PENDING_VERIFY_MAX_SIZE)
+					flush_pending_verifies();
+			}
+			else if (m_file != nullptr)
 			{
 				LOG("Closing ROM file\n");
 				m_file = nullptr;
@@ -904,6 +1035,9 @@ void rom_load_manager::process_rom_entries(const char *regiontag, const rom_entr
 			romp++; // something else - skip
 		}
 	}
+
+	/* verify everything this region loaded */
+	flush_pending_verifies();
 }
 
 
@@ -1426,6 +1560,9 @@ void rom_load_manager::process_region_list()
 
 rom_load_manager::rom_load_manager(running_machine &machine)
 	: m_machine(machine)
+	, m_pending_verify_size(0)
+	, m_hash_cache_enabled(machine.options().hash_cache())
+	, m_hash_cache_dirty(false)
 {
 	// figure out which BIOS we are using
 	std::map<std::string, std::string> card_bios;
@@ -1467,7 +1604,10 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 	m_chd_list.clear();
 
 	// process the ROM entries we were passed
+	if (m_hash_cache_enabled)
+		load_hash_cache();
 	process_region_list();
+	save_hash_cache();
 
 	// display the results and exit
 	display_rom_load_results(false);
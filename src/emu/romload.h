@@ -426,7 +426,11 @@ private:
 	void fill_random(u8 *base, u32 length);
 	void handle_missing_file(const rom_entry *romp, std::string tried_file_names, chd_error chderr);
 	void dump_wrong_and_correct_checksums(const util::hash_collection &hashes, const util::hash_collection &acthashes);
-	void verify_length_and_hash(const char *name, u32 explength, const util::hash_collection &hashes);
+	void verify_length_and_hash(emu_file *file, const char *name, u32 explength, const util::hash_collection &hashes);
+	void flush_pending_verifies();
+	static void *verify_callback(void *param, int threadid);
+	void load_hash_cache();
+	void save_hash_cache();
 	void display_loading_rom_message(const char *name, bool from_list);
 	void display_rom_load_results(bool from_list);
 	void region_post_process(memory_region *region, bool invert);
@@ -441,6 +445,19 @@ private:
 	void normalize_flags_for_device(const char *rgntag, u8 &width, endianness_t &endian);
 	void process_region_list();
 
+	// a loaded ROM file whose length and hashes haven't been checked yet
+	struct pending_verify
+	{
+		std::unique_ptr<emu_file> m_file;
+		std::string         m_name;
+		u32                 m_explength;
+		util::hash_collection m_hashes;
+		std::string         m_cachekey;
+	};
+
+	// hash pending files on worker threads once this much data is held open
+	static constexpr u64 PENDING_VERIFY_MAX_SIZE = 256 * 1024 * 1024;
+
 
 	// internal state
 	running_machine &   m_machine;            // reference to our machine
@@ -456,6 +473,12 @@ private:
 
 	std::unique_ptr<emu_file>  m_file;               /* current file */
 	std::vector<std::unique_ptr<open_chd>> m_chd_list;     /* disks */
+	std::vector<pending_verify> m_pending_verify; // files waiting for hash verification
+	u64                 m_pending_verify_size; // total size of those files
+
+	bool                m_hash_cache_enabled; // remember file hashes between runs?
+	bool                m_hash_cache_dirty;   // does the cache file need rewriting?
+	std::unordered_map<std::string, std::string> m_hash_cache; // hashes keyed by emu_file::hash_cache_key
 
 	memory_region *     m_region;             // info about current region
 
@@ -26,6 +26,8 @@
 #include "emuopts.h"
 #include "coreutil.h"
 
+#include <zlib.h>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -64,6 +66,7 @@ save_manager::save_manager(running_machine &machine)
 	: m_machine(machine)
 	, m_reg_allowed(true)
 	, m_illegal_regs(0)
+	, m_signature(0)
 {
 	m_rewind = std::make_unique<rewinder>(*this);
 }
@@ -82,7 +85,7 @@ void save_manager::allow_registration(bool allowed)
 	{
 		// look for duplicates
 		std::sort(m_entry_list.begin(), m_entry_list.end(),
-				[] (std::unique_ptr<state_entry> const& a, std::unique_ptr<state_entry> const& b) { return a->m_name < b->m_name; });
+				[] (state_entry const *a, state_entry const *b) { return a->m_name < b->m_name; });
 
 		int dupes_found = 0;
 		for (int i = 1; i < m_entry_list.size(); i++)
@@ -99,6 +102,9 @@ void save_manager::allow_registration(bool allowed)
 
 		dump_registry();
 
+		// the registry can't change any more, so every capture and restore can share one signature
+		m_signature = compute_signature();
+
 		// everything is registered by now, evaluate the savestate size
 		m_rewind->clamp_capacity();
 	}
@@ -115,7 +121,7 @@ const char *save_manager::indexed_item(int index, void *&base, u32 &valsize, u32
 	if (index >= m_entry_list.size() || index < 0)
 		return nullptr;
 
-	state_entry *entry = m_entry_list.at(index).get();
+	state_entry *entry = m_entry_list.at(index);
 	base = entry->m_data;
 	valsize = entry->m_typesize;
 	valcount = entry->m_typecount;
@@ -196,7 +202,7 @@ void save_manager::save_memory(device_t *device, const char *module, const char
 		totalname = string_format("%s/%X/%s", module, index, name);
 
 	// insert us into the list
-	m_entry_list.emplace_back(std::make_unique<state_entry>(val, totalname.c_str(), device, module, tag ? tag : "", index, valsize, valcount, blockcount, stride));
+	m_entry_list.emplace_back(machine().arena().create<state_entry>(val, totalname.c_str(), device, module, tag ? tag : "", index, valsize, valcount, blockcount, stride));
 }
 
 
@@ -268,9 +274,10 @@ save_error save_manager::read_file(emu_file &file)
 	// read all the data, flipping if necessary
 	for (auto &entry : m_entry_list)
 	{
-		const u32 blocksize = entry->m_typesize * entry->m_typecount;
+		const u32 blockcount = entry->contiguous() ? 1 : entry->m_blockcount;
+		const u32 blocksize = entry->m_typesize * entry->m_typecount * (entry->contiguous() ? entry->m_blockcount : 1);
 		u8 *data = reinterpret_cast<u8 *>(entry->m_data);
-		for (u32 b = 0; entry->m_blockcount > b; ++b, data += (entry->m_typesize * entry->m_stride))
+		for (u32 b = 0; blockcount > b; ++b, data += (entry->m_typesize * entry->m_stride))
 			if (file.read(data, blocksize) != blocksize)
 				return STATERR_READ_ERROR;
 
@@ -330,9 +337,10 @@ save_error save_manager::write_file(emu_file &file)
 	// then write all the data
 	for (auto &entry : m_entry_list)
 	{
-		const u32 blocksize = entry->m_typesize * entry->m_typecount;
+		const u32 blockcount = entry->contiguous() ? 1 : entry->m_blockcount;
+		const u32 blocksize = entry->m_typesize * entry->m_typecount * (entry->contiguous() ? entry->m_blockcount : 1);
 		const u8 *data = reinterpret_cast<const u8 *>(entry->m_data);
-		for (u32 b = 0; entry->m_blockcount > b; ++b, data += (entry->m_typesize * entry->m_stride))
+		for (u32 b = 0; blockcount > b; ++b, data += (entry->m_typesize * entry->m_stride))
 			if (file.write(data, blocksize) != blocksize)
 				return STATERR_WRITE_ERROR;
 	}
@@ -341,11 +349,11 @@ save_error save_manager::write_file(emu_file &file)
 
 
 //-------------------------------------------------
-//  signature - compute the signature, which
+//  compute_signature - compute the signature, which
 //  is a CRC over the structure of the data
 //-------------------------------------------------
 
-u32 save_manager::signature() const
+u32 save_manager::compute_signature() const
 {
 	// iterate over entries
 	u32 crc = 0;
@@ -442,6 +450,8 @@ save_manager::state_callback::state_callback(save_prepost_delegate callback)
 ram_state::ram_state(save_manager &save)
 	: m_save(save)
 	, m_data()
+	, m_raw_size(0)
+	, m_packed(false)
 	, m_valid(false)
 	, m_time(m_save.machine().time())
 {
@@ -478,6 +488,13 @@ save_error ram_state::save()
 {
 	// initialize
 	m_valid = false;
+	if (m_packed)
+	{
+		// drop the compressed copy and go back to a raw buffer
+		std::vector<u8>().swap(m_packed_data);
+		m_packed = false;
+		m_data.reserve(m_raw_size);
+	}
 	m_data.seekp(0);
 
 	// if we have illegal registrations, return an error
@@ -506,9 +523,10 @@ save_error ram_state::save()
 	// write all the data
 	for (auto &entry : m_save.m_entry_list)
 	{
-		const u32 blocksize = entry->m_typesize * entry->m_typecount;
+		const u32 blockcount = entry->contiguous() ? 1 : entry->m_blockcount;
+		const u32 blocksize = entry->m_typesize * entry->m_typecount * (entry->contiguous() ? entry->m_blockcount : 1);
 		const char *data = reinterpret_cast<const char *>(entry->m_data);
-		for (u32 b = 0; entry->m_blockcount > b; ++b, data += (entry->m_typesize * entry->m_stride))
+		for (u32 b = 0; blockcount > b; ++b, data += (entry->m_typesize * entry->m_stride))
 			m_data.write(data, blocksize);
 
 		// check for any errors
@@ -524,12 +542,90 @@ save_error ram_state::save()
 }
 
 
+//-------------------------------------------------
+//  write_file - write the captured state to a
+//  file in the same format as save_manager's
+//  write_file; doesn't touch the machine, so it
+//  can run on a worker thread
+//-------------------------------------------------
+
+save_error ram_state::write_file(emu_file &file) const
+{
+	if (!m_valid || m_packed)
+		return STATERR_WRITE_ERROR;
+
+	// write the header and turn on compression for the rest of the file
+	auto const &data = m_data.vec();
+	file.compress(FCOMPRESS_NONE);
+	file.seek(0, SEEK_SET);
+	if (file.write(&data[0], HEADER_SIZE) != HEADER_SIZE)
+		return STATERR_WRITE_ERROR;
+	file.compress(FCOMPRESS_MEDIUM);
+
+	// then write all the data
+	const u32 datasize = data.size() - HEADER_SIZE;
+	if (file.write(&data[HEADER_SIZE], datasize) != datasize)
+		return STATERR_WRITE_ERROR;
+	return STATERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  pack - compress the saved data and release
+//  the raw buffer; safe to call from a worker
+//  thread while the state isn't otherwise used
+//-------------------------------------------------
+
+void ram_state::pack()
+{
+	if (m_packed || !m_valid)
+		return;
+
+	auto const &data = m_data.vec();
+	uLongf packedsize = compressBound(data.size());
+	std::vector<u8> packed(packedsize);
+	if (compress2(&packed[0], &packedsize, reinterpret_cast<const Bytef *>(&data[0]), data.size(), Z_BEST_SPEED) != Z_OK || packedsize >= data.size())
+		return;
+
+	// keep only the compressed copy
+	packed.resize(packedsize);
+	packed.shrink_to_fit();
+	m_packed_data = std::move(packed);
+	m_raw_size = data.size();
+	m_data.vec(util::vectorstream::vector_type());
+	m_packed = true;
+}
+
+
 //-------------------------------------------------
 //  load - restore the machine state from the
-//  stream
+//  stream, unpacking it temporarily if needed
 //-------------------------------------------------
 
 save_error ram_state::load()
+{
+	if (!m_packed)
+		return load_data();
+
+	// inflate into a scratch buffer for the duration of the load
+	util::vectorstream::vector_type raw(m_raw_size);
+	uLongf rawsize = m_raw_size;
+	if (uncompress(reinterpret_cast<Bytef *>(&raw[0]), &rawsize, &m_packed_data[0], m_packed_data.size()) != Z_OK || rawsize != m_raw_size)
+		return STATERR_READ_ERROR;
+	m_data.vec(std::move(raw));
+
+	const save_error error = load_data();
+	m_data.vec(util::vectorstream::vector_type());
+	return error;
+}
+
+
+//-------------------------------------------------
+//  load_data - restore the machine state from the
+//  raw data in the stream
+//-------------------------------------------------
+
+save_error ram_state::load_data()
 {
 	// initialize
 	m_data.seekg(0);
@@ -557,9 +653,10 @@ save_error ram_state::load()
 	// read all the data, flipping if necessary
 	for (auto &entry : m_save.m_entry_list)
 	{
-		const u32 blocksize = entry->m_typesize * entry->m_typecount;
+		const u32 blockcount = entry->contiguous() ? 1 : entry->m_blockcount;
+		const u32 blocksize = entry->m_typesize * entry->m_typecount * (entry->contiguous() ? entry->m_blockcount : 1);
 		char *data = reinterpret_cast<char *>(entry->m_data);
-		for (u32 b = 0; entry->m_blockcount > b; ++b, data += (entry->m_typesize * entry->m_stride))
+		for (u32 b = 0; blockcount > b; ++b, data += (entry->m_typesize * entry->m_stride))
 			m_data.read(data, blocksize);
 
 		// check for any errors
@@ -590,7 +687,48 @@ rewinder::rewinder(save_manager &save)
 	, m_first_invalid_index(REWIND_INDEX_NONE)
 	, m_first_time_warning(true)
 	, m_first_time_note(true)
+	, m_pack_queue(nullptr)
 {
+	if (m_enabled)
+		m_pack_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+}
+
+
+//-------------------------------------------------
+//  ~rewinder - destructor
+//-------------------------------------------------
+
+rewinder::~rewinder()
+{
+	if (m_pack_queue)
+	{
+		wait_for_pack();
+		osd_work_queue_free(m_pack_queue);
+	}
+}
+
+
+//-------------------------------------------------
+//  wait_for_pack - make sure no state is being
+//  compressed before touching the state list
+//-------------------------------------------------
+
+void rewinder::wait_for_pack()
+{
+	if (m_pack_queue)
+		while (!osd_work_queue_wait(m_pack_queue, osd_ticks_per_second())) { }
+}
+
+
+//-------------------------------------------------
+//  pack_callback - compress a captured state on
+//  the worker thread
+//-------------------------------------------------
+
+void *rewinder::pack_callback(void *param, int threadid)
+{
+	reinterpret_cast<ram_state *>(param)->pack();
+	return nullptr;
 }
 
 
@@ -636,6 +774,9 @@ void rewinder::invalidate()
 	// is there anything to invalidate?
 	if (!current_index_is_last())
 	{
+		// don't race the worker over a state it's compressing
+		wait_for_pack();
+
 		// all states starting from the current one will be invalid
 		m_first_invalid_index = m_current_index;
 
@@ -659,11 +800,16 @@ bool rewinder::capture()
 		return false;
 	}
 
+	// the previous capture may still be compressing
+	wait_for_pack();
+
+	ram_state *captured;
 	if (current_index_is_last())
 	{
 		// we need to create a new state
 		std::unique_ptr<ram_state> state = std::make_unique<ram_state>(m_save);
 		const save_error error = state->save();
+		captured = state.get();
 
 		// validate the state
 		if (error == STATERR_NONE)
@@ -684,6 +830,7 @@ bool rewinder::capture()
 		// update the existing state
 		ram_state *state = m_state_list.at(m_current_index).get();
 		const save_error error = state->save();
+		captured = state;
 
 		// validate the state
 		if (error != STATERR_NONE)
@@ -705,6 +852,10 @@ bool rewinder::capture()
 	else
 		m_first_invalid_index = m_current_index + 1;
 
+	// compress the new state in the background so more of them fit in the capacity
+	if (m_pack_queue)
+		osd_work_item_queue(m_pack_queue, pack_callback, captured, WORK_ITEM_FLAG_AUTO_RELEASE);
+
 	// success
 	report_error(STATERR_NONE, rewind_operation::SAVE);
 	return true;
@@ -732,6 +883,9 @@ bool rewinder::step()
 		return false;
 	}
 
+	// the last capture may still be compressing
+	wait_for_pack();
+
 	// prepare to load the last valid index if we're too far ahead
 	if (m_first_invalid_index > REWIND_INDEX_NONE && m_current_index > m_first_invalid_index)
 		m_current_index = m_first_invalid_index;
@@ -761,26 +915,22 @@ bool rewinder::check_size()
 	if (!m_enabled)
 		return false;
 
-	// state sizes in bytes
+	// state sizes in bytes; packed states take less than the uncompressed size
 	const size_t singlesize = ram_state::get_size(m_save);
-	size_t totalsize = m_state_list.size() * singlesize;
+	size_t totalsize = 0;
+	for (auto &state : m_state_list)
+		totalsize += state->memory_size();
 
 	// convert our limit from megabytes
 	const size_t capsize = m_capacity * 1024 * 1024;
 
-	// safety check that shouldn't be allowed to trigger
-	if (totalsize > capsize)
+	// safety check that shouldn't be allowed to trigger: drop everything that's beyond capacity
+	while (totalsize > capsize && !m_state_list.empty())
 	{
-		// states to remove
-		const u32 count = (totalsize - capsize) / singlesize;
-
-		// drop everything that's beyond capacity
-		m_state_list.erase(m_state_list.begin(), m_state_list.begin() + count);
+		totalsize -= m_state_list.front()->memory_size();
+		m_state_list.erase(m_state_list.begin());
 	}
 
-	// update before new check
-	totalsize = m_state_list.size() * singlesize;
-
 	// check if capacity will be hit by the newly captured state
 	if (totalsize + singlesize >= capsize)
 	{
@@ -110,6 +110,7 @@ class save_manager
 
 		// helpers
 		void flip_data();
+		bool contiguous() const { return (m_blockcount <= 1) || (m_stride == m_typecount); } // can all blocks be copied in one go?
 
 		// state
 		void *          m_data;                 // pointer to the memory to save/restore
@@ -235,7 +236,8 @@ public:
 
 private:
 	// internal helpers
-	u32 signature() const;
+	u32 signature() const { return m_reg_allowed ? compute_signature() : m_signature; }
+	u32 compute_signature() const;
 	void dump_registry() const;
 	static save_error validate_header(const u8 *header, const char *gamename, u32 signature, void (CLIB_DECL *errormsg)(const char *fmt, ...), const char *error_prefix);
 
@@ -254,8 +256,9 @@ private:
 	std::unique_ptr<rewinder> m_rewind;               // rewinder
 	bool                      m_reg_allowed;          // are registrations allowed?
 	s32                       m_illegal_regs;         // number of illegal registrations
+	u32                       m_signature;            // signature of the registry, once registration is closed
 
-	std::vector<std::unique_ptr<state_entry>>    m_entry_list;       // list of registered entries
+	std::vector<state_entry *>    m_entry_list;       // list of registered entries, owned by the machine arena
 	std::vector<std::unique_ptr<ram_state>>      m_ramstate_list;    // list of ram states
 	std::vector<std::unique_ptr<state_callback>> m_presave_list;     // list of pre-save functions
 	std::vector<std::unique_ptr<state_callback>> m_postload_list;    // list of post-load functions
@@ -265,6 +268,11 @@ class ram_state
 {
 	save_manager &     m_save;                        // reference to save_manager
 	util::vectorstream m_data;                        // save data buffer
+	std::vector<u8>    m_packed_data;                 // zlib-compressed copy of the data when packed
+	size_t             m_raw_size;                    // size of the data before packing
+	bool               m_packed;                      // is the data only held compressed?
+
+	save_error load_data();
 
 public:
 	bool               m_valid;                       // can we load this state?
@@ -274,6 +282,9 @@ public:
 	static size_t get_size(save_manager &save);
 	save_error save();
 	save_error load();
+	save_error write_file(emu_file &file) const;
+	void pack();
+	size_t memory_size() const { return m_packed ? m_packed_data.size() : m_data.vec().size(); }
 };
 
 class rewinder
@@ -286,6 +297,7 @@ class rewinder
 	bool           m_first_time_warning;              // keep track of warnings we report
 	bool           m_first_time_note;                 // keep track of notes
 	std::vector<std::unique_ptr<ram_state>> m_state_list; // rewinder's own ram states
+	osd_work_queue * m_pack_queue;                    // worker that compresses captured states
 
 	// load/save management
 	enum class rewind_operation
@@ -303,9 +315,12 @@ class rewinder
 	bool check_size();
 	bool current_index_is_last() { return m_current_index == m_state_list.size() - 1; }
 	void report_error(save_error type, rewind_operation operation);
+	void wait_for_pack();
+	static void *pack_callback(void *param, int threadid);
 
 public:
 	rewinder(save_manager &save);
+	~rewinder();
 	bool enabled() { return m_enabled; }
 	void clamp_capacity();
 	void invalidate();
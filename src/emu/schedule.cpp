@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "debug/debugbuf.h"
 
 //**************************************************************************
 //  DEBUGGING
@@ -47,7 +48,7 @@ enum
 emu_timer::emu_timer() :
 	m_machine(nullptr),
 	m_next(nullptr),
-	m_prev(nullptr),
+	m_heap_index(-1),
 	m_param(0),
 	m_ptr(nullptr),
 	m_enabled(false),
@@ -75,12 +76,12 @@ emu_timer::~emu_timer()
 //  re-allocated as a non-device timer
 //-------------------------------------------------
 
-inline emu_timer &emu_timer::init(running_machine &machine, timer_expired_delegate callback, void *ptr, bool temporary)
+inline emu_timer &emu_timer::init(running_machine &machine, const timer_expired_delegate &callback, void *ptr, bool temporary)
 {
 	// ensure the entire timer state is clean
 	m_machine = &machine;
 	m_next = nullptr;
-	m_prev = nullptr;
+	m_heap_index = -1;
 	m_callback = callback;
 	m_param = 0;
 	m_ptr = ptr;
@@ -93,11 +94,13 @@ inline emu_timer &emu_timer::init(running_machine &machine, timer_expired_delega
 	m_id = 0;
 
 	// if we're not temporary, register ourselves with the save state system
+	// and insert into the heap; temporary timers are queued once by the
+	// adjust() that always follows
 	if (!m_temporary)
+	{
 		register_save();
-
-	// insert into the list
-	machine.scheduler().timer_list_insert(*this);
+		machine.scheduler().timer_heap_insert(*this);
+	}
 	return *this;
 }
 
@@ -112,7 +115,7 @@ inline emu_timer &emu_timer::init(device_t &device, device_timer_id id, void *pt
 	// ensure the entire timer state is clean
 	m_machine = &device.machine();
 	m_next = nullptr;
-	m_prev = nullptr;
+	m_heap_index = -1;
 	m_callback = timer_expired_delegate(FUNC(emu_timer::device_timer_expired), this);
 	m_param = 0;
 	m_ptr = ptr;
@@ -125,11 +128,13 @@ inline emu_timer &emu_timer::init(device_t &device, device_timer_id id, void *pt
 	m_id = id;
 
 	// if we're not temporary, register ourselves with the save state system
+	// and insert into the heap; temporary timers are queued once by the
+	// adjust() that always follows
 	if (!m_temporary)
+	{
 		register_save();
-
-	// insert into the list
-	machine().scheduler().timer_list_insert(*this);
+		machine().scheduler().timer_heap_insert(*this);
+	}
 	return *this;
 }
 
@@ -141,8 +146,8 @@ inline emu_timer &emu_timer::init(device_t &device, device_timer_id id, void *pt
 
 inline emu_timer &emu_timer::release()
 {
-	// unhook us from the global list
-	machine().scheduler().timer_list_remove(*this);
+	// unhook us from the global heap
+	machine().scheduler().timer_heap_remove(*this);
 	return *this;
 }
 
@@ -160,9 +165,8 @@ bool emu_timer::enable(bool enable)
 		// set the enable flag
 		m_enabled = enable;
 
-		// remove the timer and insert back into the list
-		machine().scheduler().timer_list_remove(*this);
-		machine().scheduler().timer_list_insert(*this);
+		// move the timer to its new position in the heap
+		machine().scheduler().timer_heap_update(*this);
 	}
 	return old;
 }
@@ -194,13 +198,15 @@ void emu_timer::adjust(attotime start_delay, s32 param, const attotime &period)
 	m_expire = m_start + start_delay;
 	m_period = period;
 
-	// remove and re-insert the timer in its new order
-	scheduler.timer_list_remove(*this);
-	scheduler.timer_list_insert(*this);
+	// insert the timer or move it to its new position in the heap
+	if (m_heap_index < 0)
+		scheduler.timer_heap_insert(*this);
+	else
+		scheduler.timer_heap_update(*this);
 
 	// if this was inserted as the head, abort the current timeslice and resync
 	if (this == scheduler.first_timer())
-		scheduler.abort_timeslice();
+		scheduler.abort_timeslice(device_scheduler::ABORT_TIMER);
 }
 
 
@@ -244,7 +250,9 @@ void emu_timer::register_save()
 	{
 		// for non-device timers, it is an index based on the callback function name
 		name = m_callback.name() ? m_callback.name() : "unnamed";
-		for (emu_timer *curtimer = machine().scheduler().first_timer(); curtimer != nullptr; curtimer = curtimer->next())
+		for (const auto &entry : machine().scheduler().m_timer_heap)
+		{
+			const emu_timer *curtimer = entry.m_timer;
 			if (!curtimer->m_temporary && curtimer->m_device == nullptr)
 			{
 				if (curtimer->m_callback.name() != nullptr && m_callback.name() != nullptr && strcmp(curtimer->m_callback.name(), m_callback.name()) == 0)
@@ -252,13 +260,14 @@ void emu_timer::register_save()
 				else if (curtimer->m_callback.name() == nullptr && m_callback.name() == nullptr)
 					index++;
 			}
+		}
 	}
 	else
 	{
 		// for device timers, it is an index based on the device and timer ID
 		name = string_format("%s/%d", m_device->tag(), m_id);
-		for (emu_timer *curtimer = machine().scheduler().first_timer(); curtimer != nullptr; curtimer = curtimer->next())
-			if (!curtimer->m_temporary && curtimer->m_device == m_device && curtimer->m_id == m_id)
+		for (const auto &entry : machine().scheduler().m_timer_heap)
+			if (!entry.m_timer->m_temporary && entry.m_timer->m_device == m_device && entry.m_timer->m_id == m_id)
 				index++;
 	}
 
@@ -282,10 +291,8 @@ inline void emu_timer::schedule_next_period()
 	m_start = m_expire;
 	m_expire += m_period;
 
-	// remove and re-insert us
-	device_scheduler &scheduler = machine().scheduler();
-	scheduler.timer_list_remove(*this);
-	scheduler.timer_list_insert(*this);
+	// move us to our new position in the heap
+	machine().scheduler().timer_heap_update(*this);
 }
 
 
@@ -332,16 +339,15 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_executing_device(nullptr),
 	m_execute_list(nullptr),
 	m_basetime(attotime::zero),
-	m_timer_list(nullptr),
+	m_timer_sequence(0),
 	m_callback_timer(nullptr),
 	m_callback_timer_modified(false),
 	m_callback_timer_expire_time(attotime::zero),
 	m_suspend_changes_pending(true),
 	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
 {
-	// append a single never-expiring timer so there is always one in the list
-	m_timer_list = &m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), nullptr, true);
-	m_timer_list->adjust(attotime::never);
+	// append a single never-expiring timer so there is always one in the heap
+	m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), nullptr, true).adjust(attotime::never);
 
 	// register global states
 	machine.save().save_item(NAME(m_basetime));
@@ -357,8 +363,8 @@ device_scheduler::device_scheduler(running_machine &machine) :
 device_scheduler::~device_scheduler()
 {
 	// remove all timers
-	while (m_timer_list != nullptr)
-		m_timer_allocator.reclaim(m_timer_list->release());
+	while (!m_timer_heap.empty())
+		m_timer_allocator.reclaim(m_timer_heap.back().m_timer->release());
 }
 
 
@@ -386,8 +392,8 @@ attotime device_scheduler::time() const noexcept
 bool device_scheduler::can_save() const
 {
 	// if any live temporary timers exit, fail
-	for (emu_timer *timer = m_timer_list; timer != nullptr; timer = timer->next())
-		if (timer->m_temporary && !timer->expire().is_never())
+	for (const auto &entry : m_timer_heap)
+		if (entry.m_timer->m_temporary && !entry.m_timer->expire().is_never())
 		{
 			machine().logerror("Failed save state attempt due to anonymous timers:\n");
 			dump_timers();
@@ -441,14 +447,15 @@ void device_scheduler::timeslice()
 		m_quantum_allocator.reclaim(m_quantum_list.detach_head());
 
 	// loop until we hit the next timer
-	while (m_basetime < m_timer_list->m_expire)
+	while (m_basetime < m_timer_heap.front().m_expire)
 	{
 		// by default, assume our target is the end of the next quantum
 		attotime target(m_basetime + attotime(0, m_quantum_list.first()->m_actual));
 
 		// however, if the next timer is going to fire before then, override
-		if (m_timer_list->m_expire < target)
-			target = m_timer_list->m_expire;
+		if (m_timer_heap.front().m_expire < target)
+			target = m_timer_heap.front().m_expire;
+		const attotime slice_start = m_basetime;
 
 		LOG("------------------\n");
 		LOG("cpu_timeslice: target = %s\n", target.as_string(PRECISION));
@@ -506,23 +513,32 @@ void device_scheduler::timeslice()
 						assert(ran >= exec->m_cycles_stolen);
 						ran -= exec->m_cycles_stolen;
 						g_profiler.stop();
+
+						if (UNEXPECTED(m_stats))
+							record_slice(*exec, ran);
 					}
 
 					// account for these cycles
 					exec->m_totalcycles += ran;
 
-					// update the local time for this CPU
-					attotime deltatime;
+					// update the local time for this CPU; less than a second
+					// ran is the common case and needs a single carry at most
 					if (ran < exec->m_cycles_per_second)
-						deltatime = attotime(0, exec->m_attoseconds_per_cycle * ran);
+					{
+						const attoseconds_t attos = exec->m_localtime.attoseconds() + exec->m_attoseconds_per_cycle * ran;
+						if (attos < ATTOSECONDS_PER_SECOND)
+							exec->m_localtime = attotime(exec->m_localtime.seconds(), attos);
+						else
+							exec->m_localtime = attotime(exec->m_localtime.seconds() + 1, attos - ATTOSECONDS_PER_SECOND);
+					}
 					else
 					{
 						u32 remainder;
 						s32 secs = divu_64x32_rem(ran, exec->m_cycles_per_second, &remainder);
-						deltatime = attotime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
+						attotime deltatime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
+						assert(deltatime >= attotime::zero);
+						exec->m_localtime += deltatime;
 					}
-					assert(deltatime >= attotime::zero);
-					exec->m_localtime += deltatime;
 					LOG("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION));
 
 					// if the new local CPU time is less than our target, move the target up, but not before the base
@@ -538,6 +554,11 @@ void device_scheduler::timeslice()
 
 		// update the base time
 		m_basetime = target;
+		if (UNEXPECTED(m_stats))
+		{
+			m_stats->m_timeslices++;
+			m_stats->m_slice_time += target - slice_start;
+		}
 	}
 
 	// execute timers
@@ -551,9 +572,14 @@ void device_scheduler::timeslice()
 //-------------------------------------------------
 
 void device_scheduler::abort_timeslice()
+{
+	abort_timeslice(ABORT_OTHER);
+}
+
+void device_scheduler::abort_timeslice(abort_cause cause)
 {
 	if (m_executing_device != nullptr)
-		m_executing_device->abort_timeslice();
+		m_executing_device->abort_timeslice(cause);
 }
 
 
@@ -588,6 +614,12 @@ void device_scheduler::boost_interleave(const attotime &timeslice_time, const at
 	// ignore timeslices > 1 second
 	if (timeslice_time.seconds() > 0)
 		return;
+	if (UNEXPECTED(m_stats))
+	{
+		m_stats->m_boosts++;
+		if (!boost_duration.is_never())
+			m_stats->m_boost_time += boost_duration;
+	}
 	add_scheduling_quantum(timeslice_time, boost_duration);
 }
 
@@ -597,7 +629,7 @@ void device_scheduler::boost_interleave(const attotime &timeslice_time, const at
 //  timer and return a pointer
 //-------------------------------------------------
 
-emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback, void *ptr)
+emu_timer *device_scheduler::timer_alloc(const timer_expired_delegate &callback, void *ptr)
 {
 	return &m_timer_allocator.alloc()->init(machine(), callback, ptr, false);
 }
@@ -609,7 +641,7 @@ emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback, void *
 //  amount of time
 //-------------------------------------------------
 
-void device_scheduler::timer_set(const attotime &duration, timer_expired_delegate callback, int param, void *ptr)
+void device_scheduler::timer_set(const attotime &duration, const timer_expired_delegate &callback, int param, void *ptr)
 {
 	m_timer_allocator.alloc()->init(machine(), callback, ptr, true).adjust(duration, param);
 }
@@ -681,25 +713,25 @@ void device_scheduler::presave()
 
 void device_scheduler::postload()
 {
-	// remove all timers and make a private list of permanent ones
-	simple_list<emu_timer> private_list;
-	while (m_timer_list != nullptr)
-	{
-		emu_timer &timer = *m_timer_list;
-
-		// temporary timers go away entirely (except our special never-expiring one)
-		if (timer.m_temporary && !timer.expire().is_never())
-			m_timer_allocator.reclaim(timer.release());
-
-		// permanent ones get added to our private list
-		else
-			private_list.append(timer_list_remove(timer));
-	}
+	// temporary timers go away entirely (except our special never-expiring one)
+	std::vector<emu_timer *> expired;
+	for (const auto &entry : m_timer_heap)
+		if (entry.m_timer->m_temporary && !entry.m_timer->expire().is_never())
+			expired.push_back(entry.m_timer);
+	for (emu_timer *timer : expired)
+		m_timer_allocator.reclaim(timer->release());
+
+	// take the permanent ones out in their old order; the heap still holds
+	// the cached times from before the load
+	std::vector<timer_heap_entry> private_list(m_timer_heap);
+	std::sort(private_list.begin(), private_list.end(), timer_heap_before);
+	for (const auto &entry : private_list)
+		entry.m_timer->m_heap_index = -1;
+	m_timer_heap.clear();
 
 	// now re-insert them; this effectively re-sorts them by time
-	emu_timer *timer;
-	while ((timer = private_list.detach_head()) != nullptr)
-		timer_list_insert(*timer);
+	for (const auto &entry : private_list)
+		timer_heap_insert(*entry.m_timer);
 
 	m_suspend_changes_pending = true;
 	rebuild_execute_list();
@@ -809,65 +841,155 @@ void device_scheduler::rebuild_execute_list()
 
 
 //-------------------------------------------------
-//  timer_list_insert - insert a new timer into
-//  the list at the appropriate location
+//  timer_heap_before - return true if the first
+//  entry fires before the second; timers with the
+//  same time fire in the order they were queued
 //-------------------------------------------------
 
-inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
+inline bool device_scheduler::timer_heap_before(const timer_heap_entry &first, const timer_heap_entry &second) noexcept
 {
-	// disabled timers sort to the end
-	const attotime expire = timer.m_enabled ? timer.m_expire : attotime::never;
+	// compare the parts directly, this is the innermost heap loop
+	if (first.m_expire.seconds() != second.m_expire.seconds())
+		return first.m_expire.seconds() < second.m_expire.seconds();
+	if (first.m_expire.attoseconds() != second.m_expire.attoseconds())
+		return first.m_expire.attoseconds() < second.m_expire.attoseconds();
+	return first.m_sequence < second.m_sequence;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_place - store an entry in the heap
+//  and tell its timer where it lives
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_place(int index, const timer_heap_entry &entry) noexcept
+{
+	m_timer_heap[index] = entry;
+	entry.m_timer->m_heap_index = index;
+}
 
-	// loop over the timer list
-	emu_timer *prevtimer = nullptr;
-	for (emu_timer *curtimer = m_timer_list; curtimer != nullptr; prevtimer = curtimer, curtimer = curtimer->next())
+
+//-------------------------------------------------
+//  timer_heap_sift_up - move an entry towards the
+//  root until its parent fires before it
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_sift_up(int index) noexcept
+{
+	const timer_heap_entry entry = m_timer_heap[index];
+	while (index > 0)
 	{
-		// if the current list entry expires after us, we should be inserted before it
-		if (curtimer->m_expire > expire)
-		{
-			// link the new guy in before the current list entry
-			timer.m_prev = prevtimer;
-			timer.m_next = curtimer;
+		const int parent = (index - 1) / TIMER_HEAP_ARITY;
+		if (!timer_heap_before(entry, m_timer_heap[parent]))
+			break;
+		timer_heap_place(index, m_timer_heap[parent]);
+		index = parent;
+	}
+	timer_heap_place(index, entry);
+}
 
-			if (prevtimer != nullptr)
-				prevtimer->m_next = &timer;
-			else
-				m_timer_list = &timer;
 
-			curtimer->m_prev = &timer;
-			return timer;
-		}
+//-------------------------------------------------
+//  timer_heap_sift_down - move an entry away from
+//  the root until it fires before all children
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_sift_down(int index) noexcept
+{
+	const timer_heap_entry entry = m_timer_heap[index];
+	const int count = int(m_timer_heap.size());
+	while (true)
+	{
+		// find the earliest child
+		const int first = index * TIMER_HEAP_ARITY + 1;
+		if (first >= count)
+			break;
+		const int last = std::min(first + TIMER_HEAP_ARITY, count);
+		int best = first;
+		for (int child = first + 1; child < last; child++)
+			if (timer_heap_before(m_timer_heap[child], m_timer_heap[best]))
+				best = child;
+
+		// stop if we fire before it
+		if (!timer_heap_before(m_timer_heap[best], entry))
+			break;
+		timer_heap_place(index, m_timer_heap[best]);
+		index = best;
 	}
+	timer_heap_place(index, entry);
+}
+
+
+//-------------------------------------------------
+//  timer_heap_fix - restore the heap order after
+//  the entry at index changed
+//-------------------------------------------------
 
-	// need to insert after the last one
-	if (prevtimer != nullptr)
-		prevtimer->m_next = &timer;
+inline void device_scheduler::timer_heap_fix(int index) noexcept
+{
+	if (index > 0 && timer_heap_before(m_timer_heap[index], m_timer_heap[(index - 1) / TIMER_HEAP_ARITY]))
+		timer_heap_sift_up(index);
 	else
-		m_timer_list = &timer;
+		timer_heap_sift_down(index);
+}
+
+
+//-------------------------------------------------
+//  timer_heap_insert - insert a new timer into
+//  the heap
+//-------------------------------------------------
+
+inline emu_timer &device_scheduler::timer_heap_insert(emu_timer &timer)
+{
+	assert(timer.m_heap_index < 0);
 
-	timer.m_prev = prevtimer;
-	timer.m_next = nullptr;
+	// disabled timers sort to the end
+	m_timer_heap.push_back(timer_heap_entry{ timer.m_enabled ? timer.m_expire : attotime::never, m_timer_sequence++, &timer });
+	timer_heap_sift_up(int(m_timer_heap.size()) - 1);
 	return timer;
 }
 
 
 //-------------------------------------------------
-//  timer_list_remove - remove a timer from the
-//  linked list
+//  timer_heap_remove - remove a timer from the
+//  heap
 //-------------------------------------------------
 
-inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
+inline emu_timer &device_scheduler::timer_heap_remove(emu_timer &timer)
 {
-	// remove it from the list
-	if (timer.m_prev != nullptr)
-		timer.m_prev->m_next = timer.m_next;
-	else
-		m_timer_list = timer.m_next;
+	const int index = timer.m_heap_index;
+	assert(index >= 0 && m_timer_heap[index].m_timer == &timer);
+	timer.m_heap_index = -1;
+
+	// move the last entry into the hole
+	const timer_heap_entry last = m_timer_heap.back();
+	m_timer_heap.pop_back();
+	if (index < int(m_timer_heap.size()))
+	{
+		timer_heap_place(index, last);
+		timer_heap_fix(index);
+	}
+	return timer;
+}
 
-	if (timer.m_next != nullptr)
-		timer.m_next->m_prev = timer.m_prev;
 
-	return timer;
+//-------------------------------------------------
+//  timer_heap_update - move a timer to its new
+//  position after its expiration time or enable
+//  state changed; this sorts like a remove and
+//  re-insert
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_update(emu_timer &timer)
+{
+	const int index = timer.m_heap_index;
+	assert(index >= 0 && m_timer_heap[index].m_timer == &timer);
+
+	// disabled timers sort to the end
+	timer_heap_entry &entry = m_timer_heap[index];
+	entry.m_expire = timer.m_enabled ? timer.m_expire : attotime::never;
+	entry.m_sequence = m_timer_sequence++;
+	timer_heap_fix(index);
 }
 
 
@@ -877,13 +999,13 @@ inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 
 inline void device_scheduler::execute_timers()
 {
-	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_list->m_expire.as_string(PRECISION));
+	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_heap.front().m_expire.as_string(PRECISION));
 
 	// now process any timers that are overdue
-	while (m_timer_list->m_expire <= m_basetime)
+	while (m_timer_heap.front().m_expire <= m_basetime)
 	{
 		// if this is a one-shot timer, disable it now
-		emu_timer &timer = *m_timer_list;
+		emu_timer &timer = *m_timer_heap.front().m_timer;
 		bool was_enabled = timer.m_enabled;
 		if (timer.m_period.is_zero() || timer.m_period.is_never())
 			timer.m_enabled = false;
@@ -904,6 +1026,8 @@ inline void device_scheduler::execute_timers()
 					LOG("execute_timers: timer device %s timer %d\n", timer.m_device->tag(), timer.m_id);
 				else
 					LOG("execute_timers: timer callback %s\n", timer.m_callback.name());
+				if (UNEXPECTED(m_stats))
+					record_timer(timer);
 				timer.m_callback(timer.m_ptr, timer.m_param);
 			}
 
@@ -981,7 +1105,228 @@ void device_scheduler::dump_timers() const
 {
 	machine().logerror("=============================================\n");
 	machine().logerror("Timer Dump: Time = %15s\n", time().as_string(PRECISION));
-	for (emu_timer *timer = first_timer(); timer != nullptr; timer = timer->next())
-		timer->dump();
+	std::vector<timer_heap_entry> sorted(m_timer_heap);
+	std::sort(sorted.begin(), sorted.end(), timer_heap_before);
+	for (const auto &entry : sorted)
+		entry.m_timer->dump();
 	machine().logerror("=============================================\n");
 }
+
+
+//-------------------------------------------------
+//  start_stats - start collecting scheduling
+//  statistics and report them on exit
+//-------------------------------------------------
+
+void device_scheduler::start_stats()
+{
+	m_stats = std::make_unique<stats>();
+	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&device_scheduler::stats_report, this));
+}
+
+
+//-------------------------------------------------
+//  record_slice - count a single run of a device
+//-------------------------------------------------
+
+void device_scheduler::record_slice(const device_execute_interface &exec, u32 cycles)
+{
+	device_stats &stats = m_stats->m_devices[&exec];
+	stats.m_slices++;
+	stats.m_cycles += cycles;
+
+	const u32 second = m_basetime.seconds();
+	if (stats.m_slices_per_second.size() <= second)
+		stats.m_slices_per_second.resize(second + 1, 0);
+	stats.m_slices_per_second[second]++;
+}
+
+
+//-------------------------------------------------
+//  record_abort - count a timeslice cut short
+//  for the executing device
+//-------------------------------------------------
+
+void device_scheduler::record_abort(abort_cause cause)
+{
+	m_stats->m_devices[m_executing_device].m_aborts[cause]++;
+}
+
+
+//-------------------------------------------------
+//  record_timer - count a timer callback
+//-------------------------------------------------
+
+void device_scheduler::record_timer(const emu_timer &timer)
+{
+	// string literals from FUNC() are unique enough to identify callbacks
+	auto const key = (timer.m_device != nullptr)
+			? std::make_pair(static_cast<const void *>(timer.m_device), timer.m_id)
+			: std::make_pair(static_cast<const void *>(timer.m_callback.name()), device_timer_id(0));
+	timer_stats &stats = m_stats->m_timers[key];
+	if (stats.m_fired++ == 0)
+	{
+		if (timer.m_device != nullptr)
+			stats.m_name = string_format("%s/%d", timer.m_device->tag(), timer.m_id);
+		else
+			stats.m_name = timer.m_callback.name() ? timer.m_callback.name() : "unnamed";
+	}
+}
+
+
+//-------------------------------------------------
+//  stats_report - print the scheduling statistics
+//-------------------------------------------------
+
+void device_scheduler::stats_report()
+{
+	const double seconds = m_basetime.as_double();
+	const double per_second = (seconds > 0.0) ? (1.0 / seconds) : 0.0;
+
+	osd_printf_info("Scheduler statistics for %.3f emulated seconds:\n", seconds);
+	osd_printf_info("  %u timeslices (%.1f/s), average length %s\n",
+			m_stats->m_timeslices, double(m_stats->m_timeslices) * per_second,
+			m_stats->m_timeslices ? attotime(0, m_stats->m_slice_time.as_attoseconds() / m_stats->m_timeslices).as_string(PRECISION) : "-");
+	osd_printf_info("  %u boost_interleave requests for %s\n", m_stats->m_boosts, m_stats->m_boost_time.as_string(PRECISION));
+
+	// devices in configuration order
+	osd_printf_info("  %-24s %10s %24s %12s %10s %10s %10s %10s\n", "device", "runs", "runs/s min/avg/max", "cycles/run", "ab:timer", "ab:susp", "ab:trig", "ab:other");
+	for (device_execute_interface &exec : execute_interface_iterator(machine().root_device()))
+	{
+		auto const found = m_stats->m_devices.find(&exec);
+		if (found == m_stats->m_devices.end())
+			continue;
+		const device_stats &stats = found->second;
+
+		// skip the partial last second for the minimum
+		u32 minimum = 0, maximum = 0;
+		const std::size_t full = std::max<std::size_t>(stats.m_slices_per_second.size(), 2) - 1;
+		for (std::size_t second = 0; second < stats.m_slices_per_second.size(); second++)
+		{
+			const u32 count = stats.m_slices_per_second[second];
+			if (second < full)
+				minimum = (second == 0) ? count : std::min(minimum, count);
+			maximum = std::max(maximum, count);
+		}
+		osd_printf_info("  %-24s %10u %24s %12.1f %10u %10u %10u %10u\n",
+				exec.device().tag(), stats.m_slices,
+				string_format("%u/%.0f/%u", minimum, double(stats.m_slices) * per_second, maximum),
+				stats.m_slices ? double(stats.m_cycles) / double(stats.m_slices) : 0.0,
+				stats.m_aborts[ABORT_TIMER], stats.m_aborts[ABORT_SUSPEND], stats.m_aborts[ABORT_TRIGGER], stats.m_aborts[ABORT_OTHER]);
+	}
+
+	// timer callbacks, busiest first
+	std::vector<const timer_stats *> timers;
+	for (auto const &entry : m_stats->m_timers)
+		timers.push_back(&entry.second);
+	std::stable_sort(timers.begin(), timers.end(), [] (const timer_stats *a, const timer_stats *b) { return a->m_fired > b->m_fired; });
+	osd_printf_info("  %-40s %10s %12s\n", "timer", "callbacks", "per second");
+	for (const timer_stats *timer : timers)
+		osd_printf_info("  %-40s %10u %12.1f\n", timer->m_name, timer->m_fired, double(timer->m_fired) * per_second);
+}
+
+
+//-------------------------------------------------
+//  start_pc_profile - sample the program counter
+//  of every executing device rate times per
+//  emulated second, and report them on exit
+//-------------------------------------------------
+
+void device_scheduler::start_pc_profile(u32 rate)
+{
+	if (m_pc_profile || !rate)
+		return;
+	m_pc_profile = std::make_unique<pc_samples>();
+	m_pc_profile->m_period = attotime::from_hz(rate);
+
+	for (device_execute_interface &exec : execute_interface_iterator(machine().root_device()))
+	{
+		device_state_interface *state;
+		if (exec.device().interface(state))
+			m_pc_profile->m_sources.emplace_back(&exec, state);
+	}
+
+	// samples are taken from a timer, so devices are always between instructions
+	timer_alloc(timer_expired_delegate(FUNC(device_scheduler::pc_profile_sample), this))->adjust(m_pc_profile->m_period, 0, m_pc_profile->m_period);
+	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&device_scheduler::pc_profile_report, this));
+}
+
+
+//-------------------------------------------------
+//  pc_profile_sample - count the current program
+//  counter of each running device
+//-------------------------------------------------
+
+void device_scheduler::pc_profile_sample(void *ptr, s32 param)
+{
+	m_pc_profile->m_samples++;
+	for (auto const &source : m_pc_profile->m_sources)
+		if (!source.first->suspended())
+			m_pc_profile->m_devices[source.first][source.second->pcbase()]++;
+}
+
+
+//-------------------------------------------------
+//  pc_profile_report - print the busiest program
+//  counters and instruction mnemonics of each
+//  sampled device
+//-------------------------------------------------
+
+void device_scheduler::pc_profile_report()
+{
+	osd_printf_info("PC profile, %u samples every %s:\n", m_pc_profile->m_samples, m_pc_profile->m_period.as_string(PRECISION));
+	for (auto const &source : m_pc_profile->m_sources)
+	{
+		auto const found = m_pc_profile->m_devices.find(source.first);
+		if (found == m_pc_profile->m_devices.end())
+			continue;
+		device_t &device = source.first->device();
+
+		u64 total = 0;
+		std::vector<std::pair<u64, offs_t>> pcs;
+		for (auto const &entry : found->second)
+		{
+			total += entry.second;
+			pcs.emplace_back(entry.second, entry.first);
+		}
+		std::sort(pcs.begin(), pcs.end(), [] (auto const &a, auto const &b) { return (a.first != b.first) ? (a.first > b.first) : (a.second < b.second); });
+
+		// disassemble when possible, grouping samples by mnemonic
+		device_disasm_interface *dasm;
+		device_memory_interface *memory;
+		std::unique_ptr<debug_disasm_buffer> buffer;
+		int addrchars = 8;
+		if (device.interface(dasm) && device.interface(memory) && memory->has_space(AS_PROGRAM))
+		{
+			buffer = std::make_unique<debug_disasm_buffer>(device);
+			addrchars = memory->space(AS_PROGRAM).logaddrchars();
+		}
+		std::vector<std::string> instructions;
+		std::map<std::string, u64> mnemonics;
+		for (auto const &pc : pcs)
+		{
+			std::string instruction;
+			if (buffer)
+			{
+				offs_t next_pc, size;
+				u32 info;
+				buffer->disassemble(pc.second, instruction, next_pc, size, info);
+				mnemonics[instruction.substr(0, instruction.find_first_of(" \t"))] += pc.first;
+			}
+			instructions.emplace_back(std::move(instruction));
+		}
+
+		osd_printf_info("  %s: %u samples at %u addresses\n", device.tag(), total, pcs.size());
+		for (std::size_t index = 0; index < pcs.size() && index < 32; index++)
+			osd_printf_info("    %0*X %10u %6.2f%%  %s\n", addrchars, pcs[index].second, pcs[index].first,
+					100.0 * double(pcs[index].first) / double(total), instructions[index]);
+
+		std::vector<std::pair<u64, std::string>> classes;
+		for (auto const &mnemonic : mnemonics)
+			classes.emplace_back(mnemonic.second, mnemonic.first);
+		std::stable_sort(classes.begin(), classes.end(), [] (auto const &a, auto const &b) { return a.first > b.first; });
+		for (std::size_t index = 0; index < classes.size() && index < 16; index++)
+			osd_printf_info("    %-12s %10u %6.2f%%\n", classes[index].second, classes[index].first,
+					100.0 * double(classes[index].first) / double(total));
+	}
+}
@@ -57,7 +57,7 @@ class emu_timer
 	~emu_timer();
 
 	// allocation and re-use
-	emu_timer &init(running_machine &machine, timer_expired_delegate callback, void *ptr, bool temporary);
+	emu_timer &init(running_machine &machine, const timer_expired_delegate &callback, void *ptr, bool temporary);
 	emu_timer &init(device_t &device, device_timer_id id, void *ptr, bool temporary);
 	emu_timer &release();
 
@@ -94,8 +94,8 @@ private:
 
 	// internal state
 	running_machine *   m_machine;      // reference to the owning machine
-	emu_timer *         m_next;         // next timer in order in the list
-	emu_timer *         m_prev;         // previous timer in order in the list
+	emu_timer *         m_next;         // next timer in the allocator's free list
+	int                 m_heap_index;   // index in the scheduler's timer heap, -1 if not queued
 	timer_expired_delegate m_callback;  // callback function
 	s32                 m_param;        // integer parameter
 	void *              m_ptr;          // pointer parameter
@@ -117,6 +117,52 @@ class device_scheduler
 	friend class emu_timer;
 
 public:
+	// reasons for cutting a timeslice short
+	enum abort_cause
+	{
+		ABORT_TIMER,                                        // a timer was set to fire within the slice
+		ABORT_SUSPEND,                                      // a device was suspended or resumed
+		ABORT_TRIGGER,                                      // a trigger was signalled
+		ABORT_OTHER,                                        // an explicit abort_timeslice()
+		ABORT_CAUSE_COUNT
+	};
+
+	// scheduling statistics for a single device
+	struct device_stats
+	{
+		u64                     m_slices = 0;               // number of times the device was run
+		u64                     m_cycles = 0;               // cycles executed
+		u64                     m_aborts[ABORT_CAUSE_COUNT] = { 0 }; // runs cut short, by cause
+		std::vector<u32>        m_slices_per_second;        // number of runs, by emulated second
+	};
+
+	// scheduling statistics for a single timer callback
+	struct timer_stats
+	{
+		std::string             m_name;                     // device tag and id, or delegate name
+		u64                     m_fired = 0;                // number of callbacks
+	};
+
+	// scheduling statistics, collected when requested with -schedstats
+	struct stats
+	{
+		u64                     m_timeslices = 0;           // iterations of the timeslice loop
+		attotime                m_slice_time;               // total length of those iterations
+		u64                     m_boosts = 0;               // boost_interleave requests
+		attotime                m_boost_time;               // total requested boost duration
+		std::unordered_map<const device_execute_interface *, device_stats> m_devices;
+		std::map<std::pair<const void *, device_timer_id>, timer_stats> m_timers;
+	};
+
+	// sampled program counters, collected when requested with -pcprofile
+	struct pc_samples
+	{
+		attotime                m_period;                   // time between samples
+		u64                     m_samples = 0;              // number of samples taken
+		std::vector<std::pair<device_execute_interface *, device_state_interface *>> m_sources; // devices with a PC to sample
+		std::unordered_map<const device_execute_interface *, std::unordered_map<offs_t, u64>> m_devices; // samples by PC, per device
+	};
+
 	// construction/destruction
 	device_scheduler(running_machine &machine);
 	~device_scheduler();
@@ -124,9 +170,11 @@ public:
 	// getters
 	running_machine &machine() const noexcept { return m_machine; }
 	attotime time() const noexcept;
-	emu_timer *first_timer() const { return m_timer_list; }
+	emu_timer *first_timer() const { return m_timer_heap.front().m_timer; }
 	device_execute_interface *currently_executing() const noexcept { return m_executing_device; }
 	bool can_save() const;
+	const stats *statistics() const noexcept { return m_stats.get(); }
+	const pc_samples *pc_profile() const noexcept { return m_pc_profile.get(); }
 
 	// execution
 	void timeslice();
@@ -136,9 +184,9 @@ public:
 	void suspend_resume_changed() { m_suspend_changes_pending = true; }
 
 	// timers, specified by callback/name
-	emu_timer *timer_alloc(timer_expired_delegate callback, void *ptr = nullptr);
-	void timer_set(const attotime &duration, timer_expired_delegate callback, int param = 0, void *ptr = nullptr);
-	void synchronize(timer_expired_delegate callback = timer_expired_delegate(), int param = 0, void *ptr = nullptr) { timer_set(attotime::zero, callback, param, ptr); }
+	emu_timer *timer_alloc(const timer_expired_delegate &callback, void *ptr = nullptr);
+	void timer_set(const attotime &duration, const timer_expired_delegate &callback, int param = 0, void *ptr = nullptr);
+	void synchronize(const timer_expired_delegate &callback = timer_expired_delegate(), int param = 0, void *ptr = nullptr) { timer_set(attotime::zero, callback, param, ptr); }
 
 	// timers, specified by device/id; generally devices should use the device_t methods instead
 	emu_timer *timer_alloc(device_t &device, device_timer_id id = 0, void *ptr = nullptr);
@@ -146,6 +194,8 @@ public:
 
 	// debugging
 	void dump_timers() const;
+	void start_stats();
+	void start_pc_profile(u32 rate);
 
 	// for emergencies only!
 	void eat_all_cycles();
@@ -155,16 +205,37 @@ private:
 	void timed_trigger(void *ptr, s32 param);
 	void presave();
 	void postload();
+	void stats_report();
+	void pc_profile_sample(void *ptr, s32 param);
+	void pc_profile_report();
 
 	// scheduling helpers
 	void compute_perfect_interleave();
 	void rebuild_execute_list();
 	void apply_suspend_changes();
 	void add_scheduling_quantum(const attotime &quantum, const attotime &duration);
+	void abort_timeslice(abort_cause cause);
+
+	// statistics helpers
+	void record_slice(const device_execute_interface &exec, u32 cycles);
+	void record_abort(abort_cause cause);
+	void record_timer(const emu_timer &timer);
 
 	// timer helpers
-	emu_timer &timer_list_insert(emu_timer &timer);
-	emu_timer &timer_list_remove(emu_timer &timer);
+	struct timer_heap_entry
+	{
+		attotime                m_expire;                   // cached expiration time, never for disabled timers
+		u64                     m_sequence;                 // insertion order, breaks ties between equal times
+		emu_timer *             m_timer;                    // the timer
+	};
+	static bool timer_heap_before(const timer_heap_entry &first, const timer_heap_entry &second) noexcept;
+	void timer_heap_place(int index, const timer_heap_entry &entry) noexcept;
+	void timer_heap_sift_up(int index) noexcept;
+	void timer_heap_sift_down(int index) noexcept;
+	void timer_heap_fix(int index) noexcept;
+	emu_timer &timer_heap_insert(emu_timer &timer);
+	emu_timer &timer_heap_remove(emu_timer &timer);
+	void timer_heap_update(emu_timer &timer);
 	void execute_timers();
 
 	// internal state
@@ -173,8 +244,10 @@ private:
 	device_execute_interface *  m_execute_list;             // list of devices to be executed
 	attotime                    m_basetime;                 // global basetime; everything moves forward from here
 
-	// list of active timers
-	emu_timer *                 m_timer_list;               // head of the active list
+	// d-ary min-heap of active timers, ordered by expiration time
+	static constexpr int TIMER_HEAP_ARITY = 4;
+	std::vector<timer_heap_entry> m_timer_heap;             // the heap, the next timer to fire is first
+	u64                         m_timer_sequence;           // next insertion sequence number
 	fixed_allocator<emu_timer>  m_timer_allocator;          // allocator for timers
 
 	// other internal states
@@ -182,6 +255,8 @@ private:
 	bool                        m_callback_timer_modified;  // true if the current callback timer was modified
 	attotime                    m_callback_timer_expire_time; // the original expiration time
 	bool                        m_suspend_changes_pending;  // suspend/resume changes are pending
+	std::unique_ptr<stats>      m_stats;                    // scheduling statistics, if enabled
+	std::unique_ptr<pc_samples> m_pc_profile;               // sampled program counters, if enabled
 
 	// scheduling quanta
 	class quantum_slot
@@ -568,6 +568,8 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_curbitmap(0)
 	, m_curtexture(0)
 	, m_changed(true)
+	, m_damage_tracking(false)
+	, m_damage(0, -1, 0, -1)
 	, m_last_partial_scan(0)
 	, m_partial_scan_hpos(0)
 	, m_color(rgb_t(0xff, 0xff, 0xff, 0xff))
@@ -1119,6 +1121,9 @@ void screen_device::realloc_screen_bitmaps()
 	if (m_type == SCREEN_TYPE_VECTOR)
 		return;
 
+	// whatever was shown before no longer matches
+	mark_dirty();
+
 	// determine effective size to allocate
 	const bool per_scanline = (m_video_attributes & VIDEO_VARIABLE_WIDTH);
 	s32 effwidth = std::max(per_scanline ? m_max_width : m_width, m_visarea.right() + 1);
@@ -1760,9 +1765,14 @@ bool screen_device::update_quads()
 		// only update if empty and not a vector game; otherwise assume the driver did it directly
 		if (m_type != SCREEN_TYPE_VECTOR && (m_video_attributes & VIDEO_SELF_RENDER) == 0)
 		{
+			// with damage tracking, only what the driver marked counts as a change
+			if (m_damage_tracking)
+				m_changed = !m_damage.empty();
+
 			// if we're not skipping the frame and if the screen actually changed, then update the texture
 			if (!machine().video().skip_this_frame() && m_changed)
 			{
+				m_damage.set(0, -1, 0, -1);
 				if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
 				{
 					create_composited_bitmap();
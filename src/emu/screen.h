@@ -370,6 +370,7 @@ public:
 	screen_device &set_no_palette() { m_palette.set_tag(finder_base::DUMMY_TAG); return *this; }
 	screen_device &set_video_attributes(u32 flags) { m_video_attributes = flags; return *this; }
 	screen_device &set_color(rgb_t color) { m_color = color; return *this; }
+	screen_device &set_damage_tracking(bool enable = true) { m_damage_tracking = enable; return *this; }
 	template <typename T> screen_device &set_svg_region(T &&tag) { m_svg_region.set_tag(std::forward<T>(tag)); return *this; } // default region is device tag
 
 	// information getters
@@ -410,6 +411,12 @@ public:
 	void update_now();
 	void reset_partial_updates();
 
+	// damage tracking; with set_damage_tracking() a frame only reaches the renderer if something was marked
+	void mark_dirty(const rectangle &rect) { if (m_damage.empty()) m_damage = rect; else m_damage |= rect; }
+	void mark_dirty() { mark_dirty(m_visarea); }
+	const rectangle &damage() const { return m_damage; }
+	bool damage_tracking() const { return m_damage_tracking; }
+
 	// additional helpers
 	void register_vblank_callback(vblank_state_delegate vblank_callback);
 	void register_screen_bitmap(bitmap_t &bitmap);
@@ -494,6 +501,8 @@ private:
 	u8                  m_curbitmap;                // current bitmap index
 	u8                  m_curtexture;               // current texture index
 	bool                m_changed;                  // has this bitmap changed?
+	bool                m_damage_tracking;          // use the damage region instead of update flags to detect changes
+	rectangle           m_damage;                   // area marked dirty since the last texture update
 	s32                 m_last_partial_scan;        // scanline of last partial update
 	s32                 m_partial_scan_hpos;        // horizontal pixel last rendered on this partial scanline
 	bitmap_argb32       m_screen_overlay_bitmap;    // screen overlay bitmap
@@ -16,6 +16,7 @@
 #include "validity.h"
 
 #include <cctype>
+#include <mutex>
 
 
 //**************************************************************************
@@ -32,6 +33,65 @@ typedef std::unordered_map<std::string, const software_info *> softlist_map;
 // device type definition
 DEFINE_DEVICE_TYPE(SOFTWARE_LIST, software_list_device, "software_list", "Software List")
 
+// recently parsed list files, so that new machine configurations don't parse them again
+class software_list_device::list_cache
+{
+public:
+	std::shared_ptr<const parsed_list> find(const std::string &path, const osd::directory::entry &entry)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+		{
+			if (it->path == path)
+			{
+				// discard the entry if the file changed since it was parsed
+				if ((it->size != entry.size) || (it->last_modified != entry.last_modified))
+				{
+					m_entries.erase(it);
+					return nullptr;
+				}
+
+				// move it to the front so the most recently used lists stay around
+				m_entries.splice(m_entries.begin(), m_entries, it);
+				return it->list;
+			}
+		}
+		return nullptr;
+	}
+
+	void add(const std::string &path, const osd::directory::entry &entry, std::shared_ptr<const parsed_list> const &list)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+		{
+			if (it->path == path)
+			{
+				m_entries.erase(it);
+				break;
+			}
+		}
+		m_entries.push_front(cache_entry{ path, entry.size, entry.last_modified, list });
+		if (m_entries.size() > CACHE_SIZE)
+			m_entries.pop_back();
+	}
+
+private:
+	static constexpr std::size_t CACHE_SIZE = 8;
+
+	struct cache_entry
+	{
+		std::string                             path;
+		std::uint64_t                           size;
+		std::chrono::system_clock::time_point   last_modified;
+		std::shared_ptr<const parsed_list>      list;
+	};
+
+	std::mutex              m_mutex;
+	std::list<cache_entry>  m_entries;
+};
+
+software_list_device::list_cache software_list_device::s_list_cache;
+
 false_software_list_loader false_software_list_loader::s_instance;
 rom_software_list_loader rom_software_list_loader::s_instance;
 image_software_list_loader image_software_list_loader::s_instance;
@@ -84,9 +144,7 @@ software_list_device::software_list_device(const machine_config &mconfig, const
 	device_t(mconfig, SOFTWARE_LIST, tag, owner, clock),
 	m_list_type(softlist_type::ORIGINAL_SYSTEM),
 	m_filter(nullptr),
-	m_parsed(false),
-	m_file(mconfig.options().hash_path(), OPEN_FLAG_READ),
-	m_description("")
+	m_file(mconfig.options().hash_path(), OPEN_FLAG_READ)
 {
 }
 
@@ -173,10 +231,7 @@ void software_list_device::find_approx_matches(const std::string &name, int matc
 void software_list_device::release()
 {
 	osd_printf_verbose("Resetting %s\n", m_file.filename());
-	m_parsed = false;
-	m_description.clear();
-	m_errors.clear();
-	m_infolist.clear();
+	m_list.reset();
 }
 
 
@@ -252,8 +307,16 @@ const software_info *software_list_device::find(const std::string &look_for)
 
 	const bool iswild = look_for.find_first_of("*?") != std::string::npos;
 
-	// find a match (will cause a parse if needed when calling get_info)
+	// plain names are looked up in the index (will cause a parse if needed when calling get_info)
 	const auto &info_list = get_info();
+	if (!iswild)
+	{
+		std::string name(look_for);
+		auto const found = m_list->shortnames.find(strmakelower(name));
+		return (found != m_list->shortnames.end()) ? found->second : nullptr;
+	}
+
+	// otherwise find the first match
 	auto iter = std::find_if(
 			info_list.begin(),
 			info_list.end(),
@@ -275,27 +338,47 @@ const software_info *software_list_device::find(const std::string &look_for)
 void software_list_device::parse()
 {
 	// skip if done
-	if (m_parsed)
+	if (m_list)
 		return;
 
-	// reset the errors
-	m_errors.clear();
-
 	// attempt to open the file
 	osd_file::error filerr = m_file.open(m_list_name, ".xml");
 	if (filerr == osd_file::error::NONE)
 	{
-		// parse if no error
-		std::ostringstream errs;
-		softlist_parser parser(m_file, m_file.filename(), m_description, m_infolist, errs);
+		// reuse the contents if the file was parsed before and hasn't changed since
+		std::string const path(m_file.fullpath());
+		std::unique_ptr<osd::directory::entry> const entry(osd_stat(path));
+		if (entry)
+			m_list = s_list_cache.find(path, *entry);
+
+		// parse if not
+		if (!m_list)
+		{
+			auto list = std::make_shared<parsed_list>();
+			std::ostringstream errs;
+			softlist_parser parser(m_file, m_file.filename(), list->description, list->infolist, errs);
+			list->errors = errs.str();
+
+			// index the short names for find, keeping the first of any duplicates
+			list->shortnames.reserve(list->infolist.size());
+			for (const software_info &swinfo : list->infolist)
+			{
+				std::string name(swinfo.shortname());
+				list->shortnames.emplace(std::move(strmakelower(name)), &swinfo);
+			}
+
+			if (entry)
+				s_list_cache.add(path, *entry, list);
+			m_list = std::move(list);
+		}
 		m_file.close();
-		m_errors = errs.str();
 	}
 	else
-		m_errors = string_format("Error opening file: %s\n", filename());
-
-	// indicate that we've been parsed
-	m_parsed = true;
+	{
+		auto list = std::make_shared<parsed_list>();
+		list->errors = string_format("Error opening file: %s\n", filename());
+		m_list = std::move(list);
+	}
 }
 
 
@@ -429,7 +512,7 @@ void software_list_device::internal_validity_check(validity_checker &valid)
 		std::string const &shortname(swinfo.shortname());
 
 		// first parse and output core errors if any
-		if (m_errors.length() > 0)
+		if (!m_list->errors.empty())
 		{
 			osd_printf_error("%s: Errors parsing software list:\n%s", filename(), errors_string());
 			break;
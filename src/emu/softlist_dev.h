@@ -16,6 +16,9 @@
 
 #include "softlist.h"
 
+#include <memory>
+#include <unordered_map>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -118,10 +121,10 @@ public:
 	const char *filename() { return m_file.filename(); }
 
 	// getters that may trigger a parse
-	const std::string &description() { if (!m_parsed) parse(); return m_description; }
-	bool valid() { if (!m_parsed) parse(); return !m_infolist.empty(); }
-	const char *errors_string() { if (!m_parsed) parse(); return m_errors.c_str(); }
-	const std::list<software_info> &get_info() { if (!m_parsed) parse(); return m_infolist; }
+	const std::string &description() { if (!m_list) parse(); return m_list->description; }
+	bool valid() { if (!m_list) parse(); return !m_list->infolist.empty(); }
+	const char *errors_string() { if (!m_list) parse(); return m_list->errors.c_str(); }
+	const std::list<software_info> &get_info() { if (!m_list) parse(); return m_list->infolist; }
 
 	// operations
 	const software_info *find(const std::string &look_for);
@@ -141,6 +144,16 @@ protected:
 	virtual void device_validity_check(validity_checker &valid) const override ATTR_COLD;
 
 private:
+	// parsed contents of a list file, shared by all devices that use the same file
+	struct parsed_list
+	{
+		std::string                                             description;
+		std::string                                             errors;
+		std::list<software_info>                                infolist;
+		std::unordered_map<std::string, const software_info *>  shortnames;
+	};
+	class list_cache;
+
 	// internal helpers
 	void parse();
 	void internal_validity_check(validity_checker &valid) ATTR_COLD;
@@ -151,11 +164,10 @@ private:
 	const char *                m_filter;
 
 	// internal state
-	bool                        m_parsed;
 	emu_file                    m_file;
-	std::string                 m_description;
-	std::string                 m_errors;
-	std::list<software_info>    m_infolist;
+	std::shared_ptr<const parsed_list> m_list;
+
+	static list_cache           s_list_cache;
 };
 
 
@@ -54,6 +54,8 @@ sound_stream::sound_stream(device_t &device, int inputs, int outputs, int sample
 		m_next(nullptr),
 		m_sample_rate(sample_rate),
 		m_new_sample_rate(0xffffffff),
+		m_parallel_safe(false),
+		m_parallel_sampindex(0),
 		m_attoseconds_per_sample(0),
 		m_max_samples_per_update(0),
 		m_input(inputs),
@@ -78,6 +80,7 @@ sound_stream::sound_stream(device_t &device, int inputs, int outputs, int sample
 	// create a unique tag for saving
 	std::string state_tag = string_format("%d", m_device.machine().sound().m_stream_list.size());
 	m_device.machine().save().save_item(&m_device, "stream", state_tag.c_str(), 0, NAME(m_sample_rate));
+	m_device.machine().save().register_presave(save_prepost_delegate(FUNC(sound_stream::presave), this));
 	m_device.machine().save().register_postload(save_prepost_delegate(FUNC(sound_stream::postload), this));
 
 	// save the gain of each input and output
@@ -92,6 +95,10 @@ sound_stream::sound_stream(device_t &device, int inputs, int outputs, int sample
 		m_device.machine().save().save_item(&m_device, "stream", state_tag.c_str(), outputnum, NAME(m_output[outputnum].m_gain));
 	}
 
+	// collect statistics if requested
+	if (m_device.machine().sound().m_stats_enabled)
+		m_stats = std::make_unique<stats>();
+
 	// Mark synchronous streams as such
 	m_synchronous = m_sample_rate == STREAM_SYNC;
 	if (m_synchronous)
@@ -267,6 +274,86 @@ void sound_stream::update()
 	if (!m_attoseconds_per_sample)
 		return;
 
+	s32 update_sampindex = this->update_sampindex();
+
+	// generate up to and apply any writes that are now due
+	if (!m_pending_writes.empty())
+	{
+		g_profiler.start(PROFILER_SOUND);
+		apply_pending_writes(update_sampindex);
+		g_profiler.stop();
+	}
+
+	if (update_sampindex <= m_output_sampindex)
+		return;
+
+	// generate samples to get us up to the appropriate time
+	g_profiler.start(PROFILER_SOUND);
+	assert(m_output_sampindex - m_output_base_sampindex >= 0);
+	assert(update_sampindex - m_output_base_sampindex <= m_output_bufalloc);
+	generate_samples(update_sampindex - m_output_sampindex);
+	g_profiler.stop();
+
+	// remember this info for next time
+	m_output_sampindex = update_sampindex;
+}
+
+
+//-------------------------------------------------
+//  queue_write - record a register write to be
+//  applied when the stream reaches the current
+//  time, instead of forcing an update now
+//-------------------------------------------------
+
+void sound_stream::queue_write(offs_t offset, u32 data)
+{
+	assert(!m_write_callback.isnull());
+
+	// without a time base there is nothing to defer to
+	if (!m_attoseconds_per_sample || m_synchronous)
+	{
+		m_write_callback(offset, data);
+		return;
+	}
+
+	s32 sampindex = std::max(update_sampindex(), m_output_sampindex);
+	if (sampindex == m_output_sampindex && m_pending_writes.empty())
+		m_write_callback(offset, data);
+	else
+		m_pending_writes.push_back(pending_write{ sampindex, offset, data });
+}
+
+
+//-------------------------------------------------
+//  apply_pending_writes - generate samples up to
+//  each queued write at or before the given
+//  position and apply it
+//-------------------------------------------------
+
+void sound_stream::apply_pending_writes(s32 update_sampindex)
+{
+	auto write = m_pending_writes.begin();
+	for ( ; write != m_pending_writes.end() && write->m_sampindex <= update_sampindex; ++write)
+	{
+		if (write->m_sampindex > m_output_sampindex)
+		{
+			assert(write->m_sampindex - m_output_base_sampindex <= m_output_bufalloc);
+			generate_samples(write->m_sampindex - m_output_sampindex);
+			m_output_sampindex = write->m_sampindex;
+		}
+		m_write_callback(write->m_offset, write->m_data);
+	}
+	m_pending_writes.erase(m_pending_writes.begin(), write);
+}
+
+
+//-------------------------------------------------
+//  update_sampindex - return the output position
+//  corresponding to the current emulated time
+//-------------------------------------------------
+
+s32 sound_stream::update_sampindex() const
+{
 	// determine the number of samples since the start of this second
 	attotime time = m_device.machine().time();
 	s32 update_sampindex = s32(time.attoseconds() / m_attoseconds_per_sample);
@@ -286,18 +373,21 @@ void sound_stream::update()
 		update_sampindex -= m_sample_rate;
 	}
 
-	if (update_sampindex <= m_output_sampindex)
-		return;
+	return update_sampindex;
+}
 
-	// generate samples to get us up to the appropriate time
-	g_profiler.start(PROFILER_SOUND);
-	assert(m_output_sampindex - m_output_base_sampindex >= 0);
-	assert(update_sampindex - m_output_base_sampindex <= m_output_bufalloc);
-	generate_samples(update_sampindex - m_output_sampindex);
-	g_profiler.stop();
 
-	// remember this info for next time
-	m_output_sampindex = update_sampindex;
+//-------------------------------------------------
+//  parallel_update - work queue callback that
+//  generates the samples of a pending parallel
+//  update
+//-------------------------------------------------
+
+void *sound_stream::parallel_update(void *param, int threadid)
+{
+	sound_stream &stream = **reinterpret_cast<sound_stream **>(param);
+	stream.generate_samples(stream.m_parallel_sampindex - stream.m_output_sampindex);
+	return nullptr;
 }
 
 
@@ -396,6 +486,8 @@ void sound_stream::update_with_accounting(bool second_tick)
 	{
 		m_output_sampindex -= m_sample_rate;
 		m_output_base_sampindex -= m_sample_rate;
+		for (auto &write : m_pending_writes)
+			write.m_sampindex -= m_sample_rate;
 	}
 
 	// note our current output sample
@@ -596,12 +688,27 @@ void sound_stream::allocate_output_buffers()
 }
 
 
+//-------------------------------------------------
+//  presave - save/restore callback
+//-------------------------------------------------
+
+void sound_stream::presave()
+{
+	// apply any queued writes so the device state is current
+	if (!m_pending_writes.empty())
+		update();
+}
+
+
 //-------------------------------------------------
 //  postload - save/restore callback
 //-------------------------------------------------
 
 void sound_stream::postload()
 {
+	// the loaded device state already reflects any writes we had queued
+	m_pending_writes.clear();
+
 	// recompute the same rate information
 	recompute_sample_rate_data();
 
@@ -640,7 +747,14 @@ void sound_stream::generate_samples(int samples)
 			input.m_source->m_stream->update();
 
 		// generate the resampled data
-		m_input_array[inputnum] = generate_resampled_data(input, samples);
+		if (!m_stats)
+			m_input_array[inputnum] = generate_resampled_data(input, samples);
+		else
+		{
+			osd_ticks_t const start = osd_ticks();
+			m_input_array[inputnum] = generate_resampled_data(input, samples);
+			m_stats->m_resample_ticks += osd_ticks() - start;
+		}
 	}
 
 	if (!m_input.empty())
@@ -662,7 +776,16 @@ void sound_stream::generate_samples(int samples)
 
 	// run the callback
 	VPRINTF(("  callback(%p, %d)\n", (void *)this, samples));
-	m_callback(*this, inputs, outputs, samples);
+	if (!m_stats)
+		m_callback(*this, inputs, outputs, samples);
+	else
+	{
+		osd_ticks_t const start = osd_ticks();
+		m_callback(*this, inputs, outputs, samples);
+		m_stats->m_update_ticks += osd_ticks() - start;
+		m_stats->m_calls++;
+		m_stats->m_samples += samples;
+	}
 	VPRINTF(("  callback done\n"));
 }
 
@@ -687,6 +810,13 @@ stream_sample_t *sound_stream::generate_resampled_data(stream_input &input, u32
 	sound_stream &input_stream = *output.m_stream;
 	s64 gain = (input.m_gain * input.m_user_gain * output.m_gain) >> 16;
 
+	// a fully attenuated input contributes nothing, so don't bother resampling it
+	if (gain == 0)
+	{
+		std::fill_n(dest, numsamples, 0);
+		return &input.m_resample[0];
+	}
+
 	// determine the time at which the current sample begins, accounting for the
 	// latency we calculated between the input and output streams
 	attoseconds_t basetime = m_output_sampindex * m_attoseconds_per_sample - input.m_latency_attoseconds;
@@ -713,11 +843,37 @@ stream_sample_t *sound_stream::generate_resampled_data(stream_input &input, u32
 	// if we have equal sample rates, we just need to copy
 	if (step == FRAC_ONE)
 	{
+		// unity gain is the common case for directly routed chips
+		if (gain == 0x100)
+			std::copy_n(source, numsamples, dest);
+		else
+		{
+			while (numsamples--)
+			{
+				// compute the sample
+				s64 sample = *source++;
+				*dest++ = (sample * gain) >> 8;
+			}
+		}
+	}
+
+	// input is undersampled and we have a kernel and enough history: interpolate one
+	// sample behind, so we never need more than one sample of lookahead
+	else if (step < FRAC_ONE && !m_device.machine().sound().m_resample_kernel.empty() && basesample - input_stream.m_output_base_sampindex >= sound_manager::RESAMPLE_TAPS - 2)
+	{
+		auto const &kernel = m_device.machine().sound().m_resample_kernel;
 		while (numsamples--)
 		{
-			// compute the sample
-			s64 sample = *source++;
+			// compute the sample from the phase nearest our position
+			s32 const *coeffs = &kernel[basefrac >> (FRAC_BITS - sound_manager::RESAMPLE_PHASE_BITS)][0];
+			s64 sample = s64(source[-2]) * coeffs[0] + s64(source[-1]) * coeffs[1] + s64(source[0]) * coeffs[2] + s64(source[1]) * coeffs[3];
+			sample >>= sound_manager::RESAMPLE_SCALE_BITS;
 			*dest++ = (sample * gain) >> 8;
+
+			// advance
+			basefrac += step;
+			source += basefrac >> FRAC_BITS;
+			basefrac &= FRAC_MASK;
 		}
 	}
 
@@ -843,8 +999,11 @@ sound_manager::sound_manager(running_machine &machine)
 		m_attenuation(0),
 		m_nosound_mode(machine.osd().no_sound()),
 		m_wavfile(nullptr),
+		m_work_queue(nullptr),
 		m_update_attoseconds(STREAMS_UPDATE_ATTOTIME.attoseconds()),
-		m_last_update(attotime::zero)
+		m_last_update(attotime::zero),
+		m_stats_enabled(machine.options().sound_stats()),
+		m_stats_updates(0)
 {
 	// get filename for WAV file or AVI file if specified
 	const char *wavfile = machine.options().wav_write();
@@ -866,6 +1025,8 @@ sound_manager::sound_manager(running_machine &machine)
 	machine.add_notifier(MACHINE_NOTIFY_RESUME, machine_notify_delegate(&sound_manager::resume, this));
 	machine.add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&sound_manager::reset, this));
 	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&sound_manager::stop_recording, this));
+	if (m_stats_enabled)
+		machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&sound_manager::stats_report, this));
 
 	// register global states
 	machine.save().save_item(NAME(m_last_update));
@@ -873,6 +1034,10 @@ sound_manager::sound_manager(running_machine &machine)
 	// set the starting attenuation
 	set_attenuation(machine.options().volume());
 
+	// precompute the interpolation kernel if requested
+	if (machine.options().hq_resample())
+		build_resample_kernel();
+
 	// start the periodic update flushing timer
 	m_update_timer = machine.scheduler().timer_alloc(timer_expired_delegate(FUNC(sound_manager::update), this));
 	m_update_timer->adjust(STREAMS_UPDATE_ATTOTIME, 0, STREAMS_UPDATE_ATTOTIME);
@@ -885,6 +1050,8 @@ sound_manager::sound_manager(running_machine &machine)
 
 sound_manager::~sound_manager()
 {
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
 }
 
 
@@ -1083,6 +1250,11 @@ void sound_manager::update(void *ptr, int param)
 
 	g_profiler.start(PROFILER_SOUND);
 
+	// bring independent streams up to date on the work queue first
+	update_parallel_streams();
+	if (m_stats_enabled)
+		m_stats_updates++;
+
 	// force all the speaker streams to generate the proper number of samples
 	m_samples_this_update = 0;
 	for (speaker_device &speaker : speaker_device_iterator(machine().root_device()))
@@ -1092,28 +1264,42 @@ void sound_manager::update(void *ptr, int param)
 	u32 finalmix_step = machine().video().speed_factor();
 	u32 finalmix_offset = 0;
 	s16 *finalmix = &m_finalmix[0];
-	int sample;
-	for (sample = m_finalmix_leftover; sample < m_samples_this_update * 1000; sample += finalmix_step)
+	if (finalmix_step == 1000 && m_finalmix_leftover < 1000)
+	{
+		// running at normal speed: every mixed sample is used once, in order
+		const s32 *left = &m_leftmix[0];
+		const s32 *right = &m_rightmix[0];
+		for (int sampindex = 0; sampindex < m_samples_this_update; sampindex++)
+		{
+			finalmix[finalmix_offset++] = std::min(std::max(left[sampindex], -32768), 32767);
+			finalmix[finalmix_offset++] = std::min(std::max(right[sampindex], -32768), 32767);
+		}
+	}
+	else
 	{
-		int sampindex = sample / 1000;
-
-		// clamp the left side
-		s32 samp = m_leftmix[sampindex];
-		if (samp < -32768)
-			samp = -32768;
-		else if (samp > 32767)
-			samp = 32767;
-		finalmix[finalmix_offset++] = samp;
-
-		// clamp the right side
-		samp = m_rightmix[sampindex];
-		if (samp < -32768)
-			samp = -32768;
-		else if (samp > 32767)
-			samp = 32767;
-		finalmix[finalmix_offset++] = samp;
+		int sample;
+		for (sample = m_finalmix_leftover; sample < m_samples_this_update * 1000; sample += finalmix_step)
+		{
+			int sampindex = sample / 1000;
+
+			// clamp the left side
+			s32 samp = m_leftmix[sampindex];
+			if (samp < -32768)
+				samp = -32768;
+			else if (samp > 32767)
+				samp = 32767;
+			finalmix[finalmix_offset++] = samp;
+
+			// clamp the right side
+			samp = m_rightmix[sampindex];
+			if (samp < -32768)
+				samp = -32768;
+			else if (samp > 32767)
+				samp = 32767;
+			finalmix[finalmix_offset++] = samp;
+		}
+		m_finalmix_leftover = sample - m_samples_this_update * 1000;
 	}
-	m_finalmix_leftover = sample - m_samples_this_update * 1000;
 
 	// play the result
 	if (finalmix_offset > 0)
@@ -1153,6 +1339,122 @@ void sound_manager::update(void *ptr, int param)
 }
 
 
+//-------------------------------------------------
+//  build_resample_kernel - precompute a Lanczos
+//  interpolator for every phase; it only depends
+//  on the position between input samples, so one
+//  table serves every rate pair
+//-------------------------------------------------
+
+void sound_manager::build_resample_kernel()
+{
+	auto const lanczos = [] (double x)
+	{
+		constexpr double half = RESAMPLE_TAPS / 2;
+		if (x == 0.0)
+			return 1.0;
+		if (std::abs(x) >= half)
+			return 0.0;
+		return half * std::sin(M_PI * x) * std::sin(M_PI * x / half) / (M_PI * M_PI * x * x);
+	};
+
+	m_resample_kernel.resize(1 << RESAMPLE_PHASE_BITS);
+	for (int phase = 0; phase < (1 << RESAMPLE_PHASE_BITS); phase++)
+	{
+		// tap 0 is the sample at -(RESAMPLE_TAPS/2 - 1) relative to the one preceding our position
+		double const frac = double(phase) / double(1 << RESAMPLE_PHASE_BITS);
+		double weights[RESAMPLE_TAPS];
+		double total = 0.0;
+		for (int tap = 0; tap < RESAMPLE_TAPS; tap++)
+		{
+			weights[tap] = lanczos(double(tap - (RESAMPLE_TAPS / 2 - 1)) - frac);
+			total += weights[tap];
+		}
+
+		// normalize so every phase has unity gain, putting the rounding error on the largest tap
+		s32 sum = 0;
+		int largest = 0;
+		for (int tap = 0; tap < RESAMPLE_TAPS; tap++)
+		{
+			m_resample_kernel[phase][tap] = s32(std::lround(weights[tap] / total * double(1 << RESAMPLE_SCALE_BITS)));
+			sum += m_resample_kernel[phase][tap];
+			if (std::abs(weights[tap]) > std::abs(weights[largest]))
+				largest = tap;
+		}
+		m_resample_kernel[phase][largest] += (1 << RESAMPLE_SCALE_BITS) - sum;
+	}
+}
+
+
+//-------------------------------------------------
+//  stats_report - print the update statistics
+//  of every stream, most expensive first
+//-------------------------------------------------
+
+void sound_manager::stats_report()
+{
+	std::vector<sound_stream *> streams;
+	for (auto &stream : m_stream_list)
+		if (stream->m_stats)
+			streams.push_back(stream.get());
+	std::sort(streams.begin(), streams.end(), [] (sound_stream const *a, sound_stream const *b) { return (a->m_stats->m_update_ticks + a->m_stats->m_resample_ticks) > (b->m_stats->m_update_ticks + b->m_stats->m_resample_ticks); });
+
+	double const tps = double(osd_ticks_per_second());
+	osd_printf_info("Sound statistics, %u updates:\n", m_stats_updates);
+	osd_printf_info("  %-32s %6s %12s %12s %8s %10s %10s\n", "stream", "rate", "calls", "samples", "smp/call", "update ms", "resamp ms");
+	for (sound_stream const *stream : streams)
+	{
+		sound_stream::stats const &stats = *stream->m_stats;
+		osd_printf_info("  %-32s %6d %12u %12u %8.1f %10.1f %10.1f\n",
+				stream->device().tag(),
+				stream->sample_rate(),
+				stats.m_calls,
+				stats.m_samples,
+				stats.m_calls ? double(stats.m_samples) / double(stats.m_calls) : 0.0,
+				double(stats.m_update_ticks) * 1000.0 / tps,
+				double(stats.m_resample_ticks) * 1000.0 / tps);
+	}
+}
+
+
+//-------------------------------------------------
+//  update_parallel_streams - generate the samples
+//  of streams marked parallel safe that have no
+//  connected inputs concurrently; the mix below
+//  then finds them up to date
+//-------------------------------------------------
+
+void sound_manager::update_parallel_streams()
+{
+	m_parallel_list.clear();
+	for (auto &stream : m_stream_list)
+	{
+		if (!stream->m_parallel_safe || !stream->m_attoseconds_per_sample || !stream->m_pending_writes.empty())
+			continue;
+		if (std::any_of(stream->m_input.begin(), stream->m_input.end(), [] (const sound_stream::stream_input &input) { return input.m_source != nullptr; }))
+			continue;
+
+		s32 update_sampindex = stream->update_sampindex();
+		if (update_sampindex <= stream->m_output_sampindex)
+			continue;
+		stream->m_parallel_sampindex = update_sampindex;
+		m_parallel_list.push_back(stream.get());
+	}
+
+	// a single stream isn't worth the handoff
+	if (m_parallel_list.size() < 2)
+		return;
+
+	if (m_work_queue == nullptr)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	osd_work_item_queue_multiple(m_work_queue, &sound_stream::parallel_update, m_parallel_list.size(), &m_parallel_list[0], sizeof(m_parallel_list[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+
+	for (sound_stream *stream : m_parallel_list)
+		stream->m_output_sampindex = stream->m_parallel_sampindex;
+}
+
+
 //-------------------------------------------------
 //  samples - fills the specified buffer with
 //  16-bit stereo audio samples generated during
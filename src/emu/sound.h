@@ -30,6 +30,7 @@ constexpr int STREAM_SYNC   = -1;       // special rate value indicating a one-s
 //**************************************************************************
 
 typedef delegate<void (sound_stream &, stream_sample_t **inputs, stream_sample_t **outputs, int samples)> stream_update_delegate;
+typedef delegate<void (offs_t offset, u32 data)> stream_write_delegate;
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -51,6 +52,18 @@ class sound_stream
 {
 	friend class sound_manager;
 
+public:
+	// update statistics, collected when requested with -soundstats
+	struct stats
+	{
+		u64                 m_calls = 0;                  // update callbacks
+		u64                 m_samples = 0;                // samples generated
+		osd_ticks_t         m_update_ticks = 0;           // time spent in the update callback
+		osd_ticks_t         m_resample_ticks = 0;         // time spent resampling inputs
+	};
+
+private:
+
 	typedef void (*stream_update_func)(device_t *device, sound_stream *stream, void *param, stream_sample_t **inputs, stream_sample_t **outputs, int samples);
 
 	// stream output class
@@ -108,6 +121,7 @@ public:
 	float user_gain(int inputnum) const;
 	float input_gain(int inputnum) const;
 	float output_gain(int outputnum) const;
+	const stats *statistics() const { return m_stats.get(); }
 
 	// operations
 	void set_input(int inputnum, sound_stream *input_stream, int outputnum = 0, float gain = 1.0f);
@@ -120,6 +134,13 @@ public:
 	void set_input_gain(int inputnum, float gain);
 	void set_output_gain(int outputnum, float gain);
 
+	// threading; only for callbacks that touch nothing but their own device's state
+	void set_parallel_safe(bool safe = true) { m_parallel_safe = safe; }
+
+	// deferred register writes, applied at their sample position on the next update
+	void set_write_callback(stream_write_delegate callback) { m_write_callback = callback; }
+	void queue_write(offs_t offset, u32 data);
+
 private:
 	// helpers called by our friends only
 	void update_with_accounting(bool second_tick);
@@ -130,9 +151,13 @@ private:
 	void allocate_resample_buffers();
 	void allocate_output_buffers();
 	void postload();
+	void presave();
+	void apply_pending_writes(s32 update_sampindex);
 	void generate_samples(int samples);
 	stream_sample_t *generate_resampled_data(stream_input &input, u32 numsamples);
 	void sync_update(void *, s32);
+	s32 update_sampindex() const;
+	static void *parallel_update(void *param, int threadid);
 
 	// linking information
 	device_t &          m_device;                     // owning device
@@ -142,6 +167,19 @@ private:
 	u32                 m_sample_rate;                // sample rate of this stream
 	u32                 m_new_sample_rate;            // newly-set sample rate for the stream
 	bool                m_synchronous;                // synchronous stream that runs at the rate of its input
+	bool                m_parallel_safe;              // callback may run on a worker thread
+	s32                 m_parallel_sampindex;         // target position of a pending parallel update
+
+	// deferred writes
+	struct pending_write
+	{
+		s32             m_sampindex;                  // output sample the write takes effect at
+		offs_t          m_offset;
+		u32             m_data;
+	};
+	stream_write_delegate m_write_callback;           // applies a queued write to the device
+	std::vector<pending_write> m_pending_writes;      // writes not yet applied, in time order
+	std::unique_ptr<stats> m_stats;                   // update statistics, if enabled
 
 	// timing information
 	attoseconds_t       m_attoseconds_per_sample;     // number of attoseconds per sample
@@ -185,6 +223,11 @@ class sound_manager
 	// stream updates
 	static const attotime STREAMS_UPDATE_ATTOTIME;
 
+	// interpolation kernel for upsampling inputs
+	static constexpr int RESAMPLE_PHASE_BITS = 8;
+	static constexpr int RESAMPLE_TAPS = 4;
+	static constexpr int RESAMPLE_SCALE_BITS = 14;
+
 public:
 	static constexpr int STREAMS_UPDATE_FREQUENCY = 50;
 
@@ -199,6 +242,7 @@ public:
 	attotime last_update() const { return m_last_update; }
 	attoseconds_t update_attoseconds() const { return m_update_attoseconds; }
 	int sample_count() const { return m_samples_this_update; }
+	u64 stats_updates() const { return m_stats_updates; }
 	void samples(s16 *buffer);
 
 	// stream creation
@@ -226,6 +270,9 @@ private:
 	void config_save(config_type cfg_type, util::xml::data_node *parentnode);
 
 	void update(void *ptr = nullptr, s32 param = 0);
+	void update_parallel_streams();
+	void build_resample_kernel();
+	void stats_report();
 
 	// internal state
 	running_machine &   m_machine;              // reference to our machine
@@ -245,8 +292,15 @@ private:
 
 	// streams data
 	std::vector<std::unique_ptr<sound_stream>> m_stream_list;    // list of streams
+	std::vector<sound_stream *> m_parallel_list;    // streams being updated on the work queue
+	osd_work_queue *    m_work_queue;           // queue for parallel stream updates, allocated on demand
+	std::vector<std::array<s32, RESAMPLE_TAPS>> m_resample_kernel; // polyphase interpolation kernel, empty if disabled
 	attoseconds_t       m_update_attoseconds;   // attoseconds between global updates
 	attotime            m_last_update;          // last update time
+
+	// statistics
+	bool                m_stats_enabled;        // collect per-stream update statistics
+	u64                 m_stats_updates;        // global updates while collecting
 };
 
 
@@ -11,6 +11,7 @@
 #include "emu.h"
 #include "tilemap.h"
 
+#include "emuopts.h"
 #include "screen.h"
 
 
@@ -1012,6 +1013,23 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	u32 const xextent = visarea.right() + visarea.left() + 1; // x0 + x1 + 1 for calculating horizontal centre as (x0 + x1 + 1) >> 1
 	u32 const yextent = visarea.bottom() + visarea.top() + 1; // y0 + y1 + 1 for calculating vertical centre as (y0 + y1 + 1) >> 1
 
+	if (m_manager->threaded() && blit.cliprect.height() >= 2 * tilemap_manager::MIN_BAND_HEIGHT)
+		draw_banded(screen, dest, blit, xextent, yextent);
+	else
+		draw_layout(screen, dest, blit, xextent, yextent);
+g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  draw_layout - draw every visible instance of
+//  the tilemap within the blit cliprect, handling
+//  row and column scrolling
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void tilemap_t::draw_layout(screen_device &screen, _BitmapClass &dest, blit_parameters blit, u32 xextent, u32 yextent)
+{
 	// XY scrolling playfield
 	if (m_scrollrows == 1 && m_scrollcols == 1)
 	{
@@ -1095,7 +1113,47 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 			}
 		}
 	}
-g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  draw_banded - split the blit cliprect into
+//  horizontal bands and draw them concurrently;
+//  each band only touches its own rows of the
+//  destination and priority bitmaps
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void tilemap_t::draw_banded(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, u32 xextent, u32 yextent)
+{
+	// tile callbacks aren't thread safe, so bring every tile up to date here first
+	pixmap_update();
+
+	int const height = blit.cliprect.height();
+	int const bands = std::min(height / tilemap_manager::MIN_BAND_HEIGHT, tilemap_manager::MAX_BANDS);
+	band_parameters<_BitmapClass> work[tilemap_manager::MAX_BANDS];
+	for (int band = 0; band < bands; band++)
+	{
+		work[band].tilemap = this;
+		work[band].screen = &screen;
+		work[band].dest = &dest;
+		work[band].blit = blit;
+		work[band].blit.cliprect.sety(blit.cliprect.top() + height * band / bands, blit.cliprect.top() + height * (band + 1) / bands - 1);
+		work[band].xextent = xextent;
+		work[band].yextent = yextent;
+	}
+
+	osd_work_queue *const queue = m_manager->work_queue();
+	osd_work_item_queue_multiple(queue, &tilemap_t::draw_band<_BitmapClass>, bands, work, sizeof(work[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(queue, osd_ticks_per_second() * 10);
+}
+
+template<class _BitmapClass>
+void *tilemap_t::draw_band(void *param, int threadid)
+{
+	band_parameters<_BitmapClass> &band = *reinterpret_cast<band_parameters<_BitmapClass> *>(param);
+	band.tilemap->draw_layout(*band.screen, *band.dest, band.blit, band.xextent, band.yextent);
+	return nullptr;
 }
 
 void tilemap_t::draw(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask)
@@ -1576,7 +1634,9 @@ void tilemap_t::get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &col
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_threaded(machine.options().tilemap_threads()),
+		m_work_queue(nullptr)
 {
 }
 
@@ -1600,6 +1660,22 @@ tilemap_manager::~tilemap_manager()
 				break;
 			}
 	}
+
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
+}
+
+
+//-------------------------------------------------
+//  work_queue - return the queue used for banded
+//  drawing, allocating it on first use
+//-------------------------------------------------
+
+osd_work_queue *tilemap_manager::work_queue()
+{
+	if (m_work_queue == nullptr)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	return m_work_queue;
 }
 
 
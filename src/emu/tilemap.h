@@ -526,6 +526,18 @@ private:
 		u8                  alpha;
 	};
 
+	// one horizontal band of a threaded draw
+	template<class _BitmapClass>
+	struct band_parameters
+	{
+		tilemap_t *         tilemap;
+		screen_device *     screen;
+		_BitmapClass *      dest;
+		blit_parameters     blit;
+		u32                 xextent;
+		u32                 yextent;
+	};
+
 	// inline helpers
 	s32 effective_rowscroll(int index, u32 screen_width);
 	s32 effective_colscroll(int index, u32 screen_height);
@@ -554,6 +566,9 @@ private:
 	u8 tile_apply_bitmask(const u8 *maskdata, u32 x0, u32 y0, u8 category, u8 flags);
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
+	template<class _BitmapClass> void draw_layout(screen_device &screen, _BitmapClass &dest, blit_parameters blit, u32 xextent, u32 yextent);
+	template<class _BitmapClass> void draw_banded(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, u32 xextent, u32 yextent);
+	template<class _BitmapClass> static void *draw_band(void *param, int threadid);
 	template<class _BitmapClass> void draw_roz_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_instance(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int xpos, int ypos);
 	template<class _BitmapClass> void draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound);
@@ -643,6 +658,12 @@ public:
 	void set_flip_all(u32 attributes);
 
 private:
+	// banded drawing
+	static constexpr int MIN_BAND_HEIGHT = 32;
+	static constexpr int MAX_BANDS = 8;
+	bool threaded() const { return m_threaded; }
+	osd_work_queue *work_queue();
+
 	// tilemap creation
 	tilemap_t &create(device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_mapper_delegate mapper, u16 tilewidth, u16 tileheight, u32 cols, u32 rows, tilemap_t *allocated);
 	tilemap_t &create(device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_standard_mapper mapper, u16 tilewidth, u16 tileheight, u32 cols, u32 rows, tilemap_t *allocated);
@@ -654,6 +675,8 @@ private:
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	bool                    m_threaded;             // draw large layers in bands on the work queue
+	osd_work_queue *        m_work_queue;           // queue for banded drawing, allocated on demand
 };
 
 
@@ -15,7 +15,12 @@
 #include "romload.h"
 #include "video/rgbutil.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <exception>
+#include <sstream>
+#include <thread>
 #include <type_traits>
 #include <typeinfo>
 
@@ -138,6 +143,7 @@ validity_checker::validity_checker(emu_options &options)
 	, m_current_device(nullptr)
 	, m_current_ioport(nullptr)
 	, m_validate_all(false)
+	, m_defer_output(false)
 {
 	// pre-populate the defstr map with all the default strings
 	for (int strnum = 1; strnum < INPUT_STRING_COUNT; strnum++)
@@ -217,17 +223,16 @@ bool validity_checker::check_all_matching(const char *string)
 		output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "\n");
 	}
 
-	// then iterate over all drivers and check them
+	// then gather all matching drivers and check them
+	std::vector<const game_driver *> drivers;
 	m_drivlist.reset();
-	bool validated_any = false;
 	while (m_drivlist.next())
 	{
 		if (m_drivlist.matches(string, m_drivlist.driver().name))
-		{
-			validate_one(m_drivlist.driver());
-			validated_any = true;
-		}
+			drivers.push_back(&m_drivlist.driver());
 	}
+	bool const validated_any = !drivers.empty();
+	validate_matching(drivers);
 
 	// validate devices
 	if (!string)
@@ -282,7 +287,101 @@ void validity_checker::validate_end()
 
 
 //-------------------------------------------------
-//  validate_drivers - master validity checker
+//  validate_matching - validate a list of drivers,
+//  spreading them over worker threads when there
+//  are enough of them
+//-------------------------------------------------
+
+namespace {
+
+// checker that a worker thread's output is routed to
+thread_local validity_checker *s_thread_checker = nullptr;
+
+} // anonymous namespace
+
+void validity_checker::validate_matching(const std::vector<const game_driver *> &drivers)
+{
+	constexpr size_t BATCH_SIZE = 64;
+	unsigned const numthreads = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1U), drivers.size() / BATCH_SIZE);
+	if (numthreads < 2)
+	{
+		for (const game_driver *driver : drivers)
+			validate_one(*driver);
+		return;
+	}
+
+	// duplicate names and descriptions are judged against the whole list, so record
+	// the first driver for each up front; validate_driver then flags any other driver
+	for (const game_driver *driver : drivers)
+	{
+		m_names_map.emplace(driver->name, driver);
+		m_descriptions_map.emplace(driver->type.fullname(), driver);
+	}
+
+	// each worker gets its own checker; batches are handed out in order and their
+	// output is kept per batch so the report is the same whatever the scheduling
+	size_t const numbatches = (drivers.size() + BATCH_SIZE - 1) / BATCH_SIZE;
+	std::vector<std::string> batch_output(numbatches);
+	std::vector<std::unique_ptr<validity_checker> > checkers;
+	std::vector<std::exception_ptr> failures(numthreads);
+	std::vector<std::thread> threads;
+	std::atomic<size_t> next_batch(0);
+	for (unsigned threadnum = 0; threadnum < numthreads; threadnum++)
+	{
+		checkers.emplace_back(std::make_unique<validity_checker>(m_drivlist.options()));
+		validity_checker &checker(*checkers.back());
+		checker.m_print_verbose = m_print_verbose;
+		checker.m_validate_all = m_validate_all;
+		checker.m_defer_output = true;
+		checker.m_names_map = m_names_map;
+		checker.m_descriptions_map = m_descriptions_map;
+	}
+	for (unsigned threadnum = 0; threadnum < numthreads; threadnum++)
+	{
+		threads.emplace_back(
+				[&drivers, &batch_output, &failures, &next_batch, numbatches, threadnum, &checker = *checkers[threadnum]] ()
+				{
+					s_thread_checker = &checker;
+					try
+					{
+						for (size_t batch = next_batch++; batch < numbatches; batch = next_batch++)
+						{
+							// start each batch afresh so shared checks report the same way wherever it runs
+							checker.m_already_checked.clear();
+							size_t const end = std::min((batch + 1) * BATCH_SIZE, drivers.size());
+							for (size_t index = batch * BATCH_SIZE; index < end; index++)
+								checker.validate_one(*drivers[index]);
+							batch_output[batch] = std::move(checker.m_deferred_output);
+							checker.m_deferred_output.clear();
+						}
+					}
+					catch (...)
+					{
+						failures[threadnum] = std::current_exception();
+					}
+					s_thread_checker = nullptr;
+				});
+	}
+	for (std::thread &thread : threads)
+		thread.join();
+	for (std::exception_ptr const &failure : failures)
+		if (failure)
+			std::rethrow_exception(failure);
+
+	// merge the results
+	for (auto const &checker : checkers)
+	{
+		m_errors += checker->m_errors;
+		m_warnings += checker->m_warnings;
+	}
+	for (std::string const &text : batch_output)
+		if (!text.empty())
+			output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "%s", text);
+}
+
+
+//-------------------------------------------------
+//  validate_one - validate a single driver
 //-------------------------------------------------
 
 void validity_checker::validate_one(const game_driver &driver)
@@ -1402,18 +1501,20 @@ void validity_checker::validate_rgb()
 
 void validity_checker::validate_driver()
 {
-	// check for duplicate names
+	// check for duplicate names (the maps may have been filled in advance)
 	if (!m_names_map.insert(std::make_pair(m_current_driver->name, m_current_driver)).second)
 	{
 		const game_driver *match = m_names_map.find(m_current_driver->name)->second;
-		osd_printf_error("Driver name is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
+		if (match != m_current_driver)
+			osd_printf_error("Driver name is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
 	}
 
 	// check for duplicate descriptions
 	if (!m_descriptions_map.insert(std::make_pair(m_current_driver->type.fullname(), m_current_driver)).second)
 	{
 		const game_driver *match = m_descriptions_map.find(m_current_driver->type.fullname())->second;
-		osd_printf_error("Driver description is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
+		if (match != m_current_driver)
+			osd_printf_error("Driver description is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
 	}
 
 	// determine if we are a clone
@@ -2172,6 +2273,13 @@ void validity_checker::build_output_prefix(std::ostream &str) const
 
 void validity_checker::output_callback(osd_output_channel channel, const util::format_argument_pack<std::ostream> &args)
 {
+	// messages raised on a worker thread belong to that worker's checker
+	if (s_thread_checker && (s_thread_checker != this))
+	{
+		s_thread_checker->output_callback(channel, args);
+		return;
+	}
+
 	std::ostringstream output;
 	switch (channel)
 	{
@@ -2226,6 +2334,15 @@ void validity_checker::output_callback(osd_output_channel channel, const util::f
 template <typename Format, typename... Params>
 void validity_checker::output_via_delegate(osd_output_channel channel, Format &&fmt, Params &&...args)
 {
+	// worker checkers hold their output back for the master to report
+	if (m_defer_output)
+	{
+		std::ostringstream output;
+		util::stream_format(output, std::forward<Format>(fmt), std::forward<Params>(args)...);
+		m_deferred_output.append(output.str());
+		return;
+	}
+
 	// call through to the delegate with the proper parameters
 	chain_output(channel, util::make_format_argument_pack(std::forward<Format>(fmt), std::forward<Params>(args)...));
 }
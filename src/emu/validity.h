@@ -67,6 +67,7 @@ private:
 	void validate_begin();
 	void validate_end();
 	void validate_one(const game_driver &driver);
+	void validate_matching(const std::vector<const game_driver *> &drivers);
 
 	// internal sub-checks
 	void validate_core();
@@ -120,6 +121,10 @@ private:
 	int_map                 m_region_map;
 	std::unordered_set<std::string>   m_already_checked;
 	bool                    m_validate_all;
+
+	// output of a worker checker, held back until the master reports it in order
+	bool                    m_defer_output;
+	std::string             m_deferred_output;
 };
 
 #endif // MAME_EMU_VALIDITY_H
@@ -22,6 +22,10 @@
 
 #include "osdepend.h"
 
+#include <zlib.h>
+
+#include <thread>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -54,6 +58,42 @@ const bool video_manager::s_skiptable[FRAMESKIP_LEVELS][FRAMESKIP_LEVELS] =
 
 
 
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// a unit of work for the movie encoder thread
+
+struct video_manager::record_job
+{
+	video_manager *     m_manager;
+	uint32_t            m_index;                    // index of the AVI/MNG recording
+	bool                m_mng;                      // MNG rather than AVI
+	u32                 m_frames;                   // number of times to write the bitmap
+	bitmap_rgb32        m_bitmap;                   // copy of the snapshot bitmap
+	std::vector<rgb_t>  m_palette;                  // copy of the screen palette (MNG only)
+	std::vector<s16>    m_sound;                    // interleaved stereo samples (AVI only)
+	std::string         m_software;                 // text fields for the first MNG frame
+	std::string         m_system;
+};
+
+// a unit of work for the stream encoder thread
+
+struct video_manager::stream_job
+{
+	video_manager *     m_manager;
+	u32                 m_frame;                    // frame sequence number
+	s32                 m_width;                    // size of the visible area, 0 for sound only
+	s32                 m_height;
+	rectangle           m_damage;                   // area that may have changed, relative to the visible area
+	std::vector<u32>    m_pixels;                   // copy of the visible area
+	std::vector<s16>    m_sound;                    // interleaved stereo samples
+	int                 m_sample_rate;
+	std::vector<http_manager::websocket_connection_ptr> m_clients;
+};
+
+
+
 //**************************************************************************
 //  VIDEO MANAGER
 //**************************************************************************
@@ -91,7 +131,10 @@ video_manager::video_manager(running_machine &machine)
 	, m_seconds_to_run(machine.options().seconds_to_run())
 	, m_auto_frameskip(machine.options().auto_frameskip())
 	, m_speed(original_speed_setting())
-	, m_low_latency(machine.options().low_latency())
+	, m_low_latency(machine.options().low_latency() || machine.options().vrr())
+	, m_present_ticks(0)
+	, m_present_max_ticks(0)
+	, m_present_frames(0)
 	, m_empty_skip_count(0)
 	, m_frameskip_level(machine.options().frameskip())
 	, m_frameskip_counter(0)
@@ -102,6 +145,20 @@ video_manager::video_manager(running_machine &machine)
 	, m_snap_native(true)
 	, m_snap_width(0)
 	, m_snap_height(0)
+	, m_record_async(machine.options().async_record())
+	, m_record_queue(nullptr)
+	, m_record_pending(0)
+	, m_record_failed(false)
+	, m_stream_period(machine.options().http_stream() ? attotime::from_hz(machine.options().http_stream()) : attotime::zero)
+	, m_stream_next_time(attotime::zero)
+	, m_stream_frame(0)
+	, m_stream_damage(0, -1, 0, -1)
+	, m_stream_queue(nullptr)
+	, m_stream_pending(0)
+	, m_stream_client_count(0)
+	, m_stream_keyframe(true)
+	, m_stream_width(0)
+	, m_stream_height(0)
 	, m_timecode_enabled(false)
 	, m_timecode_write(false)
 	, m_timecode_text("")
@@ -212,9 +269,14 @@ void video_manager::frame_update(bool from_debugger)
 	// only render sound and video if we're in the running phase
 	machine_phase const phase = machine().phase();
 	bool skipped_it = m_skipping_this_frame;
+	osd_ticks_t frame_done = 0;
 	if (phase == machine_phase::RUNNING && (!machine().paused() || machine().options().update_in_pause()))
 	{
+		// send batched output changes before screens that draw outputs are finished
+		machine().output().flush();
+
 		bool anything_changed = finish_screen_updates();
+		frame_done = osd_ticks();
 
 		// if none of the screens changed and we haven't skipped too many frames in a row,
 		// mark this frame as skipped to prevent throttling; this helps for games that
@@ -238,6 +300,15 @@ void video_manager::frame_update(bool from_debugger)
 	machine().osd().update(!from_debugger && skipped_it);
 	g_profiler.stop();
 
+	// measure how long a completed frame takes to reach the display
+	if (frame_done && !from_debugger && !skipped_it)
+	{
+		osd_ticks_t const latency = osd_ticks() - frame_done;
+		m_present_ticks += latency;
+		m_present_max_ticks = (std::max)(m_present_max_ticks, latency);
+		m_present_frames++;
+	}
+
 	// we synchronize after rendering instead of before, if low latency mode is enabled
 	if (!from_debugger && !skipped_it && m_low_latency && effective_throttle())
 		update_throttle(current_time);
@@ -617,6 +688,7 @@ void video_manager::end_recording_avi(uint32_t index)
 	avi_info_t &info = m_avis[index];
 	if (info.m_avi_file)
 	{
+		flush_recording();
 		info.m_avi_file.reset();
 
 		// reset the state
@@ -633,6 +705,7 @@ void video_manager::end_recording_mng(uint32_t index)
 	mng_info_t &info = m_mngs[index];
 	if (info.m_mng_file != nullptr)
 	{
+		flush_recording();
 		mng_capture_stop(*info.m_mng_file);
 		info.m_mng_file.reset();
 
@@ -648,6 +721,15 @@ void video_manager::end_recording_mng(uint32_t index)
 
 void video_manager::add_sound_to_recording(const s16 *sound, int numsamples)
 {
+	// keep at most a second for stream clients if the encoder falls behind
+	if (m_stream_client_count != 0)
+	{
+		m_stream_sound.insert(m_stream_sound.end(), sound, sound + numsamples * 2);
+		size_t const limit = machine().sample_rate() * 2;
+		if (m_stream_sound.size() > limit)
+			m_stream_sound.erase(m_stream_sound.begin(), m_stream_sound.end() - limit);
+	}
+
 	for (uint32_t index = 0; index < m_avis.size(); index++)
 	{
 		add_sound_to_avi_recording(sound, numsamples, index);
@@ -665,7 +747,14 @@ void video_manager::add_sound_to_avi_recording(const s16 *sound, int numsamples,
 {
 	avi_info_t &info = m_avis[index];
 	// only record if we have a file
-	if (info.m_avi_file != nullptr)
+	if (info.m_avi_file != nullptr && m_record_async)
+	{
+		// hand a copy to the encoder thread so it stays ordered with the video
+		record_job *job = alloc_record_job(index, false, nullptr, 0);
+		job->m_sound.assign(sound, sound + numsamples * 2);
+		queue_record_job(job);
+	}
+	else if (info.m_avi_file != nullptr)
 	{
 		g_profiler.start(PROFILER_MOVIE_REC);
 
@@ -699,6 +788,25 @@ void video_manager::exit()
 			break;
 	}
 
+	// release the encoder thread
+	if (m_record_queue != nullptr)
+	{
+		osd_work_queue_free(m_record_queue);
+		m_record_queue = nullptr;
+	}
+
+	// release the stream encoder and any clients still connected
+	if (m_stream_queue != nullptr)
+	{
+		osd_work_queue_free(m_stream_queue);
+		m_stream_queue = nullptr;
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_stream_mutex);
+		m_stream_clients.clear();
+		m_stream_client_count = 0;
+	}
+
 	// free the snapshot target
 	machine().render().target_free(m_snap_target);
 	m_snap_bitmap.reset();
@@ -711,6 +819,13 @@ void video_manager::exit()
 		double final_emu_time = m_overall_emutime.as_double();
 		osd_printf_info("Average speed: %.2f%% (%d seconds)\n", 100 * final_emu_time / final_real_time, (m_overall_emutime + attotime(0, ATTOSECONDS_PER_SECOND / 2)).seconds());
 	}
+
+	// report the time from frame completion to present
+	if (m_present_frames)
+	{
+		double const tpms = double(osd_ticks_per_second()) / 1000.0;
+		osd_printf_verbose("Present latency: %.2f ms average, %.2f ms worst (%u frames)\n", double(m_present_ticks) / m_present_frames / tpms, double(m_present_max_ticks) / tpms, m_present_frames);
+	}
 }
 
 
@@ -858,6 +973,10 @@ bool video_manager::finish_screen_updates()
 	bool anything_changed = !has_live_screen || m_output_changed;
 	m_output_changed = false;
 
+	// capture the finished frame for stream clients before the screens flip their bitmaps
+	if (!machine().paused())
+		stream_frame();
+
 	// now add the quads for all the screens
 	for (screen_device &screen : iter)
 		if (screen.update_quads())
@@ -1058,10 +1177,13 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 		else
 			delta = 0;
 
-		// see if we can sleep
+		// see if we can sleep; inside the oversleep margin, give up the rest of our time slice
+		// instead of busy-waiting so other threads get the core
 		bool const slept = allowed_to_sleep && delta;
 		if (slept)
 			osd_sleep(delta);
+		else if (allowed_to_sleep)
+			std::this_thread::yield();
 
 		// read the new value
 		osd_ticks_t const new_ticks = osd_ticks();
@@ -1080,6 +1202,12 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 				if (LOG_THROTTLE)
 					machine().logerror("Slept for %d ticks, got %d ticks, avgover = %d\n", (int)delta, (int)actual_ticks, (int)m_average_oversleep);
 			}
+			else
+			{
+				// slowly decay the average when the sleep was on time, so one bad wakeup
+				// doesn't leave us spinning through a large margin forever
+				m_average_oversleep -= m_average_oversleep / 1000;
+			}
 		}
 		current_ticks = new_ticks;
 	}
@@ -1456,6 +1584,9 @@ osd_file::error video_manager::open_next(emu_file &file, const char *extension,
 
 void video_manager::record_frame()
 {
+	// stop any recording the encoder thread failed to write
+	check_recording_errors();
+
 	// ignore if nothing to do
 	if (!is_recording())
 		return;
@@ -1472,8 +1603,26 @@ void video_manager::record_frame()
 		// create the bitmap
 		create_snapshot_bitmap(iter.current());
 
+		// hand AVI frames to the encoder thread
+		if ((index < m_avis.size()) && m_avis[index].m_avi_file && m_record_async)
+		{
+			avi_info_t &avi_info = m_avis[index];
+
+			// count the frames up to the right time; each is a copy of the same bitmap
+			u32 frames = 0;
+			for ( ; avi_info.m_avi_next_frame_time <= curtime; frames++)
+			{
+				avi_info.m_avi_next_frame_time += avi_info.m_avi_frame_period;
+				avi_info.m_avi_frame++;
+			}
+			if (frames != 0)
+			{
+				queue_record_job(alloc_record_job(index, false, iter.current(), frames));
+			}
+		}
+
 		// handle an AVI recording
-		if ((index < m_avis.size()) && m_avis[index].m_avi_file)
+		else if ((index < m_avis.size()) && m_avis[index].m_avi_file)
 		{
 			avi_info_t &avi_info = m_avis[index];
 
@@ -1495,8 +1644,33 @@ void video_manager::record_frame()
 			}
 		}
 
+		// hand MNG frames to the encoder thread
+		if ((index < m_mngs.size()) && m_mngs[index].m_mng_file && m_record_async)
+		{
+			mng_info_t &mng_info = m_mngs[index];
+			bool const first = (mng_info.m_mng_frame == 0);
+
+			// count the frames up to the right time; each is a copy of the same bitmap
+			u32 frames = 0;
+			for ( ; mng_info.m_mng_next_frame_time <= curtime; frames++)
+			{
+				mng_info.m_mng_next_frame_time += mng_info.m_mng_frame_period;
+				mng_info.m_mng_frame++;
+			}
+			if (frames != 0)
+			{
+				record_job *job = alloc_record_job(index, true, iter.current(), frames);
+				if (first)
+				{
+					job->m_software = std::string(emulator_info::get_appname()).append(" ").append(emulator_info::get_build_version());
+					job->m_system = std::string(machine().system().manufacturer).append(" ").append(machine().system().type.fullname());
+				}
+				queue_record_job(job);
+			}
+		}
+
 		// handle a MNG recording
-		if ((index < m_mngs.size()) && m_mngs[index].m_mng_file)
+		else if ((index < m_mngs.size()) && m_mngs[index].m_mng_file)
 		{
 			mng_info_t &mng_info = m_mngs[index];
 
@@ -1540,6 +1714,405 @@ void video_manager::record_frame()
 	g_profiler.stop();
 }
 
+
+//-------------------------------------------------
+//  alloc_record_job - build a job holding a copy
+//  of the current snapshot bitmap
+//-------------------------------------------------
+
+video_manager::record_job *video_manager::alloc_record_job(uint32_t index, bool mng, screen_device *screen, u32 frames)
+{
+	record_job *job = new record_job;
+	job->m_manager = this;
+	job->m_index = index;
+	job->m_mng = mng;
+	job->m_frames = frames;
+
+	// sound-only jobs don't need the bitmap
+	if (frames != 0)
+	{
+		job->m_bitmap.allocate(m_snap_bitmap.width(), m_snap_bitmap.height());
+		copybitmap(job->m_bitmap, m_snap_bitmap, 0, 0, 0, 0, m_snap_bitmap.cliprect());
+	}
+	if (mng && screen != nullptr && screen->has_palette())
+	{
+		const rgb_t *palette = screen->palette().palette()->entry_list_adjusted();
+		job->m_palette.assign(palette, palette + screen->palette().entries());
+	}
+	return job;
+}
+
+
+//-------------------------------------------------
+//  queue_record_job - pass a job to the encoder
+//  thread, waiting if it has fallen behind
+//-------------------------------------------------
+
+void video_manager::queue_record_job(record_job *job)
+{
+	if (m_record_queue == nullptr)
+		m_record_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+
+	m_record_pending++;
+	if (m_record_queue == nullptr)
+	{
+		record_job_callback(job, 0);
+		return;
+	}
+
+	// apply back-pressure rather than letting the backlog grow without bound
+	if (m_record_pending > MAX_PENDING_RECORD_JOBS)
+	{
+		g_profiler.start(PROFILER_MOVIE_REC);
+		osd_work_queue_wait(m_record_queue, osd_ticks_per_second() * 10);
+		g_profiler.stop();
+	}
+	osd_work_item_queue(m_record_queue, record_job_callback, job, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+
+//-------------------------------------------------
+//  flush_recording - wait for the encoder thread
+//  to write everything queued so far
+//-------------------------------------------------
+
+void video_manager::flush_recording()
+{
+	if (m_record_queue != nullptr && m_record_pending != 0)
+		osd_work_queue_wait(m_record_queue, osd_ticks_per_second() * 10);
+}
+
+
+//-------------------------------------------------
+//  check_recording_errors - stop all recordings
+//  if the encoder thread failed to write
+//-------------------------------------------------
+
+void video_manager::check_recording_errors()
+{
+	if (!m_record_failed)
+		return;
+
+	flush_recording();
+	m_record_failed = false;
+	for (uint32_t index = 0; index < m_avis.size(); index++)
+		end_recording_avi(index);
+	for (uint32_t index = 0; index < m_mngs.size(); index++)
+		end_recording_mng(index);
+}
+
+
+//-------------------------------------------------
+//  record_job_callback - encode and write a job
+//  on the encoder thread
+//-------------------------------------------------
+
+void *video_manager::record_job_callback(void *param, int threadid)
+{
+	std::unique_ptr<record_job> job(reinterpret_cast<record_job *>(param));
+	video_manager &manager = *job->m_manager;
+
+	// once a write has failed, drop everything until the recording is stopped
+	if (!manager.m_record_failed)
+	{
+		bool failed = false;
+		if (job->m_mng)
+		{
+			emu_file &file = *manager.m_mngs[job->m_index].m_mng_file;
+			const rgb_t *palette = job->m_palette.empty() ? nullptr : &job->m_palette[0];
+			for (u32 frame = 0; !failed && frame < job->m_frames; frame++)
+			{
+				png_info pnginfo;
+				if (frame == 0 && !job->m_software.empty())
+				{
+					pnginfo.add_text("Software", job->m_software.c_str());
+					pnginfo.add_text("System", job->m_system.c_str());
+				}
+				failed = mng_capture_frame(file, pnginfo, job->m_bitmap, job->m_palette.size(), palette) != PNGERR_NONE;
+			}
+		}
+		else
+		{
+			avi_file &file = *manager.m_avis[job->m_index].m_avi_file;
+			if (!job->m_sound.empty())
+			{
+				int const numsamples = job->m_sound.size() / 2;
+				failed = file.append_sound_samples(0, &job->m_sound[0], numsamples, 1) != avi_file::error::NONE
+						|| file.append_sound_samples(1, &job->m_sound[1], numsamples, 1) != avi_file::error::NONE;
+			}
+			for (u32 frame = 0; !failed && frame < job->m_frames; frame++)
+				failed = file.append_video_frame(job->m_bitmap) != avi_file::error::NONE;
+		}
+		if (failed)
+			manager.m_record_failed = true;
+	}
+
+	manager.m_record_pending--;
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  export_http_api - register the /stream
+//  WebSocket endpoint if streaming is enabled
+//-------------------------------------------------
+
+void video_manager::export_http_api()
+{
+	http_manager *const http = machine().manager().http();
+	if (m_stream_period == attotime::zero || !http->is_active())
+		return;
+
+	http->add_endpoint("/stream",
+			[this] (http_manager::websocket_connection_ptr connection) { add_stream_client(connection); },
+			[this] (http_manager::websocket_connection_ptr connection, const std::string &payload, int opcode) { m_stream_keyframe = true; },
+			[this] (http_manager::websocket_connection_ptr connection, int status, const std::string &reason) { remove_stream_client(connection); },
+			[this] (http_manager::websocket_connection_ptr connection, const std::error_code &error_code) { remove_stream_client(connection); });
+}
+
+
+//-------------------------------------------------
+//  add_stream_client/remove_stream_client -
+//  track WebSocket connections; called from the
+//  HTTP server thread
+//-------------------------------------------------
+
+void video_manager::add_stream_client(http_manager::websocket_connection_ptr connection)
+{
+	std::lock_guard<std::mutex> lock(m_stream_mutex);
+	m_stream_clients.push_back(connection);
+	m_stream_client_count = m_stream_clients.size();
+	m_stream_keyframe = true;
+}
+
+void video_manager::remove_stream_client(http_manager::websocket_connection_ptr connection)
+{
+	std::lock_guard<std::mutex> lock(m_stream_mutex);
+	m_stream_clients.erase(std::remove(m_stream_clients.begin(), m_stream_clients.end(), connection), m_stream_clients.end());
+	m_stream_client_count = m_stream_clients.size();
+}
+
+
+//-------------------------------------------------
+//  stream_frame - copy the first screen and the
+//  sound since the last call for the stream
+//  encoder, dropping frames if it falls behind
+//-------------------------------------------------
+
+void video_manager::stream_frame()
+{
+	if (m_stream_client_count == 0)
+	{
+		m_stream_sound.clear();
+		return;
+	}
+
+	// screens clear their damage every frame, so gather it until the next streamed frame
+	screen_device *const screen = screen_device_iterator(machine().root_device()).first();
+	if (screen != nullptr && screen->damage_tracking() && !screen->damage().empty())
+	{
+		if (m_stream_damage.empty())
+			m_stream_damage = screen->damage();
+		else
+			m_stream_damage |= screen->damage();
+	}
+
+	attotime const curtime = machine().time();
+	if (curtime < m_stream_next_time)
+		return;
+	m_stream_next_time = curtime + m_stream_period;
+
+	if (m_stream_pending >= MAX_PENDING_STREAM_JOBS)
+		return;
+
+	std::unique_ptr<stream_job> job = std::make_unique<stream_job>();
+	job->m_manager = this;
+	job->m_frame = m_stream_frame++;
+	job->m_width = 0;
+	job->m_height = 0;
+	job->m_sample_rate = machine().sample_rate();
+	job->m_sound.swap(m_stream_sound);
+
+	if (screen != nullptr && screen->curbitmap().valid())
+	{
+		const rectangle &visarea = screen->visible_area();
+		job->m_width = visarea.width();
+		job->m_height = visarea.height();
+		job->m_pixels.resize(job->m_width * job->m_height);
+		screen->pixels(&job->m_pixels[0]);
+
+		// only tiles under the damage region need comparing when the driver tracks it
+		job->m_damage.set(0, job->m_width - 1, 0, job->m_height - 1);
+		if (screen->damage_tracking())
+		{
+			rectangle damage = m_stream_damage;
+			damage &= visarea;
+			damage.offset(-visarea.min_x, -visarea.min_y);
+			job->m_damage = damage;
+			m_stream_damage.set(0, -1, 0, -1);
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_stream_mutex);
+		job->m_clients = m_stream_clients;
+	}
+
+	if (m_stream_queue == nullptr)
+		m_stream_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+
+	m_stream_pending++;
+	if (m_stream_queue == nullptr)
+		stream_job_callback(job.release(), 0);
+	else
+		osd_work_item_queue(m_stream_queue, stream_job_callback, job.release(), WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+
+//-------------------------------------------------
+//  encode_stream_frame - build a frame message
+//  holding the tiles that changed since the last
+//  frame sent
+//
+//  All values are little-endian:
+//    u8  'F'
+//    u8  flags (bit 0: key frame, all tiles sent)
+//    u16 width, u16 height
+//    u8  tile size, u8 reserved
+//    u32 frame number
+//    u32 number of tiles
+//    u16 x, u16 y tile coordinates, per tile
+//    zlib stream of each tile's pixels in rows,
+//    as 32-bit xRGB XORed with the previous frame
+//
+//  Sound messages are:
+//    u8  'A', u8 channels, u16 reserved
+//    u32 sample rate
+//    s16 interleaved samples
+//-------------------------------------------------
+
+void video_manager::encode_stream_frame(stream_job &job, std::string &message)
+{
+	s32 const width = job.m_width;
+	s32 const height = job.m_height;
+	bool const keyframe = m_stream_keyframe.exchange(false) || width != m_stream_width || height != m_stream_height;
+	if (keyframe)
+	{
+		m_stream_width = width;
+		m_stream_height = height;
+		m_stream_previous.assign(width * height, 0);
+	}
+
+	// collect the tiles that differ, replacing the previous frame as we go
+	rectangle area(0, width - 1, 0, height - 1);
+	if (!keyframe)
+		area &= job.m_damage;
+	std::vector<u16> tiles;
+	std::vector<u32> delta;
+	if (!area.empty())
+	{
+		for (s32 ty = area.min_y / STREAM_TILE_SIZE; ty <= area.max_y / STREAM_TILE_SIZE; ty++)
+		{
+			s32 const y0 = ty * STREAM_TILE_SIZE;
+			s32 const y1 = (std::min)(y0 + STREAM_TILE_SIZE, height);
+			for (s32 tx = area.min_x / STREAM_TILE_SIZE; tx <= area.max_x / STREAM_TILE_SIZE; tx++)
+			{
+				s32 const x0 = tx * STREAM_TILE_SIZE;
+				size_t const rowbytes = ((std::min)(x0 + STREAM_TILE_SIZE, width) - x0) * sizeof(u32);
+
+				bool changed = keyframe;
+				for (s32 y = y0; !changed && y < y1; y++)
+					changed = memcmp(&job.m_pixels[y * width + x0], &m_stream_previous[y * width + x0], rowbytes) != 0;
+				if (!changed)
+					continue;
+
+				tiles.push_back(tx);
+				tiles.push_back(ty);
+				for (s32 y = y0; y < y1; y++)
+				{
+					u32 *const prev = &m_stream_previous[y * width + x0];
+					const u32 *const cur = &job.m_pixels[y * width + x0];
+					for (size_t x = 0; x < rowbytes / sizeof(u32); x++)
+					{
+						delta.push_back(little_endianize_int32(cur[x] ^ prev[x]));
+						prev[x] = cur[x];
+					}
+				}
+			}
+		}
+	}
+
+	// nothing to send for an unchanged frame
+	if (tiles.empty() && !keyframe)
+		return;
+
+	auto put16 = [&message] (u16 value) { message.push_back(char(value & 0xff)); message.push_back(char(value >> 8)); };
+	auto put32 = [&put16] (u32 value) { put16(value & 0xffff); put16(value >> 16); };
+	message.push_back('F');
+	message.push_back(keyframe ? 1 : 0);
+	put16(width);
+	put16(height);
+	message.push_back(char(STREAM_TILE_SIZE));
+	message.push_back(0);
+	put32(job.m_frame);
+	put32(tiles.size() / 2);
+	for (u16 coord : tiles)
+		put16(coord);
+
+	uLongf packed = compressBound(delta.size() * sizeof(u32));
+	size_t const start = message.size();
+	message.resize(start + packed);
+	if (compress2(reinterpret_cast<Bytef *>(&message[start]), &packed, reinterpret_cast<const Bytef *>(delta.data()), delta.size() * sizeof(u32), Z_BEST_SPEED) != Z_OK)
+	{
+		// drop the frame and start over from a key frame
+		message.clear();
+		m_stream_keyframe = true;
+		return;
+	}
+	message.resize(start + packed);
+}
+
+
+//-------------------------------------------------
+//  stream_job_callback - encode a job and send it
+//  to every client on the encoder thread
+//-------------------------------------------------
+
+void *video_manager::stream_job_callback(void *param, int threadid)
+{
+	std::unique_ptr<stream_job> job(reinterpret_cast<stream_job *>(param));
+	video_manager &manager = *job->m_manager;
+
+	std::string message;
+	if (job->m_width != 0 && job->m_height != 0)
+	{
+		manager.encode_stream_frame(*job, message);
+		if (!message.empty())
+			for (auto &client : job->m_clients)
+				client->send_message(message, 2);
+	}
+
+	if (!job->m_sound.empty())
+	{
+		message.clear();
+		message.push_back('A');
+		message.push_back(2);
+		message.append(2, '\0');
+		for (int shift = 0; shift < 32; shift += 8)
+			message.push_back(char(u32(job->m_sample_rate) >> shift));
+		for (s16 sample : job->m_sound)
+		{
+			message.push_back(char(u16(sample) & 0xff));
+			message.push_back(char(u16(sample) >> 8));
+		}
+		for (auto &client : job->m_clients)
+			client->send_message(message, 2);
+	}
+
+	manager.m_stream_pending--;
+	return nullptr;
+}
+
 //-------------------------------------------------
 //  toggle_throttle
 //-------------------------------------------------
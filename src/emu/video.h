@@ -19,6 +19,8 @@
 
 #include "aviio.h"
 
+#include <mutex>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -99,6 +101,9 @@ public:
 	void add_sound_to_recording(const s16 *sound, int numsamples);
 	void add_sound_to_avi_recording(const s16 *sound, int numsamples, uint32_t index);
 
+	// remote streaming
+	void export_http_api();
+
 	void set_timecode_enabled(bool value) { m_timecode_enabled = value; }
 	bool get_timecode_enabled() { return m_timecode_enabled; }
 	bool get_timecode_write() { return m_timecode_write; }
@@ -132,6 +137,22 @@ private:
 	void create_snapshot_bitmap(screen_device *screen);
 	void record_frame();
 
+	// asynchronous movie recording helpers
+	struct record_job;
+	record_job *alloc_record_job(uint32_t index, bool mng, screen_device *screen, u32 frames);
+	void queue_record_job(record_job *job);
+	void flush_recording();
+	void check_recording_errors();
+	static void *record_job_callback(void *param, int threadid);
+
+	// remote streaming helpers
+	struct stream_job;
+	void stream_frame();
+	void add_stream_client(http_manager::websocket_connection_ptr connection);
+	void remove_stream_client(http_manager::websocket_connection_ptr connection);
+	void encode_stream_frame(stream_job &job, std::string &message);
+	static void *stream_job_callback(void *param, int threadid);
+
 	// internal state
 	running_machine &   m_machine;                  // reference to our machine
 
@@ -164,6 +185,9 @@ private:
 	bool                m_auto_frameskip;           // flag: true if we're automatically frameskipping
 	u32                 m_speed;                    // overall speed (*1000)
 	bool                m_low_latency;              // flag: true if we are throttling after blitting
+	osd_ticks_t         m_present_ticks;            // total ticks from frame completion to present
+	osd_ticks_t         m_present_max_ticks;        // worst ticks from frame completion to present
+	u32                 m_present_frames;           // number of frames measured
 
 	// frameskipping
 	u8                  m_empty_skip_count;         // number of empty frames we have skipped
@@ -213,6 +237,31 @@ private:
 	};
 	std::vector<avi_info_t> m_avis;
 
+	// movie recording - asynchronous encoding
+	static constexpr u32 MAX_PENDING_RECORD_JOBS = 8;
+	bool                m_record_async;             // encode movie frames on a worker thread?
+	osd_work_queue *    m_record_queue;             // serial queue feeding the encoder thread
+	std::atomic<u32>    m_record_pending;           // number of jobs not yet encoded
+	std::atomic<bool>   m_record_failed;            // set by the encoder thread on a write error
+
+	// remote streaming over the HTTP server's WebSocket endpoint
+	static constexpr u32 MAX_PENDING_STREAM_JOBS = 2;
+	static constexpr int STREAM_TILE_SIZE = 16;
+	attotime            m_stream_period;            // time between streamed frames, zero if disabled
+	attotime            m_stream_next_time;         // emulated time of the next streamed frame
+	u32                 m_stream_frame;             // sequence number of the next streamed frame
+	rectangle           m_stream_damage;            // screen damage since the last streamed frame
+	std::vector<s16>    m_stream_sound;             // interleaved stereo samples since the last job
+	osd_work_queue *    m_stream_queue;             // serial queue feeding the stream encoder
+	std::atomic<u32>    m_stream_pending;           // number of jobs not yet sent
+	std::mutex          m_stream_mutex;             // guards the client list
+	std::vector<http_manager::websocket_connection_ptr> m_stream_clients;
+	std::atomic<u32>    m_stream_client_count;      // size of the client list, read without the lock
+	std::atomic<bool>   m_stream_keyframe;          // next frame must be sent in full
+	std::vector<u32>    m_stream_previous;          // last frame sent, used by the encoder only
+	s32                 m_stream_width;             // size of the last frame sent
+	s32                 m_stream_height;
+
 	static const bool   s_skiptable[FRAMESKIP_LEVELS][FRAMESKIP_LEVELS];
 
 	static const attoseconds_t ATTOSECONDS_PER_SPEED_UPDATE = ATTOSECONDS_PER_SECOND / 4;
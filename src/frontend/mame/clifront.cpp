@@ -35,8 +35,13 @@
 #include "osdepend.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
 #include <new>
 #include <cctype>
+#include <thread>
 
 
 //**************************************************************************
@@ -124,10 +129,9 @@ const options_entry cli_option_entries[] =
 
 
 void print_summary(
-		const media_auditor &auditor, media_auditor::summary summary, bool record_none_needed,
+		media_auditor::summary summary, const char *details, bool record_none_needed,
 		const char *type, const char *name, const char *parent,
-		unsigned &correct, unsigned &incorrect, unsigned &notfound,
-		util::ovectorstream &buffer)
+		unsigned &correct, unsigned &incorrect, unsigned &notfound)
 {
 	if (summary == media_auditor::NOTFOUND)
 	{
@@ -137,11 +141,7 @@ void print_summary(
 	else if (record_none_needed || (summary != media_auditor::NONE_NEEDED))
 	{
 		// output the summary of the audit
-		buffer.clear();
-		buffer.seekp(0);
-		auditor.summarize(name, &buffer);
-		buffer.put('\0');
-		osd_printf_info("%s", &buffer.vec()[0]);
+		osd_printf_info("%s", details);
 
 		// output the name of the driver and its parent
 		osd_printf_info("%sset %s ", type, name);
@@ -176,6 +176,20 @@ void print_summary(
 	}
 }
 
+
+void print_summary(
+		const media_auditor &auditor, media_auditor::summary summary, bool record_none_needed,
+		const char *type, const char *name, const char *parent,
+		unsigned &correct, unsigned &incorrect, unsigned &notfound,
+		util::ovectorstream &buffer)
+{
+	buffer.clear();
+	buffer.seekp(0);
+	auditor.summarize(name, &buffer);
+	buffer.put('\0');
+	print_summary(summary, &buffer.vec()[0], record_none_needed, type, name, parent, correct, incorrect, notfound);
+}
+
 } // anonymous namespace
 
 
@@ -883,23 +897,16 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 	unsigned incorrect = 0;
 	unsigned notfound = 0;
 
-	// iterate over drivers
+	// collect the matching drivers
 	driver_enumerator drivlist(m_options);
 	media_auditor auditor(drivlist);
 	util::ovectorstream summary_string;
+	std::vector<std::size_t> drivers;
 	while (drivlist.next())
 	{
 		if (included(drivlist.driver().name))
 		{
-			// audit the ROMs in this set
-			media_auditor::summary summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
-
-			auto const clone_of = drivlist.clone();
-			print_summary(
-					auditor, summary, true,
-					"rom", drivlist.driver().name, (clone_of >= 0) ? drivlist.driver(clone_of).name : nullptr,
-					correct, incorrect, notfound,
-					summary_string);
+			drivers.push_back(drivlist.current());
 
 			// if it wasn't a wildcard, there can only be one
 			if (!iswild)
@@ -907,6 +914,77 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 		}
 	}
 
+	// audit the ROMs in each set on worker threads, each with its own enumerator
+	struct audit_result
+	{
+		media_auditor::summary summary = media_auditor::NOTFOUND;
+		std::string details;
+		std::exception_ptr error;
+		bool done = false;
+	};
+	std::vector<audit_result> results(drivers.size());
+	std::atomic<std::size_t> next_driver(0);
+	std::mutex results_mutex;
+	std::condition_variable results_ready;
+	auto const audit_worker = [this, &drivers, &results, &next_driver, &results_mutex, &results_ready] ()
+	{
+		driver_enumerator enumerator(m_options);
+		media_auditor worker_auditor(enumerator);
+		util::ovectorstream buffer;
+		for (std::size_t index = next_driver++; index < drivers.size(); index = next_driver++)
+		{
+			audit_result &result(results[index]);
+			try
+			{
+				enumerator.set_current(drivers[index]);
+				result.summary = worker_auditor.audit_media(AUDIT_VALIDATE_FAST);
+				buffer.clear();
+				buffer.seekp(0);
+				worker_auditor.summarize(enumerator.driver().name, &buffer);
+				buffer.put('\0');
+				result.details = &buffer.vec()[0];
+			}
+			catch (...)
+			{
+				result.error = std::current_exception();
+			}
+			std::lock_guard<std::mutex> lock(results_mutex);
+			result.done = true;
+			results_ready.notify_all();
+		}
+	};
+	unsigned const thread_count(std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U), drivers.size()));
+	std::vector<std::thread> workers;
+	for (unsigned i = 0; i < thread_count; i++)
+		workers.emplace_back(audit_worker);
+
+	// report the results in order as they complete
+	std::exception_ptr error;
+	for (std::size_t index = 0; !error && (index < drivers.size()); index++)
+	{
+		audit_result &result(results[index]);
+		{
+			std::unique_lock<std::mutex> lock(results_mutex);
+			results_ready.wait(lock, [&result] () { return result.done; });
+		}
+		error = result.error;
+		if (error)
+			break;
+
+		auto const clone_of = drivlist.clone(drivers[index]);
+		print_summary(
+				result.summary, result.details.c_str(), true,
+				"rom", drivlist.driver(drivers[index]).name, (clone_of >= 0) ? drivlist.driver(clone_of).name : nullptr,
+				correct, incorrect, notfound);
+	}
+
+	// stop handing out work and wait for the workers before unwinding
+	next_driver = drivers.size();
+	for (std::thread &worker : workers)
+		worker.join();
+	if (error)
+		std::rethrow_exception(error);
+
 	if (iswild || !matchcount)
 	{
 		machine_config config(GAME_NAME(___empty), m_options);
@@ -701,10 +701,7 @@ void output_one_device(std::ostream &out, machine_config &config, device_t &devi
 
 void output_devices(std::ostream &out, emu_options &lookup_options, device_type_set const *filter)
 {
-	// get config for empty machine
-	machine_config config(GAME_NAME(___empty), lookup_options);
-
-	auto const action = [&config, &out] (device_type type)
+	auto const action = [] (machine_config &config, std::ostream &out, device_type type)
 			{
 				// add it at the root of the machine config
 				device_t *dev;
@@ -724,14 +721,39 @@ void output_devices(std::ostream &out, emu_options &lookup_options, device_type_
 				config.device_remove("_tmp");
 			};
 
-	// run through devices
+	// gather the devices to describe
+	std::vector<std::add_pointer_t<device_type> > types;
 	if (filter)
 	{
-		for (std::add_pointer_t<device_type> type : *filter) action(*type);
+		types.assign(filter->begin(), filter->end());
 	}
 	else
 	{
-		for (device_type type : registered_device_types) action(type);
+		for (device_type type : registered_device_types) types.push_back(&type);
+	}
+
+	// describe them in batches, each with its own empty machine config, and emit
+	// the results in order as they complete
+	std::queue<std::future<std::string> > queue;
+	auto next = types.cbegin();
+	while (!queue.empty() || (next != types.cend()))
+	{
+		while ((queue.size() < 20) && (next != types.cend()))
+		{
+			auto const end = next + (std::min)(types.cend() - next, std::ptrdiff_t(64));
+			queue.push(std::async(std::launch::async, [&lookup_options, &action, next, end]
+			{
+				machine_config config(GAME_NAME(___empty), lookup_options);
+				std::ostringstream stream;
+				for (auto it = next; it != end; ++it)
+					action(config, stream, **it);
+				return stream.str();
+			}));
+			next = end;
+		}
+
+		out << queue.front().get();
+		queue.pop();
 	}
 }
 
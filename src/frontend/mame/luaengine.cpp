@@ -670,6 +670,20 @@ bool lua_engine::execute_function(const char *id)
 	return count > 0;
 }
 
+bool lua_engine::execute_hooks(const std::vector<sol::protected_function> &hooks)
+{
+	for (const sol::protected_function &func : hooks)
+	{
+		auto ret = invoke(func);
+		if(!ret.valid())
+		{
+			sol::error err = ret;
+			osd_printf_error("[LUA ERROR] in execute_function: %s\n", err.what());
+		}
+	}
+	return !hooks.empty();
+}
+
 void lua_engine::register_function(sol::function func, const char *id)
 {
 	sol::object functable = sol().registry()[id];
@@ -711,22 +725,22 @@ void lua_engine::on_machine_resume()
 
 void lua_engine::on_machine_frame()
 {
-	execute_function("LUA_ON_FRAME");
+	execute_hooks(m_frame_hooks);
 }
 
 void lua_engine::on_frame_done()
 {
-	execute_function("LUA_ON_FRAME_DONE");
+	execute_hooks(m_frame_done_hooks);
 }
 
 void lua_engine::on_sound_update()
 {
-	execute_function("LUA_ON_SOUND_UPDATE");
+	execute_hooks(m_sound_update_hooks);
 }
 
 void lua_engine::on_periodic()
 {
-	execute_function("LUA_ON_PERIODIC");
+	execute_hooks(m_periodic_hooks);
 }
 
 bool lua_engine::on_missing_mandatory_image(const std::string &instance_name)
@@ -785,6 +799,8 @@ void lua_engine::initialize()
  * emu.keypost(keys) - post keys to natural keyboard
  * emu.wait(len) - wait for len within coroutine
  * emu.lang_translate(str) - get translation for str if available
+ * emu.profiler_enable(state) - enable or disable the profiler (no effect unless built with the profiler)
+ * emu.profiler_snapshot() - get seconds spent per profiler category since the last profiler display update, nil if disabled
  *
  * emu.register_prestart(callback) - register callback before reset
  * emu.register_start(callback) - register callback after reset
@@ -835,10 +851,10 @@ void lua_engine::initialize()
 	emu["register_stop"] = [this](sol::function func){ register_function(func, "LUA_ON_STOP"); };
 	emu["register_pause"] = [this](sol::function func){ register_function(func, "LUA_ON_PAUSE"); };
 	emu["register_resume"] = [this](sol::function func){ register_function(func, "LUA_ON_RESUME"); };
-	emu["register_frame"] = [this](sol::function func){ register_function(func, "LUA_ON_FRAME"); };
-	emu["register_frame_done"] = [this](sol::function func){ register_function(func, "LUA_ON_FRAME_DONE"); };
-	emu["register_sound_update"] = [this](sol::function func){ register_function(func, "LUA_ON_SOUND_UPDATE"); };
-	emu["register_periodic"] = [this](sol::function func){ register_function(func, "LUA_ON_PERIODIC"); };
+	emu["register_frame"] = [this](sol::function func){ m_frame_hooks.emplace_back(func); };
+	emu["register_frame_done"] = [this](sol::function func){ m_frame_done_hooks.emplace_back(func); };
+	emu["register_sound_update"] = [this](sol::function func){ m_sound_update_hooks.emplace_back(func); };
+	emu["register_periodic"] = [this](sol::function func){ m_periodic_hooks.emplace_back(func); };
 	emu["register_mandatory_file_manager_override"] = [this](sol::function func) { register_function(func, "LUA_ON_MANDATORY_FILE_MANAGER_OVERRIDE"); };
 	emu["register_before_load_settings"] = [this](sol::function func) { register_function(func, "LUA_ON_BEFORE_LOAD_SETTINGS"); };
 	emu["register_menu"] = [this](sol::function cb, sol::function pop, const std::string &name) {
@@ -878,6 +894,18 @@ void lua_engine::initialize()
 			return lua_yield(L, 0);
 		});
 	emu["lang_translate"] = &lang_translate;
+	emu["profiler_enable"] = [](bool state) { g_profiler.enable(state); };
+	emu["profiler_snapshot"] = [this]() -> sol::object {
+			if (!g_profiler.enabled())
+				return sol::make_object(sol(), sol::nil);
+			std::vector<std::pair<std::string, u64> > data;
+			g_profiler.snapshot(machine(), data);
+			double const tps = g_profiler.ticks_per_second();
+			sol::table table = sol().create_table();
+			for (auto const &entry : data)
+				table[entry.first] = double(entry.second) / tps;
+			return table;
+		};
 	emu["pid"] = &osd_getpid;
 
 
@@ -1288,6 +1316,9 @@ void lua_engine::initialize()
  * machine:input() - get input_manager
  * machine:uiinput() - get ui_input_manager
  * machine:debugger() - get debugger_manager
+ * machine:scheduler_stats() - get scheduling statistics table, nil unless -schedstats is enabled
+ * machine:pc_profile() - get sampled program counters per device, nil unless -pcprofile is enabled
+ * machine:sound_stats() - get per-stream sound update statistics, nil unless -soundstats is enabled
  *
  * machine.paused - get paused state
  * machine.samplerate - get audio sample rate
@@ -1321,6 +1352,87 @@ void lua_engine::initialize()
 				return sol::make_object(sol(), sol::nil);
 			return sol::make_object(sol(), &m.debugger());
 		});
+	machine_type.set("scheduler_stats", [this](running_machine &m) -> sol::object {
+			const device_scheduler::stats *stats = m.scheduler().statistics();
+			if (!stats)
+				return sol::make_object(sol(), sol::nil);
+			sol::table table = sol().create_table();
+			table["seconds"] = m.time().as_double();
+			table["timeslices"] = stats->m_timeslices;
+			table["slice_time"] = stats->m_slice_time.as_double();
+			table["boosts"] = stats->m_boosts;
+			table["boost_time"] = stats->m_boost_time.as_double();
+			sol::table devices = sol().create_table();
+			for (device_execute_interface &exec : execute_interface_iterator(m.root_device()))
+			{
+				auto const found = stats->m_devices.find(&exec);
+				if (found == stats->m_devices.end())
+					continue;
+				sol::table dev = sol().create_table();
+				dev["runs"] = found->second.m_slices;
+				dev["cycles"] = found->second.m_cycles;
+				sol::table aborts = sol().create_table();
+				aborts["timer"] = found->second.m_aborts[device_scheduler::ABORT_TIMER];
+				aborts["suspend"] = found->second.m_aborts[device_scheduler::ABORT_SUSPEND];
+				aborts["trigger"] = found->second.m_aborts[device_scheduler::ABORT_TRIGGER];
+				aborts["other"] = found->second.m_aborts[device_scheduler::ABORT_OTHER];
+				dev["aborts"] = aborts;
+				sol::table per_second = sol().create_table();
+				for (std::size_t second = 0; second < found->second.m_slices_per_second.size(); second++)
+					per_second[second + 1] = found->second.m_slices_per_second[second];
+				dev["runs_per_second"] = per_second;
+				devices[exec.device().tag()] = dev;
+			}
+			table["devices"] = devices;
+			sol::table timers = sol().create_table();
+			for (auto const &timer : stats->m_timers)
+				timers[timer.second.m_name] = timer.second.m_fired;
+			table["timers"] = timers;
+			return table;
+		});
+	machine_type.set("pc_profile", [this](running_machine &m) -> sol::object {
+			const device_scheduler::pc_samples *profile = m.scheduler().pc_profile();
+			if (!profile)
+				return sol::make_object(sol(), sol::nil);
+			sol::table table = sol().create_table();
+			table["period"] = profile->m_period.as_double();
+			table["samples"] = profile->m_samples;
+			sol::table devices = sol().create_table();
+			for (auto const &device : profile->m_devices)
+			{
+				sol::table pcs = sol().create_table();
+				for (auto const &pc : device.second)
+					pcs[pc.first] = pc.second;
+				devices[device.first->device().tag()] = pcs;
+			}
+			table["devices"] = devices;
+			return table;
+		});
+	machine_type.set("sound_stats", [this](running_machine &m) -> sol::object {
+			if (!m.options().sound_stats())
+				return sol::make_object(sol(), sol::nil);
+			double const tps = double(osd_ticks_per_second());
+			sol::table table = sol().create_table();
+			table["updates"] = m.sound().stats_updates();
+			sol::table streams = sol().create_table();
+			int index = 1;
+			for (auto const &stream : m.sound().streams())
+			{
+				sound_stream::stats const *stats = stream->statistics();
+				if (!stats)
+					continue;
+				sol::table entry = sol().create_table();
+				entry["device"] = stream->device().tag();
+				entry["rate"] = stream->sample_rate();
+				entry["calls"] = stats->m_calls;
+				entry["samples"] = stats->m_samples;
+				entry["update_time"] = double(stats->m_update_ticks) / tps;
+				entry["resample_time"] = double(stats->m_resample_ticks) / tps;
+				streams[index++] = entry;
+			}
+			table["streams"] = streams;
+			return table;
+		});
 	machine_type.set("paused", sol::property(&running_machine::paused));
 	machine_type.set("samplerate", sol::property(&running_machine::sample_rate));
 	machine_type.set("exit_pending", sol::property(&running_machine::exit_pending));
@@ -1671,6 +1783,8 @@ void lua_engine::initialize()
  * space:write_direct_*(addr, val)
  * space:read_range(first_addr, last_addr, width, [opt] step) - read range of addresses and
  *                                                              return as a binary string
+ * space:write_range(first_addr, width, data) - write a binary string laid out as read_range
+ *                                              returns it to consecutive addresses
  *
  * space.name - address space name
  * space.shift - address bus shift, bitshift required for a bytewise address
@@ -1790,6 +1904,54 @@ void lua_engine::initialize()
 			luaL_pushresultsize(&buff, byte_count);
 			return sol::make_reference(L, sol::stack_reference(L, -1));
 		});
+	addr_space_type.set("write_range", [](addr_space &sp, sol::this_state s, u64 first, int width, const std::string &data) {
+			lua_State *L = s;
+			offs_t space_size = sp.space.addrmask();
+			if ((width != 8) && (width != 16) && (width != 32) && (width != 64))
+			{
+				luaL_error(L, "Invalid width. Must be 8/16/32/64");
+				return;
+			}
+			u64 const count = data.size() / (width / 8);
+			if (!count)
+				return;
+			if (first > space_size || count - 1 > space_size - first)
+			{
+				luaL_error(L, "Invalid offset");
+				return;
+			}
+			switch (width)
+			{
+			case 8:
+				for (u64 i = 0; i < count; i++)
+					sp.mem_write<u8>(first + i, u8(data[i]));
+				break;
+			case 16:
+				for (u64 i = 0; i < count; i++)
+				{
+					u16 val;
+					memcpy(&val, &data[i * 2], 2);
+					sp.mem_write<u16>(first + i, val);
+				}
+				break;
+			case 32:
+				for (u64 i = 0; i < count; i++)
+				{
+					u32 val;
+					memcpy(&val, &data[i * 4], 4);
+					sp.mem_write<u32>(first + i, val);
+				}
+				break;
+			case 64:
+				for (u64 i = 0; i < count; i++)
+				{
+					u64 val;
+					memcpy(&val, &data[i * 8], 8);
+					sp.mem_write<u64>(first + i, val);
+				}
+				break;
+			}
+		});
 	addr_space_type.set("name", sol::property([](addr_space &sp) { return sp.space.name(); }));
 	addr_space_type.set("shift", sol::property([](addr_space &sp) { return sp.space.addr_shift(); }));
 	addr_space_type.set("index", sol::property([](addr_space &sp) { return sp.space.spacenum(); }));
@@ -2676,6 +2838,8 @@ void lua_engine::initialize()
  * memory.banks[] - table of memory banks (k=tag, v=memory_bank)
  * memory.regions[] - table of memory regions (k=tag, v=memory_region)
  * memory.shares[] - table of memory shares (k=tag, v=memory_share)
+ *
+ * memory:heatmap() - get sampled access counts per space, nil unless -memheat is enabled
  */
 
 	auto memory_type = sol().registry().create_simple_usertype<memory_manager>("new", sol::no_constructor);
@@ -2697,6 +2861,35 @@ void lua_engine::initialize()
 				table[share.first] = share.second.get();
 			return table;
 		}));
+	memory_type.set("heatmap", [this](memory_manager &mm) -> sol::object {
+			auto const *heatmap = mm.heatmap();
+			if (!heatmap)
+				return sol::make_object(sol(), sol::nil);
+			sol::table table = sol().create_table();
+			for (auto const &heat : *heatmap)
+			{
+				address_space &space = *heat->m_space;
+				sol::table pages = sol().create_table();
+				for (std::size_t page = 0; page < heat->m_reads.size(); page++)
+				{
+					if (!heat->m_reads[page] && !heat->m_writes[page])
+						continue;
+					offs_t const address = offs_t(page) << heat->m_page_shift;
+					sol::table entry = sol().create_table();
+					entry["reads"] = heat->m_reads[page];
+					entry["writes"] = heat->m_writes[page];
+					entry["read_handler"] = space.get_handler_string(read_or_write::READ, address);
+					entry["write_handler"] = space.get_handler_string(read_or_write::WRITE, address);
+					pages[address] = entry;
+				}
+				sol::table spacetab = sol().create_table();
+				spacetab["page_size"] = offs_t(1) << heat->m_page_shift;
+				spacetab["sample"] = mm.heatmap_sample();
+				spacetab["pages"] = pages;
+				table[string_format("%s:%s", space.device().tag(), space.name())] = spacetab;
+			}
+			return table;
+		});
 	sol().registry().set_usertype("memory", memory_type);
 
 
@@ -2884,7 +3077,7 @@ void lua_engine::initialize()
 //-------------------------------------------------
 bool lua_engine::frame_hook()
 {
-	return execute_function("LUA_ON_FRAME_DONE");
+	return execute_hooks(m_frame_done_hooks);
 }
 
 //-------------------------------------------------
@@ -2893,6 +3086,10 @@ bool lua_engine::frame_hook()
 
 void lua_engine::close()
 {
+	m_frame_hooks.clear();
+	m_frame_done_hooks.clear();
+	m_sound_update_hooks.clear();
+	m_periodic_hooks.clear();
 	m_sol_state.reset();
 	if (m_lua_state)
 	{
@@ -119,6 +119,12 @@ private:
 
 	std::vector<std::string> m_menu;
 
+	// callbacks run every frame or sound update, bound once when they're registered
+	std::vector<sol::protected_function> m_frame_hooks;
+	std::vector<sol::protected_function> m_frame_done_hooks;
+	std::vector<sol::protected_function> m_sound_update_hooks;
+	std::vector<sol::protected_function> m_periodic_hooks;
+
 	running_machine &machine() const { return *m_machine; }
 
 	void on_machine_prestart();
@@ -132,6 +138,7 @@ private:
 	void register_function(sol::function func, const char *id);
 	int enumerate_functions(const char *id, std::function<bool(const sol::protected_function &func)> &&callback);
 	bool execute_function(const char *id);
+	bool execute_hooks(const std::vector<sol::protected_function> &hooks);
 	sol::object call_plugin(const std::string &name, sol::object in);
 
 	struct addr_space {
@@ -12,7 +12,6 @@
 #include "ui/selgame.h"
 
 #include "ui/auditmenu.h"
-#include "ui/icorender.h"
 #include "ui/inifile.h"
 #include "ui/miscmenu.h"
 #include "ui/optsmenu.h"
@@ -179,25 +178,11 @@ private:
 		m_filter_data.finalise();
 		notify_available(AVAIL_FILTER_DATA);
 
-		// convert shortnames to UCS-4
+		// pick up the UCS-4 search strings shared with the driver list
 		for (ui_system_info &info : m_sorted_list)
-			info.ucs_shortname = ustr_from_utf8(normalize_unicode(info.driver->name, unicode_normalization_form::D, true));
+			info.search = &driver_list::searchable(info.index);
 		notify_available(AVAIL_UCS_SHORTNAME);
-
-		// convert descriptions to UCS-4
-		for (ui_system_info &info : m_sorted_list)
-			info.ucs_description = ustr_from_utf8(normalize_unicode(info.driver->type.fullname(), unicode_normalization_form::D, true));
 		notify_available(AVAIL_UCS_DESCRIPTION);
-
-		// convert "<manufacturer> <description>" to UCS-4
-		std::string buf;
-		for (ui_system_info &info : m_sorted_list)
-		{
-			buf.assign(info.driver->manufacturer);
-			buf.append(1, ' ');
-			buf.append(info.driver->type.fullname());
-			info.ucs_manufacturer_description = ustr_from_utf8(normalize_unicode(buf, unicode_normalization_form::D, true));
-		}
 		notify_available(AVAIL_UCS_MANUF_DESC);
 	}
 
@@ -980,7 +965,7 @@ void menu_select_game::populate_search()
 	{
 		m_searched_fields |= persistent_data::AVAIL_UCS_SHORTNAME;
 		for (std::pair<double, std::reference_wrapper<ui_system_info const> > &info : m_searchlist)
-			info.first = util::edit_distance(ucs_search, info.second.get().ucs_shortname);
+			info.first = util::edit_distance(ucs_search, info.second.get().search->shortname);
 	}
 
 	// match descriptions
@@ -991,7 +976,7 @@ void menu_select_game::populate_search()
 		{
 			if (info.first)
 			{
-				double const penalty(util::edit_distance(ucs_search, info.second.get().ucs_description));
+				double const penalty(util::edit_distance(ucs_search, info.second.get().search->description));
 				info.first = (std::min)(penalty, info.first);
 			}
 		}
@@ -1005,7 +990,7 @@ void menu_select_game::populate_search()
 		{
 			if (info.first)
 			{
-				double const penalty(util::edit_distance(ucs_search, info.second.get().ucs_manufacturer_description));
+				double const penalty(util::edit_distance(ucs_search, info.second.get().search->manufacturer_description));
 				info.first = (std::min)(penalty, info.first);
 			}
 		}
@@ -1222,17 +1207,6 @@ render_texture *menu_select_game::get_icon_texture(int linenum, void *selectedre
 		if (m_icon_paths.empty())
 			m_icon_paths = make_icon_paths(nullptr);
 
-		// allocate an entry or allocate a texture on forced redraw
-		if (m_icons.end() == icon)
-		{
-			icon = m_icons.emplace(driver, texture_ptr(machine().render().texture_alloc(), machine().render())).first;
-		}
-		else
-		{
-			assert(!icon->second.texture);
-			icon->second.texture.reset(machine().render().texture_alloc());
-		}
-
 		// set clone status
 		bool cloneof = strcmp(driver->parent, "0");
 		if (cloneof)
@@ -1242,17 +1216,20 @@ render_texture *menu_select_game::get_icon_texture(int linenum, void *selectedre
 				cloneof = false;
 		}
 
+		// icons are decoded in the background, so show nothing until it's ready
 		bitmap_argb32 tmp;
-		emu_file snapfile(std::string(m_icon_paths), OPEN_FLAG_READ);
-		if (snapfile.open(std::string(driver->name), ".ico") == osd_file::error::NONE)
+		if (!fetch_icon(m_icon_paths, driver->name, cloneof ? driver->parent : "", tmp))
+			return nullptr;
+
+		// allocate an entry or allocate a texture on forced redraw
+		if (m_icons.end() == icon)
 		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
+			icon = m_icons.emplace(driver, texture_ptr(machine().render().texture_alloc(), machine().render())).first;
 		}
-		if (!tmp.valid() && cloneof && (snapfile.open(std::string(driver->parent), ".ico") == osd_file::error::NONE))
+		else
 		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
+			assert(!icon->second.texture);
+			icon->second.texture.reset(machine().render().texture_alloc());
 		}
 
 		scale_icon(std::move(tmp), icon->second);
@@ -1373,17 +1350,17 @@ float menu_select_game::draw_left_panel(float x1, float y1, float x2, float y2)
 //  get selected software and/or driver
 //-------------------------------------------------
 
-void menu_select_game::get_selection(ui_software_info const *&software, game_driver const *&driver) const
+void menu_select_game::get_item_selection(void *ref, ui_software_info const *&software, game_driver const *&driver) const
 {
 	if (m_populated_favorites)
 	{
-		software = reinterpret_cast<ui_software_info const *>(get_selection_ptr());
+		software = reinterpret_cast<ui_software_info const *>(ref);
 		driver = software ? software->driver : nullptr;
 	}
 	else
 	{
 		software = nullptr;
-		driver = reinterpret_cast<game_driver const *>(get_selection_ptr());
+		driver = reinterpret_cast<game_driver const *>(ref);
 	}
 }
 
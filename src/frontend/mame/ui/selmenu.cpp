@@ -12,6 +12,7 @@
 #include "ui/selmenu.h"
 
 #include "ui/datmenu.h"
+#include "ui/icorender.h"
 #include "ui/info.h"
 #include "ui/inifile.h"
 
@@ -374,11 +375,92 @@ void menu_select_launch::bios_selection::custom_render(void *selectedref, float
 }
 
 
+menu_select_launch::image_loader::image_loader(std::size_t capacity, std::size_t max_prefetch)
+	: m_images(capacity)
+	, m_pending()
+	, m_max_prefetch(max_prefetch)
+	, m_mutex()
+	, m_queue(osd_work_queue_alloc(0))
+{
+}
+
+
+menu_select_launch::image_loader::~image_loader()
+{
+	// waits for anything still being decoded
+	osd_work_queue_free(m_queue);
+}
+
+
+bool menu_select_launch::image_loader::fetch(std::string &&key, load_func &&load, bitmap_argb32 &bitmap)
+{
+	std::lock_guard<std::mutex> guard(m_mutex);
+	auto const found(m_images.find(key));
+	if (m_images.end() == found)
+	{
+		queue(std::move(key), std::move(load));
+		return false;
+	}
+
+	// copy so the decoded image stays cached for the next time it's selected
+	bitmap_argb32 const &src(found->second);
+	if (src.valid())
+	{
+		bitmap.allocate(src.width(), src.height());
+		for (int y = 0; src.height() > y; ++y)
+			std::copy_n(&src.pix32(y), src.width(), &bitmap.pix32(y));
+	}
+	else
+	{
+		bitmap.reset();
+	}
+	return true;
+}
+
+
+void menu_select_launch::image_loader::prefetch(std::string &&key, load_func &&load)
+{
+	std::lock_guard<std::mutex> guard(m_mutex);
+	if ((m_pending.size() < m_max_prefetch) && (m_images.end() == m_images.find(key)))
+		queue(std::move(key), std::move(load));
+}
+
+
+void menu_select_launch::image_loader::queue(std::string &&key, load_func &&load)
+{
+	// called with the mutex held
+	if (m_pending.insert(key).second)
+	{
+		job *const item(new job{ *this, std::move(key), std::move(load) });
+		if (!osd_work_item_queue(m_queue, &image_loader::work_callback, item, WORK_ITEM_FLAG_AUTO_RELEASE))
+		{
+			m_pending.erase(item->key);
+			delete item;
+		}
+	}
+}
+
+
+void *menu_select_launch::image_loader::work_callback(void *param, int threadid)
+{
+	std::unique_ptr<job> const item(reinterpret_cast<job *>(param));
+	bitmap_argb32 bitmap;
+	item->load(bitmap);
+
+	std::lock_guard<std::mutex> guard(item->loader.m_mutex);
+	item->loader.m_images[item->key] = std::move(bitmap);
+	item->loader.m_pending.erase(item->key);
+	return nullptr;
+}
+
+
 menu_select_launch::cache::cache(running_machine &machine)
 	: m_snapx_bitmap(std::make_unique<bitmap_argb32>(0, 0))
 	, m_snapx_texture(nullptr, machine.render())
 	, m_snapx_driver(nullptr)
 	, m_snapx_software(nullptr)
+	, m_snapshots(MAX_SNAPSHOTS_DECODED, SNAPSHOT_PREFETCH_DISTANCE * 2)
+	, m_icons(MAX_ICONS_RENDER * 2, MAX_ICONS_RENDER)
 	, m_no_avail_bitmap(256, 256)
 	, m_star_bitmap(32, 32)
 	, m_star_texture(nullptr, machine.render())
@@ -1263,6 +1345,35 @@ void menu_select_launch::set_pressed()
 }
 
 
+//-------------------------------------------------
+//  get a decoded icon, or queue it for decoding
+//  if it isn't ready yet
+//-------------------------------------------------
+
+bool menu_select_launch::fetch_icon(std::string const &paths, std::string const &name, std::string const &parent, bitmap_argb32 &bitmap)
+{
+	std::string key(paths);
+	key.append(1, '\n').append(name).append(1, '\n').append(parent);
+	return m_cache->icons().fetch(
+			std::move(key),
+			[paths, name, parent] (bitmap_argb32 &result)
+			{
+				emu_file snapfile(std::string(paths), OPEN_FLAG_READ);
+				if (snapfile.open(std::string(name), ".ico") == osd_file::error::NONE)
+				{
+					render_load_ico_highest_detail(snapfile, result);
+					snapfile.close();
+				}
+				if (!result.valid() && !parent.empty() && (snapfile.open(std::string(parent), ".ico") == osd_file::error::NONE))
+				{
+					render_load_ico_highest_detail(snapfile, result);
+					snapfile.close();
+				}
+			},
+			bitmap);
+}
+
+
 //-------------------------------------------------
 //  draw icons
 //-------------------------------------------------
@@ -2011,6 +2122,18 @@ void menu_select_launch::draw(uint32_t flags)
 		}
 	}
 
+	// start decoding icons for half a page either side of what's visible
+	if (m_has_icons)
+	{
+		int const margin(n_loop / 2);
+		for (int itemnum = (std::max)(top_line - margin, 0); ((top_line + n_loop + margin) > itemnum) && (m_available_items > itemnum); ++itemnum)
+		{
+			bool const visible((top_line <= itemnum) && ((top_line + n_loop) > itemnum));
+			if (!visible && (uintptr_t(item(itemnum).ref) > skip_main_items))
+				get_icon_texture(itemnum - top_line, item(itemnum).ref);
+		}
+	}
+
 	for (size_t count = m_available_items; count < item_count(); count++)
 	{
 		const menu_item &pitem = item(count);
@@ -2212,132 +2335,144 @@ void menu_select_launch::arts_render(float origx1, float origy1, float origx2, f
 
 		if (m_default_image)
 			m_image_view = (software->startempty == 0) ? SNAPSHOT_VIEW : CABINETS_VIEW;
+	}
+	else if (driver)
+	{
+		m_cache->set_snapx_software(nullptr);
+		software = nullptr;
 
-		// arts title and searchpath
-		std::string const searchstr = arts_render_common(origx1, origy1, origx2, origy2);
-
-		// loads the image if necessary
-		if (!m_cache->snapx_software_is(software) || !snapx_valid() || m_switch_image)
-		{
-			emu_file snapfile(searchstr.c_str(), OPEN_FLAG_READ);
-			bitmap_argb32 tmp_bitmap;
+		if (m_default_image)
+			m_image_view = ((driver->flags & machine_flags::MASK_TYPE) != machine_flags::TYPE_ARCADE) ? CABINETS_VIEW : SNAPSHOT_VIEW;
+	}
+	else
+	{
+		return;
+	}
 
-			if (software->startempty == 1)
-			{
-				// Load driver snapshot
-				std::string fullname = std::string(software->driver->name) + ".png";
-				render_load_png(tmp_bitmap, snapfile, nullptr, fullname.c_str());
+	// arts title and searchpath
+	std::string const searchstr = arts_render_common(origx1, origy1, origx2, origy2);
 
-				if (!tmp_bitmap.valid())
-				{
-					fullname.assign(software->driver->name).append(".jpg");
-					render_load_jpeg(tmp_bitmap, snapfile, nullptr, fullname.c_str());
-				}
-			}
+	// loads the image if necessary - it's decoded in the background, and nothing is shown until it's ready
+	bool ready(!m_switch_image && snapx_valid() && (software ? m_cache->snapx_software_is(software) : m_cache->snapx_driver_is(driver)));
+	if (!ready)
+	{
+		bitmap_argb32 tmp_bitmap;
+		ready = request_snapshot(searchstr, software, driver, &tmp_bitmap);
+		if (ready)
+		{
+			if (software)
+				m_cache->set_snapx_software(software);
 			else
-			{
-				// First attempt from name list
-				std::string pathname = software->listname;
-				std::string fullname = software->shortname + ".png";
-				render_load_png(tmp_bitmap, snapfile, pathname.c_str(), fullname.c_str());
-
-				if (!tmp_bitmap.valid())
-				{
-					fullname.assign(software->shortname).append(".jpg");
-					render_load_jpeg(tmp_bitmap, snapfile, pathname.c_str(), fullname.c_str());
-				}
-
-				if (!tmp_bitmap.valid())
-				{
-					// Second attempt from driver name + part name
-					pathname.assign(software->driver->name).append(software->part);
-					fullname.assign(software->shortname).append(".png");
-					render_load_png(tmp_bitmap, snapfile, pathname.c_str(), fullname.c_str());
-
-					if (!tmp_bitmap.valid())
-					{
-						fullname.assign(software->shortname).append(".jpg");
-						render_load_jpeg(tmp_bitmap, snapfile, pathname.c_str(), fullname.c_str());
-					}
-				}
-			}
-
-			m_cache->set_snapx_software(software);
+				m_cache->set_snapx_driver(driver);
 			m_switch_image = false;
 			arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
 		}
 
-		// if the image is available, loaded and valid, display it
-		draw_snapx(origx1, origy1, origx2, origy2);
+		// get the neighbours started while the user is still moving through the list
+		prefetch_snapshots(searchstr);
 	}
-	else if (driver)
-	{
-		m_cache->set_snapx_software(nullptr);
 
-		if (m_default_image)
-			m_image_view = ((driver->flags & machine_flags::MASK_TYPE) != machine_flags::TYPE_ARCADE) ? CABINETS_VIEW : SNAPSHOT_VIEW;
+	// if the image is available, loaded and valid, display it
+	if (ready)
+		draw_snapx(origx1, origy1, origx2, origy2);
+}
+
 
-		std::string const searchstr = arts_render_common(origx1, origy1, origx2, origy2);
+//-------------------------------------------------
+//  get a decoded snapshot, or queue it for
+//  decoding if it isn't ready yet
+//-------------------------------------------------
 
-		// loads the image if necessary
-		if (!m_cache->snapx_driver_is(driver) || !snapx_valid() || m_switch_image)
+bool menu_select_launch::request_snapshot(std::string const &searchstr, ui_software_info const *software, game_driver const *driver, bitmap_argb32 *bitmap)
+{
+	// work out the files to try in order - the worker mustn't look at the selection
+	std::vector<std::pair<std::string, std::string> > names;
+	bool mediapath(false);
+	if (software)
+	{
+		if (software->startempty == 1)
 		{
-			emu_file snapfile(searchstr.c_str(), OPEN_FLAG_READ);
-			snapfile.set_restrict_to_mediapath(true);
-			bitmap_argb32 tmp_bitmap;
+			// driver snapshot
+			names.emplace_back(std::string(), software->driver->name);
+		}
+		else
+		{
+			// first attempt from name list, then from driver name + part name
+			names.emplace_back(software->listname, software->shortname);
+			names.emplace_back(std::string(software->driver->name).append(software->part), software->shortname);
+		}
+	}
+	else
+	{
+		// try saved "0000" snapshot first, then the standard file
+		mediapath = true;
+		names.emplace_back(driver->name, "0000");
+		names.emplace_back(std::string(), driver->name);
 
-			// try to load snapshot first from saved "0000.png" file
-			std::string fullname(driver->name);
-			render_load_png(tmp_bitmap, snapfile, fullname.c_str(), "0000.png");
+		// if that fails, try the parent unless it's a BIOS
+		bool cloneof = strcmp(driver->parent, "0");
+		if (cloneof)
+		{
+			int cx = driver_list::find(driver->parent);
+			if ((cx >= 0) && (driver_list::driver(cx).flags & machine_flags::IS_BIOS_ROOT))
+				cloneof = false;
+		}
+		if (cloneof)
+			names.emplace_back(std::string(), driver->parent);
+	}
 
-			if (!tmp_bitmap.valid())
-				render_load_jpeg(tmp_bitmap, snapfile, fullname.c_str(), "0000.jpg");
+	std::string key(searchstr);
+	for (auto const &name : names)
+		key.append(1, '\n').append(name.first).append(1, '/').append(name.second);
 
-			// if fail, attemp to load from standard file
-			if (!tmp_bitmap.valid())
+	image_loader::load_func load(
+			[searchstr, names = std::move(names), mediapath] (bitmap_argb32 &result)
 			{
-				fullname.assign(driver->name).append(".png");
-				render_load_png(tmp_bitmap, snapfile, nullptr, fullname.c_str());
-
-				if (!tmp_bitmap.valid())
+				emu_file snapfile(searchstr.c_str(), OPEN_FLAG_READ);
+				snapfile.set_restrict_to_mediapath(mediapath);
+				for (auto it = names.begin(); !result.valid() && (names.end() != it); ++it)
 				{
-					fullname.assign(driver->name).append(".jpg");
-					render_load_jpeg(tmp_bitmap, snapfile, nullptr, fullname.c_str());
+					char const *const dirname(it->first.empty() ? nullptr : it->first.c_str());
+					render_load_png(result, snapfile, dirname, (it->second + ".png").c_str());
+					if (!result.valid())
+						render_load_jpeg(result, snapfile, dirname, (it->second + ".jpg").c_str());
 				}
-			}
+			});
 
-			// if fail again, attemp to load from parent file
-			if (!tmp_bitmap.valid())
-			{
-				// set clone status
-				bool cloneof = strcmp(driver->parent, "0");
-				if (cloneof)
-				{
-					int cx = driver_list::find(driver->parent);
-					if ((cx >= 0) && (driver_list::driver(cx).flags & machine_flags::IS_BIOS_ROOT))
-						cloneof = false;
-				}
+	if (bitmap)
+		return m_cache->snapshots().fetch(std::move(key), std::move(load), *bitmap);
 
-				if (cloneof)
-				{
-					fullname.assign(driver->parent).append(".png");
-					render_load_png(tmp_bitmap, snapfile, nullptr, fullname.c_str());
+	m_cache->snapshots().prefetch(std::move(key), std::move(load));
+	return false;
+}
 
-					if (!tmp_bitmap.valid())
-					{
-						fullname.assign(driver->parent).append(".jpg");
-						render_load_jpeg(tmp_bitmap, snapfile, nullptr, fullname.c_str());
-					}
-				}
-			}
 
-			m_cache->set_snapx_driver(driver);
-			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
-		}
+//-------------------------------------------------
+//  queue snapshots for the entries either side
+//  of the selection
+//-------------------------------------------------
 
-		// if the image is available, loaded and valid, display it
-		draw_snapx(origx1, origy1, origx2, origy2);
+void menu_select_launch::prefetch_snapshots(std::string const &searchstr)
+{
+	int const selected(selected_index());
+	if (selected >= m_available_items)
+		return;
+
+	for (int distance = 1; SNAPSHOT_PREFETCH_DISTANCE >= distance; ++distance)
+	{
+		for (int const index : { selected + distance, selected - distance })
+		{
+			if ((0 <= index) && (m_available_items > index) && (uintptr_t(item(index).ref) > skip_main_items))
+			{
+				ui_software_info const *software;
+				game_driver const *driver;
+				get_item_selection(item(index).ref, software, driver);
+				if (software && (!software->startempty || !driver))
+					request_snapshot(searchstr, software, driver, nullptr);
+				else if (driver)
+					request_snapshot(searchstr, nullptr, driver, nullptr);
+			}
+		}
 	}
 }
 
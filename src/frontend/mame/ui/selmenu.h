@@ -14,9 +14,11 @@
 
 #include "ui/menu.h"
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <vector>
 
 
@@ -35,6 +37,8 @@ public:
 protected:
 	static constexpr std::size_t MAX_ICONS_RENDER = 128;
 	static constexpr std::size_t MAX_VISIBLE_SEARCH = 200;
+	static constexpr std::size_t MAX_SNAPSHOTS_DECODED = 24;
+	static constexpr int SNAPSHOT_PREFETCH_DISTANCE = 4;
 
 	// tab navigation
 	enum class focused_menu
@@ -142,6 +146,7 @@ protected:
 	void check_for_icons(char const *listname);
 	std::string make_icon_paths(char const *listname) const;
 	bool scale_icon(bitmap_argb32 &&src, texture_and_bitmap &dst) const;
+	bool fetch_icon(std::string const &paths, std::string const &name, std::string const &parent, bitmap_argb32 &bitmap);
 
 	// forcing refresh
 	void set_switch_image() { m_switch_image = true; }
@@ -155,6 +160,9 @@ protected:
 		return (uintptr_t(selected_ref) > skip_main_items) ? selected_ref : m_prev_selected;
 	}
 
+	// get selected software and/or driver
+	void get_selection(ui_software_info const *&software, game_driver const *&driver) const { get_item_selection(get_selection_ptr(), software, driver); }
+
 	int         m_available_items;
 	int         skip_main_items;
 	void        *m_prev_selected;
@@ -173,6 +181,39 @@ private:
 	class software_parts;
 	class bios_selection;
 
+	// decodes images on worker threads and keeps the most recently used ones
+	class image_loader
+	{
+	public:
+		using load_func = std::function<void (bitmap_argb32 &)>;
+
+		image_loader(std::size_t capacity, std::size_t max_prefetch);
+		~image_loader();
+
+		// copy out a decoded image if it's ready, otherwise make sure it's queued
+		bool fetch(std::string &&key, load_func &&load, bitmap_argb32 &bitmap);
+
+		// queue an image that's likely to be wanted soon, unless too many are already waiting
+		void prefetch(std::string &&key, load_func &&load);
+
+	private:
+		struct job
+		{
+			image_loader    &loader;
+			std::string     key;
+			load_func       load;
+		};
+
+		void queue(std::string &&key, load_func &&load);
+		static void *work_callback(void *param, int threadid);
+
+		util::lru_cache_map<std::string, bitmap_argb32> m_images;  // decoded images, invalid if not found
+		std::set<std::string>   m_pending;                          // keys queued or being decoded
+		std::size_t const       m_max_prefetch;
+		std::mutex              m_mutex;                            // guards images and pending
+		osd_work_queue          *m_queue;
+	};
+
 	class cache
 	{
 	public:
@@ -186,6 +227,9 @@ private:
 		void set_snapx_driver(game_driver const *value) { m_snapx_driver = value; }
 		void set_snapx_software(ui_software_info const *software) { m_snapx_software = software; }
 
+		image_loader &snapshots() { return m_snapshots; }
+		image_loader &icons() { return m_icons; }
+
 		bitmap_argb32 &no_avail_bitmap() { return m_no_avail_bitmap; }
 		render_texture *star_texture() { return m_star_texture.get(); }
 
@@ -200,6 +244,9 @@ private:
 		game_driver const       *m_snapx_driver;
 		ui_software_info const  *m_snapx_software;
 
+		image_loader            m_snapshots;
+		image_loader            m_icons;
+
 		bitmap_argb32           m_no_avail_bitmap;
 		bitmap_argb32           m_star_bitmap;
 		texture_ptr             m_star_texture;
@@ -228,8 +275,8 @@ private:
 	void infos_render(float x1, float y1, float x2, float y2);
 	virtual void general_info(const game_driver *driver, std::string &buffer) = 0;
 
-	// get selected software and/or driver
-	virtual void get_selection(ui_software_info const *&software, game_driver const *&driver) const = 0;
+	// get software and/or driver for a list entry
+	virtual void get_item_selection(void *ref, ui_software_info const *&software, game_driver const *&driver) const = 0;
 	virtual bool accept_search() const { return true; }
 	void select_prev()
 	{
@@ -278,6 +325,8 @@ private:
 	void arts_render(float origx1, float origy1, float origx2, float origy2);
 	std::string arts_render_common(float origx1, float origy1, float origx2, float origy2);
 	void arts_render_images(bitmap_argb32 &&bitmap, float origx1, float origy1, float origx2, float origy2);
+	bool request_snapshot(std::string const &searchstr, ui_software_info const *software, game_driver const *driver, bitmap_argb32 *bitmap);
+	void prefetch_snapshots(std::string const &searchstr);
 	void draw_snapx(float origx1, float origy1, float origx2, float origy2);
 
 	// text for main top/bottom panels
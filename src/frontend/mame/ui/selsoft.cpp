@@ -12,7 +12,6 @@
 #include "ui/selsoft.h"
 
 #include "ui/ui.h"
-#include "ui/icorender.h"
 #include "ui/inifile.h"
 #include "ui/selector.h"
 
@@ -584,6 +583,11 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 		if (m_icon_paths.end() == paths)
 			paths = m_icon_paths.emplace(swinfo->listname, make_icon_paths(swinfo->listname.c_str())).first;
 
+		// icons are decoded in the background, so show nothing until it's ready
+		bitmap_argb32 tmp;
+		if (!fetch_icon(paths->second, swinfo->shortname, swinfo->parentname, tmp))
+			return nullptr;
+
 		// allocate an entry or allocate a texture on forced redraw
 		if (m_icons.end() == icon)
 		{
@@ -595,19 +599,6 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 			icon->second.texture.reset(machine().render().texture_alloc());
 		}
 
-		bitmap_argb32 tmp;
-		emu_file snapfile(std::string(paths->second), OPEN_FLAG_READ);
-		if (snapfile.open(std::string(swinfo->shortname), ".ico") == osd_file::error::NONE)
-		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
-		}
-		if (!tmp.valid() && !swinfo->parentname.empty() && (snapfile.open(std::string(swinfo->parentname), ".ico") == osd_file::error::NONE))
-		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
-		}
-
 		scale_icon(std::move(tmp), icon->second);
 	}
 
@@ -619,9 +610,9 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 //  get selected software and/or driver
 //-------------------------------------------------
 
-void menu_select_software::get_selection(ui_software_info const *&software, game_driver const *&driver) const
+void menu_select_software::get_item_selection(void *ref, ui_software_info const *&software, game_driver const *&driver) const
 {
-	software = reinterpret_cast<ui_software_info const *>(get_selection_ptr());
+	software = reinterpret_cast<ui_software_info const *>(ref);
 	driver = software ? software->driver : nullptr;
 }
 
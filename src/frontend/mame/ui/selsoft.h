@@ -56,7 +56,7 @@ private:
 	virtual render_texture *get_icon_texture(int linenum, void *selectedref) override;
 
 	// get selected software and/or driver
-	virtual void get_selection(ui_software_info const *&software, game_driver const *&driver) const override;
+	virtual void get_item_selection(void *ref, ui_software_info const *&software, game_driver const *&driver) const override;
 
 	// text for main top/bottom panels
 	virtual void make_topbox_text(std::string &line0, std::string &line1, std::string &line2) const override;
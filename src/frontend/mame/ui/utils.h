@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include "drivenum.h"
 #include "unicode.h"
 
 #include <algorithm>
@@ -37,9 +38,7 @@ struct ui_system_info
 	int index;
 	bool available = false;
 
-	std::u32string ucs_shortname;
-	std::u32string ucs_description;
-	std::u32string ucs_manufacturer_description;
+	driver_list::search_strings const *search = nullptr;
 };
 
 struct ui_software_info
@@ -107,6 +107,7 @@ namespace analog
 		, m_NR (*this, "NR")
 		, m_CJE(*this, "CJE")
 		, m_CJC(*this, "CJC")
+		, m_FASTEXP(*this, "FASTEXP")
 		{}
 
 		value_t m_IS;  //!< transport saturation current
@@ -116,6 +117,7 @@ namespace analog
 		value_t m_NR;  //!< reverse current emission coefficient
 		value_t m_CJE; //!< B-E zero-bias depletion capacitance
 		value_t m_CJC; //!< B-C zero-bias depletion capacitance
+		value_base_t<int> m_FASTEXP; //!< use tabulated exp (0=off, 1=on)
 
 	};
 
@@ -432,8 +434,8 @@ namespace analog
 		m_alpha_f = BF / (nlconst::one() + BF);
 		m_alpha_r = BR / (nlconst::one() + BR);
 
-		m_gD_BE.set_param(IS / m_alpha_f, NF, exec().gmin(), nlconst::T0());
-		m_gD_BC.set_param(IS / m_alpha_r, NR, exec().gmin(), nlconst::T0());
+		m_gD_BE.set_param(IS / m_alpha_f, NF, exec().gmin(), nlconst::T0(), m_model.m_FASTEXP != 0);
+		m_gD_BC.set_param(IS / m_alpha_r, NR, exec().gmin(), nlconst::T0(), m_model.m_FASTEXP != 0);
 	}
 
 } // namespace analog
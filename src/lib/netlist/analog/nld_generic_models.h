@@ -92,6 +92,7 @@ namespace analog
 		: m_h(dev, name + ".m_h", nlconst::zero())
 		, m_v(dev, name + ".m_v", nlconst::zero())
 		, m_gmin(nlconst::zero())
+		, m_step(nlconst::zero())
 		{
 		}
 
@@ -103,17 +104,27 @@ namespace analog
 			return - G(cap) * m_v;
 		}
 
-		void timestep(nl_fptype cap, nl_fptype v, nl_fptype step) noexcept
+		/// \brief Advance to the next time step.
+		///
+		/// \returns true if G changed, i.e. the time step differs from
+		///          the previous call.
+		///
+		bool timestep(nl_fptype cap, nl_fptype v, nl_fptype step) noexcept
 		{
 			plib::unused_var(cap);
-			m_h = plib::reciprocal(step);
 			m_v = v;
+			if (step == m_step)
+				return false;
+			m_step = step;
+			m_h = plib::reciprocal(step);
+			return true;
 		}
-		void setparams(nl_fptype gmin) noexcept { m_gmin = gmin; }
+		void setparams(nl_fptype gmin) noexcept { m_gmin = gmin; m_step = nlconst::zero(); }
 	private:
 		state_var<nl_fptype> m_h;
 		state_var<nl_fptype> m_v;
 		nl_fptype m_gmin;
+		nl_fptype m_step; // last time step, not saved to force recalculation
 	};
 
 	// -----------------------------------------------------------------------------
@@ -142,6 +153,7 @@ namespace analog
 		, m_gmin(nlconst::magic(1e-15))
 		, m_VtInv(nlconst::zero())
 		, m_Vcrit(nlconst::zero())
+		, m_fastexp(false)
 		, m_name(name)
 		{
 			set_param(
@@ -178,7 +190,7 @@ namespace analog
 				}
 				else
 				{
-					const auto IseVDVt = plib::exp(m_logIs + m_Vd * m_VtInv);
+					const auto IseVDVt = exp(m_logIs + m_Vd * m_VtInv);
 					m_Id = IseVDVt - m_Is;
 					m_G = IseVDVt * m_VtInv + m_gmin;
 				}
@@ -194,15 +206,22 @@ namespace analog
 				else // log stepping should already be done in mosfet
 				{
 					m_Vd = nVd;
-					const auto IseVDVt = plib::exp(std::min(+fp_constants<nl_fptype>::DIODE_MAXVOLT(), m_logIs + m_Vd * m_VtInv));
+					const auto IseVDVt = exp(std::min(+fp_constants<nl_fptype>::DIODE_MAXVOLT(), m_logIs + m_Vd * m_VtInv));
 					m_Id = IseVDVt - m_Is;
 					m_G = IseVDVt * m_VtInv + m_gmin;
 				}
 			}
 		}
 
-		void set_param(nl_fptype Is, nl_fptype n, nl_fptype gmin, nl_fptype temp) noexcept
+		/// \brief Set diode parameters
+		///
+		/// \param fastexp use the tabulated plib::fast_exp instead of
+		///        plib::exp. The relative error of current and conductance
+		///        is below 1e-6.
+		///
+		void set_param(nl_fptype Is, nl_fptype n, nl_fptype gmin, nl_fptype temp, bool fastexp = false) noexcept
 		{
+			m_fastexp = fastexp;
 			m_Is = Is;
 			m_logIs = plib::log(Is);
 			m_n = n;
@@ -226,6 +245,11 @@ namespace analog
 		// owning object must save those ...
 
 	private:
+		nl_fptype exp(nl_fptype v) const noexcept
+		{
+			return m_fastexp ? plib::fast_exp(v) : plib::exp(v);
+		}
+
 		state_var<nl_fptype> m_Vd;
 		state_var<nl_fptype> m_Id;
 		state_var<nl_fptype> m_G;
@@ -239,6 +263,7 @@ namespace analog
 
 		nl_fptype m_VtInv;
 		nl_fptype m_Vcrit;
+		bool m_fastexp;
 
 		pstring m_name;
 	};
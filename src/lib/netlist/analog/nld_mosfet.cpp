@@ -120,6 +120,7 @@ namespace analog
 		, m_CGDO(*this, "CGDO")
 		, m_CGBO(*this, "CGBO")
 		, m_CAPMOD(*this, "CAPMOD")
+		, m_FASTEXP(*this, "FASTEXP")
 		{}
 
 		value_t m_VTO;      //!< Threshold voltage [V]
@@ -142,6 +143,7 @@ namespace analog
 		value_t m_CGDO;     //!< Gate-drain overlap capacitance per meter channel width
 		value_t m_CGBO;     //!< Gate-bulk overlap capacitance per meter channel width
 		value_base_t<int> m_CAPMOD; //!< Capacitance model (0=no model 2=Meyer)
+		value_base_t<int> m_FASTEXP; //!< use tabulated exp for bulk diodes (0=off, 1=on)
 	};
 
 	// Have a common start for mosfets
@@ -317,9 +319,9 @@ namespace analog
 			NETLIB_NAME(FET)::reset();
 			// Bulk diodes
 
-			m_D_BD.set_param(m_model.m_ISD, m_model.m_N, exec().gmin(), constants::T0());
+			m_D_BD.set_param(m_model.m_ISD, m_model.m_N, exec().gmin(), constants::T0(), m_model.m_FASTEXP != 0);
 			#if (!BODY_CONNECTED_TO_SOURCE)
-				m_D_BS.set_param(m_model.m_ISS, m_model.m_N, exec().gmin(), constants::T0());
+				m_D_BS.set_param(m_model.m_ISS, m_model.m_N, exec().gmin(), constants::T0(), m_model.m_FASTEXP != 0);
 			#endif
 		}
 
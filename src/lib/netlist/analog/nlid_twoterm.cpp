@@ -117,6 +117,7 @@ namespace analog
 		m_gmin = exec().gmin();
 		m_I = nlconst::zero();
 		m_G = m_gmin;
+		m_step = nlconst::zero();
 		set_mat( m_G, -m_G, -m_I,
 				-m_G,  m_G,  m_I);
 		//set(1.0/NETLIST_GMIN, 0.0, -5.0 * NETLIST_GMIN);
@@ -124,15 +125,23 @@ namespace analog
 
 	NETLIB_UPDATE_PARAM(L)
 	{
+		// Force recalculation of G on the next time step
+		m_step = nlconst::zero();
 	}
 
 	NETLIB_TIMESTEP(L)
 	{
 		// Gpar should support convergence
 		m_I += m_I + m_G * deltaV();
-		m_G = step / m_L() + m_gmin;
-		set_mat( m_G, -m_G, -m_I,
-				-m_G,  m_G,  m_I);
+		if (step != m_step)
+		{
+			m_step = step;
+			m_G = step / m_L() + m_gmin;
+			set_mat( m_G, -m_G, -m_I,
+					-m_G,  m_G,  m_I);
+		}
+		else
+			set_I(-m_I, m_I);
 	}
 
 	// ----------------------------------------------------------------------------------------
@@ -144,7 +153,7 @@ namespace analog
 		nl_fptype Is = m_model.m_IS;
 		nl_fptype n = m_model.m_N;
 
-		m_D.set_param(Is, n, exec().gmin(), nlconst::T0());
+		m_D.set_param(Is, n, exec().gmin(), nlconst::T0(), m_model.m_FASTEXP != 0);
 		set_G_V_I(m_D.G(), nlconst::zero(), m_D.Ieq());
 	}
 
@@ -153,7 +162,7 @@ namespace analog
 		nl_fptype Is = m_model.m_IS;
 		nl_fptype n = m_model.m_N;
 
-		m_D.set_param(Is, n, exec().gmin(), nlconst::T0());
+		m_D.set_param(Is, n, exec().gmin(), nlconst::T0(), m_model.m_FASTEXP != 0);
 	}
 
 	NETLIB_UPDATE_TERMINALS(D)
@@ -120,6 +120,16 @@ namespace analog
 			m_N.set_go_gt_I(a21, a22, rhs2);
 		}
 
+		/// \brief Only update the current sources.
+		///
+		/// Use if conductances did not change since the last call to set_mat.
+		///
+		void set_I(nl_fptype rhs1, nl_fptype rhs2) const noexcept
+		{
+			m_P.set_I(rhs1);
+			m_N.set_I(rhs2);
+		}
+
 	private:
 	};
 
@@ -155,6 +165,9 @@ namespace analog
 		{
 		}
 
+		/// \brief Resistance as set by the parameter.
+		nl_fptype R() const noexcept { return m_R(); }
+
 
 	protected:
 
@@ -256,14 +269,23 @@ namespace analog
 		NETLIB_IS_TIMESTEP(true)
 		NETLIB_TIMESTEPI()
 		{
-			m_cap.timestep(m_C(), deltaV(), step);
 			if (m_cap.type() == capacitor_e::CONSTANT_CAPACITY)
 			{
+				// G only changes with the time step. For fixed time steps
+				// only the current source needs to be updated.
+				const bool G_changed = m_cap.timestep(m_C(), deltaV(), step);
 				const nl_fptype I = m_cap.Ieq(m_C(), deltaV());
-				const nl_fptype G = m_cap.G(m_C());
-				set_mat( G, -G, -I,
-						-G,  G,  I);
+				if (G_changed)
+				{
+					const nl_fptype G = m_cap.G(m_C());
+					set_mat( G, -G, -I,
+							-G,  G,  I);
+				}
+				else
+					set_I(-I, I);
 			}
+			else
+				m_cap.timestep(m_C(), deltaV(), step);
 		}
 
 		NETLIB_IS_DYNAMIC(m_cap.type() == capacitor_e::VARIABLE_CAPACITY)
@@ -284,7 +306,8 @@ namespace analog
 	protected:
 		//NETLIB_UPDATEI();
 		//FIXME: should be able to change
-		NETLIB_UPDATE_PARAMI() { }
+		// Force recalculation of G on the next time step
+		NETLIB_UPDATE_PARAMI() { m_cap.setparams(exec().gmin()); }
 
 	private:
 		//generic_capacitor<capacitor_e::VARIABLE_CAPACITY> m_cap;
@@ -302,6 +325,7 @@ namespace analog
 		, m_L(*this, "L", nlconst::magic(1e-6))
 		, m_gmin(nlconst::zero())
 		, m_G(nlconst::zero())
+		, m_step(nlconst::zero())
 		, m_I(nlconst::zero())
 		{
 			//register_term("1", m_P);
@@ -321,6 +345,7 @@ namespace analog
 
 		nl_fptype m_gmin;
 		nl_fptype m_G;
+		nl_fptype m_step; // last time step, G is only recalculated on change
 		nl_fptype m_I;
 	};
 
@@ -355,10 +380,12 @@ namespace analog
 		: param_model_t(device, name, val)
 		, m_IS(*this, "IS")
 		, m_N(*this, "N")
+		, m_FASTEXP(*this, "FASTEXP")
 		{}
 
 		value_t m_IS;    //!< saturation current.
 		value_t m_N;     //!< emission coefficient.
+		value_base_t<int> m_FASTEXP; //!< use tabulated exp (0=off, 1=on)
 	};
 
 	// -----------------------------------------------------------------------------
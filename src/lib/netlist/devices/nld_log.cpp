@@ -11,34 +11,116 @@
 #include "plib/pstream.h"
 //#include "sound/wavwrite.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 namespace netlist
 {
 	namespace devices
 	{
-	NETLIB_OBJECT(log)
+
+	// Formatting and writing log lines is slow. Samples are collected in
+	// chunks and a writer thread drains full chunks to the file while the
+	// simulation continues with the next chunk.
+
+	class log_writer_t
 	{
-		NETLIB_CONSTRUCTOR(log)
-		, m_I(*this, "I")
-		, m_strm(plib::filesystem::u8path(plib::pfmt("{1}.log")(this->name())))
+	public:
+		using sample_t = std::pair<nl_fptype, nl_fptype>;
+
+		static constexpr const std::size_t CHUNK_SIZE = 16384;
+
+		explicit log_writer_t(const pstring &fname)
+		: m_strm(plib::filesystem::u8path(fname))
 		, m_writer(&m_strm)
+		, m_stop(false)
 		{
 			if (m_strm.fail())
-				throw plib::file_open_e(plib::pfmt("{1}.log")(this->name()));
+				throw plib::file_open_e(fname);
 
 			m_strm.imbue(std::locale::classic());
+			m_cur.reserve(CHUNK_SIZE);
+			m_pending.reserve(CHUNK_SIZE);
+			m_thread = std::thread([this]() { drain(); });
+		}
+
+		COPYASSIGNMOVE(log_writer_t, delete)
+
+		~log_writer_t()
+		{
+			hand_over();
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+				m_stop = true;
+			}
+			m_cv.notify_all();
+			m_thread.join();
+		}
+
+		void push(nl_fptype t, nl_fptype v)
+		{
+			m_cur.emplace_back(t, v);
+			if (m_cur.size() >= CHUNK_SIZE)
+				hand_over();
+		}
+
+	private:
+		void hand_over()
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_cv.wait(lock, [this]() { return m_pending.empty(); });
+			std::swap(m_cur, m_pending);
+			lock.unlock();
+			m_cv.notify_all();
+		}
+
+		void drain()
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			while (true)
+			{
+				m_cv.wait(lock, [this]() { return m_stop || !m_pending.empty(); });
+				if (m_pending.empty())
+					break;
+				// Only the writer thread accesses m_pending while it is non-empty
+				lock.unlock();
+				for (auto &e : m_pending)
+					m_writer.writeline(plib::pfmt("{1:.9} {2}").e(e.first).e(e.second));
+				m_strm.flush();
+				lock.lock();
+				m_pending.clear();
+				m_cv.notify_all();
+			}
+		}
+
+		std::ofstream m_strm;
+		plib::putf8_writer m_writer;
+		std::vector<sample_t> m_cur;
+		std::vector<sample_t> m_pending;
+		std::mutex m_lock;
+		std::condition_variable m_cv;
+		bool m_stop;
+		std::thread m_thread;
+	};
+
+	NETLIB_OBJECT(log)
+	{
+		NETLIB_CONSTRUCTOR(log)
+		, m_I(*this, "I")
+		, m_writer(plib::pfmt("{1}.log")(this->name()))
+		{
 		}
 
 		NETLIB_UPDATEI()
 		{
-			/* use pstring::sprintf, it is a LOT faster */
-			m_writer.writeline(plib::pfmt("{1:.9} {2}").e(exec().time().as_fp<nl_fptype>()).e(static_cast<nl_fptype>(m_I())));
+			m_writer.push(exec().time().as_fp<nl_fptype>(), static_cast<nl_fptype>(m_I()));
 		}
 
 		NETLIB_RESETI() { }
 	protected:
 		analog_input_t m_I;
-		std::ofstream m_strm;
-		plib::putf8_writer m_writer;
+		log_writer_t m_writer;
 	};
 
 	NETLIB_OBJECT_DERIVED(logD, log)
@@ -50,7 +132,7 @@ namespace netlist
 
 		NETLIB_UPDATEI()
 		{
-			m_writer.writeline(plib::pfmt("{1:.9} {2}").e(exec().time().as_fp<nl_fptype>()).e(static_cast<nl_fptype>(m_I() - m_I2())));
+			m_writer.push(exec().time().as_fp<nl_fptype>(), static_cast<nl_fptype>(m_I() - m_I2()));
 		}
 
 		NETLIB_RESETI() { }
@@ -78,11 +78,19 @@ namespace netlist
 	: nld_base_a_to_d_proxy(anetlist, name, in_proxied)
 	, m_Q(*this, "Q")
 	, m_I(*this, "I")
+	, m_last_vn(nlconst::zero())
+	, m_last_vp(nlconst::zero())
+	, m_low_thresh(nlconst::zero())
+	, m_high_thresh(nlconst::zero())
 	{
 	}
 
 	NETLIB_RESET(a_to_d_proxy)
 	{
+		m_last_vn = m_tn->net().Q_Analog();
+		m_last_vp = m_tp->net().Q_Analog();
+		m_low_thresh = logic_family()->low_thresh_V(m_last_vn, m_last_vp);
+		m_high_thresh = logic_family()->high_thresh_V(m_last_vn, m_last_vp);
 	}
 
 	NETLIB_UPDATE(a_to_d_proxy)
@@ -91,9 +99,21 @@ namespace netlist
 		const auto vn(m_tn->net().Q_Analog());
 		const auto vp(m_tp->net().Q_Analog());
 
-		if (logic_family()->is_above_high_thresh_V(v, vn, vp))
+		// Supplies are almost always rails. Only recalculate the
+		// thresholds if they changed.
+		if (vn != m_last_vn || vp != m_last_vp)
+		{
+			m_last_vn = vn;
+			m_last_vp = vp;
+			m_low_thresh = logic_family()->low_thresh_V(vn, vp);
+			m_high_thresh = logic_family()->high_thresh_V(vn, vp);
+		}
+
+		// same comparison as logic_family_desc_t::is_above_high_thresh_V
+		// and is_below_low_thresh_V
+		if ((v - vn) > m_high_thresh)
 			out().push(1, netlist_time::quantum());
-		else if (logic_family()->is_below_low_thresh_V(v, vn, vp))
+		else if ((v - vn) < m_low_thresh)
 			out().push(0, netlist_time::quantum());
 		else
 		{
@@ -118,6 +138,8 @@ namespace netlist
 	, m_RN(*this, "RN")
 	, m_last_state(*this, "m_last_var", -1)
 	, m_is_timestep(false)
+	, m_G_low(nlconst::zero())
+	, m_G_high(nlconst::zero())
 	{
 		register_subalias("Q", m_RN.m_P);
 
@@ -146,7 +168,9 @@ namespace netlist
 		m_RN.reset();
 		m_RP.reset();
 		m_is_timestep = m_RN.m_P.net().solver()->has_timestep_devices();
-		m_RN.set_G_V_I(plib::reciprocal(logic_family()->R_low()),
+		m_G_low = plib::reciprocal(logic_family()->R_low());
+		m_G_high = plib::reciprocal(logic_family()->R_high());
+		m_RN.set_G_V_I(m_G_low,
 				logic_family()->low_offset_V(), nlconst::zero());
 		m_RP.set_G_V_I(G_OFF,
 			nlconst::zero(),
@@ -168,12 +192,12 @@ namespace netlist
 				m_RN.set_G_V_I(G_OFF,
 					nlconst::zero(),
 					nlconst::zero());
-				m_RP.set_G_V_I(plib::reciprocal(logic_family()->R_high()),
+				m_RP.set_G_V_I(m_G_high,
 						logic_family()->high_offset_V(), nlconst::zero());
 			}
 			else
 			{
-				m_RN.set_G_V_I(plib::reciprocal(logic_family()->R_low()),
+				m_RN.set_G_V_I(m_G_low,
 						logic_family()->low_offset_V(), nlconst::zero());
 				m_RP.set_G_V_I(G_OFF,
 					nlconst::zero(),
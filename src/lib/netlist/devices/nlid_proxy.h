@@ -75,6 +75,12 @@ namespace devices
 	private:
 		logic_output_t m_Q;
 		analog_input_t m_I;
+
+		// thresholds for the supply voltages last seen
+		nl_fptype m_last_vn;
+		nl_fptype m_last_vp;
+		nl_fptype m_low_thresh;
+		nl_fptype m_high_thresh;
 	};
 
 	// -----------------------------------------------------------------------------
@@ -120,6 +126,9 @@ namespace devices
 		analog::NETLIB_NAME(twoterm) m_RN;
 		state_var<int> m_last_state;
 		bool m_is_timestep;
+		// cached from the logic family
+		nl_fptype m_G_low;
+		nl_fptype m_G_high;
 	};
 
 } // namespace devices
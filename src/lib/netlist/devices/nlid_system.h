@@ -27,6 +27,7 @@ namespace devices
 		, m_startup_strategy(*this, "STARTUP_STRATEGY", 1)
 		, m_mos_capmodel(*this, "DEFAULT_MOS_CAPMODEL", 2)
 		, m_max_link_loops(*this, "MAX_LINK_RESOLVE_LOOPS", 100)
+		, m_remove_unused(*this, "REMOVE_UNUSED", true)
 		{
 		}
 		NETLIB_UPDATEI() { }
@@ -38,6 +39,8 @@ namespace devices
 		param_num_t<unsigned>   m_mos_capmodel;
 		//! How many times do we try to resolve links (connections)
 		param_num_t<unsigned>   m_max_link_loops;
+		//! Remove logic devices whose outputs are not connected
+		param_logic_t m_remove_unused;
 	};
 
 	// -----------------------------------------------------------------------------
@@ -86,12 +89,22 @@ namespace devices
 		, m_freq(*this, "FREQ", nlconst::magic(7159000.0 * 5.0))
 		, m_FAMILY(*this, "FAMILY", "FAMILY(TYPE=TTL)")
 		, m_supply(*this)
+		, m_implicit(false)
 		{
 			m_inc = netlist_time::from_fp(plib::reciprocal(m_freq()*nlconst::two()));
 
 			connect(m_feedback, m_Q);
 		}
-		//NETLIB_RESETI();
+
+		NETLIB_RESETI()
+		{
+			if (m_implicit)
+			{
+				// first edge as if pushed by update
+				m_feedback.inactivate();
+				m_Q.net().set_next_scheduled_time(m_inc);
+			}
+		}
 
 		NETLIB_UPDATE_PARAMI()
 		{
@@ -100,9 +113,25 @@ namespace devices
 
 		NETLIB_UPDATEI()
 		{
-			m_Q.push(!m_feedback(), m_inc);
+			if (!m_implicit)
+				m_Q.push(!m_feedback(), m_inc);
+		}
+
+		/// \brief Let the main loop toggle the output
+		///
+		/// Only possible if the feedback is not routed through the
+		/// analog domain. Must be called before reset.
+		///
+		/// \returns true if the main loop has to toggle the output
+		bool set_implicit() noexcept
+		{
+			m_implicit = (&m_feedback.net() == &m_Q.net());
+			return m_implicit;
 		}
 
+		logic_net_t &Q_net() noexcept { return m_Q.net(); }
+		const netlist_time &inc() const noexcept { return m_inc; }
+
 	private:
 		logic_input_t m_feedback;
 		logic_output_t m_Q;
@@ -112,6 +141,7 @@ namespace devices
 
 		param_model_t m_FAMILY;
 		NETLIB_NAME(power_pins) m_supply;
+		bool m_implicit;
 };
 
 	// -----------------------------------------------------------------------------
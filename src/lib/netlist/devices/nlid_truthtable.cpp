@@ -8,6 +8,8 @@
 
 #include <bitset>
 #include <cstdint>
+#include <map>
+#include <mutex>
 #include <vector>
 
 namespace netlist
@@ -252,11 +254,7 @@ namespace devices
 			if (!m_ttbl)
 			{
 				m_ttbl = pool.make_unique<typename nld_truthtable_t<m_NI, m_NO>::truthtable_t>();
-				truthtable_parser desc_s(m_NO, m_NI,
-						packed_int(m_ttbl->m_out_state.data(), sizeof(m_ttbl->m_out_state[0]) * 8),
-						m_ttbl->m_timing_index.data(), m_ttbl->m_timing_nt.data());
-
-				desc_s.parse(m_desc);
+				*m_ttbl = parsed_table(m_desc);
 			}
 
 			// update truthtable family definitions
@@ -269,7 +267,33 @@ namespace devices
 			return pool.make_unique<tt_type>(anetlist, name, *m_family_desc, *m_ttbl, m_desc);
 		}
 	private:
-		unique_pool_ptr<typename nld_truthtable_t<m_NI, m_NO>::truthtable_t> m_ttbl;
+		using table_type = typename nld_truthtable_t<m_NI, m_NO>::truthtable_t;
+
+		// Parsing and calculating the ignore masks is expensive for
+		// larger tables. Tables only depend on the description, thus
+		// parse each description only once and share the result between
+		// all netlist instances.
+		static table_type parsed_table(const std::vector<pstring> &desc)
+		{
+			static std::mutex lock;
+			static std::map<std::vector<pstring>, table_type> cache;
+
+			std::lock_guard<std::mutex> guard(lock);
+			auto it = cache.find(desc);
+			if (it == cache.end())
+			{
+				table_type tbl;
+				truthtable_parser desc_s(m_NO, m_NI,
+						packed_int(tbl.m_out_state.data(), sizeof(tbl.m_out_state[0]) * 8),
+						tbl.m_timing_index.data(), tbl.m_timing_nt.data());
+
+				desc_s.parse(desc);
+				it = cache.emplace(desc, tbl).first;
+			}
+			return it->second;
+		}
+
+		unique_pool_ptr<table_type> m_ttbl;
 	};
 
 	tt_bitset truthtable_parser::calculate_ignored_inputs(tt_bitset state) const
@@ -17,6 +17,7 @@
 #include "nl_errstr.h"
 
 #include <limits>
+#include <map>
 
 namespace netlist
 {
@@ -27,6 +28,7 @@ namespace netlist
 
 	// NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init, modernize-use-equals-default)
 	logic_family_desc_t::logic_family_desc_t()
+	: m_inertial(false)
 	{
 	}
 
@@ -124,8 +126,8 @@ namespace netlist
 		m_qsize = this->size();
 		for (std::size_t i = 0; i < m_qsize; i++ )
 		{
-			m_times[i] =  this->listptr()[i].exec_time().as_raw();
-			m_net_ids[i] = state().find_net_id(this->listptr()[i].object());
+			m_times[i] =  (*this)[i].exec_time().as_raw();
+			m_net_ids[i] = state().find_net_id((*this)[i].object());
 		}
 	}
 
@@ -184,6 +186,7 @@ namespace netlist
 		, m_mainclock(nullptr)
 		, m_queue(*this)
 		, m_use_stats(false)
+		, m_queue_staged(false)
 	{
 		state.run_state_manager().save_item(this, static_cast<plib::state_manager_t::callback_t &>(m_queue), "m_queue");
 		state.run_state_manager().save_item(this, m_time, "m_time");
@@ -238,10 +241,17 @@ namespace netlist
 
 	std::size_t netlist_state_t::find_net_id(const detail::net_t *net) const
 	{
-		for (std::size_t i = 0; i < m_nets.size(); i++)
-			if (m_nets[i].get() == net)
-				return i;
-		return std::numeric_limits<std::size_t>::max();
+		// The queue looks up every pending entry on each save. A linear
+		// search made saving quadratic and stalled rewind.
+		if (m_net_index.size() != m_nets.size())
+		{
+			m_net_index.clear();
+			m_net_index.reserve(m_nets.size());
+			for (std::size_t i = 0; i < m_nets.size(); i++)
+				m_net_index.insert({m_nets[i].get(), i});
+		}
+		auto f = m_net_index.find(net);
+		return (f != m_net_index.end()) ? f->second : std::numeric_limits<std::size_t>::max();
 	}
 
 	void netlist_state_t::rebuild_lists()
@@ -323,8 +333,17 @@ namespace netlist
 
 		m_time = netlist_time_ext::zero();
 		m_queue.clear();
+		m_clocks.clear();
 		if (m_mainclock != nullptr)
+		{
 			m_mainclock->m_Q.net().set_next_scheduled_time(netlist_time_ext::zero());
+			m_clocks.push_back({&m_mainclock->m_Q.net(), &m_mainclock->m_inc, netlist_time_ext::zero()});
+		}
+#if (NL_USE_IMPLICIT_CLOCKS)
+		for (auto *clk : m_state.get_device_list<devices::NETLIB_NAME(clock)>())
+			if (clk->set_implicit())
+				m_clocks.push_back({&clk->Q_net(), &clk->inc(), netlist_time_ext::zero()});
+#endif
 		//if (m_solver != nullptr)
 		//  m_solver->reset();
 
@@ -431,7 +450,7 @@ namespace netlist
 				index.push_back(i);
 
 			std::sort(index.begin(), index.end(),
-					[&](size_t i1, size_t i2) { return m_state.m_devices[i1].second->m_stats->m_stat_total_time.total() < m_state.m_devices[i2].second->m_stats->m_stat_total_time.total(); });
+					[&](size_t i1, size_t i2) { return m_state.m_devices[i1].second->m_stats->total_time() < m_state.m_devices[i2].second->m_stats->total_time(); });
 
 			plib::pperftime_t<true>::type total_time(0);
 			plib::pperftime_t<true>::ctype total_count(0);
@@ -441,15 +460,36 @@ namespace netlist
 				auto entry = m_state.m_devices[j].second.get();
 				auto stats = entry->m_stats.get();
 				log().verbose("Device {1:20} : {2:12} {3:12} {4:15} {5:12}", entry->name(),
-						stats->m_stat_call_count(), stats->m_stat_total_time.count(),
-						stats->m_stat_total_time.total(), stats->m_stat_inc_active());
-				total_time += stats->m_stat_total_time.total();
-				total_count += stats->m_stat_total_time.count();
+						stats->m_stat_call_count(), stats->exec_count(),
+						stats->total_time(), stats->m_stat_inc_active());
+				total_time += stats->total_time();
+				total_count += stats->exec_count();
 			}
 
 			log().verbose("Total calls : {1:12} {2:12} {3:12}", total_count,
 				total_time, total_time / static_cast<decltype(total_time)>(total_count ? total_count : 1));
 
+			// aggregate by device type. Devices created by other devices
+			// are accounted to the closest parent created by the factory.
+			std::map<pstring, std::pair<plib::pperftime_t<true>::ctype, plib::pperftime_t<true>::type>> types;
+			for (auto & d : m_state.m_devices)
+			{
+				factory::element_t *e = nullptr;
+				pstring n;
+				for (auto &part : plib::psplit(d.first, "."))
+				{
+					n = (n.empty() ? part : n + "." + part);
+					auto *f = m_state.setup().device_factory_element(n);
+					if (f != nullptr)
+						e = f;
+				}
+				auto &t = types[e != nullptr ? e->name() : pstring("<unknown>")];
+				t.first += d.second->m_stats->exec_count();
+				t.second += d.second->m_stats->total_time();
+			}
+			for (auto & t : types)
+				log().verbose("Type   {1:20} : {2:12} {3:15}", t.first, t.second.first, t.second.second);
+
 			log().verbose("Total loop     {1:15}", m_stat_mainloop());
 			log().verbose("Total time     {1:15}", total_time);
 
@@ -493,11 +533,11 @@ namespace netlist
 				auto ep = entry.second.get();
 				auto stats = ep->m_stats.get();
 				// Factor of 3 offers best performace increase
-				if (stats->m_stat_inc_active() > 3 * stats->m_stat_total_time.count()
+				if (stats->m_stat_inc_active() > 3 * stats->exec_count()
 					&& stats->m_stat_inc_active() > trigger)
 					log().verbose("HINT({}, NO_DEACTIVATE) // {} {} {}", ep->name(),
-						static_cast<nl_fptype>(stats->m_stat_inc_active()) / static_cast<nl_fptype>(stats->m_stat_total_time.count()),
-						stats->m_stat_inc_active(), stats->m_stat_total_time.count());
+						static_cast<nl_fptype>(stats->m_stat_inc_active()) / static_cast<nl_fptype>(stats->exec_count()),
+						stats->m_stat_inc_active(), stats->exec_count());
 			}
 			log().verbose("");
 		}
@@ -505,6 +545,18 @@ namespace netlist
 		log().verbose("Maximum pool memory allocated: {1:12} kB", nlstate().pool().max_alloc() >> 10);
 	}
 
+	void netlist_t::write_stats_collapsed(std::ostream &strm) const
+	{
+		if (!m_use_stats)
+			return;
+		for (auto & d : m_state.m_devices)
+		{
+			const auto t(d.second->m_stats->total_time());
+			if (t > 0)
+				strm << plib::pfmt("{1};{2} {3}\n")(m_state.name(), plib::replace_all(d.first, pstring("."), pstring(";")), t);
+		}
+	}
+
 	core_device_t *netlist_state_t::get_single_device(const pstring &classname, bool (*cc)(core_device_t *)) const
 	{
 		core_device_t *ret = nullptr;
@@ -656,12 +708,13 @@ namespace netlist
 	{
 		// rebuild m_list
 
+		// push_back walks the list, build it from the back instead
 		m_list_active.clear();
-		for (auto & term : m_core_terms)
-			if (term->terminal_state() != logic_t::STATE_INP_PASSIVE)
+		for (auto term = m_core_terms.rbegin(); term != m_core_terms.rend(); ++term)
+			if ((*term)->terminal_state() != logic_t::STATE_INP_PASSIVE)
 			{
-				m_list_active.push_back(term);
-				term->set_copied_input(m_cur_Q);
+				m_list_active.push_front(*term);
+				(*term)->set_copied_input(m_cur_Q);
 			}
 	}
 
@@ -682,11 +735,12 @@ namespace netlist
 		// rebuild m_list and reset terminals to active or analog out state
 
 		m_list_active.clear();
-		for (core_terminal_t *ct : m_core_terms)
+		for (auto it = m_core_terms.rbegin(); it != m_core_terms.rend(); ++it)
 		{
+			core_terminal_t *ct = *it;
 			ct->reset();
 			if (ct->terminal_state() != logic_t::STATE_INP_PASSIVE)
-				m_list_active.push_back(ct);
+				m_list_active.push_front(ct);
 			ct->set_copied_input(m_cur_Q);
 		}
 	}
@@ -818,6 +872,7 @@ namespace netlist
 	logic_output_t::logic_output_t(core_device_t &dev, const pstring &aname)
 		: logic_t(dev, aname, STATE_OUT)
 		, m_my_net(dev.state(), name() + ".net", this)
+		, m_inertial(dev.logic_family() != nullptr && dev.logic_family()->m_inertial)
 	{
 		this->set_net(&m_my_net);
 		state().register_net(owned_pool_ptr<logic_net_t>(&m_my_net, false));
@@ -917,7 +972,17 @@ namespace netlist
 	param_str_t::param_str_t(device_t &device, const pstring &name, const pstring &val)
 	: param_t(device, name)
 	{
-		m_param = device.state().setup().get_initial_param_val(this->name(),val);
+		m_param = &device.state().intern(device.state().setup().get_initial_param_val(this->name(),val));
+	}
+
+	void param_str_t::setTo(const pstring &param)
+	{
+		if (*m_param != param)
+		{
+			m_param = &state().intern(param);
+			changed();
+			update_param();
+		}
 	}
 
 	void param_str_t::changed() noexcept
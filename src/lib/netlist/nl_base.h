@@ -19,6 +19,7 @@
 #include "plib/pfunction.h"
 #include "plib/plists.h"
 #include "plib/pmempool.h"
+#include "plib/pomp.h"
 #include "plib/ppmf.h"
 #include "plib/pstate.h"
 #include "plib/pstonum.h"
@@ -29,6 +30,7 @@
 #include "nltypes.h"
 
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 //============================================================
@@ -287,6 +289,7 @@ namespace netlist
 		nl_fptype m_high_VO;           //!< high output voltage offset. The supply voltage minus this offset is output if the ouput is "1"
 		nl_fptype m_R_low;             //!< low output resistance. Value of series resistor used for low output
 		nl_fptype m_R_high;            //!< high output resistance. Value of series resistor used for high output
+		bool m_inertial;               //!< inertial delay. Transitions reverted before they are delivered are cancelled
 	};
 
 	/// \brief Base class for devices, terminals, outputs and inputs which support
@@ -749,6 +752,13 @@ namespace netlist
 				}
 			}
 
+			// only used for logic nets
+			//
+			// Inertial delay: if the net returns to its current state
+			// before a pending transition is delivered, the pending
+			// transition is cancelled instead of queueing a no-op.
+			void set_Q_and_push_inertial(netlist_sig_t newQ, netlist_time delay) noexcept;
+
 			// only used for logic nets
 			void set_Q_time(netlist_sig_t newQ, netlist_time_ext at) noexcept
 			{
@@ -824,6 +834,13 @@ namespace netlist
 			set_go_gt_I(GO, GT, nlconst::zero());
 		}
 
+		void set_I(nl_fptype I) const noexcept
+		{
+			// Check for rail nets ...
+			if (m_go1 != nullptr)
+				*m_Idr1 = I;
+		}
+
 		void set_go_gt_I(nl_fptype GO, nl_fptype GT, nl_fptype I) const noexcept
 		{
 			// Check for rail nets ...
@@ -925,6 +942,7 @@ namespace netlist
 		using detail::net_t::Q;
 		using detail::net_t::initial;
 		using detail::net_t::set_Q_and_push;
+		using detail::net_t::set_Q_and_push_inertial;
 		using detail::net_t::set_Q_time;
 		using detail::net_t::Q_state_ptr;
 	};
@@ -964,9 +982,24 @@ namespace netlist
 
 		void initial(netlist_sig_t val) noexcept;
 
+		/// \brief Change the family, keeping the cached inertial flag in sync.
+		///
+		/// Devices like logic_input only know their family after the
+		/// outputs have been constructed.
+		///
+		void set_logic_family(const logic_family_desc_t *fam) noexcept
+		{
+			logic_t::set_logic_family(fam);
+			m_inertial = (fam != nullptr && fam->m_inertial);
+		}
+
 		void push(netlist_sig_t newQ, netlist_time delay) noexcept
 		{
-			m_my_net.set_Q_and_push(newQ, delay); // take the shortcut
+			// take the shortcut
+			if (m_inertial)
+				m_my_net.set_Q_and_push_inertial(newQ, delay);
+			else
+				m_my_net.set_Q_and_push(newQ, delay);
 		}
 
 		void set_Q_time(netlist_sig_t newQ, netlist_time_ext at) noexcept
@@ -976,6 +1009,7 @@ namespace netlist
 
 	private:
 		logic_net_t m_my_net;
+		bool m_inertial;
 	};
 
 	class analog_output_t : public analog_t
@@ -1040,6 +1074,27 @@ namespace netlist
 		// stats
 		struct stats_t
 		{
+			using time_type = plib::pperftime_t<true>::type;
+			using count_type = plib::pperftime_t<true>::ctype;
+
+			// returns true if this execution should be timed
+			bool sample() const noexcept
+			{
+				return (m_stat_call_count() & ((1u << NL_STATS_SAMPLE_SHIFT) - 1)) == 0;
+			}
+
+			/// \brief Total time with sampling taken into account
+			time_type total_time() const noexcept
+			{
+				return m_stat_total_time.total() * static_cast<time_type>(1u << NL_STATS_SAMPLE_SHIFT);
+			}
+
+			/// \brief Executions with sampling taken into account
+			count_type exec_count() const noexcept
+			{
+				return m_stat_total_time.count() << NL_STATS_SAMPLE_SHIFT;
+			}
+
 			// NL_KEEP_STATISTICS
 			plib::pperftime_t<true>  m_stat_total_time;
 			plib::pperfcount_t<true> m_stat_call_count;
@@ -1207,20 +1262,12 @@ namespace netlist
 		param_str_t(device_t &device, const pstring &name, const pstring &val);
 
 		const pstring &operator()() const noexcept { return str(); }
-		void setTo(const pstring &param)
-		{
-			if (m_param != param)
-			{
-				m_param = param;
-				changed();
-				update_param();
-			}
-		}
+		void setTo(const pstring &param);
 	protected:
 		virtual void changed() noexcept;
-		const pstring &str() const noexcept { return m_param; }
+		const pstring &str() const noexcept { return *m_param; }
 	private:
-		pstring m_param;
+		const pstring *m_param; // shared copy owned by netlist_state_t
 	};
 
 	// -----------------------------------------------------------------------------
@@ -1313,8 +1360,13 @@ namespace netlist
 			family_setter_t(core_device_t &dev, const logic_family_desc_t &desc);
 		};
 
+#if (NL_USE_CALENDAR_QUEUE)
+		template <class T, bool TS>
+		using timed_queue = plib::timed_queue_calendar<T, TS>;
+#else
 		template <class T, bool TS>
 		using timed_queue = plib::timed_queue_linear<T, TS>;
+#endif
 
 		// Use timed_queue_heap to use stdc++ heap functions instead of linear processing.
 		// This slows down processing by about 25% on a Kaby Lake.
@@ -1325,8 +1377,9 @@ namespace netlist
 		// queue_t
 		// -----------------------------------------------------------------------------
 
-		// We don't need a thread-safe queue currently. Parallel processing of
-		// solvers will update inputs after parallel processing.
+		// The queue itself is not thread-safe. Producers running in parallel,
+		// e.g. solvers updating their inputs, push into per-thread staging
+		// buffers which are merged by netlist_t::queue_staging_end.
 
 		class queue_t :
 				//public timed_queue<pqentry_t<net_t *, netlist_time>, false, NL_KEEP_STATISTICS>,
@@ -1434,6 +1487,38 @@ namespace netlist
 
 		plib::dynlib &lib() const noexcept { return *m_lib; }
 
+		/// \brief Return the shared copy of a string.
+		///
+		/// Parameter strings are stored once per netlist, so repeated
+		/// packages and subcircuits with the same model strings share them.
+		/// The reference stays valid as long as the netlist exists.
+		///
+		/// \param s String to look up.
+		/// \returns Reference to the shared copy.
+		const pstring &intern(const pstring &s) { return *m_strings.insert(s).first; }
+
+		/// \brief Register a table of statically linked solvers.
+		///
+		/// Must be called before the solvers are created. Static solvers
+		/// are preferred over the external library and JIT compilation.
+		///
+		/// \param table Table terminated by an entry with a nullptr name.
+		void add_static_solvers(const static_solver_entry *table)
+		{
+			for (; table->name != nullptr; table++)
+				m_static_solvers[pstring(table->name)] = table->func;
+		}
+
+		/// \brief Look up a statically linked solver.
+		///
+		/// \returns Function pointer or nullptr if not found.
+		template <typename T>
+		T static_solver(const pstring &name) const noexcept
+		{
+			auto it = m_static_solvers.find(name);
+			return (it != m_static_solvers.end()) ? reinterpret_cast<T>(it->second) : nullptr;
+		}
+
 		netlist_t &exec() noexcept { return *m_netlist; }
 		const netlist_t &exec() const noexcept { return *m_netlist; }
 
@@ -1466,10 +1551,8 @@ namespace netlist
 
 		core_device_t *find_device(const pstring &name) const
 		{
-			for (auto & d : m_devices)
-				if (d.first == name)
-					return d.second.get();
-			return nullptr;
+			auto f = m_device_index.find(name);
+			return (f != m_device_index.end()) ? f->second : nullptr;
 		}
 
 		/// \brief Register device using owned_ptr
@@ -1483,13 +1566,12 @@ namespace netlist
 		template <typename T>
 		void register_device(const pstring &name, owned_pool_ptr<T> &&dev) noexcept(false)
 		{
-			for (auto & d : m_devices)
-				if (d.first == name)
-				{
-					dev.release();
-					log().fatal(MF_DUPLICATE_NAME_DEVICE_LIST(name));
-					throw nl_exception(MF_DUPLICATE_NAME_DEVICE_LIST(name));
-				}
+			if (!m_device_index.insert({name, dev.get()}).second)
+			{
+				dev.release();
+				log().fatal(MF_DUPLICATE_NAME_DEVICE_LIST(name));
+				throw nl_exception(MF_DUPLICATE_NAME_DEVICE_LIST(name));
+			}
 			//m_devices.push_back(std::move(dev));
 			m_devices.insert(m_devices.end(), { name, std::move(dev) });
 		}
@@ -1520,11 +1602,32 @@ namespace netlist
 				if (it->second.get() == dev)
 				{
 					m_state.remove_save_items(dev);
+					m_device_index.erase(it->first);
 					m_devices.erase(it);
 					return;
 				}
 		}
 
+		/// \brief Remove devices
+		///
+		/// Same as remove_device but removes all devices in one pass.
+		///
+		/// \param devs Devices to be removed
+
+		void remove_devices(const std::vector<core_device_t *> &devs)
+		{
+			std::unordered_set<const void *> owners(devs.begin(), devs.end());
+			m_state.remove_save_items(owners);
+			m_devices.erase(std::remove_if(m_devices.begin(), m_devices.end(),
+				[this, &owners](const devices_collection_type::value_type &d)
+				{
+					if (owners.find(d.second.get()) == owners.end())
+						return false;
+					m_device_index.erase(d.first);
+					return true;
+				}), m_devices.end());
+		}
+
 		setup_t &setup() noexcept { return *m_setup; }
 		const setup_t &setup() const noexcept { return *m_setup; }
 
@@ -1579,14 +1682,20 @@ namespace netlist
 		pstring                             m_name;
 		unique_pool_ptr<netlist_t>          m_netlist;
 		plib::unique_ptr<plib::dynlib>      m_lib; // external lib needs to be loaded as long as netlist exists
+		std::unordered_map<pstring, void (*)()> m_static_solvers;
+		std::unordered_set<pstring>         m_strings; // shared parameter strings
 		plib::state_manager_t               m_state;
 		plib::unique_ptr<callbacks_t>       m_callbacks;
 		log_type                            m_log;
 		plib::unique_ptr<setup_t>           m_setup;
 
 		nets_collection_type                m_nets;
+		// net id lookup for state saving, rebuilt if m_nets changed size
+		mutable std::unordered_map<const detail::net_t *, std::size_t> m_net_index;
 		// sole use is to manage lifetime of net objects
 		devices_collection_type             m_devices;
+		// name lookup for m_devices
+		std::unordered_map<pstring, core_device_t *> m_device_index;
 		bool m_extended_validation;
 
 		// dummy version
@@ -1664,7 +1773,9 @@ namespace netlist
 		template <typename E>
 		void qpush(E && e) noexcept
 		{
-			if (!NL_USE_QUEUE_STATS || !m_use_stats)
+			if (m_queue_staged)
+				m_queue_staging.push(plib::omp::get_thread_num(), std::forward<E>(e)); // NOLINT(performance-move-const-arg)
+			else if (!NL_USE_QUEUE_STATS || !m_use_stats)
 				m_queue.push<false>(std::forward<E>(e)); // NOLINT(performance-move-const-arg)
 			else
 				m_queue.push<true>(std::forward<E>(e)); // NOLINT(performance-move-const-arg)
@@ -1673,12 +1784,44 @@ namespace netlist
 		template <class R>
 		void qremove(const R &elem) noexcept
 		{
-			if (!NL_USE_QUEUE_STATS || !m_use_stats)
+			if (m_queue_staged)
+				m_queue_staging.remove(plib::omp::get_thread_num(), detail::queue_t::entry_t(m_time, elem));
+			else if (!NL_USE_QUEUE_STATS || !m_use_stats)
 				m_queue.remove<false>(elem);
 			else
 				m_queue.remove<true>(elem);
 		}
 
+		/// \brief Redirect queue operations to per-thread staging buffers.
+		///
+		/// Between queue_staging_begin and queue_staging_end qpush and qremove
+		/// may be called concurrently from at most `producers` threads. Each
+		/// thread records into its own buffer identified by the OpenMP thread
+		/// number. Threads must not operate on the same nets.
+		///
+		/// Every buffer has room for a push and a remove per queue entry,
+		/// so recording never allocates.
+		///
+		void queue_staging_begin(std::size_t producers)
+		{
+			m_queue_staging.reserve_producers(producers, 2 * m_queue.capacity());
+			m_queue_staged = true;
+		}
+
+		/// \brief Merge staged queue operations into the queue.
+		///
+		/// Must be called from the thread driving the netlist after all
+		/// producers have finished.
+		///
+		void queue_staging_end() noexcept
+		{
+			m_queue_staged = false;
+			if (!NL_USE_QUEUE_STATS || !m_use_stats)
+				m_queue_staging.merge<false>(m_queue);
+			else
+				m_queue_staging.merge<true>(m_queue);
+		}
+
 		// Control functions
 
 		void stop();
@@ -1703,14 +1846,49 @@ namespace netlist
 
 		void print_stats() const;
 
+		/// \brief Write device statistics in collapsed stack format
+		///
+		/// Each line contains the device name hierarchy separated by ';'
+		/// followed by the time spent in the device in ticks. The
+		/// output can be processed by common flame graph tools.
+		/// Nothing is written if statistics are disabled.
+		///
+		/// \param strm Stream to write to
+		///
+		void write_stats_collapsed(std::ostream &strm) const;
+
 		bool stats_enabled() const noexcept { return m_use_stats; }
 		void enable_stats(bool val) noexcept { m_use_stats = val; }
 
+		/// \brief Number of queue entries processed
+		///
+		/// Counted independent of \ref enable_stats. Edges of clocks driven
+		/// by the main loop are not included.
+		///
+		plib::pperfcount_t<true>::type queue_events() const noexcept { return m_perf_out_processed(); }
+
 	private:
 
 		template <bool KEEP_STATS>
 		void process_queue_stats(netlist_time_ext delta) noexcept;
 
+		/// \brief Clock toggled by the main loop
+		struct implicit_clock_t
+		{
+			logic_net_t *m_net;
+			const netlist_time *m_inc;
+			netlist_time_ext m_next;
+		};
+
+		implicit_clock_t *next_clock() noexcept
+		{
+			implicit_clock_t *ret(&m_clocks[0]);
+			for (std::size_t i = 1; i < m_clocks.size(); i++)
+				if (m_clocks[i].m_next < ret->m_next)
+					ret = &m_clocks[i];
+			return ret;
+		}
+
 		netlist_state_t &                   m_state;
 		devices::NETLIB_NAME(solver) *      m_solver;
 
@@ -1718,10 +1896,13 @@ namespace netlist
 		PALIGNAS_CACHELINE()
 		netlist_time_ext                    m_time;
 		devices::NETLIB_NAME(mainclock) *   m_mainclock;
+		std::vector<implicit_clock_t>       m_clocks;
 
 		PALIGNAS_CACHELINE()
 		detail::queue_t                     m_queue;
 		bool                                m_use_stats;
+		bool                                m_queue_staged;
+		plib::timed_queue_staging_t<detail::queue_t::entry_t> m_queue_staging;
 		// performance
 		plib::pperftime_t<true>             m_stat_mainloop;
 		plib::pperfcount_t<true>            m_perf_out_processed;
@@ -1883,6 +2064,21 @@ namespace netlist
 		}
 	}
 
+	inline void detail::net_t::set_Q_and_push_inertial(netlist_sig_t newQ, netlist_time delay) noexcept
+	{
+		if (newQ != m_new_Q)
+		{
+			m_new_Q = newQ;
+			if (newQ == m_cur_Q && is_queued())
+			{
+				exec().qremove(this);
+				m_in_queue = queue_status::DELIVERED;
+			}
+			else
+				push_to_queue(delay);
+		}
+	}
+
 	inline void detail::net_t::add_to_active_list(core_terminal_t &term) noexcept
 	{
 		if (m_list_active.empty())
@@ -2045,11 +2241,17 @@ namespace netlist
 			{
 				p.set_copied_input(sig);
 				auto *stats = p.device().m_stats.get();
+				const bool sample(stats->sample());
 				stats->m_stat_call_count.inc();
 				if ((p.terminal_state() & mask))
 				{
-					auto g(stats->m_stat_total_time.guard());
-					p.run_delegate();
+					if (sample)
+					{
+						auto g(stats->m_stat_total_time.guard());
+						p.run_delegate();
+					}
+					else
+						p.run_delegate();
 				}
 			}
 		}
@@ -2082,7 +2284,7 @@ namespace netlist
 
 		qpush(detail::queue_t::entry_t(stop, nullptr));
 
-		if (m_mainclock == nullptr)
+		if (m_clocks.empty())
 		{
 			m_time = m_queue.top().exec_time();
 			detail::net_t *obj(m_queue.top().object());
@@ -2091,8 +2293,7 @@ namespace netlist
 			while (obj != nullptr)
 			{
 				obj->template update_devs<KEEP_STATS>();
-				if (KEEP_STATS)
-					m_perf_out_processed.inc();
+				m_perf_out_processed.inc();
 				const detail::queue_t::entry_t *top = &m_queue.top();
 				m_time = top->exec_time();
 				obj = top->object();
@@ -2101,20 +2302,21 @@ namespace netlist
 		}
 		else
 		{
-			logic_net_t &mc_net(m_mainclock->m_Q.net());
-			const netlist_time inc(m_mainclock->m_inc);
-			netlist_time_ext mc_time(mc_net.next_scheduled_time());
+			for (auto &c : m_clocks)
+				c.m_next = c.m_net->next_scheduled_time();
 
 			do
 			{
 				const detail::queue_t::entry_t *top = &m_queue.top();
-				while (top->exec_time() > mc_time)
+				implicit_clock_t *clk = next_clock();
+				while (top->exec_time() > clk->m_next)
 				{
-					m_time = mc_time;
-					mc_net.toggle_new_Q();
-					mc_net.update_devs<KEEP_STATS>();
+					m_time = clk->m_next;
+					clk->m_net->toggle_new_Q();
+					clk->m_net->template update_devs<KEEP_STATS>();
+					clk->m_next += *clk->m_inc;
 					top = &m_queue.top();
-					mc_time += inc;
+					clk = next_clock();
 				}
 
 				m_time = top->exec_time();
@@ -2124,11 +2326,11 @@ namespace netlist
 					obj->template update_devs<KEEP_STATS>();
 				else
 					break;
-				if (KEEP_STATS)
-					m_perf_out_processed.inc();
+				m_perf_out_processed.inc();
 			} while (true);
 
-			mc_net.set_next_scheduled_time(mc_time);
+			for (auto &c : m_clocks)
+				c.m_net->set_next_scheduled_time(c.m_next);
 		}
 	}
 
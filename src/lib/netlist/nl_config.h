@@ -42,6 +42,17 @@
 #define NL_USE_MEMPOOL               (1)
 #endif
 
+/// \brief  Use a persistent thread pool for the solver PARALLEL parameter.
+///
+/// If enabled, solvers are distributed over PARALLEL persistent threads
+/// instead of an OpenMP parallel section per time step. Works without
+/// OpenMP support.
+///
+
+#ifndef NL_USE_SOLVER_THREAD_POOL
+#define NL_USE_SOLVER_THREAD_POOL      (1)
+#endif
+
 /// \brief  Enable queue statistics.
 ///
 /// Queue statistics come at a performance cost. Although
@@ -53,6 +64,44 @@
 #define NL_USE_QUEUE_STATS             (0)
 #endif
 
+/// \brief  Sample device statistics.
+///
+/// If statistics are enabled, only one in 2^NL_STATS_SAMPLE_SHIFT
+/// device executions is timed. Totals are scaled accordingly. This
+/// keeps the measurement overhead low on large netlists at the expense
+/// of accuracy for devices rarely executed. 0 times every execution.
+///
+
+#ifndef NL_STATS_SAMPLE_SHIFT
+#define NL_STATS_SAMPLE_SHIFT          (0)
+#endif
+
+/// \brief  Use a calendar queue as the main event queue.
+///
+/// Set to 1 to use \ref plib::timed_queue_calendar instead of the
+/// linear queue. Pushes into the near future are sorted only against
+/// entries in the same time bucket. This pays off for netlists with
+/// large queues, e.g. big TTL boards. Small netlists are usually faster
+/// with the linear queue.
+///
+
+#ifndef NL_USE_CALENDAR_QUEUE
+#define NL_USE_CALENDAR_QUEUE          (0)
+#endif
+
+/// \brief  Drive clocks from the main loop.
+///
+/// If enabled, CLOCK devices are not pushed to the queue each edge.
+/// Like MAINCLOCK, the main loop toggles their outputs when the next
+/// edge is due. High frequency clocks, e.g. pixel clocks in TTL games,
+/// otherwise make up most of the queue traffic. Clocks whose feedback
+/// passes through the analog domain are not affected.
+///
+
+#ifndef NL_USE_IMPLICIT_CLOCKS
+#define NL_USE_IMPLICIT_CLOCKS         (1)
+#endif
+
 /// \brief  Store input values in logic_terminal_t.
 ///
 /// Set to 1 to store values in logic_terminal_t instead of
@@ -13,6 +13,8 @@
 #include "plib/putil.h"
 #include "solver/nld_solver.h"
 
+#include <algorithm>
+
 namespace netlist
 {
 	// ----------------------------------------------------------------------------------------
@@ -157,6 +159,7 @@ namespace netlist
 		}
 
 		m_device_factory.insert(m_device_factory.end(), {key, f});
+		m_device_factory_index.insert({key, f});
 	}
 
 	void nlparse_t::register_link(const pstring &sin, const pstring &sout)
@@ -302,10 +305,23 @@ namespace netlist
 
 	bool nlparse_t::device_exists(const pstring &name) const
 	{
-		for (auto &d : m_device_factory)
-			if (d.first == name)
-				return true;
-		return false;
+		return m_device_factory_index.find(name) != m_device_factory_index.end();
+	}
+
+	factory::element_t *nlparse_t::device_factory_element(const pstring &name) const
+	{
+		auto f = m_device_factory_index.find(name);
+		return (f != m_device_factory_index.end()) ? f->second : nullptr;
+	}
+
+	std::vector<pstring> nlparse_t::devices_of_type(const pstring &type) const
+	{
+		std::vector<pstring> ret;
+		for (const auto &d : m_device_factory_index)
+			if (d.second->name() == type)
+				ret.push_back(d.first);
+		std::sort(ret.begin(), ret.end());
+		return ret;
 	}
 
 	bool nlparse_t::parse_stream(plib::psource_t::stream_ptr &&istrm, const pstring &name)
@@ -893,19 +909,27 @@ void setup_t::resolve_inputs()
 	while (!m_links.empty() > 0 && tries >  0)
 	{
 
-		for (auto li = m_links.begin(); li != m_links.end(); )
+		// connect may add links (e.g. proxy power terminals) and
+		// thus invalidate iterators. Use an index instead.
+		// Links not connected are compacted to the front in one pass,
+		// erasing each connected link would be quadratic.
+		std::size_t lo = 0;
+		for (std::size_t li = 0; li < m_links.size(); li++)
 		{
-			const pstring t1s = li->first;
-			const pstring t2s = li->second;
+			const pstring t1s = m_links[li].first;
+			const pstring t2s = m_links[li].second;
 			detail::core_terminal_t *t1 = find_terminal(t1s);
 			detail::core_terminal_t *t2 = find_terminal(t2s);
 
 			//printf("%s %s\n", t1s.c_str(), t2s.c_str());
-			if (connect(*t1, *t2))
-				li = m_links.erase(li);
-			else
-				li++;
+			if (!connect(*t1, *t2))
+			{
+				if (lo != li)
+					m_links[lo] = std::move(m_links[li]);
+				lo++;
+			}
 		}
+		m_links.resize(lo);
 		tries--;
 	}
 	if (tries == 0)
@@ -1139,10 +1163,16 @@ unique_pool_ptr<devices::nld_base_a_to_d_proxy> logic_family_std_proxy_t::create
 const logic_family_desc_t *setup_t::family_from_model(const pstring &model)
 {
 
+	const bool inertial = (m_models.value(model, "INERTIAL") != nlconst::zero());
+	const logic_family_desc_t *base = nullptr;
+
 	if (m_models.value_str(model, "TYPE") == "TTL")
-		return family_TTL();
+		base = family_TTL();
 	if (m_models.value_str(model, "TYPE") == "CD4XXX")
-		return family_CD4XXX();
+		base = family_CD4XXX();
+
+	if (base != nullptr && !inertial)
+		return base;
 
 	auto it = m_nlstate.m_family_cache.find(model);
 	if (it != m_nlstate.m_family_cache.end())
@@ -1150,13 +1180,27 @@ const logic_family_desc_t *setup_t::family_from_model(const pstring &model)
 
 	auto ret = plib::make_unique<logic_family_std_proxy_t>();
 
-	ret->m_fixed_V = m_models.value(model, "FV");
-	ret->m_low_thresh_PCNT = m_models.value(model, "IVL");
-	ret->m_high_thresh_PCNT = m_models.value(model, "IVH");
-	ret->m_low_VO = m_models.value(model, "OVL");
-	ret->m_high_VO = m_models. value(model, "OVH");
-	ret->m_R_low = m_models.value(model, "ORL");
-	ret->m_R_high = m_models.value(model, "ORH");
+	if (base != nullptr)
+	{
+		ret->m_fixed_V = base->m_fixed_V;
+		ret->m_low_thresh_PCNT = base->m_low_thresh_PCNT;
+		ret->m_high_thresh_PCNT = base->m_high_thresh_PCNT;
+		ret->m_low_VO = base->m_low_VO;
+		ret->m_high_VO = base->m_high_VO;
+		ret->m_R_low = base->m_R_low;
+		ret->m_R_high = base->m_R_high;
+	}
+	else
+	{
+		ret->m_fixed_V = m_models.value(model, "FV");
+		ret->m_low_thresh_PCNT = m_models.value(model, "IVL");
+		ret->m_high_thresh_PCNT = m_models.value(model, "IVH");
+		ret->m_low_VO = m_models.value(model, "OVL");
+		ret->m_high_VO = m_models. value(model, "OVH");
+		ret->m_R_low = m_models.value(model, "ORL");
+		ret->m_R_high = m_models.value(model, "ORH");
+	}
+	ret->m_inertial = inertial;
 
 	auto retp = ret.get();
 
@@ -1185,18 +1229,20 @@ plib::psource_t::stream_ptr setup_t::get_data_stream(const pstring &name)
 
 void setup_t::delete_empty_nets()
 {
+	std::unordered_set<const void *> deleted;
 	m_nlstate.nets().erase(
 		std::remove_if(m_nlstate.nets().begin(), m_nlstate.nets().end(),
-			[](owned_pool_ptr<detail::net_t> &x)
+			[&deleted](owned_pool_ptr<detail::net_t> &x)
 			{
 				if (x->num_cons() == 0)
 				{
 					x->state().log().verbose("Deleting net {1} ...", x->name());
-					x->state().run_state_manager().remove_save_items(x.get());
+					deleted.insert(x.get());
 					return true;
 				}
 				return false;
 			}), m_nlstate.nets().end());
+	m_nlstate.run_state_manager().remove_save_items(deleted);
 }
 
 // ----------------------------------------------------------------------------------------
@@ -1287,7 +1333,14 @@ void setup_t::prepare_to_run()
 	// resolve inputs
 	resolve_inputs();
 
+	if (m_netlist_params->m_remove_unused())
+	{
+		log().verbose("looking for unused devices ...");
+		remove_unused_devices();
+	}
+
 	log().verbose("looking for two terms connected to rail nets ...");
+	std::vector<core_device_t *> rail_devices;
 	for (auto & t : m_nlstate.get_device_list<analog::NETLIB_NAME(twoterm)>())
 	{
 		if (t->m_N.net().isRailNet() && t->m_P.net().isRailNet())
@@ -1296,9 +1349,10 @@ void setup_t::prepare_to_run()
 				t->name(), t->m_N.net().name(), t->m_P.net().name()));
 			t->m_N.net().remove_terminal(t->m_N);
 			t->m_P.net().remove_terminal(t->m_P);
-			m_nlstate.remove_device(t);
+			rail_devices.push_back(t);
 		}
 	}
+	m_nlstate.remove_devices(rail_devices);
 
 	log().verbose("initialize solver ...\n");
 
@@ -1321,6 +1375,213 @@ void setup_t::prepare_to_run()
 			dev->set_default_delegate(*term);
 		}
 
+	// purely informational, so don't pay for it unless it's shown
+	if (log().verbose.is_enabled())
+	{
+		log().verbose("looking for independent partitions ...");
+		const std::size_t partitions(analyze_partitions());
+		log().verbose("Found {1} independent partitions", partitions);
+	}
+}
+
+// ----------------------------------------------------------------------------------------
+// Unused device removal
+// ----------------------------------------------------------------------------------------
+
+// Netlists converted from schematics contain many unused gates. These
+// still are updated whenever one of their inputs changes. Logic devices
+// whose outputs are not connected are removed. Removing a device
+// disconnects its inputs which may leave the driving device unused as
+// well. Thus this is repeated until nothing changes.
+//
+// Devices are kept if
+//
+// - they have terminals other than logic terminals and power pins,
+//   A/D proxies feeding removed inputs are removed as well,
+// - they are sub devices or own sub devices,
+// - they have pointer parameters (memory accessed by the host).
+//
+// Constant inputs are not propagated. A device with only constant inputs
+// is updated once at startup and thereafter never again. Folding chains
+// of inverters or buffers would change propagation delays and is
+// left to the netlist author.
+
+void setup_t::remove_unused_devices()
+{
+	std::unordered_map<const core_device_t *, std::vector<detail::core_terminal_t *>> terms;
+	for (auto &t : m_terminals)
+		terms[&t.second->device()].push_back(t.second);
+
+	std::unordered_set<const core_device_t *> keep;
+	for (auto &p : m_params)
+		if (dynamic_cast<const param_ptr_t *>(p.second.param()) != nullptr)
+			keep.insert(&p.second.device());
+
+	// sub devices and their owners
+	std::unordered_set<pstring> owners;
+	for (auto &d : m_nlstate.devices())
+		if (!d.second.is_owned())
+		{
+			keep.insert(d.second.get());
+			pstring prefix;
+			for (auto &s : plib::psplit(d.first, "."))
+			{
+				prefix += s;
+				owners.insert(prefix);
+				prefix += ".";
+			}
+		}
+
+	auto unused = [](const core_device_t *dev, const std::vector<detail::core_terminal_t *> &dt)
+	{
+		const bool is_proxy(dynamic_cast<const devices::nld_base_a_to_d_proxy *>(dev) != nullptr);
+		bool has_input(false);
+		bool has_output(false);
+		for (auto *t : dt)
+		{
+			if (!t->has_net())
+				return false;
+			if (t->is_logic_input() || (is_proxy && t->is_analog_input()))
+				has_input = true;
+			else if (t->is_logic_output())
+			{
+				if (t->net().num_cons() != 0)
+					return false;
+				has_output = true;
+			}
+			else if (!t->is_analog_input() || !t->net().isRailNet())
+				return false;
+		}
+		return has_input && has_output;
+	};
+
+	std::vector<core_device_t *> removed;
+	std::unordered_set<const void *> removed_objects;
+	bool changed(true);
+	while (changed)
+	{
+		changed = false;
+		for (auto &d : m_nlstate.devices())
+		{
+			core_device_t *dev = d.second.get();
+			auto t = terms.find(dev);
+			if (t == terms.end()
+				|| removed_objects.find(dev) != removed_objects.end()
+				|| keep.find(dev) != keep.end()
+				|| owners.find(d.first) != owners.end()
+				|| !unused(dev, t->second))
+				continue;
+
+			log().info(MI_REMOVE_UNUSED_DEVICE_1(dev->name()));
+			for (auto *term : t->second)
+			{
+				if (!term->is_logic_output())
+					term->net().remove_terminal(*term);
+				removed_objects.insert(term);
+			}
+			removed_objects.insert(dev);
+			removed.push_back(dev);
+			changed = true;
+		}
+	}
+
+	if (removed.empty())
+		return;
+
+	// Terminals and parameters must not be found anymore
+	for (auto it = m_terminals.begin(); it != m_terminals.end(); )
+		if (removed_objects.find(it->second) != removed_objects.end())
+			it = m_terminals.erase(it);
+		else
+			++it;
+	for (auto it = m_params.begin(); it != m_params.end(); )
+		if (removed_objects.find(&it->second.device()) != removed_objects.end())
+			it = m_params.erase(it);
+		else
+			++it;
+	for (auto it = m_proxies.begin(); it != m_proxies.end(); )
+		if (removed_objects.find(it->first) != removed_objects.end()
+			|| removed_objects.find(static_cast<core_device_t *>(it->second)) != removed_objects.end())
+			it = m_proxies.erase(it);
+		else
+			++it;
+
+	// nets may be owned by removed outputs, delete them first
+	delete_empty_nets();
+	m_nlstate.run_state_manager().remove_save_items(removed_objects);
+	m_nlstate.remove_devices(removed);
+}
+
+// ----------------------------------------------------------------------------------------
+// Partition analysis
+// ----------------------------------------------------------------------------------------
+
+// Devices are in the same partition if they share a net. Nets driven by
+// constant sources (GND, ANALOG_INPUT, LOGIC_INPUT) do not couple devices.
+// Independent partitions only interact through the event queue and are
+// candidates for parallel execution.
+
+std::size_t setup_t::analyze_partitions()
+{
+	std::unordered_map<const core_device_t *, std::size_t> index;
+	for (auto &d : m_nlstate.devices())
+		index.emplace(d.second.get(), index.size());
+
+	std::vector<std::size_t> parent(index.size());
+	std::vector<bool> coupled(index.size(), false);
+	for (std::size_t i = 0; i < parent.size(); i++)
+		parent[i] = i;
+
+	auto find = [&parent](std::size_t i)
+	{
+		while (parent[i] != i)
+		{
+			parent[i] = parent[parent[i]];
+			i = parent[i];
+		}
+		return i;
+	};
+
+	for (auto &n : m_nlstate.nets())
+	{
+		if (n->isRailNet())
+		{
+			core_device_t *rd = &n->railterminal().device();
+			if (dynamic_cast<devices::NETLIB_NAME(gnd) *>(rd) != nullptr
+				|| dynamic_cast<devices::NETLIB_NAME(analog_input) *>(rd) != nullptr
+				|| dynamic_cast<devices::NETLIB_NAME(logic_input) *>(rd) != nullptr)
+				continue;
+		}
+		std::size_t first(std::numeric_limits<std::size_t>::max());
+		for (auto & term : n->core_terms())
+		{
+			auto it(index.find(&term->device()));
+			if (it == index.end())
+				continue;
+			if (first == std::numeric_limits<std::size_t>::max())
+				first = it->second;
+			else if (it->second != first)
+			{
+				coupled[first] = true;
+				coupled[it->second] = true;
+				parent[find(it->second)] = find(first);
+			}
+		}
+	}
+
+	// count partitions containing devices actually connected to others
+	std::vector<bool> seen(index.size(), false);
+	std::size_t count(0);
+	for (std::size_t i = 0; i < parent.size(); i++)
+	{
+		const std::size_t r(find(i));
+		if (coupled[i] && !seen[r])
+		{
+			seen[r] = true;
+			count++;
+		}
+	}
+	return count;
 }
 
 // ----------------------------------------------------------------------------------------
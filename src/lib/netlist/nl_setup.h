@@ -302,6 +302,21 @@ namespace netlist
 		// used from netlist.cpp (mame)
 		bool device_exists(const pstring &name) const;
 
+		/// \brief Factory element a device was created from
+		///
+		/// \param name Fully qualified device name
+		/// \return element or nullptr if the device is not known, e.g.
+		///   devices created by other devices.
+		///
+		factory::element_t *device_factory_element(const pstring &name) const;
+
+		/// \brief Names of all devices created from a factory element
+		///
+		/// \param type Name of the factory element, e.g. "SOLVER"
+		/// \return sorted list of fully qualified device names
+		///
+		std::vector<pstring> devices_of_type(const pstring &type) const;
+
 		// FIXME: used by source_t - need a different approach at some time
 		bool parse_stream(plib::psource_t::stream_ptr &&istrm, const pstring &name);
 
@@ -349,6 +364,8 @@ namespace netlist
 
 		// need to preserve order of device creation ...
 		std::vector<std::pair<pstring, factory::element_t *>> m_device_factory;
+		// name lookup for m_device_factory
+		std::unordered_map<pstring, factory::element_t *> m_device_factory_index;
 
 
 	private:
@@ -445,6 +462,9 @@ namespace netlist
 		devices::nld_base_proxy *get_a_d_proxy(detail::core_terminal_t &inp);
 		detail::core_terminal_t &resolve_proxy(detail::core_terminal_t &term);
 
+		std::size_t analyze_partitions();
+		void remove_unused_devices();
+
 		std::unordered_map<pstring, detail::core_terminal_t *> m_terminals;
 		std::unordered_map<const terminal_t *, terminal_t *> m_connected_terminals;
 
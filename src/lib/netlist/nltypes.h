@@ -61,6 +61,18 @@ namespace netlist
 
 	using log_type =  plib::plog_base<callbacks_t, NL_DEBUG>;
 
+	/// \brief Entry in a table of statically linked solvers.
+	///
+	/// Tables are written by `nltool --cmd=static --table=name` and are
+	/// terminated by an entry with a nullptr name. The function is cast
+	/// back to the solver's signature when it is looked up by name.
+	///
+	struct static_solver_entry
+	{
+		const char *name;
+		void (*func)();
+	};
+
 	//============================================================
 	//  Types needed by various includes
 	//============================================================
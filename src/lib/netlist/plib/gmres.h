@@ -14,6 +14,7 @@
 #include "vector_ops.h"
 
 #include <algorithm>
+#include <vector>
 
 namespace plib
 {
@@ -42,6 +43,8 @@ namespace plib
 		, m_LU(static_cast<typename mat_type::index_type>(size))
 		, m_ILU_scale(static_cast<std::size_t>(ilu_scale))
 		, m_band_width(bw)
+		, m_reuse_tol(plib::constants<FT>::zero())
+		, m_LU_valid(false)
 		{
 		}
 
@@ -50,6 +53,21 @@ namespace plib
 		{
 			m_mat.build_from_fill_mat(fill, 0);
 			m_LU.build(fill, m_ILU_scale);
+			m_last_A.resize(m_mat.nz_num);
+			m_LU_valid = false;
+		}
+
+		/// \brief Reuse the factorization while the matrix changes slowly.
+		///
+		/// The factorization is only recomputed if a matrix element moved
+		/// by more than tol relative to the values last factorized. A stale
+		/// preconditioner only costs GMRES iterations, never accuracy.
+		/// Zero refactorizes on every solve.
+		///
+		void set_reuse_tolerance(FT tol) noexcept
+		{
+			m_reuse_tol = tol;
+			m_LU_valid = false;
 		}
 
 
@@ -61,6 +79,13 @@ namespace plib
 
 		void precondition()
 		{
+			if (m_reuse_tol > plib::constants<FT>::zero())
+			{
+				if (m_LU_valid && !values_changed())
+					return;
+				std::copy(&m_mat.A[0], &m_mat.A[0] + m_mat.nz_num, m_last_A.begin());
+				m_LU_valid = true;
+			}
 			m_LU.incomplete_LU_factorization(m_mat);
 		}
 
@@ -76,6 +101,18 @@ namespace plib
 		matLU_type              m_LU;
 		std::size_t             m_ILU_scale;
 		std::size_t             m_band_width;
+	private:
+		bool values_changed() const noexcept
+		{
+			for (std::size_t i = 0; i < m_mat.nz_num; i++)
+				if (plib::abs(m_mat.A[i] - m_last_A[i]) > m_reuse_tol * plib::abs(m_last_A[i]))
+					return true;
+			return false;
+		}
+
+		FT                      m_reuse_tol;
+		bool                    m_LU_valid;
+		std::vector<FT>         m_last_A;
 	};
 
 	template <typename FT, int SIZE>
@@ -224,10 +261,22 @@ namespace plib
 			, m_ht(RESTART +1, RESTART)
 			, m_v(RESTART + 1, size)
 			, m_size(size)
+			, m_restart(RESTART)
+			, m_rho(plib::constants<FT>::zero())
 			, m_use_more_precise_stop_condition(false)
 			{
 			}
 
+		/// \brief Set the number of iterations before GMRES restarts.
+		///
+		/// Values are limited to the range 1 to RESTART.
+		///
+		void set_restart(std::size_t restart) noexcept
+		{
+			m_restart = std::max(plib::constants<std::size_t>::one(),
+				std::min(restart, static_cast<std::size_t>(RESTART)));
+		}
+
 		void givens_mult( const FT c, const FT s, FT & g0, FT & g1 )
 		{
 			const FT g0_last(g0);
@@ -239,11 +288,11 @@ namespace plib
 		std::size_t size() const { return (SIZE<=0) ? m_size : static_cast<std::size_t>(SIZE); }
 
 		template <int k, typename OPS, typename VT>
-		bool do_k(OPS &ops, VT &x, std::size_t &itr_used, FT rho_delta, bool dummy)
+		bool do_k(OPS &ops, VT &x, std::size_t &itr_used, std::size_t itr_max, FT rho_delta, bool dummy)
 		{
 			plib::unused_var(dummy);
 			//printf("%d\n", k);
-			if (do_k<k-1, OPS>(ops, x, itr_used, rho_delta, do_khelper<k-1>::value))
+			if (do_k<k-1, OPS>(ops, x, itr_used, itr_max, rho_delta, do_khelper<k-1>::value))
 				return true;
 
 			const std::size_t kp1 = k + 1;
@@ -280,8 +329,9 @@ namespace plib
 			// FIXME ..
 			itr_used = itr_used + 1;
 
-			if (rho <= rho_delta || k == RESTART-1)
+			if (rho <= rho_delta || kp1 >= m_restart || itr_used >= itr_max)
 			{
+				m_rho = rho;
 				// Solve the system H * y = g
 				// x += m_v[j] * m_y[j]
 				for (std::size_t i = k + 1; i-- > 0;)
@@ -300,9 +350,9 @@ namespace plib
 		}
 
 		template <int k, typename OPS, typename VT>
-		bool do_k(OPS &ops, VT &x, std::size_t &itr_used, FT rho_delta, float dummy)
+		bool do_k(OPS &ops, VT &x, std::size_t &itr_used, std::size_t itr_max, FT rho_delta, float dummy)
 		{
-			plib::unused_var(ops, x, itr_used, rho_delta, dummy);
+			plib::unused_var(ops, x, itr_used, itr_max, rho_delta, dummy);
 			return false;
 		}
 
@@ -399,11 +449,14 @@ namespace plib
 
 				vec_mult_scalar(n, m_v[0], residual, reciprocal(rho));
 
-				if (do_k<RESTART-1>(ops, x, itr_used, rho_delta, true))
-					// converged
-					break;
+				// Returns after convergence, m_restart iterations
+				// or itr_max iterations in total.
+				do_k<RESTART-1>(ops, x, itr_used, itr_max, rho_delta, true);
+				if (m_rho <= rho_delta)
+					return itr_used;
 			}
-			return itr_used;
+			// signal failure to converge
+			return itr_max + 1;
 		}
 
 	private:
@@ -422,6 +475,8 @@ namespace plib
 		plib::parray2D<float_type, RESTART + 1, SIZE> m_v;  // mr + 1, n
 
 		std::size_t m_size;
+		std::size_t m_restart;
+		float_type m_rho;
 
 		bool m_use_more_precise_stop_condition;
 
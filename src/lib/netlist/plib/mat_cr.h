@@ -284,6 +284,17 @@ namespace plib
 			return { fill_max, ops };
 		}
 
+		/// \brief Use a previously extended fill matrix.
+		///
+		/// \p fill must be the result of gaussian_extend_fill_mat for the
+		/// same matrix structure, e.g. loaded from a cache.
+		///
+		template <typename M>
+		void use_extended_fill_mat(const M &fill)
+		{
+			build_parallel_gaussian_execution_scheme(fill);
+		}
+
 		template <typename V>
 		void gaussian_elimination(V & RHS)
 		{
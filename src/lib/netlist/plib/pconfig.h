@@ -97,6 +97,23 @@
 #define NVCCBUILD (0)
 #endif
 
+/// \brief Use compiler vector extensions in vector operations.
+///
+/// GCC and clang provide generic vector types which are mapped to
+/// SSE/AVX on x86 and NEON on ARM depending on the target flags. If
+/// enabled, selected vector operations on float and double are
+/// implemented using these types.
+///
+/// Defaults to 1 for GCC and clang builds.
+///
+#ifndef PUSE_VECTOR_EXTENSIONS
+#if defined(__GNUC__) && !defined(_MSC_VER) && !(NVCCBUILD)
+#define PUSE_VECTOR_EXTENSIONS (1)
+#else
+#define PUSE_VECTOR_EXTENSIONS (0)
+#endif
+#endif
+
 // ============================================================
 //  Check for CPP Version
 //
@@ -57,6 +57,11 @@ public:
 		m_sym = dl.getsym<calltype>(name);
 	}
 
+	void load(calltype sym) noexcept
+	{
+		m_sym = sym;
+	}
+
 	R operator ()(Args&&... args) const
 	{
 		return m_sym(std::forward<Args>(args)...);
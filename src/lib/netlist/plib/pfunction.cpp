@@ -9,6 +9,7 @@
 #include "pstrutil.h"
 #include "putil.h"
 
+#include <algorithm>
 #include <stack>
 #include <type_traits>
 
@@ -36,6 +37,7 @@ namespace plib {
 	{
 		m_precompiled.clear();
 		int stk = 0;
+		int max_stk = 0;
 
 		for (const pstring &cmd : cmds)
 		{
@@ -82,10 +84,71 @@ namespace plib {
 			}
 			if (stk < 1)
 				throw pexception(plib::pfmt("pfunction: stack underflow on token <{1}> in <{2}>")(cmd)(expr));
+			max_stk = std::max(max_stk, stk);
 			m_precompiled.push_back(rc);
 		}
 		if (stk != 1)
 			throw pexception(plib::pfmt("pfunction: stack count different to one on <{2}>")(expr));
+		if (static_cast<std::size_t>(max_stk) > MAX_STACK)
+			throw pexception(plib::pfmt("pfunction: stack overflow in <{1}>")(expr));
+		optimize();
+	}
+
+	template <typename NT>
+	NT pfunction<NT>::eval_binary(rpn_cmd cmd, NT a, NT b) noexcept
+	{
+		switch (cmd)
+		{
+			case ADD:  return a + b;
+			case MULT: return a * b;
+			case SUB:  return a - b;
+			case DIV:  return a / b;
+			default:   return plib::pow(a, b);
+		}
+	}
+
+	template <typename NT>
+	void pfunction<NT>::optimize() noexcept
+	{
+		std::vector<rpn_inst> opt;
+		for (const auto &rc : m_precompiled)
+		{
+			const std::size_t n = opt.size();
+			const bool c1(n >= 1 && opt[n-1].m_cmd == PUSH_CONST);
+			const bool c2(c1 && n >= 2 && opt[n-2].m_cmd == PUSH_CONST);
+			switch (rc.m_cmd)
+			{
+				case ADD:
+				case MULT:
+				case SUB:
+				case DIV:
+				case POW:
+					if (c2)
+					{
+						opt[n-2].m_param = eval_binary(rc.m_cmd, opt[n-2].m_param, opt[n-1].m_param);
+						opt.pop_back();
+					}
+					else if (c1)
+						opt[n-1].m_cmd = static_cast<rpn_cmd>(ADD_CONST + (rc.m_cmd - ADD));
+					else
+						opt.push_back(rc);
+					break;
+				case SIN:
+				case COS:
+				case TRUNC:
+					if (c1)
+						opt[n-1].m_param = (rc.m_cmd == SIN) ? plib::sin(opt[n-1].m_param)
+							: (rc.m_cmd == COS) ? plib::cos(opt[n-1].m_param)
+							: plib::trunc(opt[n-1].m_param);
+					else
+						opt.push_back(rc);
+					break;
+				default:
+					opt.push_back(rc);
+					break;
+			}
+		}
+		m_precompiled = std::move(opt);
 	}
 
 	static int get_prio(const pstring &v)
@@ -265,7 +328,7 @@ namespace plib {
 	template <typename NT>
 	NT pfunction<NT>::evaluate(const std::vector<NT> &values) noexcept
 	{
-		std::array<NT, 20> stack = { plib::constants<NT>::zero() };
+		std::array<NT, MAX_STACK> stack; // NOLINT(cppcoreguidelines-pro-type-member-init)
 		unsigned ptr = 0;
 		stack[0] = plib::constants<NT>::zero();
 		for (auto &rc : m_precompiled)
@@ -280,6 +343,11 @@ namespace plib {
 				OP(SIN,  0, plib::sin(ST2))
 				OP(COS,  0, plib::cos(ST2))
 				OP(TRUNC,  0, plib::trunc(ST2))
+				OP(ADD_CONST,  0, ST2 + rc.m_param)
+				OP(MULT_CONST, 0, ST2 * rc.m_param)
+				OP(SUB_CONST,  0, ST2 - rc.m_param)
+				OP(DIV_CONST,  0, ST2 / rc.m_param)
+				OP(POW_CONST,  0, plib::pow(ST2, rc.m_param))
 				case RAND:
 					stack[ptr++] = lfsr_random<NT>(m_lfsr);
 					break;
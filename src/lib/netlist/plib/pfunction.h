@@ -40,7 +40,14 @@ namespace plib {
 			RAND, /// random number between 0 and 1
 			TRUNC,
 			PUSH_CONST,
-			PUSH_INPUT
+			PUSH_INPUT,
+			// binary operations with a constant second operand,
+			// same order as ADD to POW above
+			ADD_CONST,
+			MULT_CONST,
+			SUB_CONST,
+			DIV_CONST,
+			POW_CONST
 		};
 		struct rpn_inst
 		{
@@ -104,6 +111,15 @@ namespace plib {
 		void compile_postfix(const std::vector<pstring> &inputs,
 				const std::vector<pstring> &cmds, const pstring &expr);
 
+		/// \brief Fold constant sub expressions and fuse constant operands
+		///        into binary operations.
+		///
+		void optimize() noexcept;
+
+		static NT eval_binary(rpn_cmd cmd, NT a, NT b) noexcept;
+
+		static constexpr const std::size_t MAX_STACK = 20;
+
 		std::vector<rpn_inst> m_precompiled; //!< precompiled expression
 
 		std::uint16_t m_lfsr; //!< lfsr used for generating random numbers
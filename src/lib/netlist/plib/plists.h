@@ -10,11 +10,14 @@
 
 #include "palloc.h"
 #include "pchrono.h"
+#include "pexception.h"
 #include "pstring.h"
 
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <cstdint>
+#include <iterator>
 #include <mutex>
 #include <type_traits>
 #include <utility>
@@ -516,6 +519,366 @@ namespace plib {
 		pperfcount_t<true> m_prof_retime;
 	};
 
+	/// \brief calendar (time-bucketed ring) queue.
+	///
+	/// The ring covers a window of BUCKETS consecutive time slots of
+	/// 2^SHIFT raw time units each. Entries within the window are pushed
+	/// into the bucket of their slot. Buckets are small sorted vectors, thus
+	/// near-future pushes - the common case for gate propagation - only
+	/// need to sort against the few entries sharing the same slot.
+	/// Entries beyond the window are kept in a sorted overflow list and
+	/// migrate into the ring as the window advances.
+	///
+	/// Use TS = true for a threadsafe queue
+	///
+	template <class T, bool TS, std::size_t BUCKETS = 512, unsigned SHIFT = 7>
+	class timed_queue_calendar : nocopyassignmove
+	{
+		static_assert((BUCKETS & (BUCKETS - 1)) == 0, "BUCKETS must be a power of 2");
+	public:
+
+		explicit timed_queue_calendar(const std::size_t list_size)
+		: m_buckets(BUCKETS)
+		{
+			m_far.reserve(list_size);
+			clear();
+		}
+
+		std::size_t capacity() const noexcept { return m_far.capacity(); }
+		bool empty() const noexcept { return (m_ring_size == 0); }
+
+		template<bool KEEPSTAT>
+		void push(T && e) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			insert<KEEPSTAT>(std::move(e));
+			if (KEEPSTAT)
+				m_prof_call.inc();
+		}
+
+		void pop() noexcept
+		{
+			auto &b(m_buckets[m_base & MASK]);
+			b.pop_back();
+			--m_ring_size;
+			if (b.empty())
+				next_bucket();
+		}
+
+		const T &top() const noexcept { return m_buckets[m_base & MASK].back(); }
+
+		template <bool KEEPSTAT, class R>
+		void remove(const R &elem) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			if (KEEPSTAT)
+				m_prof_remove.inc();
+			erase(elem);
+		}
+
+		template <bool KEEPSTAT, class R>
+		void retime(R && elem) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			if (KEEPSTAT)
+				m_prof_retime.inc();
+			if (erase(elem)) // partial equal!
+				insert<KEEPSTAT>(T(std::forward<R>(elem)));
+		}
+
+		void clear() noexcept
+		{
+			lock_guard_type lck(m_lock);
+			for (auto &b : m_buckets)
+				b.clear();
+			m_far.clear();
+			m_ring_size = 0;
+			m_base = 0;
+			m_max_slot = 0;
+		}
+
+		// save state support & mame disasm
+
+		std::size_t size() const noexcept { return m_ring_size + m_far.size(); }
+
+		/// \brief Access entries in the same order as timed_queue_linear.
+		///
+		/// Index 0 is the entry scheduled last, index size()-1 is top().
+		/// This walks the buckets and is not meant to be used from
+		/// time critical code.
+		///
+		const T & operator[](std::size_t index) const noexcept
+		{
+			if (index < m_far.size())
+				return m_far[index];
+			index -= m_far.size();
+			for (std::uint64_t s = m_max_slot; ; --s)
+			{
+				const auto &b(m_buckets[s & MASK]);
+				if (index < b.size())
+					return b[index];
+				index -= b.size();
+			}
+		}
+
+	private:
+		static constexpr const std::uint64_t MASK = BUCKETS - 1;
+
+		static std::uint64_t slot(const T &e) noexcept
+		{
+			return static_cast<std::uint64_t>(e.exec_time().as_raw()) >> SHIFT;
+		}
+
+		// insert sorted, last element has lowest time
+		template<bool KEEPSTAT>
+		void insert_sorted(std::vector<T> &v, T && e) noexcept
+		{
+			v.push_back(std::move(e));
+			for (std::size_t i = v.size() - 1; i > 0 && v[i-1] < v[i]; --i)
+			{
+				std::swap(v[i-1], v[i]);
+				if (KEEPSTAT)
+					m_prof_sortmove.inc();
+			}
+		}
+
+		template<bool KEEPSTAT>
+		void insert_ring(std::uint64_t s, T && e) noexcept
+		{
+			insert_sorted<KEEPSTAT>(m_buckets[s & MASK], std::move(e));
+			++m_ring_size;
+			m_max_slot = std::max(m_max_slot, s);
+		}
+
+		template<bool KEEPSTAT>
+		void insert(T && e) noexcept
+		{
+			const std::uint64_t s(slot(e));
+			if (m_ring_size == 0)
+			{
+				// far list is empty as well
+				m_base = s;
+				m_max_slot = s;
+			}
+			else if (s < m_base)
+				rewind(s);
+			if (s < m_base + BUCKETS)
+				insert_ring<KEEPSTAT>(s, std::move(e));
+			else
+				insert_sorted<KEEPSTAT>(m_far, std::move(e));
+		}
+
+		// move window start back to slot s
+		void rewind(std::uint64_t s) noexcept
+		{
+			const std::uint64_t old_base(m_base);
+			const std::uint64_t lim(s + BUCKETS);
+			m_base = s;
+			// slots now beyond the window move to the far list. Their
+			// times are lower than those already on the far list and we
+			// walk them from high to low, thus appending keeps it sorted.
+			for (std::uint64_t i = m_max_slot; i >= lim && i >= old_base; --i)
+			{
+				auto &b(m_buckets[i & MASK]);
+				m_ring_size -= b.size();
+				std::move(b.begin(), b.end(), std::back_inserter(m_far));
+				b.clear();
+			}
+			m_max_slot = std::min(m_max_slot, lim - 1);
+		}
+
+		// advance window until bucket at window start is non-empty
+		void next_bucket() noexcept
+		{
+			if (m_ring_size == 0)
+			{
+				if (m_far.empty())
+					return;
+				m_base = slot(m_far.back());
+				m_max_slot = m_base;
+			}
+			else
+				++m_base;
+			migrate();
+			while (m_buckets[m_base & MASK].empty())
+			{
+				++m_base;
+				migrate();
+			}
+		}
+
+		// move entries now within the window from the far list to the ring
+		void migrate() noexcept
+		{
+			while (!m_far.empty())
+			{
+				const std::uint64_t s(slot(m_far.back()));
+				if (s >= m_base + BUCKETS)
+					break;
+				insert_ring<false>(s, std::move(m_far.back()));
+				m_far.pop_back();
+			}
+		}
+
+		template <class R>
+		bool erase(const R &elem) noexcept
+		{
+			for (std::uint64_t s = m_base; s <= m_max_slot && m_ring_size > 0; ++s)
+			{
+				auto &b(m_buckets[s & MASK]);
+				for (std::size_t i = b.size(); i-- > 0; )
+				{
+					// == operator ignores time!
+					if (b[i] == elem)
+					{
+						b.erase(b.begin() + static_cast<std::ptrdiff_t>(i));
+						--m_ring_size;
+						if (s == m_base && b.empty())
+							next_bucket();
+						return true;
+					}
+				}
+			}
+			for (std::size_t i = m_far.size(); i-- > 0; )
+			{
+				if (m_far[i] == elem)
+				{
+					m_far.erase(m_far.begin() + static_cast<std::ptrdiff_t>(i));
+					return true;
+				}
+			}
+			return false;
+		}
+
+		using mutex_type = pspin_mutex<TS>;
+		using lock_guard_type = std::lock_guard<mutex_type>;
+
+		mutex_type              m_lock;
+		PALIGNAS_CACHELINE()
+		std::uint64_t           m_base;
+		std::uint64_t           m_max_slot;
+		std::size_t             m_ring_size;
+		std::vector<std::vector<T>> m_buckets;
+		std::vector<T>          m_far;
+
+	public:
+		// profiling
+		pperfcount_t<true> m_prof_sortmove;
+		pperfcount_t<true> m_prof_call;
+		pperfcount_t<true> m_prof_remove;
+		pperfcount_t<true> m_prof_retime;
+	};
+
+	// ----------------------------------------------------------------------------------------
+	// timed queue staging
+	// ----------------------------------------------------------------------------------------
+
+	/// \brief Per-producer staging buffers for timed queue operations.
+	///
+	/// Producers running in parallel record push and remove operations
+	/// into their own buffer. Since each producer only touches its own
+	/// buffer no locks or atomics are needed.
+	/// A single thread replays the operations into the target queue by
+	/// calling merge once the parallel section has finished.
+	///
+	/// Operations recorded by one producer are replayed in the order they
+	/// were recorded. Different producers must not operate on the same
+	/// queue objects.
+	///
+	/// \tparam T queue entry type
+	///
+	template <class T>
+	class timed_queue_staging_t : nocopyassignmove
+	{
+	public:
+
+		timed_queue_staging_t() = default;
+		~timed_queue_staging_t() noexcept = default;
+
+		/// \brief Make sure there is a buffer for each producer.
+		///
+		/// Each buffer is given room for ops operations so that push and
+		/// remove never allocate. Must not be called while producers are
+		/// active.
+		///
+		void reserve_producers(std::size_t producers, std::size_t ops)
+		{
+			if (producers > m_buffers.size())
+				m_buffers.resize(producers);
+			for (auto &b : m_buffers)
+				b.m_ops.reserve(ops);
+		}
+
+		std::size_t producers() const noexcept { return m_buffers.size(); }
+
+		/// \brief Record a push.
+		///
+		/// The capacity reserved by reserve_producers must not be exceeded.
+		///
+		void push(std::size_t producer, T && e) noexcept
+		{
+			auto &ops(m_buffers[producer].m_ops);
+			passert_always_msg(ops.size() < ops.capacity(), "timed_queue_staging_t: capacity exceeded");
+			ops.emplace_back(op_e::PUSH, std::move(e));
+		}
+
+		/// \brief Record a remove.
+		///
+		/// The capacity reserved by reserve_producers must not be exceeded.
+		///
+		void remove(std::size_t producer, T && e) noexcept
+		{
+			auto &ops(m_buffers[producer].m_ops);
+			passert_always_msg(ops.size() < ops.capacity(), "timed_queue_staging_t: capacity exceeded");
+			ops.emplace_back(op_e::REMOVE, std::move(e));
+		}
+
+		bool empty() const noexcept
+		{
+			for (auto &b : m_buffers)
+				if (!b.m_ops.empty())
+					return false;
+			return true;
+		}
+
+		/// \brief Replay all staged operations into queue q.
+		///
+		template <bool KEEPSTAT, class Q>
+		void merge(Q &q) noexcept
+		{
+			for (auto &b : m_buffers)
+			{
+				for (auto &op : b.m_ops)
+				{
+					if (op.first == op_e::PUSH)
+						q.template push<KEEPSTAT>(std::move(op.second));
+					else
+						q.template remove<KEEPSTAT>(op.second);
+				}
+				b.m_ops.clear();
+			}
+		}
+
+	private:
+		enum class op_e
+		{
+			PUSH,
+			REMOVE
+		};
+
+		struct buffer_t
+		{
+			// keep producers on separate cache lines
+			PALIGNAS_CACHELINE()
+			std::vector<std::pair<op_e, T>> m_ops;
+		};
+
+		std::vector<buffer_t> m_buffers;
+	};
+
 } // namespace plib
 
 #endif // PLISTS_H_
@@ -12,7 +12,10 @@
 #include "ptypes.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
 
 #if (PUSE_FLOAT128)
@@ -415,6 +418,65 @@ namespace plib
 		return (m != 0 && n != 0) ? (plib::abs(m) / gcd(m, n)) * plib::abs(n) : 0;
 	}
 
+	/// \brief Tabulated exponential function
+	///
+	/// exp(x) is split into 2^k * 2^f with integer k and 0 <= f < 1.
+	/// 2^f is linearly interpolated from a table with 256 entries, 2^k
+	/// is assembled directly in the exponent of an IEEE 754 double.
+	///
+	/// The maximum relative error compared to std::exp is
+	/// (ln(2)/256)^2/8 < 1e-6. Arguments are clamped to [-708, 709],
+	/// i.e. the result neither overflows nor becomes denormal.
+	///
+	/// Calculation is always done in double precision.
+	///
+	class fast_exp_t
+	{
+	public:
+		static constexpr const std::size_t BITS = 8;
+		static constexpr const std::size_t SIZE = 1 << BITS;
+
+		fast_exp_t() noexcept
+		{
+			for (std::size_t i = 0; i < SIZE; i++)
+			{
+				m_tab[i] = std::exp2(static_cast<double>(i) / static_cast<double>(SIZE));
+				m_dtab[i] = std::exp2(static_cast<double>(i + 1) / static_cast<double>(SIZE)) - m_tab[i];
+			}
+		}
+
+		double operator()(double x) const noexcept
+		{
+			x = std::min(709.0, std::max(-708.0, x));
+			const double y = x * (1.442695040888963407359924681001892137 * static_cast<double>(SIZE));
+			const std::int64_t n = static_cast<std::int64_t>(y) - (y < 0.0 ? 1 : 0);
+			const std::size_t idx = static_cast<std::size_t>(n) & (SIZE - 1);
+			const auto e = static_cast<std::uint64_t>((n >> BITS) + 1023) << 52;
+			double scale;
+			std::memcpy(&scale, &e, sizeof(scale));
+			return (m_tab[idx] + (y - static_cast<double>(n)) * m_dtab[idx]) * scale;
+		}
+
+	private:
+		std::array<double, SIZE> m_tab;
+		std::array<double, SIZE> m_dtab;
+	};
+
+	/// \brief fast approximation of the exp function
+	///
+	/// See fast_exp_t for accuracy bounds.
+	///
+	/// \tparam T type of the argument
+	/// \param  v argument
+	/// \return approximation of exp(v)
+	///
+	template <typename T>
+	static inline T fast_exp(T v) noexcept
+	{
+		static const fast_exp_t fe;
+		return static_cast<T>(fe(static_cast<double>(v)));
+	}
+
 	static_assert(noexcept(constants<double>::one()) == true, "Not evaluated as constexpr");
 
 } // namespace plib
@@ -17,7 +17,6 @@
 
 #include <algorithm>
 #include <memory>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -27,6 +26,16 @@ namespace plib {
 	//  Memory pool
 	//============================================================
 
+	/// \brief Arena based memory pool
+	///
+	/// Memory is taken from large blocks. Each allocation is preceded by a
+	/// pointer to its block, thus deallocation does not need any global
+	/// lookup and different pools do not share any state. Pools used by
+	/// different threads therefore do not contend.
+	///
+	/// Blocks without allocations are kept for reuse. All blocks are
+	/// released at once when the pool is destroyed.
+	///
 	class mempool
 	{
 	public:
@@ -56,7 +65,6 @@ namespace plib {
 			{
 				if (b->m_num_alloc != 0)
 				{
-					plib::perrlogger("Found {} info blocks\n", sinfo().size());
 					plib::perrlogger("Found block with {} dangling allocations\n", b->m_num_alloc);
 				}
 				aligned_arena::free(b);
@@ -77,7 +85,8 @@ namespace plib {
 			if (align < m_min_align)
 				align = m_min_align;
 
-			size_t rs = size + align;
+			// room for alignment and the block pointer
+			size_t rs = size + align + sizeof(block *);
 			for (auto &bs : m_blocks)
 			{
 				if (bs->m_free > rs)
@@ -92,10 +101,11 @@ namespace plib {
 			}
 			b->m_free -= rs;
 			b->m_num_alloc++;
-			void *ret = reinterpret_cast<void *>(b->m_data + b->m_cur);
-			auto capacity(rs);
+			void *ret = reinterpret_cast<void *>(b->m_data + b->m_cur + sizeof(block *));
+			auto capacity(rs - sizeof(block *));
 			ret = std::align(align, size, ret, capacity);
-			sinfo().insert({ ret, info(b, b->m_cur)});
+			// store block pointer in front of the allocation
+			*(reinterpret_cast<block **>(ret) - 1) = b;
 			rs -= (capacity - size);
 			b->m_cur += rs;
 			m_stat_cur_alloc += size;
@@ -106,11 +116,7 @@ namespace plib {
 
 		static void deallocate(void *ptr, size_t size)
 		{
-
-			auto it = sinfo().find(ptr);
-			if (it == sinfo().end())
-				plib::terminate("mempool::free - pointer not found");
-			block *b = it->second.m_block;
+			block *b = *(reinterpret_cast<block **>(ptr) - 1);
 			if (b->m_num_alloc == 0)
 				plib::terminate("mempool::free - double free was called");
 			else
@@ -121,14 +127,10 @@ namespace plib {
 				//printf("Freeing in block %p %lu\n", b, b->m_num_alloc);
 				if (b->m_num_alloc == 0)
 				{
-					auto itb = std::find(mp.m_blocks.begin(), mp.m_blocks.end(), b);
-					if (itb == mp.m_blocks.end())
-						plib::terminate("mempool::free - block not found");
-
-					mp.m_blocks.erase(itb);
-					aligned_arena::free(b);
+					// recycle the block
+					b->m_cur = 0;
+					b->m_free = b->m_size;
 				}
-				sinfo().erase(it);
 			}
 		}
 
@@ -186,6 +188,7 @@ namespace plib {
 			{
 				min_bytes = std::max(mp.m_min_alloc, min_bytes);
 				m_free = min_bytes;
+				m_size = min_bytes;
 				size_type alloc_bytes = (min_bytes + mp.m_min_align); // - 1); // & ~(mp.m_min_align - 1);
 				//m_data_allocated = ::operator new(alloc_bytes);
 				m_data_allocated = new char[alloc_bytes];
@@ -206,22 +209,13 @@ namespace plib {
 
 			size_type m_num_alloc;
 			size_type m_free;
+			size_type m_size;
 			size_type m_cur;
 			char *m_data;
 			char *m_data_allocated;
 			mempool &m_mempool;
 		};
 
-		struct info
-		{
-			info(block *b, size_type p) : m_block(b), m_pos(p) { }
-			~info() = default;
-			COPYASSIGNMOVE(info, default)
-
-			block * m_block;
-			size_type m_pos;
-		};
-
 		block * new_block(size_type min_bytes)
 		{
 			auto *b = aligned_arena::alloc<block>(*this, min_bytes);
@@ -229,12 +223,6 @@ namespace plib {
 			return b;
 		}
 
-		static std::unordered_map<void *, info> &sinfo()
-		{
-			static std::unordered_map<void *, info> spinfo;
-			return spinfo;
-		}
-
 		size_t m_min_alloc;
 		size_t m_min_align;
 
@@ -13,7 +13,11 @@
 #include "pconfig.h"
 #include "ptypes.h"
 
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #if PHAS_OPENMP
 #include "omp.h"
@@ -74,6 +78,142 @@ inline std::size_t get_max_threads() noexcept
 #endif
 }
 
+namespace detail {
+
+	inline std::size_t &pool_thread_num() noexcept
+	{
+		static thread_local std::size_t num = 0;
+		return num;
+	}
+
+} // namespace detail
+
+inline std::size_t get_thread_num() noexcept
+{
+#if PHAS_OPENMP && PUSE_OPENMP
+	if (omp_in_parallel())
+		return static_cast<std::size_t>(omp_get_thread_num());
+#endif
+	return detail::pool_thread_num();
+}
+
+/// \brief Persistent pool of worker threads
+///
+/// The threads are created once and wait for work. This avoids the
+/// fork/join cost of an OpenMP parallel section per call. The calling
+/// thread takes part in the work as thread number 0. Within the work
+/// function get_thread_num() returns the number of the executing thread.
+///
+class thread_pool_t
+{
+public:
+	/// \brief Create a thread pool
+	///
+	/// \param threads number of threads including the calling thread.
+	///
+	explicit thread_pool_t(std::size_t threads)
+	: m_job(nullptr)
+	, m_job_data(nullptr)
+	, m_start(0)
+	, m_end(0)
+	, m_gen(0)
+	, m_pending(0)
+	, m_stop(false)
+	{
+		for (std::size_t i = 1; i < threads; i++)
+			m_threads.emplace_back(&thread_pool_t::worker, this, i);
+	}
+
+	~thread_pool_t()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_cv_start.notify_all();
+		for (auto &t : m_threads)
+			t.join();
+	}
+
+	thread_pool_t(const thread_pool_t &) = delete;
+	thread_pool_t &operator=(const thread_pool_t &) = delete;
+	thread_pool_t(thread_pool_t &&) = delete;
+	thread_pool_t &operator=(thread_pool_t &&) = delete;
+
+	std::size_t size() const noexcept { return m_threads.size() + 1; }
+
+	/// \brief Call what(i) for all i in [start, end)
+	///
+	/// Indices are distributed round robin, i.e. for an unchanged range
+	/// an index is always processed by the same thread.
+	/// Returns after all calls completed.
+	///
+	template <typename T>
+	void for_static(std::size_t start, std::size_t end, const T &what) noexcept
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_job = &call<T>;
+			m_job_data = &what;
+			m_start = start;
+			m_end = end;
+			m_pending = m_threads.size();
+			++m_gen;
+		}
+		m_cv_start.notify_all();
+		run(0);
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_cv_done.wait(lock, [this]() { return m_pending == 0; });
+	}
+
+private:
+	using job_func = void (*)(const void *, std::size_t);
+
+	template <typename T>
+	static void call(const void *what, std::size_t i)
+	{
+		(*static_cast<const T *>(what))(i);
+	}
+
+	void run(std::size_t tnum) noexcept
+	{
+		const std::size_t n = size();
+		for (std::size_t i = m_start + tnum; i < m_end; i += n)
+			m_job(m_job_data, i);
+	}
+
+	void worker(std::size_t tnum) noexcept
+	{
+		detail::pool_thread_num() = tnum;
+		std::size_t gen = 0;
+		std::unique_lock<std::mutex> lock(m_mutex);
+		for (;;)
+		{
+			m_cv_start.wait(lock, [this, gen]() { return m_stop || m_gen != gen; });
+			if (m_stop)
+				return;
+			gen = m_gen;
+			lock.unlock();
+			run(tnum);
+			lock.lock();
+			if (--m_pending == 0)
+				m_cv_done.notify_one();
+		}
+	}
+
+	std::vector<std::thread> m_threads;
+	std::mutex m_mutex;
+	std::condition_variable m_cv_start;
+	std::condition_variable m_cv_done;
+	job_func m_job;
+	const void *m_job_data;
+	std::size_t m_start;
+	std::size_t m_end;
+	std::size_t m_gen;
+	std::size_t m_pending;
+	bool m_stop;
+};
+
 
 // ----------------------------------------------------------------------------------------
 // pdynlib: dynamic loading of libraries  ...
@@ -12,8 +12,10 @@
 #include "pstring.h"
 #include "ptypes.h"
 
+#include <algorithm>
 #include <array>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 // ----------------------------------------------------------------------------------------
@@ -146,20 +148,18 @@ public:
 
 	void remove_save_items(const void *owner)
 	{
-		auto i = m_save.end();
-		while (i != m_save.begin())
-		{
-			i--;
-			if (i->owner() == owner)
-				i = m_save.erase(i);
-		}
-		i = m_custom.end();
-		while (i > m_custom.begin())
-		{
-			i--;
-			if (i->owner() == owner)
-				i = m_custom.erase(i);
-		}
+		remove_save_items_if([owner](const void *o) { return o == owner; });
+	}
+
+	/// \brief Remove the items of all owners in one pass
+	///
+	/// Removing owners one by one is quadratic in the number of
+	/// items.
+	///
+	void remove_save_items(const std::unordered_set<const void *> &owners)
+	{
+		if (!owners.empty())
+			remove_save_items_if([&owners](const void *o) { return owners.find(o) != owners.end(); });
 	}
 
 	std::vector<const entry_t *> save_list() const
@@ -173,6 +173,14 @@ public:
 protected:
 
 private:
+	template <typename P>
+	void remove_save_items_if(P pred)
+	{
+		auto f = [&pred](const entry_t &e) { return pred(e.owner()); };
+		m_save.erase(std::remove_if(m_save.begin(), m_save.end(), f), m_save.end());
+		m_custom.erase(std::remove_if(m_custom.begin(), m_custom.end(), f), m_custom.end());
+	}
+
 	entry_t::list_t m_save;
 	entry_t::list_t m_custom;
 
@@ -205,7 +205,7 @@ namespace plib {
 	{
 		// skip ws
 		pstring::value_type c = getc();
-		while (m_whitespace.find(c) != pstring::npos)
+		while (is_whitespace(c))
 		{
 			c = getc();
 			if (eof())
@@ -215,16 +215,16 @@ namespace plib {
 		}
 		if (m_support_line_markers && c == '#')
 			return token_t(token_type::LINEMARKER, "#");
-		else if (m_number_chars_start.find(c) != pstring::npos)
+		else if (is_number_start_char(c))
 		{
 			// read number while we receive number or identifier chars
 			// treat it as an identifier when there are identifier chars in it
 			token_type ret = token_type::NUMBER;
 			pstring tokstr = "";
 			while (true) {
-				if (m_identifier_chars.find(c) != pstring::npos && m_number_chars.find(c) == pstring::npos)
+				if (is_identifier_char(c) && !is_number_char(c))
 					ret = token_type::IDENTIFIER;
-				else if (m_number_chars.find(c) == pstring::npos)
+				else if (!is_number_char(c))
 					break;
 				tokstr += c;
 				c = getc();
@@ -232,11 +232,11 @@ namespace plib {
 			ungetc(c);
 			return token_t(ret, tokstr);
 		}
-		else if (m_identifier_chars.find(c) != pstring::npos)
+		else if (is_identifier_char(c))
 		{
 			// read identifier till non identifier char
 			pstring tokstr = "";
-			while (m_identifier_chars.find(c) != pstring::npos)
+			while (is_identifier_char(c))
 			{
 				tokstr += c;
 				c = getc();
@@ -263,7 +263,7 @@ namespace plib {
 		{
 			// read identifier till first identifier char or ws
 			pstring tokstr = "";
-			while ((m_identifier_chars.find(c) == pstring::npos) && (m_whitespace.find(c) == pstring::npos))
+			while ((!is_identifier_char(c)) && (!is_whitespace(c)))
 			{
 				tokstr += c;
 				// expensive, check for single char tokens
@@ -14,6 +14,8 @@
 
 #include "putil.h" // psource_t
 
+#include <array>
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 
@@ -29,6 +31,7 @@ namespace plib {
 		, m_px(m_cur_line.begin())
 		, m_unget(0)
 		, m_string('"')
+		, m_char_class()
 		, m_support_line_markers(true) // FIXME
 		{
 			// add a first entry to the stack
@@ -115,10 +118,27 @@ namespace plib {
 			return ret;
 		}
 
-		ptokenizer & identifier_chars(const pstring &s) { m_identifier_chars = s; return *this; }
-		ptokenizer & number_chars(const pstring &st, const pstring & rem) { m_number_chars_start = st; m_number_chars = rem; return *this; }
+		ptokenizer & identifier_chars(const pstring &s)
+		{
+			m_identifier_chars = s;
+			set_char_class(s, CC_IDENTIFIER);
+			return *this;
+		}
+		ptokenizer & number_chars(const pstring &st, const pstring & rem)
+		{
+			m_number_chars_start = st;
+			m_number_chars = rem;
+			set_char_class(st, CC_NUMBER_START);
+			set_char_class(rem, CC_NUMBER);
+			return *this;
+		}
 		ptokenizer & string_char(pstring::value_type c) { m_string = c; return *this; }
-		ptokenizer & whitespace(const pstring & s) { m_whitespace = s; return *this; }
+		ptokenizer & whitespace(const pstring & s)
+		{
+			m_whitespace = s;
+			set_char_class(s, CC_WHITESPACE);
+			return *this;
+		}
 		ptokenizer & comment(const pstring &start, const pstring &end, const pstring &line)
 		{
 			m_tok_comment_start = register_token(start);
@@ -142,6 +162,39 @@ namespace plib {
 
 		bool eof() const { return m_strm.eof(); }
 
+		// Character classes are looked up for every character read.
+		// ASCII characters use a table, others fall back to searching
+		// the class string.
+
+		enum char_class_e : std::uint8_t
+		{
+			CC_WHITESPACE   = 1,
+			CC_IDENTIFIER   = 2,
+			CC_NUMBER       = 4,
+			CC_NUMBER_START = 8
+		};
+
+		void set_char_class(const pstring &s, char_class_e cls)
+		{
+			for (auto &e : m_char_class)
+				e &= static_cast<std::uint8_t>(~cls);
+			for (const auto &c : s)
+				if (static_cast<std::size_t>(c) < m_char_class.size())
+					m_char_class[static_cast<std::size_t>(c)] |= cls;
+		}
+
+		bool is_class(pstring::value_type c, char_class_e cls, const pstring &s) const
+		{
+			if (static_cast<std::size_t>(c) < m_char_class.size())
+				return (m_char_class[static_cast<std::size_t>(c)] & cls) != 0;
+			return s.find(c) != pstring::npos;
+		}
+
+		bool is_whitespace(pstring::value_type c) const { return is_class(c, CC_WHITESPACE, m_whitespace); }
+		bool is_identifier_char(pstring::value_type c) const { return is_class(c, CC_IDENTIFIER, m_identifier_chars); }
+		bool is_number_char(pstring::value_type c) const { return is_class(c, CC_NUMBER, m_number_chars); }
+		bool is_number_start_char(pstring::value_type c) const { return is_class(c, CC_NUMBER_START, m_number_chars_start); }
+
 		putf8_reader m_strm;
 
 		pstring m_cur_line;
@@ -156,6 +209,7 @@ namespace plib {
 		std::unordered_map<pstring, token_id_t> m_tokens;
 		pstring m_whitespace;
 		pstring::value_type  m_string;
+		std::array<std::uint8_t, 128> m_char_class;
 
 		token_id_t m_tok_comment_start;
 		token_id_t m_tok_comment_end;
@@ -9,6 +9,9 @@
 #include <algorithm>
 #include <cstdlib> // needed for getenv ...
 #include <initializer_list>
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
 
 namespace plib
 {
@@ -55,6 +58,23 @@ namespace plib
 			return (std::getenv(var.c_str()) == nullptr) ? default_val
 				: pstring(std::getenv(var.c_str()));
 		}
+
+		std::size_t peak_memory()
+		{
+		#if defined(_WIN32)
+			return 0;
+		#else
+			struct rusage ru;
+			if (getrusage(RUSAGE_SELF, &ru) != 0)
+				return 0;
+		#if defined(__APPLE__)
+			return static_cast<std::size_t>(ru.ru_maxrss);
+		#else
+			// kilobytes on linux and bsd
+			return static_cast<std::size_t>(ru.ru_maxrss) * 1024;
+		#endif
+		#endif
+		}
 	} // namespace util
 
 	std::vector<pstring> psplit(const pstring &str, const pstring &onstr, bool ignore_empty)
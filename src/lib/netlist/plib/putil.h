@@ -226,6 +226,11 @@ namespace plib
 		pstring path(const pstring &filename);
 		pstring buildpath(std::initializer_list<pstring> list );
 		pstring environment(const pstring &var, const pstring &default_val);
+
+		/// \brief Peak resident memory of the process in bytes
+		///
+		/// \returns 0 if not supported on the platform
+		std::size_t peak_memory();
 	} // namespace util
 
 	namespace container
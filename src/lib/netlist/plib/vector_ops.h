@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <type_traits>
 
 #if !defined(__clang__) && !defined(_MSC_VER) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ > 6))
@@ -108,6 +109,108 @@ namespace plib
 			result[i] += scalar * v[i];
 	}
 
+	template<typename T>
+	T vec_mult_p(const std::size_t n, const T * v1, const T * v2) noexcept
+	{
+		T value(0);
+		for ( std::size_t i = 0; i < n; i++ )
+			value += v1[i] * v2[i];
+		return value;
+	}
+
+#if (PUSE_VECTOR_EXTENSIONS)
+	namespace detail
+	{
+		/// \brief 32 byte vector types used by the vector operations.
+		///
+		/// 32 bytes match AVX registers. On targets with 16 byte vectors
+		/// (SSE2, NEON) the compiler splits operations into two halves.
+		///
+		template <typename T>
+		struct pvector_traits;
+
+		template <>
+		struct pvector_traits<double>
+		{
+			typedef double type __attribute__((vector_size(32))); // NOLINT(modernize-use-using)
+			static constexpr const std::size_t LANES = 4;
+		};
+
+		template <>
+		struct pvector_traits<float>
+		{
+			typedef float type __attribute__((vector_size(32))); // NOLINT(modernize-use-using)
+			static constexpr const std::size_t LANES = 8;
+		};
+
+		// Pointers into matrix rows are not necessarily aligned.
+		// memcpy compiles to unaligned vector loads and stores.
+
+		template <typename T>
+		void vec_add_mult_scalar_p(const std::size_t n, T * result, const T * v, T scalar) noexcept
+		{
+			using vt = typename pvector_traits<T>::type;
+			constexpr const std::size_t L = pvector_traits<T>::LANES;
+			const vt s = vt{} + scalar;
+			std::size_t i = 0;
+			for ( ; i + L <= n; i += L)
+			{
+				vt r;
+				vt a;
+				std::memcpy(&r, result + i, sizeof(vt));
+				std::memcpy(&a, v + i, sizeof(vt));
+				r += s * a;
+				std::memcpy(result + i, &r, sizeof(vt));
+			}
+			for ( ; i < n; i++ )
+				result[i] += scalar * v[i];
+		}
+
+		template <typename T>
+		T vec_mult_p(const std::size_t n, const T * v1, const T * v2) noexcept
+		{
+			using vt = typename pvector_traits<T>::type;
+			constexpr const std::size_t L = pvector_traits<T>::LANES;
+			vt acc = vt{};
+			std::size_t i = 0;
+			for ( ; i + L <= n; i += L)
+			{
+				vt a;
+				vt b;
+				std::memcpy(&a, v1 + i, sizeof(vt));
+				std::memcpy(&b, v2 + i, sizeof(vt));
+				acc += a * b;
+			}
+			T value(0);
+			for (std::size_t j = 0; j < L; j++)
+				value += acc[j];
+			for ( ; i < n; i++ )
+				value += v1[i] * v2[i];
+			return value;
+		}
+	} // namespace detail
+
+	inline void vec_add_mult_scalar_p(const std::size_t n, double * result, const double * v, double scalar) noexcept
+	{
+		detail::vec_add_mult_scalar_p(n, result, v, scalar);
+	}
+
+	inline void vec_add_mult_scalar_p(const std::size_t n, float * result, const float * v, float scalar) noexcept
+	{
+		detail::vec_add_mult_scalar_p(n, result, v, scalar);
+	}
+
+	inline double vec_mult_p(const std::size_t n, const double * v1, const double * v2) noexcept
+	{
+		return detail::vec_mult_p(n, v1, v2);
+	}
+
+	inline float vec_mult_p(const std::size_t n, const float * v1, const float * v2) noexcept
+	{
+		return detail::vec_mult_p(n, v1, v2);
+	}
+#endif
+
 	template<typename R, typename V>
 	void vec_add_ip(const std::size_t n, R & result, const V & v) noexcept
 	{
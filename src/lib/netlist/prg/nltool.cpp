@@ -18,10 +18,14 @@
 #include "netlist/solver/nld_solver.h"
 #include "netlist/tools/nl_convert.h"
 
+#include <array>
+#include <atomic>
 #include <cstdio> // scanf
 #include <iomanip> // scanf
 #include <ios>
 #include <iostream> // scanf
+#include <mutex>
+#include <thread>
 
 class tool_app_t : public plib::app
 {
@@ -29,7 +33,7 @@ public:
 	tool_app_t() :
 		plib::app(),
 		opt_grp1(*this,     "General options",              "The following options apply to all commands."),
-		opt_cmd (*this,     "c", "cmd",         0,          std::vector<pstring>({"run","validate","convert","listdevices","static","header","docheader"}), "run|validate|convert|listdevices|static|header|docheader"),
+		opt_cmd (*this,     "c", "cmd",         0,          std::vector<pstring>({"run","validate","convert","listdevices","static","header","docheader","batch","tune"}), "run|validate|convert|listdevices|static|header|docheader|batch|tune"),
 		opt_file(*this,     "f", "file",        "-",        "file to process (default is stdin)"),
 		opt_includes(*this, "I", "include",                 "Add the directory to the list of directories to be searched for header files. This option may be specified repeatedly."),
 		opt_defines(*this,  "D", "define",                  "predefine value as macro, e.g. -Dname=value. If '=value' is omitted predefine it as 1. This option may be specified repeatedly."),
@@ -45,10 +49,12 @@ public:
 
 		opt_grp3(*this,     "Options for static command",   "These options apply to static command."),
 		opt_dir(*this,      "d", "dir",        "",          "output directory for the generated files"),
+		opt_table(*this,    "",  "table",      "",          "also write all solvers to one source file in the output directory together with a table of the given name. The table can be registered with netlist_state_t::add_static_solvers."),
 
-		opt_grp4(*this,     "Options for run command",      "These options are only used by the run command."),
+		opt_grp4(*this,     "Options for run and tune commands", "These options are used by the run and tune commands."),
 		opt_ttr (*this,     "t", "time_to_run", 1,          "time to run the emulation (seconds)\n\n  abc def\n\n xyz"),
 		opt_stats(*this,    "s", "statistics",              "gather runtime statistics"),
+		opt_stats_file(*this, "", "stats-file", "",         "write device statistics in collapsed stack format to file. Implies -s. The output can be used to create flame graphs."),
 		opt_logs(*this,     "l", "log" ,                    "define terminal to log. This option may be specified repeatedly."),
 		opt_inp(*this,      "i", "input",       "",         "input file to process (default is none)"),
 		opt_loadstate(*this,"",  "loadstate",   "",         "load state from file and continue from there"),
@@ -56,22 +62,38 @@ public:
 		opt_fperr(*this,    "",  "fperr",
 			"raise exception on floating point errors. This is intended to be used during debugging."),
 
+		opt_tolerance(*this, "", "tolerance",  netlist::nlconst::magic(1e-3), "maximum deviation of net voltages from the reference run accepted by the tune command"),
+
 		opt_grp5(*this,     "Options for convert command",  "These options are only used by the convert command."),
 		opt_type(*this,     "y", "type",        0,          std::vector<pstring>({"spice","eagle","rinf"}), "type of file to be converted: spice,eagle,rinf"),
 
 		opt_grp6(*this,     "Options for validate command",  "These options are only used by the validate command."),
 		opt_extended_validation(*this, "", "extended",       "Identify issues with power terminals."),
+		opt_validate_list(*this, "", "list",                "the file specified by ""-f"" is a list of netlists in the format used by the batch command. All netlists are validated concurrently, see ""-j""."),
 
 		opt_grp7(*this,     "Options for header command",  "These options are only used by the header command."),
 		opt_tabwidth(*this, "", "tab-width", 4,          "Tab width for output."),
 		opt_linewidth(*this,"", "line-width", 72,       "Line width for output."),
 
+		opt_grp8(*this,     "Options for batch command",  "These options are used by the batch command and validate --list."),
+		opt_jobs(*this,     "j", "jobs",        0,          "number of netlists to run concurrently (default: number of cores)"),
+		opt_summary(*this,  "",  "summary-file", "",        "write the results as comma separated values to file. Use -j 1 for benchmarking."),
+
 		opt_ex1(*this,     "nltool -c run -t 3.5 -f nl_examples/cdelay.c -n cap_delay",
 				"Run netlist \"cap_delay\" from file nl_examples/cdelay.c for 3.5 seconds"),
 		opt_ex2(*this,     "nltool --cmd=listdevices",
 				"List all known devices."),
 		opt_ex3(*this,     "nltool --cmd=header --tab-width=8 --line-width=80",
 				"Create the header file needed for including netlists as code."),
+		opt_ex4(*this,     "nltool -c batch -j 4 -f manifest.txt",
+				"Run all netlists listed in manifest.txt, four at a time. Each line has the form\n"
+				"file,time_to_run[,name[,input]]. Empty lines and lines starting with # are skipped.\n"
+				"LOG devices of all jobs write to the current directory."),
+		opt_ex5(*this,     "nltool -c tune -t 2 -f nl_examples/kidniki.c",
+				"Run the netlist with each solver method and report the fastest one.\nThe result may be stored in the netlist with the PARAM line printed."),
+		opt_ex6(*this,     "nltool -c validate --list -j 4 -f manifest.txt",
+				"Validate all netlists listed in manifest.txt, four at a time. The manifest has the\n"
+				"same format as used by the batch command."),
 
 		m_warnings(0),
 		m_errors(0)
@@ -92,24 +114,34 @@ public:
 	plib::option_str    opt_name;
 	plib::option_group  opt_grp3;
 	plib::option_str    opt_dir;
+	plib::option_str    opt_table;
 	plib::option_group  opt_grp4;
 	plib::option_num<nl_fptype> opt_ttr;
 	plib::option_bool   opt_stats;
+	plib::option_str    opt_stats_file;
 	plib::option_vec    opt_logs;
 	plib::option_str    opt_inp;
 	plib::option_str    opt_loadstate;
 	plib::option_str    opt_savestate;
 	plib::option_bool   opt_fperr;
+	plib::option_num<nl_fptype> opt_tolerance;
 	plib::option_group  opt_grp5;
 	plib::option_str_limit<unsigned> opt_type;
 	plib::option_group  opt_grp6;
 	plib::option_bool   opt_extended_validation;
+	plib::option_bool   opt_validate_list;
 	plib::option_group  opt_grp7;
 	plib::option_num<unsigned> opt_tabwidth;
 	plib::option_num<unsigned> opt_linewidth;
+	plib::option_group  opt_grp8;
+	plib::option_num<unsigned> opt_jobs;
+	plib::option_str    opt_summary;
 	plib::option_example opt_ex1;
 	plib::option_example opt_ex2;
 	plib::option_example opt_ex3;
+	plib::option_example opt_ex4;
+	plib::option_example opt_ex5;
+	plib::option_example opt_ex6;
 
 	int execute() override;
 	pstring usage() override;
@@ -130,7 +162,10 @@ public:
 	int m_errors;
 private:
 	void run();
+	void batch();
+	void tune();
 	void validate();
+	void validate_list();
 	void convert();
 	void static_compile();
 
@@ -204,11 +239,17 @@ public:
 	{
 	}
 
+	netlist_tool_t(plib::unique_ptr<netlist::callbacks_t> &&callbacks, const pstring &aname)
+	: netlist::netlist_state_t(aname, std::move(callbacks))
+	{
+	}
+
 	void read_netlist(const pstring &filename, const pstring &name,
 			const std::vector<pstring> &logs,
 			const std::vector<pstring> &defines,
 			const std::vector<pstring> &roms,
-			const std::vector<pstring> &includes)
+			const std::vector<pstring> &includes,
+			const pstring &solver_method = "")
 	{
 		// read the netlist ...
 
@@ -227,6 +268,11 @@ public:
 		setup().include(name);
 		create_dynamic_logs(logs);
 
+		// override the method of all solvers
+		if (solver_method != "")
+			for (auto &sn : setup().devices_of_type("SOLVER"))
+				setup().register_param(sn + ".METHOD", solver_method);
+
 		// start devices
 		setup().prepare_to_run();
 	}
@@ -305,6 +351,106 @@ void netlist_tool_callbacks_t::vlog(const plib::plog_level &l, const pstring &ls
 	m_app.pout("{}", err);
 }
 
+// Collects the log of a batch job. Output is written once the job is done
+// so that concurrent jobs do not interleave.
+class netlist_batch_callbacks_t : public netlist::callbacks_t
+{
+public:
+	netlist_batch_callbacks_t(pstring &buf, std::atomic<int> &errors)
+	: m_buf(buf), m_errors(errors), m_warnings(nullptr)
+	{ }
+
+	netlist_batch_callbacks_t(pstring &buf, std::atomic<int> &errors, std::atomic<int> &warnings)
+	: m_buf(buf), m_errors(errors), m_warnings(&warnings)
+	{ }
+
+	void vlog(const plib::plog_level &l, const pstring &ls) const noexcept override
+	{
+		if (l == plib::plog_level::ERROR || l == plib::plog_level::FATAL)
+			m_errors++;
+		else if (l == plib::plog_level::WARNING && m_warnings != nullptr)
+			(*m_warnings)++;
+		m_buf += plib::pfmt("{}: {}\n")(l.name())(ls.c_str());
+	}
+
+private:
+	pstring &m_buf;
+	std::atomic<int> &m_errors;
+	std::atomic<int> *m_warnings;
+};
+
+// -------------------------------------------------
+//    batch support
+// -------------------------------------------------
+
+struct batch_job_t
+{
+	pstring file;
+	pstring name;
+	pstring input;
+	nl_fptype ttr;
+	pstring out;
+	nl_fptype startup;
+	nl_fptype emutime;
+	std::size_t events;
+	std::size_t solves;
+	std::size_t peak_memory;
+	bool ok;
+};
+
+// Lines have the form file,time_to_run[,name[,input]]
+static std::vector<batch_job_t> read_manifest(const pstring &fname)
+{
+	std::vector<batch_job_t> jobs;
+	plib::putf8_reader r = plib::putf8_reader(std::ifstream(plib::filesystem::u8path(fname)));
+	if (r.stream().fail())
+		throw netlist::nl_exception(netlist::MF_FILE_OPEN_ERROR(fname));
+	r.stream().imbue(std::locale::classic());
+	pstring l;
+	while (r.readline(l))
+	{
+		l = plib::trim(l);
+		if (l == "" || plib::startsWith(l, "#"))
+			continue;
+		auto f(plib::psplit(l, ","));
+		if (f.size() < 2 || f.size() > 4)
+			throw netlist::nl_exception(plib::pfmt("batch: invalid line {1}\n")(l));
+		batch_job_t j;
+		j.file = plib::trim(f[0]);
+		j.ttr = plib::pstonum<nl_fptype>(plib::trim(f[1]));
+		j.name = f.size() > 2 ? plib::trim(f[2]) : pstring("");
+		j.input = f.size() > 3 ? plib::trim(f[3]) : pstring("");
+		j.startup = j.emutime = netlist::nlconst::zero();
+		j.events = j.solves = j.peak_memory = 0;
+		j.ok = false;
+		jobs.push_back(j);
+	}
+	return jobs;
+}
+
+// Calls f(i) for i in [0, count) using up to nthreads threads.
+// nthreads == 0 uses one thread per core.
+template <typename F>
+static void run_concurrently(std::size_t count, std::size_t nthreads, F f)
+{
+	if (nthreads == 0)
+		nthreads = std::max(std::thread::hardware_concurrency(), 1u);
+	nthreads = std::min(nthreads, count);
+
+	std::atomic<std::size_t> next(0);
+	auto worker = [&]()
+	{
+		for (std::size_t i = next++; i < count; i = next++)
+			f(i);
+	};
+
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < nthreads; i++)
+		threads.emplace_back(worker);
+	for (auto &t : threads)
+		t.join();
+}
+
 struct input_t
 {
 	input_t(const netlist::setup_t &setup, const pstring &line)
@@ -380,7 +526,7 @@ void tool_app_t::run()
 		auto t_guard(t.guard());
 		//plib::perftime_t<plib::exact_ticks> t;
 
-		nt.exec().enable_stats(opt_stats());
+		nt.exec().enable_stats(opt_stats() || opt_stats_file.was_specified());
 
 		if (!opt_verb())
 			nt.log().verbose.set_enabled(false);
@@ -458,14 +604,258 @@ void tool_app_t::run()
 		nt.exec().stop();
 	}
 
+	if (opt_stats_file.was_specified())
+	{
+		std::ofstream strm(plib::filesystem::u8path(opt_stats_file()));
+		if (strm.fail())
+			throw plib::file_open_e(opt_stats_file());
+		strm.imbue(std::locale::classic());
+		nt.exec().write_stats_collapsed(strm);
+	}
+
 	auto emutime(t.as_seconds<nl_fptype>());
 	pout("{1:f} seconds emulation took {2:f} real time ==> {3:5.2f}%\n",
 			(ttr - nlt).as_fp<nl_fptype>(), emutime,
 			(ttr - nlt).as_fp<nl_fptype>() / emutime * netlist::nlconst::magic(100.0));
 }
 
+void tool_app_t::batch()
+{
+	std::vector<batch_job_t> jobs(read_manifest(opt_file()));
+
+	std::atomic<int> errors(0);
+	std::mutex out_lock;
+
+	run_concurrently(jobs.size(), opt_jobs(), [&](std::size_t i)
+	{
+		batch_job_t &j = jobs[i];
+		try
+		{
+			plib::chrono::timer<plib::chrono::system_ticks> t;
+			netlist_tool_t nt(plib::make_unique<netlist_batch_callbacks_t>(j.out, errors), "netlist");
+			std::vector<input_t> inps;
+			{
+				auto t_guard(t.guard());
+				nt.exec().enable_stats(opt_stats());
+				nt.log().verbose.set_enabled(opt_stats());
+				nt.log().info.set_enabled(false);
+				if (opt_quiet())
+					nt.log().warning.set_enabled(false);
+
+				nt.read_netlist(j.file, j.name, opt_logs(),
+					m_defines, opt_rfolders(), opt_includes());
+				nt.exec().reset();
+				inps = read_input(nt.setup(), j.input);
+			}
+			j.startup = t.as_seconds<nl_fptype>();
+			t.reset();
+			{
+				auto t_guard(t.guard());
+				const auto ttr(netlist::netlist_time_ext::from_fp(j.ttr));
+				netlist::netlist_time_ext nlt = nt.exec().time();
+				for (auto &inp : inps)
+				{
+					if (inp.m_time >= ttr || inp.m_time < nlt)
+						break;
+					nt.exec().process_queue(inp.m_time - nlt);
+					inp.setparam();
+					nlt = inp.m_time;
+				}
+				if (ttr > nlt)
+					nt.exec().process_queue(ttr - nlt);
+				nt.exec().stop();
+			}
+			j.emutime = t.as_seconds<nl_fptype>();
+			j.events = static_cast<std::size_t>(nt.exec().queue_events());
+			if (nt.exec().solver() != nullptr)
+				j.solves = nt.exec().solver()->solve_count();
+			// process wide, only meaningful with one job at a time
+			j.peak_memory = plib::util::peak_memory();
+			j.ok = true;
+		}
+		catch (plib::pexception &e)
+		{
+			j.out += plib::pfmt("Exception caught: {}\n")(e.text());
+			errors++;
+		}
+
+		std::lock_guard<std::mutex> guard(out_lock);
+		pout("==== {1} {2}\n", j.file, j.name);
+		pout.write(j.out);
+		if (j.ok)
+		{
+			pout("{1:f} seconds emulation took {2:f} real time ==> {3:5.2f}% (startup {4:5.3f})\n",
+				j.ttr, j.emutime, j.ttr / j.emutime * netlist::nlconst::magic(100.0), j.startup);
+			pout("{1} events ({2:.0f}/s), {3} solves ({4:.0f}/s)\n",
+				j.events, static_cast<nl_fptype>(j.events) / j.emutime,
+				j.solves, static_cast<nl_fptype>(j.solves) / j.emutime);
+		}
+		else
+			pout("FAILED\n");
+	});
+
+	pout("\nSummary:\n");
+	for (auto &j : jobs)
+	{
+		if (j.ok)
+			pout("{1:-40} {2:-12} {3:8.2f}%\n", j.file, j.name, j.ttr / j.emutime * netlist::nlconst::magic(100.0));
+		else
+			pout("{1:-40} {2:-12} FAILED\n", j.file, j.name);
+	}
+
+	if (opt_summary.was_specified())
+	{
+		std::ofstream strm(plib::filesystem::u8path(opt_summary()));
+		if (strm.fail())
+			throw plib::file_open_e(opt_summary());
+		strm.imbue(std::locale::classic());
+		strm << "file,name,ok,time_to_run,startup,real_time,speed,events,events_per_s,solves,solves_per_s,peak_memory\n";
+		for (auto &j : jobs)
+		{
+			const nl_fptype rt(j.ok ? j.emutime : netlist::nlconst::one());
+			strm << plib::pfmt("{1},{2},{3},{4},{5},{6},{7},{8},{9},{10},{11},{12}\n")
+				(j.file)(j.name)(j.ok ? 1 : 0)(j.ttr)(j.startup)(j.emutime)
+				(j.ok ? j.ttr / rt : netlist::nlconst::zero())
+				(j.events)(static_cast<nl_fptype>(j.events) / rt)
+				(j.solves)(static_cast<nl_fptype>(j.solves) / rt)
+				(j.peak_memory);
+		}
+	}
+	m_errors += errors;
+}
+
+void tool_app_t::tune()
+{
+	using mt = netlist::solver::matrix_type_e;
+
+	struct result_t
+	{
+		pstring method;
+		nl_fptype emutime;
+		nl_fptype deviation;
+		bool ok;
+	};
+
+	static const std::array<mt, 8> candidates = {{ mt::MAT_CR, mt::MAT, mt::SM,
+		mt::W, mt::SOR, mt::SOR_MAT, mt::GMRES, mt::MAT_MIXED }};
+
+	const auto ttr(netlist::netlist_time_ext::from_fp(opt_ttr()));
+	std::vector<pstring> solvers;
+	std::vector<nl_fptype> reference;
+
+	// Runs the netlist with the given method and returns the voltages
+	// of all analog nets at the end of the run.
+	auto run_method = [&](result_t &r) -> std::vector<nl_fptype>
+	{
+		std::vector<nl_fptype> volts;
+		try
+		{
+			netlist_tool_t nt(*this, "netlist");
+			std::vector<input_t> inps;
+
+			nt.log().verbose.set_enabled(false);
+			nt.log().info.set_enabled(false);
+			// overriding METHOD issues a warning
+			nt.log().warning.set_enabled(false);
+
+			nt.read_netlist(opt_file(), opt_name(), opt_logs(),
+				m_defines, opt_rfolders(), opt_includes(), r.method);
+			nt.exec().reset();
+			inps = read_input(nt.setup(), opt_inp());
+			if (solvers.empty())
+				solvers = nt.setup().devices_of_type("SOLVER");
+
+			plib::chrono::timer<plib::chrono::system_ticks> t;
+			{
+				auto t_guard(t.guard());
+				netlist::netlist_time_ext nlt = nt.exec().time();
+				for (auto &inp : inps)
+				{
+					if (inp.m_time >= ttr || inp.m_time < nlt)
+						break;
+					nt.exec().process_queue(inp.m_time - nlt);
+					inp.setparam();
+					nlt = inp.m_time;
+				}
+				if (ttr > nlt)
+					nt.exec().process_queue(ttr - nlt);
+				nt.exec().stop();
+			}
+			r.emutime = t.as_seconds<nl_fptype>();
+			for (auto &n : nt.nets())
+				if (n->is_analog())
+					volts.push_back(static_cast<netlist::analog_net_t *>(n.get())->Q_Analog());
+			r.ok = true;
+		}
+		catch (plib::pexception &e)
+		{
+			pout("{1:-10} failed: {2}\n", r.method, e.text());
+		}
+		return volts;
+	};
+
+	// The reference uses the methods set in the netlist.
+	{
+		result_t r = { "", netlist::nlconst::zero(), netlist::nlconst::zero(), false };
+		reference = run_method(r);
+		if (!r.ok)
+		{
+			m_errors++;
+			return;
+		}
+		pout("{1:-10} {2:10.4f} s {3:10.2f}%\n", "netlist", r.emutime,
+			opt_ttr() / r.emutime * netlist::nlconst::magic(100.0));
+	}
+	if (solvers.empty())
+	{
+		pout("Netlist has no solver, nothing to tune.\n");
+		return;
+	}
+
+	std::vector<result_t> results;
+	for (const auto &c : candidates)
+	{
+		result_t r = { plib::trim(pstring(mt(c).name())), netlist::nlconst::zero(), netlist::nlconst::zero(), false };
+		auto volts = run_method(r);
+		if (r.ok)
+		{
+			if (volts.size() != reference.size())
+				r.ok = false;
+			else
+				for (std::size_t i = 0; i < volts.size(); i++)
+					r.deviation = std::max(r.deviation, plib::abs(volts[i] - reference[i]));
+			r.ok = r.ok && r.deviation <= opt_tolerance();
+			pout("{1:-10} {2:10.4f} s {3:10.2f}% deviation {4:10.3e} V{5}\n", r.method, r.emutime,
+				opt_ttr() / r.emutime * netlist::nlconst::magic(100.0), r.deviation,
+				r.ok ? "" : " rejected");
+		}
+		results.push_back(r);
+	}
+
+	const result_t *best = nullptr;
+	for (auto &r : results)
+		if (r.ok && (best == nullptr || r.emutime < best->emutime))
+			best = &r;
+
+	if (best == nullptr)
+	{
+		perr("tune: no solver method met the tolerance\n");
+		m_errors++;
+		return;
+	}
+	pout("\nFastest method: {1}. Add to the netlist to keep it:\n\n", best->method);
+	for (auto &sn : solvers)
+		pout("\tPARAM({1}.METHOD, \"{2}\")\n", sn, best->method);
+}
+
 void tool_app_t::validate()
 {
+	if (opt_validate_list())
+	{
+		validate_list();
+		return;
+	}
+
 	netlist_tool_t nt(*this, "netlist");
 
 	if (!opt_verb())
@@ -501,6 +891,61 @@ void tool_app_t::validate()
 
 }
 
+void tool_app_t::validate_list()
+{
+	std::vector<batch_job_t> jobs(read_manifest(opt_file()));
+
+	std::atomic<int> errors(0);
+	std::atomic<int> warnings(0);
+	std::mutex out_lock;
+	plib::chrono::timer<plib::chrono::system_ticks> total;
+
+	{
+		auto t_guard(total.guard());
+		run_concurrently(jobs.size(), opt_jobs(), [&](std::size_t i)
+		{
+			batch_job_t &j = jobs[i];
+			std::atomic<int> jerrors(0);
+			std::atomic<int> jwarnings(0);
+			plib::chrono::timer<plib::chrono::system_ticks> t;
+			try
+			{
+				auto j_guard(t.guard());
+				netlist_tool_t nt(plib::make_unique<netlist_batch_callbacks_t>(j.out, jerrors, jwarnings), "netlist");
+				nt.log().verbose.set_enabled(opt_verb());
+				nt.log().info.set_enabled(!opt_quiet());
+				nt.set_extended_validation(opt_extended_validation());
+				nt.read_netlist(j.file, j.name, opt_logs(),
+					m_defines, opt_rfolders(), opt_includes());
+			}
+			catch (plib::pexception &e)
+			{
+				j.out += plib::pfmt("Exception caught: {}\n")(e.text());
+				jerrors++;
+			}
+			j.startup = t.as_seconds<nl_fptype>();
+			j.ok = (jerrors == 0 && jwarnings == 0);
+			errors += jerrors;
+			warnings += jwarnings;
+
+			std::lock_guard<std::mutex> guard(out_lock);
+			pout("==== {1} {2}\n", j.file, j.name);
+			pout.write(j.out);
+			pout("{1} errors {2} warnings ({3:5.3f} seconds)\n", jerrors.load(), jwarnings.load(), j.startup);
+		});
+	}
+
+	pout("\nSummary:\n");
+	for (auto &j : jobs)
+		pout("{1:-40} {2:-12} {3}\n", j.file, j.name, j.ok ? "ok" : "FAILED");
+	pout("validated {1} netlists in {2:5.3f} seconds\n", jobs.size(), total.as_seconds<nl_fptype>());
+
+	m_errors += errors;
+	m_warnings += warnings;
+	if (m_warnings + m_errors > 0)
+		throw netlist::nl_exception("validation: {1} errors {2} warnings", m_errors, m_warnings);
+}
+
 void tool_app_t::static_compile()
 {
 	if (!opt_dir.was_specified())
@@ -530,6 +975,23 @@ void tool_app_t::static_compile()
 		sout << e.second;
 	}
 
+	if (opt_table.was_specified())
+	{
+		auto sout(std::ofstream(opt_dir() + "/" + opt_table() + ".cpp"));
+		sout << "// generated by nltool --cmd=static\n\n";
+		sout << "#include \"netlist/nltypes.h\"\n\n";
+		for (auto &e : mp)
+			if (e.first != "")
+				sout << e.second << "\n";
+		sout << "extern const netlist::static_solver_entry " << opt_table() << "[] =\n{\n";
+		for (auto &e : mp)
+			if (e.first != "")
+				sout << "\t{ \"" << e.first << "\", reinterpret_cast<void (*)()>(&" << e.first << ") },\n";
+		sout << "\t{ nullptr, nullptr }\n};\n";
+		if (!sout.good())
+			throw netlist::nl_exception("unable to write {1}.cpp", opt_table());
+	}
+
 	nt.exec().stop();
 
 }
@@ -1031,6 +1493,10 @@ int tool_app_t::execute()
 			listdevices();
 		else if (cmd == "run")
 			run();
+		else if (cmd == "batch")
+			batch();
+		else if (cmd == "tune")
+			tune();
 		else if (cmd == "validate")
 			validate();
 		else if (cmd == "static")
@@ -518,9 +518,8 @@ int nlwav_app::execute()
 
 		if (oi == "-")
 		{
-			auto temp(plib::make_unique<std::stringstream>());
-			plib::copystream(*temp, std::cin);
-			fin = std::move(temp);
+			// read directly from the pipe, logs may still be written
+			fin = plib::make_unique<std::istream>(std::cin.rdbuf());
 		}
 		else
 			fin = plib::make_unique<std::ifstream>(plib::filesystem::u8path(oi));
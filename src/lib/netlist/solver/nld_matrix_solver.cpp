@@ -2,14 +2,27 @@
 // copyright-holders:Couriersud
 
 #include "nld_matrix_solver.h"
+#include "analog/nlid_twoterm.h"
 #include "nl_setup.h"
 #include "plib/putil.h"
 
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+
 namespace netlist
 {
 namespace solver
 {
 
+	bool is_split_terminal(const terminal_t &term, nl_fptype split_r) noexcept
+	{
+		if (split_r <= nlconst::zero())
+			return false;
+		const auto *r = dynamic_cast<const analog::NETLIB_NAME(R) *>(&term.device());
+		return r != nullptr && r->R() >= split_r;
+	}
+
 	terms_for_net_t::terms_for_net_t(analog_net_t * net)
 		: m_net(net)
 		, m_railstart(0)
@@ -46,7 +59,10 @@ namespace solver
 		, m_stat_calculations(*this, "m_stat_calculations", 0)
 		, m_stat_newton_raphson(*this, "m_stat_newton_raphson", 0)
 		, m_stat_vsolver_calls(*this, "m_stat_vsolver_calls", 0)
+		, m_stat_nr_hist()
 		, m_last_step(*this, "m_last_step", netlist_time_ext::zero())
+		, m_bypass_shift(*this, "m_bypass_shift", 0)
+		, m_pred_h(nlconst::zero())
 		, m_fb_sync(*this, "FB_sync")
 		, m_Q_sync(*this, "Q_sync")
 		, m_ops(0)
@@ -63,6 +79,136 @@ namespace solver
 		return &state().setup().get_connected_terminal(*term)->net();
 	}
 
+	plib::unique_ptr<plib::dynlib> matrix_solver_t::jit_compile()
+	{
+		pstring cxx = plib::util::environment("NL_JIT_CXX", "");
+		if (cxx == "")
+			return nullptr;
+
+		auto code(create_solver_code());
+		if (code.first == "")
+			return nullptr;
+
+#ifdef _WIN32
+		const pstring ext(".dll");
+#else
+		const pstring ext(".so");
+#endif
+		pstring dir = plib::util::environment("NL_JIT_CACHE", ".");
+		pstring libname = plib::util::buildpath({dir, code.first + ext});
+
+		if (!std::ifstream(libname.c_str()).good())
+		{
+			pstring srcname = plib::util::buildpath({dir, code.first + ".cpp"});
+			{
+				std::ofstream src(srcname.c_str());
+				src << code.second;
+				if (!src.good())
+				{
+					log().warning("JIT: unable to write {1}", srcname);
+					return nullptr;
+				}
+			}
+			pstring cmd = cxx + " -o \"" + libname + "\" \"" + srcname + "\"";
+			log().verbose("JIT: {1}", cmd);
+			if (std::system(cmd.c_str()) != 0)
+			{
+				log().warning("JIT: compile of {1} failed", code.first);
+				return nullptr;
+			}
+		}
+
+		auto lib = plib::make_unique<plib::dynlib>(libname);
+		if (!lib->isLoaded())
+		{
+			log().warning("JIT: unable to load {1}", libname);
+			return nullptr;
+		}
+		return lib;
+	}
+
+	std::string matrix_solver_t::fill_plan_key(const fill_mat_t &fill)
+	{
+		std::string key;
+		for (const auto &row : fill)
+		{
+			for (std::size_t j = 0; j < row.size(); j++)
+				key += (row[j] == 0) ? '1' : '0';
+			key += ',';
+		}
+		return key;
+	}
+
+	pstring matrix_solver_t::fill_plan_name(const std::string &key, std::size_t size)
+	{
+		pstring dir = plib::util::environment("NL_SETUP_CACHE", "");
+		if (dir == "")
+			return "";
+
+		std::hash<std::string> h;
+		return plib::util::buildpath({dir,
+			plib::pfmt("nl_plan_{1:x}_{2}.bin")(h(key))(size)});
+	}
+
+	// identifies the file layout: header, fill pattern, extended fill matrix
+	static constexpr const std::uint64_t FILL_PLAN_MAGIC = 0x314e414c50464e4eULL; // "NNFPLAN1"
+
+	bool matrix_solver_t::load_fill_plan(fill_mat_t &fill, fill_result_t &res)
+	{
+		const std::string key(fill_plan_key(fill));
+		pstring fname = fill_plan_name(key, fill.size());
+		if (fname == "")
+			return false;
+
+		std::ifstream strm(fname.c_str(), std::ios::binary);
+		if (!strm.good())
+			return false;
+
+		std::uint64_t hdr[4];
+		strm.read(reinterpret_cast<char *>(hdr), sizeof(hdr));
+		if (!strm.good() || hdr[0] != FILL_PLAN_MAGIC || hdr[1] != fill.size())
+			return false;
+
+		// the file name is only a hash, make sure the plan is for this pattern
+		std::string stored(key.size(), ' ');
+		strm.read(&stored[0], static_cast<std::streamsize>(stored.size()));
+		if (!strm.good() || stored != key)
+		{
+			log().verbose("Ignoring elimination plan {1} for a different matrix", fname);
+			return false;
+		}
+
+		fill_mat_t tmp(fill.size(), std::vector<unsigned>(fill.size()));
+		for (auto &row : tmp)
+			strm.read(reinterpret_cast<char *>(row.data()),
+				static_cast<std::streamsize>(row.size() * sizeof(unsigned)));
+		if (!strm.good())
+			return false;
+
+		fill = std::move(tmp);
+		res = fill_result_t(static_cast<std::size_t>(hdr[2]), static_cast<std::size_t>(hdr[3]));
+		log().verbose("Loaded elimination plan {1}", fname);
+		return true;
+	}
+
+	void matrix_solver_t::save_fill_plan(const fill_mat_t &orig, const fill_mat_t &fill, const fill_result_t &res)
+	{
+		const std::string key(fill_plan_key(orig));
+		pstring fname = fill_plan_name(key, orig.size());
+		if (fname == "")
+			return;
+
+		std::ofstream strm(fname.c_str(), std::ios::binary);
+		const std::uint64_t hdr[4] = { FILL_PLAN_MAGIC, fill.size(), res.first, res.second };
+		strm.write(reinterpret_cast<const char *>(hdr), sizeof(hdr));
+		strm.write(key.data(), static_cast<std::streamsize>(key.size()));
+		for (const auto &row : fill)
+			strm.write(reinterpret_cast<const char *>(row.data()),
+				static_cast<std::streamsize>(row.size() * sizeof(unsigned)));
+		if (!strm.good())
+			log().warning("Unable to write elimination plan {1}", fname);
+	}
+
 	void matrix_solver_t::setup_base(const analog_net_t::list_t &nets)
 	{
 		log().debug("New solver setup\n");
@@ -158,6 +304,9 @@ namespace solver
 
 		switch (sort)
 		{
+			case matrix_sort_type_e::MIN_DEGREE:
+				sort_min_degree();
+				break;
 			case matrix_sort_type_e::PREFER_BAND_MATRIX:
 				{
 					for (std::size_t k = 0; k < iN - 1; k++)
@@ -221,6 +370,78 @@ namespace solver
 		}
 	}
 
+	void matrix_solver_t::sort_min_degree()
+	{
+		// Minimum degree ordering on the elimination graph.
+		//
+		// Always eliminates the net with the fewest connections to nets
+		// not yet eliminated. Eliminating a net connects all its remaining
+		// neighbours, i.e. the graph tracks the fill-in created by gaussian
+		// elimination. This keeps fill low on large sparse matrices where
+		// the local swap heuristics above do poorly.
+		//
+
+		const std::size_t iN = m_terms.size();
+
+		std::vector<std::vector<bool>> adj(iN, std::vector<bool>(iN, false));
+		for (std::size_t k = 0; k < iN; k++)
+		{
+			auto &term = m_terms[k];
+			for (std::size_t i = 0; i < term.count(); i++)
+			{
+				auto col = get_net_idx(get_connected_net(term.terms()[i]));
+				if (col >= 0 && static_cast<std::size_t>(col) != k)
+				{
+					adj[k][static_cast<std::size_t>(col)] = true;
+					adj[static_cast<std::size_t>(col)][k] = true;
+				}
+			}
+		}
+
+		std::vector<bool> done(iN, false);
+		std::vector<std::size_t> order;
+		order.reserve(iN);
+
+		for (std::size_t step = 0; step < iN; step++)
+		{
+			std::size_t best = iN;
+			std::size_t best_deg = iN + 1;
+			for (std::size_t k = 0; k < iN; k++)
+			{
+				if (done[k])
+					continue;
+				std::size_t deg = 0;
+				for (std::size_t j = 0; j < iN; j++)
+					if (adj[k][j] && !done[j])
+						deg++;
+				if (deg < best_deg)
+				{
+					best = k;
+					best_deg = deg;
+				}
+			}
+
+			done[best] = true;
+			order.push_back(best);
+
+			// fill-in: remaining neighbours become connected
+			for (std::size_t i = 0; i < iN; i++)
+				if (adj[best][i] && !done[i])
+					for (std::size_t j = i + 1; j < iN; j++)
+						if (adj[best][j] && !done[j])
+						{
+							adj[i][j] = true;
+							adj[j][i] = true;
+						}
+		}
+
+		plib::aligned_vector<terms_for_net_t> sorted;
+		sorted.reserve(iN);
+		for (auto &k : order)
+			sorted.push_back(std::move(m_terms[k]));
+		m_terms = std::move(sorted);
+	}
+
 	void matrix_solver_t::setup_matrix()
 	{
 		const std::size_t iN = m_terms.size();
@@ -365,6 +586,10 @@ namespace solver
 		m_Idrn.resize(iN, max_count);
 		m_connected_net_Vn.resize(iN, max_count);
 
+		// nets across a split are read from the snapshot taken by snapshot_split
+		m_split_V.resize(m_split_nets.size());
+		snapshot_split();
+
 		for (std::size_t k = 0; k < iN; k++)
 		{
 			auto count = m_terms[k].count();
@@ -373,7 +598,12 @@ namespace solver
 			{
 				m_terms[k].terms()[i]->set_ptrs(&m_gtn[k][i], &m_gonn[k][i], &m_Idrn[k][i]);
 				//m_connected_net_Vn[k][i] = m_terms[k].terms()[i]->connected_terminal()->net().Q_Analog_state_ptr();
-				m_connected_net_Vn[k][i] = get_connected_net(m_terms[k].terms()[i])->Q_Analog_state_ptr();
+				auto *net = get_connected_net(m_terms[k].terms()[i]);
+				const auto split = plib::container::indexof(m_split_nets, net);
+				if (split != plib::container::npos)
+					m_connected_net_Vn[k][i] = &m_split_V[split];
+				else
+					m_connected_net_Vn[k][i] = net->Q_Analog_state_ptr();
 			}
 		}
 	}
@@ -385,6 +615,34 @@ namespace solver
 			inp->push(inp->proxied_net()->Q_Analog());
 	}
 
+	void matrix_solver_t::update_coupled()
+	{
+		// Solvers across a split see the change with their next solve.
+		// Only schedule them on significant changes so that coupled
+		// solvers settle instead of oscillating.
+		for (auto &c : m_coupled)
+		{
+			const nl_fptype v = c.net->Q_Analog();
+			if (plib::abs(v - c.last_V) > m_params.m_vntol() + m_params.m_reltol() * plib::abs(v))
+			{
+				c.last_V = v;
+				// nothing to do if it was already solved with this value,
+				// e.g. by SPLIT_LOOPS relaxation
+				if (c.solver->m_last_step() != exec().time() || c.solver->split_changed())
+					c.solver->update_after(netlist_time::quantum());
+			}
+		}
+	}
+
+	void matrix_solver_t::register_split_coupling()
+	{
+		for (auto *net : m_split_nets)
+		{
+			log().verbose("{1}: coupled to {2} via net {3}", this->name(), net->solver()->name(), net->name());
+			net->solver()->m_coupled.push_back({net, this, net->Q_Analog()});
+		}
+	}
+
 	void matrix_solver_t::update_dynamic()
 	{
 		// update all non-linear devices
@@ -395,19 +653,79 @@ namespace solver
 	void matrix_solver_t::reset()
 	{
 		m_last_step = netlist_time_ext::zero();
+		m_bypass_shift = 0;
+		m_bypass_V.clear();
+		m_pred_V.clear();
+		m_pred_h = nlconst::zero();
+		m_stat_nr_hist.fill(0);
+	}
+
+	void matrix_solver_t::predict_nr_start(nl_fptype delta) noexcept
+	{
+		// Linear extrapolation from the last two solutions. The
+		// extrapolation is limited to one previous step length to
+		// avoid overshooting after long idle periods.
+		const std::size_t iN = m_terms.size();
+		const bool valid(m_pred_V.size() == iN && m_pred_h > nlconst::zero());
+		const nl_fptype f = valid ? std::min(nlconst::one(), delta / m_pred_h) : nlconst::zero();
+		m_pred_V.resize(iN);
+		for (std::size_t k = 0; k < iN; k++)
+		{
+			const auto v(m_terms[k].getV<nl_fptype>());
+			if (valid)
+				m_terms[k].setV(v + (v - m_pred_V[k]) * f);
+			m_pred_V[k] = v;
+		}
+		m_pred_h = delta;
 	}
 
 	void matrix_solver_t::update() noexcept
 	{
+		snapshot_split();
 		const netlist_time new_timestep = solve(exec().time());
 		update_inputs();
+		update_coupled();
 
 		if (m_params.m_dynamic_ts && has_timestep_devices() && new_timestep > netlist_time::zero())
 		{
-			m_Q_sync.net().toggle_and_push_to_queue(new_timestep);
+			update_after(bypass_timestep(new_timestep));
 		}
 	}
 
+	netlist_time matrix_solver_t::bypass_timestep(netlist_time ts) noexcept
+	{
+		if (!m_params.m_bypass)
+			return ts;
+
+		// The solver is idle if no net voltage changed by more than
+		// VNTOL + RELTOL * |V| since the last solve. Idle solvers double
+		// their time step up to 2^BYPASS_MAX_SHIFT, but never beyond the
+		// maximum time step set by FREQ. Integration over the longer step
+		// is handled by the next solve. Changes on inputs still trigger an
+		// immediate solve.
+		const std::size_t iN = m_terms.size();
+		bool idle(m_bypass_V.size() == iN);
+		if (!idle)
+			m_bypass_V.resize(iN);
+
+		for (std::size_t k = 0; k < iN; k++)
+		{
+			const auto v(m_terms[k].getV<nl_fptype>());
+			if (plib::abs(v - m_bypass_V[k]) > m_params.m_vntol() + m_params.m_reltol() * plib::abs(v))
+				idle = false;
+			m_bypass_V[k] = v;
+		}
+
+		if (!idle)
+			m_bypass_shift = 0;
+		else if (m_bypass_shift < m_params.m_bypass_max_shift())
+			++m_bypass_shift;
+
+		const netlist_time stretched(ts * (static_cast<netlist_time::internal_type>(1) << m_bypass_shift()));
+		const auto max_ts(netlist_time::from_fp(m_params.m_max_timestep));
+		return (stretched > max_ts) ? std::max(ts, max_ts) : stretched;
+	}
+
 	// update_forced is called from within param_update
 	//
 	// this should only occur outside of execution and thus
@@ -415,10 +733,20 @@ namespace solver
 
 	void matrix_solver_t::update_forced()
 	{
+		// Several terminals changing at the same time, e.g. D/A proxies
+		// driven by the same logic edge, call this repeatedly. Only the
+		// first call solves, the others have nothing to push.
+		const bool up_to_date = (exec().time() - m_last_step()) < netlist_time_ext::quantum();
+
+		snapshot_split();
 		const netlist_time new_timestep = solve(exec().time());
 		plib::unused_var(new_timestep);
 
-		update_inputs();
+		if (!up_to_date)
+		{
+			update_inputs();
+			update_coupled();
+		}
 
 		if (m_params.m_dynamic_ts && has_timestep_devices())
 		{
@@ -446,6 +774,38 @@ namespace solver
 		m_last_step = now;
 		step(static_cast<netlist_time>(delta));
 
+		if (has_dynamic_devices() && m_params.m_nr_predictor)
+			predict_nr_start(delta.as_fp<nl_fptype>());
+
+		solve_nets();
+
+		return compute_next_timestep(delta.as_fp<nl_fptype>());
+	}
+
+	void matrix_solver_t::resolve()
+	{
+		solve_nets();
+	}
+
+	bool matrix_solver_t::split_changed() const noexcept
+	{
+		for (std::size_t i = 0; i < m_split_V.size(); i++)
+		{
+			const nl_fptype v = m_split_nets[i]->Q_Analog();
+			if (plib::abs(v - m_split_V[i]) > m_params.m_vntol() + m_params.m_reltol() * plib::abs(v))
+				return true;
+		}
+		return false;
+	}
+
+	void matrix_solver_t::snapshot_split() noexcept
+	{
+		for (std::size_t i = 0; i < m_split_nets.size(); i++)
+			m_split_V[i] = m_split_nets[i]->Q_Analog();
+	}
+
+	void matrix_solver_t::solve_nets()
+	{
 		++m_stat_vsolver_calls;
 		if (has_dynamic_devices())
 		{
@@ -461,6 +821,10 @@ namespace solver
 			} while (this_resched > 1 && newton_loops < m_params.m_nr_loops);
 
 			m_stat_newton_raphson += newton_loops;
+			std::size_t bucket = 0;
+			while (bucket + 1 < m_stat_nr_hist.size() && (std::size_t(1) << bucket) < newton_loops)
+				bucket++;
+			m_stat_nr_hist[bucket]++;
 			// reschedule ....
 			if (this_resched > 1 && !m_Q_sync.net().is_queued())
 			{
@@ -473,8 +837,6 @@ namespace solver
 			this->m_stat_calculations++;
 			this->vsolve_non_dynamic(false);
 		}
-
-		return compute_next_timestep(delta.as_fp<nl_fptype>());
 	}
 
 	int matrix_solver_t::get_net_idx(const analog_net_t *net) const noexcept
@@ -561,6 +923,15 @@ namespace solver
 			{
 				m_terms[net_idx].add_terminal(term, ot, true);
 			}
+			else if (is_split_terminal(*term, m_params.m_split_r()))
+			{
+				// The net belongs to another solver. Its voltage is
+				// treated as known, like a rail.
+				m_rails_temp[net_idx].add_terminal(term, -1, false);
+				auto *net = get_connected_net(term);
+				if (!plib::container::contains(m_split_nets, net))
+					m_split_nets.push_back(net);
+			}
 			// Should this be allowed ?
 			else
 			{
@@ -589,6 +960,14 @@ namespace solver
 					nlconst::magic(100.0) * static_cast<nl_fptype>(this->m_iterative_fail)
 						/ static_cast<nl_fptype>(this->m_stat_calculations),
 					static_cast<nl_fptype>(this->m_iterative_total) / static_cast<nl_fptype>(this->m_stat_calculations));
+			if (this->has_dynamic_devices())
+			{
+				pstring line;
+				for (std::size_t i = 0; i < m_stat_nr_hist.size(); i++)
+					if (m_stat_nr_hist[i] != 0)
+						line += plib::pfmt(" <={1}:{2}")(std::size_t(1) << i)(m_stat_nr_hist[i]);
+				log().verbose("       newton raphson loops histogram:{1}", line);
+			}
 		}
 	}
 
@@ -16,6 +16,8 @@
 #include "netlist/plib/putil.h"
 #include "netlist/plib/vector_ops.h"
 
+#include <array>
+
 namespace netlist
 {
 namespace solver
@@ -25,7 +27,8 @@ namespace solver
 		ASCENDING,
 		DESCENDING,
 		PREFER_IDENTITY_TOP_LEFT,
-		PREFER_BAND_MATRIX
+		PREFER_BAND_MATRIX,
+		MIN_DEGREE
 	)
 
 	P_ENUM(matrix_type_e,
@@ -35,7 +38,8 @@ namespace solver
 		SM,
 		W,
 		SOR,
-		GMRES
+		GMRES,
+		MAT_MIXED
 	)
 
 	P_ENUM(matrix_fp_type_e,
@@ -52,6 +56,7 @@ namespace solver
 
 		// iteration parameters
 		, m_gs_sor(parent,   "SOR_FACTOR", nlconst::magic(1.059))
+		, m_gs_chebyshev(parent, "SOR_CHEBYSHEV", false) ///< Chebyshev accelerated over relaxation factor for red-black SOR_MAT
 		, m_method(parent,   "METHOD", matrix_type_e::MAT_CR)
 		, m_fp_type(parent,  "FPTYPE", matrix_fp_type_e::DOUBLE)
 		, m_reltol(parent,   "RELTOL", nlconst::magic(1e-3))            ///< SPICE RELTOL parameter
@@ -59,24 +64,35 @@ namespace solver
 		, m_accuracy(parent, "ACCURACY", nlconst::magic(1e-7))          ///< Iterative solver accuracy
 		, m_nr_loops(parent, "NR_LOOPS", 250)           ///< Maximum number of Newton-Raphson loops
 		, m_gs_loops(parent, "GS_LOOPS", 9)             ///< Maximum number of Gauss-Seidel loops
+		, m_gmres_ilu_level(parent, "GMRES_ILU_LEVEL", 0) ///< fill level k of the GMRES ILU(k) preconditioner
+		, m_gmres_ilu_reuse(parent, "GMRES_ILU_REUSE", nlconst::zero()) ///< relative matrix change before refactorizing the ILU, 0: always
+		, m_gmres_restart(parent, "GMRES_RESTART", 80)  ///< GMRES iterations before restart, at most 80
 
 		// general parameters
 		, m_gmin(parent, "GMIN", nlconst::magic(1e-9))
 		, m_pivot(parent, "PIVOT", false)               ///< use pivoting on supported solvers
 		, m_nr_recalc_delay(parent, "NR_RECALC_DELAY",
 			netlist_time::quantum().as_fp<nl_fptype>()) ///< Delay to next solve attempt if nr loops exceeded
+		, m_nr_predictor(parent, "NR_PREDICTOR", false) ///< extrapolate Newton-Raphson start values from previous steps
+		, m_nr_max_step(parent, "NR_MAX_STEP", nlconst::zero()) ///< maximum voltage change per Newton-Raphson loop, 0: unlimited
 		, m_parallel(parent, "PARALLEL", 0)
 
 		// automatic time step
 		, m_dynamic_ts(parent, "DYNAMIC_TS", false)     ///< Use dynamic time stepping
 		, m_dynamic_lte(parent, "DYNAMIC_LTE", nlconst::magic(1e-5))    ///< dynamic time stepping slope
 		, m_dynamic_min_ts(parent, "DYNAMIC_MIN_TIMESTEP", nlconst::magic(1e-6)) ///< smallest time step allowed
+		, m_dynamic_max_ts(parent, "DYNAMIC_MAX_TIMESTEP", nlconst::zero()) ///< largest time step allowed, 0: 1/FREQ
+		, m_dynamic_growth(parent, "DYNAMIC_GROWTH", nlconst::zero()) ///< maximum time step growth per solve, 0: unlimited
 
 		// matrix sorting
 		, m_sort_type(parent, "SORT_TYPE", matrix_sort_type_e::PREFER_IDENTITY_TOP_LEFT)
 
 		// special
 		, m_use_gabs(parent, "USE_GABS", true)
+		, m_bypass(parent, "BYPASS", false)             ///< reschedule idle solvers with exponential backoff
+		, m_bypass_max_shift(parent, "BYPASS_MAX_SHIFT", 6) ///< maximum backoff is 2^BYPASS_MAX_SHIFT time steps
+		, m_split_r(parent, "SPLIT_R", nlconst::zero()) ///< solve nets coupled only by resistors >= SPLIT_R separately, 0: off
+		, m_split_loops(parent, "SPLIT_LOOPS", 0)       ///< relaxation sweeps per time step across SPLIT_R, 0: one step delayed coupling
 
 		{
 			m_min_timestep = m_dynamic_min_ts();
@@ -84,7 +100,9 @@ namespace solver
 
 			if (m_dynamic_ts)
 			{
-				m_max_timestep *= 1;//NL_FCONST(1000.0);
+				// Step sizes are decoupled from the output rate if requested
+				if (m_dynamic_max_ts() > nlconst::zero())
+					m_max_timestep = netlist_time::from_fp(m_dynamic_max_ts()).as_fp<decltype(m_max_timestep)>();
 			}
 			else
 			{
@@ -94,6 +112,7 @@ namespace solver
 
 		param_fp_t m_freq;
 		param_fp_t m_gs_sor;
+		param_logic_t m_gs_chebyshev;
 		param_enum_t<matrix_type_e> m_method;
 		param_enum_t<matrix_fp_type_e> m_fp_type;
 		param_fp_t m_reltol;
@@ -101,16 +120,27 @@ namespace solver
 		param_fp_t m_accuracy;
 		param_num_t<std::size_t> m_nr_loops;
 		param_num_t<std::size_t> m_gs_loops;
+		param_num_t<std::size_t> m_gmres_ilu_level;
+		param_fp_t m_gmres_ilu_reuse;
+		param_num_t<std::size_t> m_gmres_restart;
 		param_fp_t m_gmin;
 		param_logic_t  m_pivot;
 		param_fp_t m_nr_recalc_delay;
+		param_logic_t m_nr_predictor;
+		param_fp_t m_nr_max_step;
 		param_int_t m_parallel;
 		param_logic_t  m_dynamic_ts;
 		param_fp_t m_dynamic_lte;
 		param_fp_t m_dynamic_min_ts;
+		param_fp_t m_dynamic_max_ts;
+		param_fp_t m_dynamic_growth;
 		param_enum_t<matrix_sort_type_e> m_sort_type;
 
 		param_logic_t m_use_gabs;
+		param_logic_t m_bypass;
+		param_num_t<std::size_t> m_bypass_max_shift;
+		param_fp_t m_split_r;
+		param_num_t<std::size_t> m_split_loops;
 
 		nl_fptype m_min_timestep;
 		nl_fptype m_max_timestep;
@@ -169,6 +199,18 @@ namespace solver
 		analog_net_t *m_proxied_net; // only for proxy nets in analog input logic
 	};
 
+	/// \brief Terminal of a resistor at which net groups are split
+	///
+	/// Net groups coupled only through resistors of at least split_r are
+	/// solved by separate solvers. Each solver treats the voltage of the
+	/// other side as known, like a rail.
+	///
+	/// \param term terminal to check
+	/// \param split_r minimum resistance, 0 disables splitting
+	/// \return true if the group is split at this terminal
+	///
+	bool is_split_terminal(const terminal_t &term, nl_fptype split_r) noexcept;
+
 	class matrix_solver_t : public device_t
 	{
 	public:
@@ -180,10 +222,49 @@ namespace solver
 		const netlist_time solve(netlist_time_ext now);
 		void update_inputs();
 
+		/// \brief Schedule solvers reading nets of this solver across a split.
+		///
+		/// Reads the nets and state of other solvers and thus must not be
+		/// called from within a parallel section.
+		///
+		void update_coupled();
+
 		bool has_dynamic_devices() const noexcept { return !m_dynamic_devices.empty(); }
 		bool has_timestep_devices() const noexcept { return !m_step_devices.empty(); }
 
 		void update_forced();
+
+		/// \brief Register with the solvers owning nets read as rails.
+		///
+		/// Must be called once all solvers were created. These solvers
+		/// will schedule a solve of this solver if the voltage of one of
+		/// these nets changes.
+		///
+		void register_split_coupling();
+
+		/// \brief Reads nets across a split.
+		bool has_split_nets() const noexcept { return !m_split_nets.empty(); }
+
+		/// \brief Nets read across a split moved since the last snapshot.
+		///
+		/// Changes below VNTOL + RELTOL * |V| are ignored.
+		///
+		bool split_changed() const noexcept;
+
+		/// \brief Copy the voltages of nets read across a split.
+		///
+		/// Solves use these values instead of the live nets. Must be
+		/// called outside of parallel sections before solve or resolve.
+		///
+		void snapshot_split() noexcept;
+
+		/// \brief Solve again at the time of the last solve.
+		///
+		/// Time step devices are not advanced. Used to relax the coupling
+		/// across splits after the nets read across the split changed.
+		///
+		void resolve();
+
 		void update_after(netlist_time after) noexcept
 		{
 			m_Q_sync.net().toggle_and_push_to_queue(after);
@@ -203,6 +284,9 @@ namespace solver
 		// return number of floating point operations for solve
 		std::size_t ops() { return m_ops; }
 
+		// number of matrix solves done so far
+		std::size_t solve_count() const noexcept { return m_stat_calculations(); }
+
 	protected:
 		template <typename T>
 		using aligned_alloc = plib::aligned_allocator<T, PALIGN_VECTOROPT>;
@@ -214,6 +298,43 @@ namespace solver
 		virtual unsigned vsolve_non_dynamic(bool newton_raphson) = 0;
 		virtual netlist_time compute_next_timestep(nl_fptype cur_ts) = 0;
 
+		/// \brief Compile solver code at runtime.
+		///
+		/// Uses the compiler command given in environment variable NL_JIT_CXX
+		/// to build the code returned by create_solver_code into a shared
+		/// library. Libraries are cached in the directory given by NL_JIT_CACHE
+		/// (default: current directory) using the symbol name as the file name
+		/// and are only compiled if not found.
+		///
+		/// \returns Loaded library or nullptr if it could not be loaded.
+		///
+		plib::unique_ptr<plib::dynlib> jit_compile();
+
+		using fill_mat_t = std::vector<std::vector<unsigned>>;
+		using fill_result_t = std::pair<std::size_t, std::size_t>;
+
+		/// \brief Load an elimination plan from the setup cache.
+		///
+		/// The cache is located in the directory given by environment
+		/// variable NL_SETUP_CACHE and disabled if the variable is not set.
+		/// Plans are keyed by the structure of the unextended fill matrix.
+		/// The structure is stored in the file as well and must match
+		/// exactly, so hash collisions or stale files are never used.
+		///
+		/// \param fill unextended fill matrix, replaced by the extended one on success.
+		/// \param res fill statistics as returned by gaussian_extend_fill_mat.
+		/// \returns true if a plan was found.
+		///
+		bool load_fill_plan(fill_mat_t &fill, fill_result_t &res);
+
+		/// \brief Save an elimination plan to the setup cache.
+		///
+		/// \param orig unextended fill matrix used as the key.
+		/// \param fill extended fill matrix.
+		/// \param res fill statistics as returned by gaussian_extend_fill_mat.
+		///
+		void save_fill_plan(const fill_mat_t &orig, const fill_mat_t &fill, const fill_result_t &res);
+
 		plib::pmatrix2d<nl_fptype, aligned_alloc<nl_fptype>>        m_gonn;
 		plib::pmatrix2d<nl_fptype, aligned_alloc<nl_fptype>>        m_gtn;
 		plib::pmatrix2d<nl_fptype, aligned_alloc<nl_fptype>>        m_Idrn;
@@ -231,11 +352,31 @@ namespace solver
 		plib::aligned_vector<terms_for_net_t> m_rails_temp;
 		std::vector<unique_pool_ptr<proxied_analog_output_t>> m_inps;
 
+		// nets of other solvers read across a split
+		std::vector<analog_net_t *> m_split_nets;
+		// their voltages used by solves, see snapshot_split
+		std::vector<nl_fptype> m_split_V;
+		// solvers reading nets of this solver across a split
+		struct coupled_solver_t
+		{
+			analog_net_t *net;
+			matrix_solver_t *solver;
+			nl_fptype last_V;
+		};
+		std::vector<coupled_solver_t> m_coupled;
+
 		state_var<std::size_t> m_stat_calculations;
 		state_var<std::size_t> m_stat_newton_raphson;
 		state_var<std::size_t> m_stat_vsolver_calls;
+		// Newton-Raphson loop histogram, bucket i counts 2^(i-1) < loops <= 2^i
+		std::array<std::size_t, 10> m_stat_nr_hist;
 
 		state_var<netlist_time_ext> m_last_step;
+		state_var<std::size_t> m_bypass_shift;
+		std::vector<nl_fptype> m_bypass_V;
+		// Newton-Raphson predictor: voltages and time step of last solve
+		std::vector<nl_fptype> m_pred_V;
+		nl_fptype m_pred_h;
 		std::vector<core_device_t *> m_step_devices;
 		std::vector<core_device_t *> m_dynamic_devices;
 
@@ -247,17 +388,27 @@ namespace solver
 		// base setup - called from constructor
 		void setup_base(const analog_net_t::list_t &nets) noexcept(false);
 
+		void predict_nr_start(nl_fptype delta) noexcept;
+		void solve_nets();
+
 		void sort_terms(matrix_sort_type_e sort);
+		void sort_min_degree();
 
 		void update_dynamic();
 		void step(const netlist_time &delta);
 
+		// returns the time step adjusted for bypassing idle solvers
+		netlist_time bypass_timestep(netlist_time ts) noexcept;
+
 		int get_net_idx(const analog_net_t *net) const noexcept;
 		std::pair<int, int> get_left_right_of_diag(std::size_t irow, std::size_t idiag);
 		nl_fptype get_weight_around_diag(std::size_t row, std::size_t diag);
 
 		void add_term(std::size_t net_idx, terminal_t *term) noexcept(false);
 
+		static std::string fill_plan_key(const fill_mat_t &fill);
+		pstring fill_plan_name(const std::string &key, std::size_t size);
+
 		// calculate matrix
 		void setup_matrix();
 
@@ -396,6 +547,13 @@ namespace solver
 				this->m_terms[i].setV(m_new_V[i]);
 		}
 
+		/// \brief Check Newton-Raphson convergence
+		///
+		/// If NR_MAX_STEP is set, the voltage changes in m_new_V are
+		/// limited to NR_MAX_STEP as well.
+		///
+		/// \returns true if not converged
+		///
 		bool check_err()
 		{
 			// NOTE: Ideally we should also include currents (RHS) here. This would
@@ -405,15 +563,22 @@ namespace solver
 			const std::size_t iN = size();
 			const auto reltol(static_cast<FT>(m_params.m_reltol));
 			const auto vntol(static_cast<FT>(m_params.m_vntol));
+			const auto maxstep(static_cast<FT>(m_params.m_nr_max_step));
+			bool err(false);
 			for (std::size_t i = 0; i < iN; i++)
 			{
 				const auto vold(this->m_terms[i].template getV<FT>());
 				const auto vnew(m_new_V[i]);
 				const auto tol(vntol + reltol * std::max(plib::abs(vnew),plib::abs(vold)));
 				if (plib::abs(vnew - vold) > tol)
-					return true;
+				{
+					if (maxstep <= plib::constants<FT>::zero())
+						return true;
+					err = true;
+					m_new_V[i] = std::max(vold - maxstep, std::min(vold + maxstep, vnew));
+				}
 			}
-			return false;
+			return err;
 		}
 
 		netlist_time compute_next_timestep(const nl_fptype cur_ts) override
@@ -446,6 +611,10 @@ namespace solver
 
 					new_solver_timestep = std::min(new_net_timestep, new_solver_timestep);
 				}
+				// Limit step growth. Shrinking is not limited so fast edges
+				// are picked up on the next step.
+				if (m_params.m_dynamic_growth() > nlconst::zero())
+					new_solver_timestep = std::min(new_solver_timestep, std::max(cur_ts, m_params.m_min_timestep) * m_params.m_dynamic_growth());
 				new_solver_timestep = std::max(new_solver_timestep, m_params.m_min_timestep);
 			}
 
@@ -537,6 +706,84 @@ namespace solver
 
 		}
 
+		/// \brief Only calculate the right hand side.
+		///
+		/// The results are bit-identical to the RHS calculated by
+		/// fill_matrix_and_rhs.
+		///
+		void fill_rhs()
+		{
+			const std::size_t N = size();
+
+			for (std::size_t k = 0; k < N; k++)
+			{
+				auto &net = m_terms[k];
+
+				const std::size_t term_count = net.count();
+				const std::size_t railstart = net.railstart();
+				const auto &go = m_gonn[k];
+				const auto &Idr = m_Idrn[k];
+				const auto &cnV = m_connected_net_Vn[k];
+
+				auto RHS_t (nlconst::zero());
+
+				for (std::size_t i = 0; i < term_count; i++)
+					RHS_t         += Idr[i];
+
+				for (std::size_t i = railstart; i < term_count; i++)
+					RHS_t +=  (- go[i]) * *cnV[i];
+
+				m_RHS[k] = static_cast<FT>(RHS_t);
+			}
+		}
+
+		/// \brief Check whether the matrix changed since the last call.
+		///
+		/// Compares the conductances fill_matrix_and_rhs uses to populate
+		/// the matrix with the values seen on the previous call and
+		/// updates the cached values.
+		///
+		/// \returns true if the matrix changed or on the first call.
+		///
+		bool matrix_changed()
+		{
+			const std::size_t N = size();
+			bool changed(m_mat_cache.empty());
+			if (changed)
+			{
+				std::size_t cnt(0);
+				for (std::size_t k = 0; k < N; k++)
+					cnt += m_terms[k].railstart() + m_terms[k].count();
+				m_mat_cache.resize(cnt);
+			}
+
+			auto *c = m_mat_cache.data();
+			for (std::size_t k = 0; k < N; k++)
+			{
+				const std::size_t term_count = m_terms[k].count();
+				const std::size_t railstart = m_terms[k].railstart();
+				const auto &go = m_gonn[k];
+				const auto &gt = m_gtn[k];
+
+				for (std::size_t i = 0; i < railstart; i++, c++)
+					if (*c != go[i])
+					{
+						*c = go[i];
+						changed = true;
+					}
+				for (std::size_t i = 0; i < term_count; i++, c++)
+					if (*c != gt[i])
+					{
+						*c = gt[i];
+						changed = true;
+					}
+			}
+			return changed;
+		}
+
+	private:
+		std::vector<nl_fptype> m_mat_cache;
+
 	};
 
 } // namespace solver
@@ -32,7 +32,7 @@ namespace solver
 			const analog_net_t::list_t &nets,
 			const solver_parameters_t *params, const std::size_t size);
 
-		void reset() override { matrix_solver_t::reset(); }
+		void reset() override { matrix_solver_t::reset(); m_lu_valid = false; }
 
 	private:
 
@@ -47,11 +47,24 @@ namespace solver
 
 		void LE_solve();
 
+		/// \brief Apply the elimination stored by LE_solve to the RHS.
+		///
+		/// Together with LE_back_subst this solves for a new right hand
+		/// side without factorizing the matrix again.
+		///
+		template <typename T>
+		void LE_solve_rhs(T & rhs);
+
 		template <typename T>
 		void LE_back_subst(T & x);
 
 		PALIGNAS_VECTOROPT()
 		plib::parray2D<FT, SIZE, m_pitch_ABS> m_A;
+
+	private:
+		// m_A contains the factorization of the current matrix
+		bool m_lu_valid;
+		std::vector<std::size_t> m_pivot_row;
 	};
 
 	// ----------------------------------------------------------------------------------------
@@ -77,6 +90,8 @@ namespace solver
 					for (auto &k : nzrd)
 						m_A[j][k] += m_A[i][k] * f1;
 					this->m_RHS[j] += this->m_RHS[i] * f1;
+					// not used any longer, keep factor for LE_solve_rhs
+					m_A[j][i] = f1;
 				}
 			}
 		}
@@ -93,6 +108,7 @@ namespace solver
 						maxrow = j;
 				}
 
+				m_pivot_row[i] = maxrow;
 				if (maxrow != i)
 				{
 					// Swap the maxrow and ith row
@@ -120,11 +136,43 @@ namespace solver
 							//A(j,k) += A(i,k) * f1;
 						this->m_RHS[j] += this->m_RHS[i] * f1;
 					}
+					// not used any longer, keep factor for LE_solve_rhs
+					m_A[j][i] = f1;
 				}
 			}
 		}
 	}
 
+	template <typename FT, int SIZE>
+	template <typename T>
+	void matrix_solver_direct_t<FT, SIZE>::LE_solve_rhs(T & rhs)
+	{
+		const std::size_t kN = this->size();
+		if (!this->m_params.m_pivot)
+		{
+			for (std::size_t i = 0; i < kN; i++)
+			{
+				for (auto &j : this->m_terms[i].m_nzbd)
+					rhs[j] += rhs[i] * m_A[j][i];
+			}
+		}
+		else
+		{
+			// Row swaps were applied to the stored factors as well.
+			// Permute first, then eliminate.
+			for (std::size_t i = 0; i < kN; i++)
+				if (m_pivot_row[i] != i)
+					std::swap(rhs[i], rhs[m_pivot_row[i]]);
+			for (std::size_t i = 0; i < kN; i++)
+			{
+				const FT ri = rhs[i];
+				if (ri != plib::constants<FT>::zero())
+					for (std::size_t j = i + 1; j < kN; j++)
+						rhs[j] += ri * m_A[j][i];
+			}
+		}
+	}
+
 	template <typename FT, int SIZE>
 	template <typename T>
 	void matrix_solver_direct_t<FT, SIZE>::LE_back_subst(
@@ -137,9 +185,7 @@ namespace solver
 		{
 			for (std::size_t j = kN; j-- > 0; )
 			{
-				FT tmp = 0;
-				for (std::size_t k = j+1; k < kN; k++)
-					tmp += m_A[j][k] * x[k];
+				const FT tmp = plib::vec_mult_p(kN-j-1, &(m_A[j][j+1]), x.data() + j + 1);
 				x[j] = (this->m_RHS[j] - tmp) / m_A[j][j];
 			}
 		}
@@ -173,11 +219,28 @@ namespace solver
 	template <typename FT, int SIZE>
 	unsigned matrix_solver_direct_t<FT, SIZE>::vsolve_non_dynamic(bool newton_raphson)
 	{
+		// Linear, time-invariant circuits only change the right hand side
+		// between steps. Reuse the factorization in this case.
+		if (m_lu_valid && !this->matrix_changed())
+		{
+			this->fill_rhs();
+			this->LE_solve_rhs(this->m_RHS);
+			this->LE_back_subst(this->m_new_V);
+
+			bool err(false);
+			if (newton_raphson)
+				err = this->check_err();
+			this->store();
+			return (err) ? 2 : 1;
+		}
+
 		// populate matrix
 		this->clear_square_mat(m_A);
 		this->fill_matrix_and_rhs();
 
-		return this->solve_non_dynamic(newton_raphson);
+		const unsigned ret(this->solve_non_dynamic(newton_raphson));
+		m_lu_valid = true;
+		return ret;
 	}
 
 	template <typename FT, int SIZE>
@@ -188,6 +251,8 @@ namespace solver
 	: matrix_solver_ext_t<FT, SIZE>(anetlist, name, nets, params, size)
 	, m_pitch(m_pitch_ABS ? m_pitch_ABS : (((size + 0) + 7) / 8) * 8)
 	, m_A(size, m_pitch)
+	, m_lu_valid(false)
+	, m_pivot_row(size)
 	{
 		this->build_mat_ptr(m_A);
 	}
@@ -37,6 +37,7 @@ namespace solver
 			const solver_parameters_t *params, const std::size_t size)
 		: matrix_solver_ext_t<FT, SIZE>(anetlist, name, nets, params, size)
 		, mat(static_cast<typename mat_type::index_type>(size))
+		, m_jit_lib()
 		, m_proc()
 		{
 			const std::size_t iN = this->size();
@@ -58,7 +59,15 @@ namespace solver
 
 			}
 
-			auto gr = mat.gaussian_extend_fill_mat(fill);
+			std::pair<std::size_t, std::size_t> gr;
+			if (this->load_fill_plan(fill, gr))
+				mat.use_extended_fill_mat(fill);
+			else
+			{
+				const auto orig(fill);
+				gr = mat.gaussian_extend_fill_mat(fill);
+				this->save_fill_plan(orig, fill, gr);
+			}
 
 			this->log_fill(fill, mat);
 
@@ -95,7 +104,15 @@ namespace solver
 			// During extended validation there is no reason to check for
 			// differences in the generated code since during
 			// extended validation this will be different (and non-functional)
-			if (!anetlist.is_extended_validation() && anetlist.lib().isLoaded())
+			if (!anetlist.is_extended_validation())
+			{
+				pstring symname = static_compile_name();
+				m_proc.load(anetlist.static_solver<void (*)(FT *, FT *, FT *)>(symname));
+				if (m_proc.resolved())
+					anetlist.log().info("Linked static solver {1} found ...", symname);
+			}
+
+			if (!anetlist.is_extended_validation() && !m_proc.resolved() && anetlist.lib().isLoaded())
 			{
 				pstring symname = static_compile_name();
 				m_proc.load(anetlist.lib(), symname);
@@ -108,6 +125,19 @@ namespace solver
 					anetlist.log().warning("External static solver {1} not found ...", symname);
 				}
 			}
+
+			// No prebuilt static solver - try to compile one
+			if (!anetlist.is_extended_validation() && !m_proc.resolved())
+			{
+				m_jit_lib = this->jit_compile();
+				if (m_jit_lib)
+				{
+					pstring symname = static_compile_name();
+					m_proc.load(*m_jit_lib, symname);
+					if (m_proc.resolved())
+						anetlist.log().info("JIT static solver {1} loaded ...", symname);
+				}
+			}
 		}
 
 		unsigned vsolve_non_dynamic(bool newton_raphson) override;
@@ -124,6 +154,7 @@ namespace solver
 
 		mat_type mat;
 
+		plib::unique_ptr<plib::dynlib> m_jit_lib; // must outlive m_proc
 		plib::dynproc<void, FT * , FT * , FT * > m_proc;
 
 	};
@@ -38,11 +38,14 @@ namespace solver
 			const solver_parameters_t *params,
 			const std::size_t size)
 			: matrix_solver_direct_t<FT, SIZE>(anetlist, name, nets, params, size)
-			, m_ops(size, 0)
+			, m_ops(size, params->m_gmres_ilu_level())
 			, m_gmres(size)
 			{
 			const std::size_t iN = this->size();
 
+			m_ops.set_reuse_tolerance(static_cast<FT>(params->m_gmres_ilu_reuse()));
+			m_gmres.set_restart(params->m_gmres_restart());
+
 			std::vector<std::vector<unsigned>> fill(iN);
 
 			for (std::size_t k=0; k<iN; k++)
@@ -0,0 +1,249 @@
+// license:GPL-2.0+
+// copyright-holders:Couriersud
+
+#ifndef NLD_MS_MIXED_H_
+#define NLD_MS_MIXED_H_
+
+///
+/// \file nld_ms_mixed.h
+///
+/// Mixed precision direct solver
+///
+/// The matrix is factorized in float precision. The solution is refined
+/// in FT precision until the correction is below ACCURACY or GS_LOOPS
+/// refinement steps were done:
+///
+///     x_0 = LU^-1 b
+///     r_i = b - A x_i         (FT)
+///     x_i+1 = x_i + LU^-1 r_i (float)
+///
+/// The factorization uses the elimination pattern of the direct solver
+/// without pivoting.
+///
+/// Refinement only converges if cond(A) * eps(float) < 1. If refinement
+/// diverges or does not converge, the matrix is factorized in FT precision
+/// as well and this factorization is used until the matrix changes.
+///
+
+#include "nld_matrix_solver.h"
+#include "nld_solver.h"
+#include "plib/parray.h"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace netlist
+{
+namespace solver
+{
+
+	template <typename FT, int SIZE>
+	class matrix_solver_mixed_t: public matrix_solver_ext_t<FT, SIZE>
+	{
+	public:
+
+		using float_type = FT;
+		using lu_type = float;
+
+		matrix_solver_mixed_t(netlist_state_t &anetlist, const pstring &name,
+			const analog_net_t::list_t &nets,
+			const solver_parameters_t *params, const std::size_t size);
+
+		void reset() override { matrix_solver_t::reset(); m_lu_valid = false; }
+
+	private:
+
+		const std::size_t m_pitch;
+
+	protected:
+		static constexpr const std::size_t SIZEABS = plib::parray<FT, SIZE>::SIZEABS();
+		static constexpr const std::size_t m_pitch_ABS = (((SIZEABS + 0) + 7) / 8) * 8;
+
+		unsigned vsolve_non_dynamic(bool newton_raphson) override;
+
+	private:
+		template <typename M>
+		void LU_factorize(M &lu);
+
+		/// \brief Solve LU x = b in place.
+		template <typename M, typename V>
+		void LU_solve(const M &lu, V &x);
+
+		/// \brief Iterative refinement using the float factorization
+		///
+		/// \returns false if refinement did not converge
+		///
+		bool refine();
+
+		PALIGNAS_VECTOROPT()
+		plib::parray2D<FT, SIZE, m_pitch_ABS> m_A;
+		PALIGNAS_VECTOROPT()
+		plib::parray2D<lu_type, SIZE, m_pitch_ABS> m_LU;
+		PALIGNAS_VECTOROPT()
+		plib::parray2D<FT, SIZE, m_pitch_ABS> m_LU_FT;
+		PALIGNAS_VECTOROPT()
+		plib::parray<lu_type, SIZE> m_d;
+
+		// m_LU contains the factorization of the current matrix
+		bool m_lu_valid;
+		// m_LU_FT is used for the current matrix
+		bool m_fallback;
+	};
+
+	// ----------------------------------------------------------------------------------------
+	// matrix_solver_mixed
+	// ----------------------------------------------------------------------------------------
+
+	template <typename FT, int SIZE>
+	template <typename M>
+	void matrix_solver_mixed_t<FT, SIZE>::LU_factorize(M &lu)
+	{
+		using T = typename std::decay<decltype(lu[0][0])>::type;
+		const std::size_t kN = this->size();
+
+		// fill-in elements must start at zero
+		this->clear_square_mat(lu);
+		for (std::size_t i = 0; i < kN; i++)
+			for (auto &k : this->m_terms[i].m_nz)
+				lu[i][k] = static_cast<T>(m_A[i][k]);
+
+		for (std::size_t i = 0; i < kN; i++)
+		{
+			// FIXME: Singular matrix?
+			const T f = plib::reciprocal(lu[i][i]);
+			const auto &nzrd = this->m_terms[i].m_nzrd;
+			const auto &nzbd = this->m_terms[i].m_nzbd;
+
+			for (auto &j : nzbd)
+			{
+				const T f1 = -f * lu[j][i];
+				for (auto &k : nzrd)
+					lu[j][k] += lu[i][k] * f1;
+				// keep factor for LU_solve
+				lu[j][i] = f1;
+			}
+		}
+	}
+
+	template <typename FT, int SIZE>
+	template <typename M, typename V>
+	void matrix_solver_mixed_t<FT, SIZE>::LU_solve(const M &lu, V &x)
+	{
+		using T = typename std::decay<decltype(x[0])>::type;
+		const std::size_t kN = this->size();
+
+		for (std::size_t i = 0; i < kN; i++)
+		{
+			for (auto &j : this->m_terms[i].m_nzbd)
+				x[j] += x[i] * lu[j][i];
+		}
+
+		for (std::size_t j = kN; j-- > 0; )
+		{
+			T tmp = 0;
+			for (auto &k : this->m_terms[j].m_nzrd)
+				tmp += lu[j][k] * x[k];
+			x[j] = (x[j] - tmp) / lu[j][j];
+		}
+	}
+
+	template <typename FT, int SIZE>
+	bool matrix_solver_mixed_t<FT, SIZE>::refine()
+	{
+		const std::size_t kN = this->size();
+
+		for (std::size_t i = 0; i < kN; i++)
+			m_d[i] = static_cast<lu_type>(this->m_RHS[i]);
+		this->LU_solve(m_LU, m_d);
+		for (std::size_t i = 0; i < kN; i++)
+			this->m_new_V[i] = static_cast<FT>(m_d[i]);
+
+		const auto accuracy(static_cast<FT>(this->m_params.m_accuracy));
+		std::size_t iter = 0;
+		auto last_err(plib::constants<FT>::zero());
+		do
+		{
+			// residual in full precision
+			for (std::size_t i = 0; i < kN; i++)
+			{
+				FT r(this->m_RHS[i]);
+				for (auto &k : this->m_terms[i].m_nz)
+					r -= m_A[i][k] * this->m_new_V[k];
+				m_d[i] = static_cast<lu_type>(r);
+			}
+			this->LU_solve(m_LU, m_d);
+
+			auto err(plib::constants<FT>::zero());
+			for (std::size_t i = 0; i < kN; i++)
+			{
+				const auto d(static_cast<FT>(m_d[i]));
+				this->m_new_V[i] += d;
+				err = std::max(err, plib::abs(d));
+			}
+			iter++;
+			this->m_iterative_total++;
+			if (err <= accuracy)
+				return true;
+			// diverging - this also catches NaN
+			if (iter > 1 && !(err < last_err))
+				return false;
+			last_err = err;
+		} while (iter < this->m_params.m_gs_loops);
+		return false;
+	}
+
+	template <typename FT, int SIZE>
+	unsigned matrix_solver_mixed_t<FT, SIZE>::vsolve_non_dynamic(bool newton_raphson)
+	{
+		if (m_lu_valid && !this->matrix_changed())
+			this->fill_rhs();
+		else
+		{
+			this->clear_square_mat(m_A);
+			this->fill_matrix_and_rhs();
+			this->LU_factorize(m_LU);
+			m_lu_valid = true;
+			m_fallback = false;
+		}
+
+		if (!m_fallback && !refine())
+		{
+			this->m_iterative_fail++;
+			this->LU_factorize(m_LU_FT);
+			m_fallback = true;
+		}
+		if (m_fallback)
+		{
+			for (std::size_t i = 0; i < this->size(); i++)
+				this->m_new_V[i] = this->m_RHS[i];
+			this->LU_solve(m_LU_FT, this->m_new_V);
+		}
+
+		bool err(false);
+		if (newton_raphson)
+			err = this->check_err();
+		this->store();
+		return (err) ? 2 : 1;
+	}
+
+	template <typename FT, int SIZE>
+	matrix_solver_mixed_t<FT, SIZE>::matrix_solver_mixed_t(netlist_state_t &anetlist, const pstring &name,
+		const analog_net_t::list_t &nets,
+		const solver_parameters_t *params,
+		const std::size_t size)
+	: matrix_solver_ext_t<FT, SIZE>(anetlist, name, nets, params, size)
+	, m_pitch(m_pitch_ABS ? m_pitch_ABS : (((size + 0) + 7) / 8) * 8)
+	, m_A(size, m_pitch)
+	, m_LU(size, m_pitch)
+	, m_LU_FT(size, m_pitch)
+	, m_d(size)
+	, m_lu_valid(false)
+	, m_fallback(false)
+	{
+		this->build_mat_ptr(m_A);
+	}
+
+} // namespace solver
+} // namespace netlist
+
+#endif // NLD_MS_MIXED_H_
@@ -209,10 +209,15 @@ namespace solver
 		// NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
 		std::array<float_type, m_pitch> z;
 
-		if ((m_cnt % 50) == 0)
+		// Only rows which changed since the last solve are applied as
+		// rank-1 updates. Idle solvers or a single switch toggling thus
+		// never invert. Rounding errors accumulate with every update, so
+		// a complete inversion is done after 50 updates.
+		if (m_cnt == 0 || m_cnt > 50)
 		{
 			// complete calculation
 			this->LE_invert();
+			m_cnt = 1;
 		}
 		else
 		{
@@ -239,6 +244,7 @@ namespace solver
 
 				if (colcount > 0)
 				{
+					m_cnt++;
 					auto lamba(plib::constants<FT>::zero());
 					std::array<float_type, m_pitch> w = {0};
 
@@ -271,8 +277,6 @@ namespace solver
 			}
 		}
 
-		m_cnt++;
-
 		this->LE_compute_x(this->m_new_V);
 
 		bool err(false);
@@ -11,6 +11,12 @@
 ///
 /// For w==1 we will do the classic Gauss-Seidel approach
 ///
+/// Nets are coloured at setup so that no two nets of the same colour are
+/// coupled. Sweeps process one colour at a time; updates within a colour
+/// are independent of each other and are computed before being applied.
+/// If the nets are two-colourable (red-black), SOR_CHEBYSHEV replaces the
+/// fixed SOR_FACTOR by the Chebyshev sequence of relaxation factors.
+///
 
 #include "nld_matrix_solver.h"
 #include "nld_ms_direct.h"
@@ -37,15 +43,121 @@ namespace solver
 			const solver_parameters_t *params, std::size_t size)
 			: matrix_solver_direct_t<FT, SIZE>(anetlist, name, nets, params, size)
 			, m_omega(*this, "m_omega", static_cast<float_type>(params->m_gs_sor))
+			, m_delta(size)
 			{
+				colour_nets();
 			}
 
 		unsigned vsolve_non_dynamic(bool newton_raphson) override;
 
 	private:
+		void colour_nets();
+		float_type jacobi_radius_bound();
+
 		state_var<float_type> m_omega;
+		std::vector<unsigned> m_colour_order;     // net indices ordered by colour
+		std::vector<std::size_t> m_colour_start;  // start of each colour in m_colour_order plus end
+		std::vector<float_type> m_delta;          // updates of the current colour
 	};
 
+	// ----------------------------------------------------------------------------------------
+	// greedy graph colouring of the net coupling
+	// ----------------------------------------------------------------------------------------
+
+	template <typename FT, int SIZE>
+	void matrix_solver_SOR_mat_t<FT, SIZE>::colour_nets()
+	{
+		const std::size_t iN = this->size();
+
+		// m_nz is symmetric for netlist matrices, but don't rely on it
+		std::vector<std::vector<unsigned>> adj(iN);
+		for (std::size_t k = 0; k < iN; k++)
+			for (auto p : this->m_terms[k].m_nz)
+				if (p != k && p < iN)
+				{
+					adj[k].push_back(p);
+					adj[p].push_back(static_cast<unsigned>(k));
+				}
+
+		// try a red-black colouring first, ladders and chains are bipartite
+		std::vector<std::size_t> colour(iN, iN);
+		std::vector<std::size_t> queue;
+		bool bipartite = true;
+		for (std::size_t r = 0; r < iN && bipartite; r++)
+		{
+			if (colour[r] != iN)
+				continue;
+			colour[r] = 0;
+			queue.assign(1, r);
+			for (std::size_t q = 0; q < queue.size() && bipartite; q++)
+			{
+				const std::size_t k = queue[q];
+				for (auto p : adj[k])
+				{
+					if (colour[p] == iN)
+					{
+						colour[p] = 1 - colour[k];
+						queue.push_back(p);
+					}
+					else if (colour[p] == colour[k])
+						bipartite = false;
+				}
+			}
+		}
+
+		std::size_t colours = (iN > 1) ? 2 : iN;
+		if (!bipartite)
+		{
+			// greedy colouring in net order
+			std::vector<std::size_t> used(iN + 1, iN);
+			colours = 0;
+			std::fill(colour.begin(), colour.end(), iN);
+			for (std::size_t k = 0; k < iN; k++)
+			{
+				for (auto p : adj[k])
+					if (colour[p] != iN)
+						used[colour[p]] = k;
+				std::size_t c = 0;
+				while (used[c] == k)
+					c++;
+				colour[k] = c;
+				colours = std::max(colours, c + 1);
+			}
+		}
+
+		m_colour_start.assign(colours + 1, 0);
+		for (std::size_t k = 0; k < iN; k++)
+			m_colour_start[colour[k] + 1]++;
+		for (std::size_t c = 0; c < colours; c++)
+			m_colour_start[c + 1] += m_colour_start[c];
+		m_colour_order.resize(iN);
+		std::vector<std::size_t> pos(m_colour_start.begin(), m_colour_start.end() - 1);
+		for (std::size_t k = 0; k < iN; k++)
+			m_colour_order[pos[colour[k]]++] = static_cast<unsigned>(k);
+
+		this->log().verbose("SOR_MAT: {1} nets in {2} colours", iN, colours);
+	}
+
+	// ----------------------------------------------------------------------------------------
+	// Gershgorin bound of the spectral radius of the Jacobi iteration matrix
+	// ----------------------------------------------------------------------------------------
+
+	template <typename FT, int SIZE>
+	FT matrix_solver_SOR_mat_t<FT, SIZE>::jacobi_radius_bound()
+	{
+		const std::size_t iN = this->size();
+		float_type rho = plib::constants<FT>::zero();
+		for (std::size_t k = 0; k < iN; k++)
+		{
+			float_type s = plib::constants<FT>::zero();
+			for (auto p : this->m_terms[k].m_nz)
+				if (p != k)
+					s += plib::abs(this->m_A[k][p]);
+			rho = std::max(rho, s / plib::abs(this->m_A[k][k]));
+		}
+		return rho;
+	}
+
 	// ----------------------------------------------------------------------------------------
 	// matrix_solver - Gauss - Seidel
 	// ----------------------------------------------------------------------------------------
@@ -103,38 +215,74 @@ namespace solver
 		for (std::size_t k = 0; k < iN; k++)
 			this->m_new_V[k] = this->m_terms[k].template getV<FT>();
 
+		// Chebyshev acceleration needs a red-black ordering and a convergent
+		// Jacobi iteration; otherwise use the fixed factor
+		const std::size_t colours = m_colour_start.size() - 1;
+		float_type rho2 = plib::constants<FT>::zero();
+		bool chebyshev = false;
+		if (this->m_params.m_gs_chebyshev && colours == 2)
+		{
+			const float_type rho = jacobi_radius_bound();
+			rho2 = rho * rho;
+			chebyshev = (rho < plib::constants<FT>::one());
+		}
+		float_type omega = chebyshev ? plib::constants<FT>::one() : static_cast<float_type>(m_omega);
+		bool first = true;
+
 		do {
 			resched = false;
 			FT cerr = plib::constants<FT>::zero();
 
-			for (std::size_t k = 0; k < iN; k++)
+			for (std::size_t c = 0; c < colours; c++)
 			{
-				float_type Idrive = 0;
+				const std::size_t s = m_colour_start[c];
+				const std::size_t ce = m_colour_start[c + 1];
 
-				const auto *p = this->m_terms[k].m_nz.data();
-				const std::size_t e = this->m_terms[k].m_nz.size();
+				// nets of one colour are not coupled, so all updates of the
+				// colour can be computed before any is applied
+				for (std::size_t j = s; j < ce; j++)
+				{
+					const std::size_t k = m_colour_order[j];
+					float_type Idrive = 0;
 
-				for (std::size_t i = 0; i < e; i++)
-					Idrive = Idrive + this->m_A[k][p[i]] * this->m_new_V[p[i]];
+					const auto *p = this->m_terms[k].m_nz.data();
+					const std::size_t e = this->m_terms[k].m_nz.size();
 
-				FT w = m_omega / this->m_A[k][k];
-				if (this->m_params.m_use_gabs)
-				{
-					FT gabs_t = plib::constants<FT>::zero();
 					for (std::size_t i = 0; i < e; i++)
-						if (p[i] != k)
-							gabs_t = gabs_t + plib::abs(this->m_A[k][p[i]]);
+						Idrive = Idrive + this->m_A[k][p[i]] * this->m_new_V[p[i]];
 
-					gabs_t *= plib::constants<FT>::one(); // derived by try and error
-					if (gabs_t > this->m_A[k][k])
+					FT w = omega / this->m_A[k][k];
+					if (this->m_params.m_use_gabs)
 					{
-						w = plib::constants<FT>::one() / (this->m_A[k][k] + gabs_t);
+						FT gabs_t = plib::constants<FT>::zero();
+						for (std::size_t i = 0; i < e; i++)
+							if (p[i] != k)
+								gabs_t = gabs_t + plib::abs(this->m_A[k][p[i]]);
+
+						gabs_t *= plib::constants<FT>::one(); // derived by try and error
+						if (gabs_t > this->m_A[k][k])
+						{
+							w = plib::constants<FT>::one() / (this->m_A[k][k] + gabs_t);
+						}
 					}
+
+					m_delta[j] = w * (this->m_RHS[k] - Idrive);
 				}
 
-				const float_type delta = w * (this->m_RHS[k] - Idrive) ;
-				cerr = std::max(cerr, plib::abs(delta));
-				this->m_new_V[k] += delta;
+				for (std::size_t j = s; j < ce; j++)
+				{
+					cerr = std::max(cerr, plib::abs(m_delta[j]));
+					this->m_new_V[m_colour_order[j]] += m_delta[j];
+				}
+
+				// omega(1/2) = 1 / (1 - rho^2 / 2), omega(n+1/2) = 1 / (1 - rho^2 omega(n) / 4)
+				if (chebyshev)
+				{
+					const float_type half = plib::constants<FT>::half();
+					const float_type f = first ? rho2 * half : rho2 * omega * half * half;
+					omega = plib::constants<FT>::one() / (plib::constants<FT>::one() - f);
+					first = false;
+				}
 			}
 
 			if (cerr > static_cast<float_type>(this->m_params.m_accuracy))
@@ -68,6 +68,7 @@ namespace solver
 			const solver_parameters_t *params, const std::size_t size)
 		: matrix_solver_ext_t<FT, SIZE>(anetlist, name, nets, params, size)
 		, m_cnt(0)
+		, m_update_cost(0)
 		{
 			this->build_mat_ptr(m_A);
 		}
@@ -117,6 +118,8 @@ namespace solver
 		std::array<unsigned, storage_N> colcount;
 
 		unsigned m_cnt;
+		// work spent on low-rank corrections since the last inversion
+		std::size_t m_update_cost;
 	};
 
 	// ----------------------------------------------------------------------------------------
@@ -217,11 +220,17 @@ namespace solver
 		// NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
 		std::array<float_type, storage_N> w;
 
-		if ((m_cnt % 50) == 0)
+		// Corrections are relative to the last inverted matrix, so if
+		// only a switch toggled the rank stays small and the inverse can
+		// be kept. Invert again once the accumulated correction work
+		// exceeds the cost of an inversion.
+		if (m_cnt == 0 || m_update_cost > iN * iN * iN)
 		{
 			// complete calculation
 			this->LE_invert();
 			this->LE_compute_x(this->m_new_V);
+			m_cnt = 0;
+			m_update_cost = 0;
 		}
 		else
 		{
@@ -250,6 +259,8 @@ namespace solver
 			}
 			if (rowcount > 0)
 			{
+				m_update_cost += rowcount * iN;
+
 				// construct w = transform(V) * y
 				// dim: rowcount x iN
 				//
@@ -34,6 +34,7 @@
 #include "nld_ms_direct2.h"
 #include "nld_ms_gcr.h"
 #include "nld_ms_gmres.h"
+#include "nld_ms_mixed.h"
 #include "nld_ms_sm.h"
 #include "nld_ms_sor.h"
 #include "nld_ms_sor_mat.h"
@@ -42,6 +43,7 @@
 #include "plib/pomp.h"
 
 #include <algorithm>
+#include <unordered_map>
 
 namespace netlist
 {
@@ -64,6 +66,29 @@ namespace devices
 			s->log_stats();
 	}
 
+	template <typename F>
+	void NETLIB_NAME(solver)::for_each_solver(std::vector<solver::matrix_solver_t *> &solvers, std::size_t nthreads, F f)
+	{
+		if (m_pool && solvers.size() > 1)
+		{
+			exec().queue_staging_begin(m_pool->size());
+			m_pool->for_static(0, solvers.size(), [&solvers, &f](std::size_t i) { f(*solvers[i]); });
+			exec().queue_staging_end();
+		}
+		else if (nthreads > 1 && solvers.size() > 1)
+		{
+			exec().queue_staging_begin(nthreads);
+			plib::omp::set_num_threads(nthreads);
+			plib::omp::for_static(static_cast<std::size_t>(0), solvers.size(), [&solvers, &f](std::size_t i) { f(*solvers[i]); });
+			exec().queue_staging_end();
+		}
+		else
+		{
+			for (auto &solver : solvers)
+				f(*solver);
+		}
+	}
+
 	NETLIB_UPDATE(solver)
 	{
 		if (m_params.m_dynamic_ts)
@@ -78,24 +103,38 @@ namespace devices
 
 		std::vector<solver::matrix_solver_t *> &solvers = (force_solve ? m_mat_solvers_all : m_mat_solvers_timestepping);
 
-		if (nthreads > 1 && solvers.size() > 1)
+		if (m_has_split && m_params.m_split_loops() > 0)
 		{
-			plib::omp::set_num_threads(nthreads);
-			plib::omp::for_static(static_cast<std::size_t>(0), solvers.size(), [&solvers, now](std::size_t i)
+			relax_split(solvers, now, nthreads);
+		}
+		else
+		{
+			// Nets across a split are read from a snapshot. Solved serially
+			// each solver sees the solvers solved before it, in parallel
+			// all see the voltages from before the parallel section.
+			const bool parallel = solvers.size() > 1 && (m_pool || nthreads > 1);
+			if (m_has_split && parallel)
+				for (auto & solver : solvers)
+					solver->snapshot_split();
+
+			// Inputs are updated within the parallel section. Queue
+			// operations are staged per thread and merged afterwards.
+			for_each_solver(solvers, nthreads, [now, parallel](solver::matrix_solver_t &s)
 				{
-					const netlist_time ts = solvers[i]->solve(now);
+					if (!parallel)
+						s.snapshot_split();
+					const netlist_time ts = s.solve(now);
 					plib::unused_var(ts);
+					s.update_inputs();
 				});
 		}
-		else
-			for (auto & solver : solvers)
-			{
-				const netlist_time ts = solver->solve(now);
-				plib::unused_var(ts);
-			}
 
-		for (auto & solver : solvers)
-			solver->update_inputs();
+		// Coupling across splits reads other solvers' nets. Done serially
+		// once all solvers are finished. Solvers not settled by SPLIT_LOOPS
+		// are scheduled here as well.
+		if (m_has_split)
+			for (auto & solver : solvers)
+				solver->update_coupled();
 
 		// step circuit
 		if (!m_Q_step.net().is_queued())
@@ -104,6 +143,39 @@ namespace devices
 		}
 	}
 
+	void NETLIB_NAME(solver)::relax_split(std::vector<solver::matrix_solver_t *> &solvers, netlist_time_ext now, std::size_t nthreads)
+	{
+		// Relax the coupling across splits within the time step: all
+		// solvers read the other sides' voltages of the previous sweep,
+		// and only solvers which saw a change are solved again. This costs
+		// one barrier per sweep while the split voltages settle, instead
+		// of one extra queued solve per coupled solver and step.
+		// Sweeps solve from snapshots and thus do not depend on the
+		// number of threads.
+		for (auto &solver : solvers)
+			solver->snapshot_split();
+		for_each_solver(solvers, nthreads, [now](solver::matrix_solver_t &s)
+			{
+				const netlist_time ts = s.solve(now);
+				plib::unused_var(ts);
+			});
+
+		for (std::size_t loop = 0; loop < m_params.m_split_loops(); loop++)
+		{
+			m_relax.clear();
+			for (auto &solver : solvers)
+				if (solver->has_split_nets() && solver->split_changed())
+					m_relax.push_back(solver);
+			if (m_relax.empty())
+				break;
+			for (auto &solver : m_relax)
+				solver->snapshot_split();
+			for_each_solver(m_relax, nthreads, [](solver::matrix_solver_t &s) { s.resolve(); });
+		}
+
+		for_each_solver(solvers, nthreads, [](solver::matrix_solver_t &s) { s.update_inputs(); });
+	}
+
 	template <class C>
 	plib::unique_ptr<solver::matrix_solver_t> create_it(netlist_state_t &nl, pstring name,
 		analog_net_t::list_t &nets,
@@ -142,6 +214,9 @@ namespace devices
 				return create_it<solver::matrix_solver_SOR_t<FT, SIZE>>(state(), solvername, nets, m_params, size);
 			case solver::matrix_type_e::GMRES:
 				return create_it<solver::matrix_solver_GMRES_t<FT, SIZE>>(state(), solvername, nets, m_params, size);
+			case solver::matrix_type_e::MAT_MIXED:
+				// float factorization, FPTYPE refinement
+				return create_it<solver::matrix_solver_mixed_t<FT, SIZE>>(state(), solvername, nets, m_params, size);
 		}
 		return plib::unique_ptr<solver::matrix_solver_t>();
 	}
@@ -253,31 +328,34 @@ namespace devices
 	struct net_splitter
 	{
 
+		explicit net_splitter(nl_fptype split_r)
+		: m_split_r(split_r)
+		{ }
+
 		bool already_processed(const analog_net_t &n)
 		{
 			// no need to process rail nets - these are known variables
 			if (n.isRailNet())
 				return true;
-			// First check if it is in a previous group.
-			// In this case we need to merge this group into the current group
-			if (groupspre.size() > 1)
+			auto g = group_of.find(&n);
+			if (g == group_of.end())
+				return false;
+			// If it is in a previous group we need to merge this group
+			// into the current group
+			const std::size_t cur = groupspre.size() - 1;
+			if (g->second != cur)
 			{
-				for (std::size_t i = 0; i<groupspre.size() - 1; i++)
-					if (plib::container::contains(groupspre[i], &n))
-					{
-						// copy all nets
-						for (auto & cn : groupspre[i])
-							if (!plib::container::contains(groupspre.back(), cn))
-								groupspre.back().push_back(cn);
-						// clear
-						groupspre[i].clear();
-						return true;
-					}
+				auto &prev = groupspre[g->second];
+				// copy all nets
+				for (auto & cn : prev)
+				{
+					groupspre.back().push_back(cn);
+					group_of[cn] = cur;
+				}
+				// clear
+				prev.clear();
 			}
-			// if it's already processed - no need to continue
-			if (!groupspre.empty() && plib::container::contains(groupspre.back(), &n))
-				return true;
-			return false;
+			return true;
 		}
 
 		void process_net(netlist_state_t &netlist, analog_net_t &n)
@@ -288,6 +366,7 @@ namespace devices
 				return;
 			// add the net
 			groupspre.back().push_back(&n);
+			group_of[&n] = groupspre.size() - 1;
 			// process all terminals connected to this net
 			for (auto &term : n.core_terms())
 			{
@@ -296,6 +375,9 @@ namespace devices
 				if (term->is_type(detail::terminal_type::TERMINAL))
 				{
 					auto *pt = static_cast<terminal_t *>(term);
+					// the group is split at large resistors if requested
+					if (solver::is_split_terminal(*pt, m_split_r))
+						continue;
 					// check the connected terminal
 					// analog_net_t &connected_net = pt->connected_terminal()->net();
 					analog_net_t &connected_net = netlist.setup().get_connected_terminal(*pt)->net();
@@ -332,7 +414,10 @@ namespace devices
 
 		std::vector<analog_net_t::list_t> groups;
 	private:
+		nl_fptype m_split_r;
 		std::vector<analog_net_t::list_t> groupspre;
+		// index into groupspre for every net already processed
+		std::unordered_map<const analog_net_t *, std::size_t> group_of;
 	};
 
 	void NETLIB_NAME(solver)::post_start()
@@ -340,7 +425,7 @@ namespace devices
 		log().verbose("Scanning net groups ...");
 		// determine net groups
 
-		net_splitter splitter;
+		net_splitter splitter(m_params.m_split_r());
 
 		splitter.run(state());
 
@@ -398,6 +483,21 @@ namespace devices
 
 			m_mat_solvers.emplace_back(std::move(ms));
 		}
+
+		for (auto &ms : m_mat_solvers)
+		{
+			ms->register_split_coupling();
+			m_has_split = m_has_split || ms->has_split_nets();
+		}
+
+#if (NL_USE_SOLVER_THREAD_POOL)
+		const auto nthreads = std::min(static_cast<std::size_t>(std::max(m_params.m_parallel(), 0)), m_mat_solvers.size());
+		if (nthreads > 1 && !m_params.m_dynamic_ts)
+		{
+			log().verbose("Using {1} solver threads", nthreads);
+			m_pool = plib::make_unique<plib::omp::thread_pool_t>(nthreads);
+		}
+#endif
 	}
 
 	void NETLIB_NAME(solver)::create_solver_code(std::map<pstring, pstring> &mp)
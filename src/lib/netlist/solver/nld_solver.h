@@ -30,6 +30,7 @@ namespace devices
 		, m_fb_step(*this, "FB_step")
 		, m_Q_step(*this, "Q_step")
 		, m_params(*this)
+		, m_has_split(false)
 		{
 			// internal staff
 
@@ -41,6 +42,15 @@ namespace devices
 
 		nl_fptype gmin() const { return m_params.m_gmin(); }
 
+		/// \brief Number of matrix solves done by all solvers
+		std::size_t solve_count() const noexcept
+		{
+			std::size_t ret(0);
+			for (auto &s : m_mat_solvers)
+				ret += s->solve_count();
+			return ret;
+		}
+
 		void create_solver_code(std::map<pstring, pstring> &mp);
 
 		NETLIB_UPDATEI();
@@ -56,6 +66,13 @@ namespace devices
 		std::vector<solver::matrix_solver_t *> m_mat_solvers_timestepping;
 
 		solver::solver_parameters_t m_params;
+		plib::unique_ptr<plib::omp::thread_pool_t> m_pool;
+		bool m_has_split;
+		std::vector<solver::matrix_solver_t *> m_relax;
+
+		template <typename F>
+		void for_each_solver(std::vector<solver::matrix_solver_t *> &solvers, std::size_t nthreads, F f);
+		void relax_split(std::vector<solver::matrix_solver_t *> &solvers, netlist_time_ext now, std::size_t nthreads);
 
 		template <typename FT, int SIZE>
 		plib::unique_ptr<solver::matrix_solver_t> create_solver(std::size_t size,
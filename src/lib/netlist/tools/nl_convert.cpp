@@ -97,6 +97,7 @@ nl_convert_base_t::nl_convert_base_t()
 nl_convert_base_t::~nl_convert_base_t()
 {
 	m_nets.clear();
+	m_dev_index.clear();
 	m_devs.clear();
 	m_pins.clear();
 }
@@ -114,12 +115,11 @@ void nl_convert_base_t::add_ext_alias(const pstring &alias)
 
 void nl_convert_base_t::add_device(plib::unique_ptr<dev_t> dev)
 {
-	for (auto & d : m_devs)
-		if (d->name() == dev->name())
-		{
-			out("ERROR: Duplicate device {1} ignored.", dev->name());
-			return;
-		}
+	if (!m_dev_index.emplace(dev->name(), dev.get()).second)
+	{
+		out("ERROR: Duplicate device {1} ignored.", dev->name());
+		return;
+	}
 	m_devs.push_back(std::move(dev));
 }
 
@@ -141,7 +141,7 @@ void nl_convert_base_t::add_term(const pstring &netname, const pstring &termname
 	net_t * net = nullptr;
 	auto idx = m_nets.find(netname);
 	if (idx != m_nets.end())
-		net = m_nets[netname].get();
+		net = idx->second.get();
 	else
 	{
 		auto nets = plib::make_unique<net_t>(netname);
@@ -150,17 +150,23 @@ void nl_convert_base_t::add_term(const pstring &netname, const pstring &termname
 	}
 
 	// if there is a pin alias, translate ...
-	pin_alias_t *alias = m_pins[termname].get();
+	auto alias = m_pins.find(termname);
 
-	if (alias != nullptr)
-		net->terminals().push_back(alias->alias());
+	if (alias != m_pins.end())
+		net->terminals().push_back(alias->second->alias());
 	else
 		net->terminals().push_back(termname);
 }
 
 void nl_convert_base_t::add_term(const pstring &netname, const pstring &devname, unsigned term)
 {
-	auto e = dev_map.find(get_device(devname)->type());
+	auto *dev = get_device(devname);
+	if (dev == nullptr)
+	{
+		out("// ERROR: Device {} not found\n", devname);
+		return;
+	}
+	auto e = dev_map.find(dev->type());
 	if (e == dev_map.end())
 		out("// ERROR: No terminals found for device {}\n", devname);
 	else
@@ -187,6 +193,14 @@ void nl_convert_base_t::add_device_extra_s(const pstring &devname, const pstring
 
 void nl_convert_base_t::dump_nl()
 {
+	// index terminals to their positions in nets. Replacements only
+	// append terminals, so the positions stay valid.
+	std::unordered_map<pstring, std::vector<std::pair<net_t *, std::size_t>>> term_pos;
+	if (!m_replace.empty())
+		for (auto &n : m_nets)
+			for (std::size_t i = 0; i < n.second->terminals().size(); i++)
+				term_pos[n.second->terminals()[i]].emplace_back(n.second.get(), i);
+
 	// do replacements
 	for (auto &r : m_replace)
 	{
@@ -205,15 +219,11 @@ void nl_convert_base_t::dump_nl()
 			continue;
 		}
 		pstring term1 = r.m_ce + "." + e->second[0];
-		// scan all nets
-		for (auto &n : m_nets)
-		{
-			for (auto &t : n.second->terminals())
-			{
-				if (t == term1)
-					t = r.m_repterm;
-			}
-		}
+		// replace the terminal in all nets
+		auto tp = term_pos.find(term1);
+		if (tp != term_pos.end())
+			for (auto &t : tp->second)
+				t.first->terminals()[t.second] = r.m_repterm;
 		add_term(r.m_net, term1);
 	}
 
@@ -265,6 +275,7 @@ void nl_convert_base_t::dump_nl()
 		}
 	}
 	m_replace.clear();
+	m_dev_index.clear();
 	m_devs.clear();
 	m_nets.clear();
 	m_pins.clear();
@@ -161,15 +161,15 @@ private:
 	void add_device(plib::unique_ptr<dev_t> dev);
 	dev_t *get_device(const pstring &name)
 	{
-		for (auto &e : m_devs)
-			if (e->name() == name)
-				return e.get();
-		return nullptr;
+		auto e = m_dev_index.find(name);
+		return (e != m_dev_index.end()) ? e->second : nullptr;
 	}
 
 	std::stringstream m_buf;
 
 	std::vector<plib::unique_ptr<dev_t>> m_devs;
+	// name lookup for m_devs, large imports have thousands of devices
+	std::unordered_map<pstring, dev_t *> m_dev_index;
 	std::unordered_map<pstring, plib::unique_ptr<net_t> > m_nets;
 	std::vector<pstring> m_ext_alias;
 	std::unordered_map<pstring, plib::unique_ptr<pin_alias_t>> m_pins;
@@ -12,6 +12,7 @@
 
 #include "bitmap.h"
 
+#include <algorithm>
 #include <new>
 
 
@@ -21,12 +22,27 @@
 //**************************************************************************
 
 //-------------------------------------------------
-//  compute_rowpixels - compute a rowpixels value
+//  compute_alignpixels - compute the number of
+//  pixels in one row alignment unit
 //-------------------------------------------------
 
-inline int32_t bitmap_t::compute_rowpixels(int width, int xslop)
+inline int32_t bitmap_t::compute_alignpixels() const
 {
-	return width + 2 * xslop;
+	return std::max(m_rowalign * 8 / m_bpp, 1);
+}
+
+
+//-------------------------------------------------
+//  compute_rowpixels - compute a rowpixels value;
+//  the left slop is rounded up so that pixel 0 of
+//  each row lands on an aligned boundary
+//-------------------------------------------------
+
+inline int32_t bitmap_t::compute_rowpixels(int width, int xslop) const
+{
+	int32_t const alignpixels = compute_alignpixels();
+	int32_t const leftslop = (xslop + alignpixels - 1) & ~(alignpixels - 1);
+	return (leftslop + width + xslop + alignpixels - 1) & ~(alignpixels - 1);
 }
 
 
@@ -37,7 +53,10 @@ inline int32_t bitmap_t::compute_rowpixels(int width, int xslop)
 
 inline void bitmap_t::compute_base(int xslop, int yslop)
 {
-	m_base = m_alloc.get() + (m_rowpixels * yslop + xslop) * (m_bpp / 8);
+	int32_t const alignpixels = compute_alignpixels();
+	int32_t const leftslop = (xslop + alignpixels - 1) & ~(alignpixels - 1);
+	uintptr_t const start = (reinterpret_cast<uintptr_t>(m_alloc.get()) + m_rowalign - 1) & ~uintptr_t(m_rowalign - 1);
+	m_base = reinterpret_cast<uint8_t *>(start) + (m_rowpixels * yslop + leftslop) * (m_bpp / 8);
 }
 
 
@@ -93,6 +112,7 @@ bitmap_t::bitmap_t(bitmap_t &&that)
 	, m_bpp(that.m_bpp)
 	, m_palette(nullptr)
 	, m_cliprect(that.m_cliprect)
+	, m_rowalign(that.m_rowalign)
 {
 	set_palette(that.m_palette);
 	that.reset();
@@ -119,6 +139,7 @@ bitmap_t::bitmap_t(bitmap_format format, uint8_t bpp, int width, int height, int
 	, m_format(format)
 	, m_bpp(bpp)
 	, m_palette(nullptr)
+	, m_rowalign(1)
 {
 	assert(valid_format());
 
@@ -150,6 +171,7 @@ bitmap_t::bitmap_t(bitmap_format format, uint8_t bpp, void *base, int width, int
 	, m_bpp(bpp)
 	, m_palette(nullptr)
 	, m_cliprect(0, width - 1, 0, height - 1)
+	, m_rowalign(1)
 {
 	assert(valid_format());
 }
@@ -176,6 +198,7 @@ bitmap_t::bitmap_t(bitmap_format format, uint8_t bpp, bitmap_t &source, const re
 	, m_bpp(bpp)
 	, m_palette(nullptr)
 	, m_cliprect(0, subrect.width() - 1, 0, subrect.height() - 1)
+	, m_rowalign(1)
 {
 	assert(format == source.m_format);
 	assert(bpp == source.m_bpp);
@@ -208,6 +231,7 @@ bitmap_t &bitmap_t::operator=(bitmap_t &&that)
 	m_bpp = that.m_bpp;
 	set_palette(that.m_palette);
 	m_cliprect = that.m_cliprect;
+	m_rowalign = that.m_rowalign;
 	that.reset();
 	return *this;
 }
@@ -244,8 +268,8 @@ void bitmap_t::allocate(int width, int height, int xslop, int yslop)
 	m_height = height;
 	m_cliprect.set(0, width - 1, 0, height - 1);
 
-	// allocate memory for the bitmap itself
-	m_allocbytes = m_rowpixels * (m_height + 2 * yslop) * m_bpp / 8;
+	// allocate memory for the bitmap itself, with room to align the start
+	m_allocbytes = m_rowpixels * (m_height + 2 * yslop) * m_bpp / 8 + m_rowalign - 1;
 	m_alloc.reset(new uint8_t[m_allocbytes]);
 
 	// clear to 0 by default
@@ -280,7 +304,7 @@ void bitmap_t::resize(int width, int height, int xslop, int yslop)
 
 	// determine how much memory we need for the new bitmap
 	int new_rowpixels = compute_rowpixels(width, xslop);
-	uint32_t new_allocbytes = new_rowpixels * (height + 2 * yslop) * m_bpp / 8;
+	uint32_t new_allocbytes = new_rowpixels * (height + 2 * yslop) * m_bpp / 8 + m_rowalign - 1;
 
 	// if we need more memory, just realloc
 	if (new_allocbytes > m_allocbytes)
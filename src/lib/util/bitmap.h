@@ -144,8 +144,10 @@ public:
 	bool valid() const { return (m_base != nullptr); }
 	palette_t *palette() const { return m_palette; }
 	const rectangle &cliprect() const { return m_cliprect; }
+	int row_alignment() const { return m_rowalign; }
 
 	// allocation/sizing
+	void set_row_alignment(int bytes) { assert(bytes > 0 && !(bytes & (bytes - 1))); m_rowalign = bytes; }
 	void allocate(int width, int height, int xslop = 0, int yslop = 0);
 	void resize(int width, int height, int xslop = 0, int yslop = 0);
 
@@ -171,7 +173,8 @@ protected:
 
 private:
 	// internal helpers
-	int32_t compute_rowpixels(int width, int xslop);
+	int32_t compute_alignpixels() const;
+	int32_t compute_rowpixels(int width, int xslop) const;
 	void compute_base(int xslop, int yslop);
 	bool valid_format() const;
 
@@ -186,6 +189,7 @@ private:
 	uint8_t                     m_bpp;          // bits per pixel
 	palette_t *                 m_palette;      // optional palette
 	rectangle                   m_cliprect;     // a clipping rectangle covering the full bitmap
+	int                         m_rowalign;     // byte alignment of the first pixel of each row
 };
 
 
@@ -129,7 +129,7 @@ struct chd_file::metadata_hash
 //  a byte buffer
 //-------------------------------------------------
 
-inline uint64_t chd_file::be_read(const uint8_t *base, int numbytes)
+inline uint64_t chd_file::be_read(const uint8_t *base, int numbytes) const
 {
 	uint64_t result = 0;
 	while (numbytes--)
@@ -788,7 +788,7 @@ chd_error chd_file::open(util::core_file &file, bool writeable, chd_file *parent
 	m_file = &file;
 	m_owns_file = false;
 	m_parent = parent;
-	m_cachehunk = ~0;
+	cache_reset();
 	return open_common(writeable);
 }
 
@@ -844,7 +844,7 @@ void chd_file::close()
 
 	// reset caching
 	m_cache.clear();
-	m_cachehunk = ~0;
+	cache_reset();
 }
 
 /**
@@ -1063,15 +1063,16 @@ chd_error chd_file::write_hunk(uint32_t hunknum, const void *buffer)
 			// write the map entry back
 			be_write(rawmap, rawentry, 4);
 			file_write(m_mapoffset + hunknum * 4, rawmap, 4);
-
-			// update the cached hunk if we just wrote it
-			if (hunknum == m_cachehunk && buffer != &m_cache[0])
-				memcpy(&m_cache[0], buffer, m_hunkbytes);
 		}
 
 		// otherwise, just overwrite
 		else
 			file_write(uint64_t(rawentry) * uint64_t(m_hunkbytes), buffer, m_hunkbytes);
+
+		// update the cached hunk if we just wrote it
+		uint8_t *cached = cache_find(hunknum);
+		if (cached != nullptr && cached != buffer)
+			memcpy(cached, buffer, m_hunkbytes);
 		return CHDERR_NONE;
 	}
 
@@ -1140,6 +1141,7 @@ chd_error chd_file::read_bytes(uint64_t offset, void *buffer, uint32_t bytes)
 	// iterate over hunks
 	uint32_t first_hunk = offset / m_hunkbytes;
 	uint32_t last_hunk = (offset + bytes - 1) / m_hunkbytes;
+	uint32_t last_full_hunk = ((offset + bytes) % m_hunkbytes == 0) ? last_hunk : (last_hunk - 1);
 	uint8_t *dest = reinterpret_cast<uint8_t *>(buffer);
 	for (uint32_t curhunk = first_hunk; curhunk <= last_hunk; curhunk++)
 	{
@@ -1147,22 +1149,38 @@ chd_error chd_file::read_bytes(uint64_t offset, void *buffer, uint32_t bytes)
 		uint32_t startoffs = (curhunk == first_hunk) ? (offset % m_hunkbytes) : 0;
 		uint32_t endoffs = (curhunk == last_hunk) ? ((offset + bytes - 1) % m_hunkbytes) : (m_hunkbytes - 1);
 
-		// if it's a full block, just read directly from disk unless it's the cached hunk
+		// if it's a full block, just read directly from disk unless it's a cached hunk
 		chd_error err = CHDERR_NONE;
-		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && curhunk != m_cachehunk)
+		uint8_t *cached = cache_find(curhunk);
+		uint32_t const run = (startoffs == 0 && cached == nullptr) ? uncompressed_run(curhunk, last_full_hunk) : 0;
+		if (run > 1)
+		{
+			// uncompressed hunks stored back to back can be read in one go
+			try
+			{
+				file_read(uint64_t(be_read(&m_rawmap[m_mapentrybytes * curhunk], 4)) * uint64_t(m_hunkbytes), dest, run * m_hunkbytes);
+			}
+			catch (chd_error &readerr)
+			{
+				return readerr;
+			}
+			dest += run * m_hunkbytes;
+			curhunk += run - 1;
+			continue;
+		}
+		else if (startoffs == 0 && endoffs == m_hunkbytes - 1 && cached == nullptr)
 			err = read_hunk(curhunk, dest);
 
 		// otherwise, read from the cache
 		else
 		{
-			if (curhunk != m_cachehunk)
+			if (cached == nullptr)
 			{
-				err = read_hunk(curhunk, &m_cache[0]);
+				err = cache_load(curhunk, cached);
 				if (err != CHDERR_NONE)
 					return err;
-				m_cachehunk = curhunk;
 			}
-			memcpy(dest, &m_cache[startoffs], endoffs + 1 - startoffs);
+			memcpy(dest, &cached[startoffs], endoffs + 1 - startoffs);
 		}
 
 		// handle errors and advance
@@ -1200,23 +1218,23 @@ chd_error chd_file::write_bytes(uint64_t offset, const void *buffer, uint32_t by
 		uint32_t startoffs = (curhunk == first_hunk) ? (offset % m_hunkbytes) : 0;
 		uint32_t endoffs = (curhunk == last_hunk) ? ((offset + bytes - 1) % m_hunkbytes) : (m_hunkbytes - 1);
 
-		// if it's a full block, just write directly to disk unless it's the cached hunk
+		// if it's a full block, just write directly to disk unless it's a cached hunk
 		chd_error err = CHDERR_NONE;
-		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && curhunk != m_cachehunk)
+		uint8_t *cached = cache_find(curhunk);
+		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && cached == nullptr)
 			err = write_hunk(curhunk, source);
 
 		// otherwise, write from the cache
 		else
 		{
-			if (curhunk != m_cachehunk)
+			if (cached == nullptr)
 			{
-				err = read_hunk(curhunk, &m_cache[0]);
+				err = cache_load(curhunk, cached);
 				if (err != CHDERR_NONE)
 					return err;
-				m_cachehunk = curhunk;
 			}
-			memcpy(&m_cache[startoffs], source, endoffs + 1 - startoffs);
-			err = write_hunk(curhunk, &m_cache[0]);
+			memcpy(&cached[startoffs], source, endoffs + 1 - startoffs);
+			err = write_hunk(curhunk, cached);
 		}
 
 		// handle errors and advance
@@ -2467,7 +2485,113 @@ void chd_file::create_open_common()
 
 	// allocate the temporary compressed buffer and a buffer for caching
 	m_compressed.resize(m_hunkbytes);
-	m_cache.resize(m_hunkbytes);
+	m_cache.resize(m_hunkbytes * CACHE_HUNKS);
+	cache_reset();
+}
+
+/**
+ * @fn  void chd_file::cache_reset()
+ *
+ * @brief   -------------------------------------------------
+ *            cache_reset - mark every slot of the hunk cache empty
+ *          -------------------------------------------------.
+ */
+
+void chd_file::cache_reset()
+{
+	std::fill(std::begin(m_cachehunk), std::end(m_cachehunk), ~uint32_t(0));
+	std::fill(std::begin(m_cacheage), std::end(m_cacheage), 0);
+	m_cacheclock = 0;
+}
+
+/**
+ * @fn  uint8_t *chd_file::cache_find(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            cache_find - return the cached copy of a hunk, or nullptr if it isn't cached
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ *
+ * @return  null if it fails, else a pointer to the cached data.
+ */
+
+uint8_t *chd_file::cache_find(uint32_t hunknum)
+{
+	for (int slot = 0; slot < CACHE_HUNKS; slot++)
+		if (m_cachehunk[slot] == hunknum)
+		{
+			m_cacheage[slot] = ++m_cacheclock;
+			return &m_cache[slot * m_hunkbytes];
+		}
+	return nullptr;
+}
+
+/**
+ * @fn  chd_error chd_file::cache_load(uint32_t hunknum, uint8_t *&data)
+ *
+ * @brief   -------------------------------------------------
+ *            cache_load - read a hunk into the least recently used cache slot
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The hunknum.
+ * @param [out] data        Receives a pointer to the cached data.
+ *
+ * @return  A chd_error.
+ */
+
+chd_error chd_file::cache_load(uint32_t hunknum, uint8_t *&data)
+{
+	data = cache_find(hunknum);
+	if (data != nullptr)
+		return CHDERR_NONE;
+
+	// pick the least recently used slot
+	int victim = 0;
+	for (int slot = 1; slot < CACHE_HUNKS; slot++)
+		if (m_cacheage[slot] < m_cacheage[victim])
+			victim = slot;
+
+	// the slot holds nothing valid until the read succeeds
+	m_cachehunk[victim] = ~uint32_t(0);
+	data = &m_cache[victim * m_hunkbytes];
+	chd_error err = read_hunk(hunknum, data);
+	if (err != CHDERR_NONE)
+		return err;
+	m_cachehunk[victim] = hunknum;
+	m_cacheage[victim] = ++m_cacheclock;
+	return CHDERR_NONE;
+}
+
+/**
+ * @fn  uint32_t chd_file::uncompressed_run(uint32_t hunknum, uint32_t lasthunk) const
+ *
+ * @brief   -------------------------------------------------
+ *            uncompressed_run - count the hunks from hunknum up to lasthunk that are stored
+ *            uncompressed and consecutively in this file and aren't cached
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum     The first hunk.
+ * @param   lasthunk    The last hunk that may be included.
+ *
+ * @return  The number of hunks, or 0 if hunknum itself doesn't qualify.
+ */
+
+uint32_t chd_file::uncompressed_run(uint32_t hunknum, uint32_t lasthunk) const
+{
+	// only uncompressed v5 files store plain hunk indexes in the map
+	if (m_version < 5 || compressed() || m_file == nullptr || hunknum > lasthunk || lasthunk >= m_hunkcount)
+		return 0;
+
+	uint32_t const base = be_read(&m_rawmap[m_mapentrybytes * hunknum], 4);
+	if (base == 0)
+		return 0;
+
+	uint32_t count = 1;
+	while (hunknum + count <= lasthunk && be_read(&m_rawmap[m_mapentrybytes * (hunknum + count)], 4) == base + count
+			&& std::find(std::begin(m_cachehunk), std::end(m_cachehunk), hunknum + count) == std::end(m_cachehunk))
+		count++;
+	return count;
 }
 
 /**
@@ -372,7 +372,7 @@ private:
 	struct metadata_hash;
 
 	// inline helpers
-	uint64_t be_read(const uint8_t *base, int numbytes);
+	uint64_t be_read(const uint8_t *base, int numbytes) const;
 	void be_write(uint8_t *base, uint64_t value, int numbytes);
 	util::sha1_t be_read_sha1(const uint8_t *base);
 	void be_write_sha1(uint8_t *base, util::sha1_t value);
@@ -390,6 +390,10 @@ private:
 	void decompress_v5_map();
 	chd_error create_common();
 	chd_error open_common(bool writeable);
+	void cache_reset();
+	uint8_t *cache_find(uint32_t hunknum);
+	chd_error cache_load(uint32_t hunknum, uint8_t *&data);
+	uint32_t uncompressed_run(uint32_t hunknum, uint32_t lasthunk) const;
 	void create_open_common();
 	void verify_proper_compression_append(uint32_t hunknum);
 	void hunk_write_compressed(uint32_t hunknum, int8_t compression, const uint8_t *compressed, uint32_t complength, util::crc16_t crc16);
@@ -435,8 +439,11 @@ private:
 	std::vector<uint8_t>          m_compressed;       // temporary buffer for compressed data
 
 	// caching
-	std::vector<uint8_t>          m_cache;            // single-hunk cache for partial reads/writes
-	uint32_t                  m_cachehunk;        // which hunk is in the cache?
+	static constexpr int CACHE_HUNKS = 4;
+	std::vector<uint8_t>          m_cache;            // small LRU cache of hunks for partial reads/writes
+	uint32_t                  m_cachehunk[CACHE_HUNKS]; // which hunk is in each cache slot?
+	uint32_t                  m_cacheage[CACHE_HUNKS]; // when was each cache slot last used?
+	uint32_t                  m_cacheclock;       // counter for LRU ordering
 };
 
 
@@ -331,6 +331,53 @@ private:
 };
 
 
+// ======================> frame_allocator
+
+// a frame_allocator hands out objects from blocks it keeps between uses;
+// everything is given back at once with reset(), so objects that only
+// live for one frame cost no allocation or free list traffic
+template<class ItemType, std::size_t BlockSize = 256>
+class frame_allocator
+{
+	// we don't support deep copying
+	frame_allocator(const frame_allocator &);
+	frame_allocator &operator=(const frame_allocator &);
+
+public:
+	// construction/destruction
+	frame_allocator() : m_block(0), m_index(0) { }
+
+	// allocate the next item, adding a block when the current ones are used up
+	ItemType *alloc()
+	{
+		if (m_index == BlockSize)
+		{
+			m_block++;
+			m_index = 0;
+		}
+		if (m_block == m_blocks.size())
+			m_blocks.emplace_back(std::make_unique<ItemType []>(BlockSize));
+		return &m_blocks[m_block][m_index++];
+	}
+
+	// give back an item if it was the most recent allocation
+	void reclaim(ItemType &item)
+	{
+		if (m_index != 0 && &m_blocks[m_block][m_index - 1] == &item)
+			m_index--;
+	}
+
+	// make every item available again; the blocks are kept
+	void reset() { m_block = 0; m_index = 0; }
+
+private:
+	// internal state
+	std::vector<std::unique_ptr<ItemType []>> m_blocks; // storage blocks
+	std::size_t             m_block;        // block holding the next item
+	std::size_t             m_index;        // index of the next item in that block
+};
+
+
 // ======================> contiguous_sequence_wrapper
 
 namespace util {
@@ -162,30 +162,32 @@ hard_disk_info *hard_disk_get_info(hard_disk_file *file)
 -------------------------------------------------*/
 
 /**
- * @fn  uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer)
+ * @fn  uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer, uint32_t count)
  *
  * @brief   Hard disk read.
  *
  * @param [in,out]  file    If non-null, the file.
- * @param   lbasector       The lbasector.
+ * @param   lbasector       The first lbasector.
  * @param [in,out]  buffer  If non-null, the buffer.
+ * @param   count           Number of consecutive sectors to read.
  *
  * @return  An uint32_t.
  */
 
-uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer)
+uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer, uint32_t count)
 {
 	if (file->chd)
 	{
-		chd_error err = file->chd->read_units(lbasector, buffer);
+		chd_error err = file->chd->read_units(lbasector, buffer, count);
 		return (err == CHDERR_NONE);
 	}
 	else
 	{
 		uint32_t actual = 0;
-		file->fhandle->seek(file->info.fileoffset + (lbasector * file->info.sectorbytes), SEEK_SET);
-		actual = file->fhandle->read(buffer, file->info.sectorbytes);
-		return (actual == file->info.sectorbytes);
+		uint32_t bytes = count * file->info.sectorbytes;
+		file->fhandle->seek(file->info.fileoffset + (uint64_t(lbasector) * file->info.sectorbytes), SEEK_SET);
+		actual = file->fhandle->read(buffer, bytes);
+		return (actual == bytes);
 	}
 }
 
@@ -46,7 +46,7 @@ void hard_disk_close(hard_disk_file *file);
 chd_file *hard_disk_get_chd(hard_disk_file *file);
 hard_disk_info *hard_disk_get_info(hard_disk_file *file);
 
-uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer);
+uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer, uint32_t count = 1);
 uint32_t hard_disk_write(hard_disk_file *file, uint32_t lbasector, const void *buffer);
 
 #endif // MAME_UTIL_HARDDISK_H
@@ -10,9 +10,33 @@
 
 #include "hashing.h"
 #include <zlib.h>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 
+// carry-less multiply folding for CRC-32 on x86, checked for at run time
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define HASHING_X86_CLMUL 1
+#define HASHING_TARGET_CLMUL __attribute__((target("pclmul,sse4.1")))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define HASHING_X86_CLMUL 1
+#define HASHING_TARGET_CLMUL
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#define HASHING_X86_CLMUL 0
+#endif
+
+// the ARMv8 CRC-32 instructions are only used when the build targets them
+#if defined(__ARM_FEATURE_CRC32) && defined(__AARCH64EL__)
+#define HASHING_ARM_CRC32 1
+#include <arm_acle.h>
+#else
+#define HASHING_ARM_CRC32 0
+#endif
+
 
 namespace util {
 //**************************************************************************
@@ -47,6 +71,100 @@ inline int char_to_hex(char c)
 }
 
 
+#if HASHING_X86_CLMUL
+
+//-------------------------------------------------
+//  have_clmul - check whether the CPU supports
+//  PCLMULQDQ and SSE4.1
+//-------------------------------------------------
+
+static bool have_clmul()
+{
+#if defined(_MSC_VER)
+	int regs[4];
+	__cpuid(regs, 1);
+	return ((regs[2] >> 1) & 1) && ((regs[2] >> 19) & 1);
+#else
+	unsigned int eax, ebx, ecx, edx;
+	return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && ((ecx >> 1) & 1) && ((ecx >> 19) & 1);
+#endif
+}
+
+static bool const use_clmul = have_clmul();
+
+
+//-------------------------------------------------
+//  crc32_clmul - fold 64-byte chunks with carry-
+//  less multiplies; crc is the inverted running
+//  value, length must be a multiple of 16 and at
+//  least 64
+//-------------------------------------------------
+
+HASHING_TARGET_CLMUL static uint32_t crc32_clmul(const uint8_t *buf, uint32_t length, uint32_t crc)
+{
+	// x^n mod P constants for the bit-reflected CRC-32 polynomial
+	__m128i const k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+	__m128i const k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+	__m128i const k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+	__m128i const poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+	__m128i const mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+	__m128i x1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x00)), _mm_cvtsi32_si128(crc));
+	__m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x10));
+	__m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x20));
+	__m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x30));
+	__m128i x5;
+	buf += 64;
+	length -= 64;
+
+	// fold four lanes in parallel
+	for ( ; length >= 64; buf += 64, length -= 64)
+	{
+		__m128i const x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+		__m128i const x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+		__m128i const x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+		x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x00)));
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x10)));
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x20)));
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x30)));
+	}
+
+	// fold the lanes into one, then any remaining 16-byte blocks
+	for (__m128i const next : { x2, x3, x4 })
+	{
+		x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, next), x5);
+	}
+	for ( ; length >= 16; buf += 16, length -= 16)
+	{
+		x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf))), x5);
+	}
+
+	// fold 128 bits down to 64
+	x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5k0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	// Barrett reduction to 32 bits
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), poly, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+	return _mm_extract_epi32(x1, 1);
+}
+
+#endif
+
+
 
 //**************************************************************************
 //  SHA-1 HELPERS
@@ -186,7 +304,29 @@ std::string crc32_t::as_string() const
 
 void crc32_creator::append(const void *data, uint32_t length)
 {
-	m_accum.m_raw = crc32(m_accum, reinterpret_cast<const Bytef *>(data), length);
+	const uint8_t *bytes = reinterpret_cast<const uint8_t *>(data);
+#if HASHING_X86_CLMUL
+	if (use_clmul && (length >= 64))
+	{
+		uint32_t const bulk = length & ~uint32_t(15);
+		m_accum.m_raw = ~crc32_clmul(bytes, bulk, ~m_accum.m_raw);
+		bytes += bulk;
+		length -= bulk;
+	}
+#elif HASHING_ARM_CRC32
+	uint32_t crc = ~m_accum.m_raw;
+	for ( ; length >= 8; bytes += 8, length -= 8)
+	{
+		uint64_t word;
+		std::memcpy(&word, bytes, 8);
+		crc = __crc32d(crc, word);
+	}
+	for ( ; length; bytes++, length--)
+		crc = __crc32b(crc, *bytes);
+	m_accum.m_raw = ~crc;
+#endif
+	if (length)
+		m_accum.m_raw = crc32(m_accum, reinterpret_cast<const Bytef *>(bytes), length);
 }
 
 
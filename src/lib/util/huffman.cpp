@@ -722,6 +722,8 @@ huffman_error huffman_8bit_encoder::encode(const uint8_t *source, uint32_t sleng
 //  8-BIT DECODER
 //**************************************************************************
 
+constexpr int huffman_8bit_decoder::PAIR_LOOKUP_BITS;
+
 //-------------------------------------------------
 //  huffman_8bit_decoder - constructor
 //-------------------------------------------------
@@ -753,9 +755,72 @@ huffman_error huffman_8bit_decoder::decode(const uint8_t *source, uint32_t sleng
 	if (err != HUFFERR_NONE)
 		return err;
 
-	// then decode the data
-	for (uint32_t cur = 0; cur < dlength; cur++)
+	// then decode the data; for large blocks it pays to build a table that decodes two short codes per lookup
+	uint32_t cur = 0;
+	if (dlength >= (4 << PAIR_LOOKUP_BITS))
+	{
+		int const pairbits = build_pair_lookup_table();
+		while (pairbits != 0 && cur + 1 < dlength)
+		{
+			uint32_t const entry = m_pair_lookup[bitbuf.peek(pairbits)];
+			switch ((entry >> 5) & 3)
+			{
+			case 2:
+				dest[cur++] = entry >> 8;
+				dest[cur++] = entry >> 16;
+				bitbuf.remove(entry & 0x1f);
+				break;
+
+			case 1:
+				dest[cur++] = entry >> 8;
+				bitbuf.remove(entry & 0x1f);
+				break;
+
+			default:
+				dest[cur++] = decode_one(bitbuf);
+				break;
+			}
+		}
+	}
+	for ( ; cur < dlength; cur++)
 		dest[cur] = decode_one(bitbuf);
 	bitbuf.flush();
 	return bitbuf.overflow() ? HUFFERR_INPUT_BUFFER_TOO_SMALL : HUFFERR_NONE;
 }
+
+
+//-------------------------------------------------
+//  build_pair_lookup_table - build a table that
+//  decodes up to two codes from a short prefix,
+//  returning the number of bits it is indexed by
+//-------------------------------------------------
+
+int huffman_8bit_decoder::build_pair_lookup_table()
+{
+	int const pairbits = (std::min<int>)(m_maxbits, PAIR_LOOKUP_BITS);
+	if (pairbits == 0)
+		return 0;
+	int const shift = m_maxbits - pairbits;
+	uint32_t const mask = (1 << pairbits) - 1;
+
+	for (uint32_t index = 0; index <= mask; index++)
+	{
+		// the first code must fit entirely within the prefix
+		lookup_value const first = m_lookup[index << shift];
+		int const firstbits = first & 0x1f;
+		if (firstbits == 0 || firstbits > pairbits)
+		{
+			m_pair_lookup[index] = 0;
+			continue;
+		}
+
+		// and so must the second, in whatever bits are left over
+		lookup_value const second = m_lookup[((index << firstbits) & mask) << shift];
+		int const secondbits = second & 0x1f;
+		if (secondbits == 0 || firstbits + secondbits > pairbits)
+			m_pair_lookup[index] = ((first >> 5) << 8) | (1 << 5) | firstbits;
+		else
+			m_pair_lookup[index] = ((second >> 5) << 16) | ((first >> 5) << 8) | (2 << 5) | (firstbits + secondbits);
+	}
+	return pairbits;
+}
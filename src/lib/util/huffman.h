@@ -167,6 +167,15 @@ public:
 
 	// operations
 	huffman_error decode(const uint8_t *source, uint32_t slength, uint8_t *dest, uint32_t destlength);
+
+private:
+	// internal helpers
+	int build_pair_lookup_table();
+
+	// a pair lookup entry holds the bits consumed, the number of codes (0-2) and up to two codes
+	static constexpr int PAIR_LOOKUP_BITS = 11;
+
+	uint32_t                m_pair_lookup[1 << PAIR_LOOKUP_BITS];
 };
 
 
@@ -100,6 +100,35 @@ void palette_client::dirty_state::mark_dirty(uint32_t index)
 }
 
 
+//-------------------------------------------------
+//  mark_dirty_range - mark an inclusive range of
+//  entries dirty
+//-------------------------------------------------
+
+void palette_client::dirty_state::mark_dirty_range(uint32_t start, uint32_t end)
+{
+	assert(start <= end);
+
+	// fill whole words in one go, masking the partial words at either end
+	uint32_t const startword = start / 32;
+	uint32_t const endword = end / 32;
+	uint32_t const startmask = ~uint32_t(0) << (start % 32);
+	uint32_t const endmask = ~uint32_t(0) >> (31 - (end % 32));
+	if (startword == endword)
+	{
+		m_dirty[startword] |= startmask & endmask;
+	}
+	else
+	{
+		m_dirty[startword] |= startmask;
+		std::fill(m_dirty.begin() + startword + 1, m_dirty.begin() + endword, ~uint32_t(0));
+		m_dirty[endword] |= endmask;
+	}
+	m_mindirty = std::min(m_mindirty, start);
+	m_maxdirty = std::max(m_maxdirty, end);
+}
+
+
 //-------------------------------------------------
 //  reset - clear the dirty array to mark all
 //  entries as clean
@@ -288,9 +317,7 @@ void palette_t::set_brightness(float brightness)
 	m_brightness = brightness;
 
 	// update across all indices in all groups
-	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
-		for (int index = 0; index < m_numcolors; index++)
-			update_adjusted_color(groupnum, index);
+	update_all_adjusted();
 }
 
 
@@ -307,9 +334,7 @@ void palette_t::set_contrast(float contrast)
 	m_contrast = contrast;
 
 	// update across all indices in all groups
-	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
-		for (int index = 0; index < m_numcolors; index++)
-			update_adjusted_color(groupnum, index);
+	update_all_adjusted();
 }
 
 
@@ -335,9 +360,7 @@ void palette_t::set_gamma(float gamma)
 	}
 
 	// update across all indices in all groups
-	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
-		for (int index = 0; index < m_numcolors; index++)
-			update_adjusted_color(groupnum, index);
+	update_all_adjusted();
 }
 
 
@@ -451,6 +474,37 @@ void palette_t::entry_set_contrast(uint32_t index, float contrast)
 }
 
 
+//-------------------------------------------------
+//  entry_set_colors - set the raw RGB colors for
+//  a run of palette indices
+//-------------------------------------------------
+
+void palette_t::entry_set_colors(uint32_t start, const rgb_t *colors, uint32_t count)
+{
+	assert(start + count <= m_numcolors);
+
+	// copy the colors, remembering the span that actually changed
+	uint32_t first = count, last = 0;
+	for (uint32_t index = 0; index < count; index++)
+	{
+		if (m_entry_color[start + index] != colors[index])
+		{
+			m_entry_color[start + index] = colors[index];
+			first = std::min(first, index);
+			last = index;
+		}
+	}
+
+	// if unchanged, ignore
+	if (first > last)
+		return;
+
+	// update across all groups
+	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
+		update_adjusted_range(groupnum, start + first, start + last + 1);
+}
+
+
 //-------------------------------------------------
 //  group_set_brightness - configure overall
 //  brightness for a palette group
@@ -471,8 +525,7 @@ void palette_t::group_set_brightness(uint32_t group, float brightness)
 	m_group_bright[group] = brightness;
 
 	// update across all colors
-	for (int index = 0; index < m_numcolors; index++)
-		update_adjusted_color(group, index);
+	update_adjusted_range(group, 0, m_numcolors);
 }
 
 
@@ -493,8 +546,7 @@ void palette_t::group_set_contrast(uint32_t group, float contrast)
 	m_group_contrast[group] = contrast;
 
 	// update across all colors
-	for (int index = 0; index < m_numcolors; index++)
-		update_adjusted_color(group, index);
+	update_adjusted_range(group, 0, m_numcolors);
 }
 
 
@@ -570,3 +622,63 @@ void palette_t::update_adjusted_color(uint32_t group, uint32_t index)
 	for (palette_client *client = m_client_list; client != nullptr; client = client->next())
 		client->mark_dirty(finalindex);
 }
+
+
+//-------------------------------------------------
+//  update_adjusted_range - update a run of color
+//  indices [start, end) within a group, marking
+//  clients dirty a run at a time
+//-------------------------------------------------
+
+void palette_t::update_adjusted_range(uint32_t group, uint32_t start, uint32_t end)
+{
+	// hoist everything that doesn't depend on the entry
+	float const brightness = m_group_bright[group] + m_brightness;
+	float const contrast = m_group_contrast[group] * m_contrast;
+	uint32_t const base = group * m_numcolors;
+	rgb_t const *const src = &m_entry_color[0];
+	float const *const entry_contrast = &m_entry_contrast[0];
+	rgb_t *const dest = &m_adjusted_color[base];
+	rgb_t *const dest15 = &m_adjusted_rgb15[base];
+
+	// runs of changed entries are reported to the clients as a single range
+	uint32_t runstart = end;
+	for (uint32_t index = start; index <= end; index++)
+	{
+		bool changed = false;
+		if (index < end)
+		{
+			rgb_t const adjusted = adjust_palette_entry(src[index], brightness, contrast * entry_contrast[index], m_gamma_map);
+			if (dest[index] != adjusted)
+			{
+				dest[index] = adjusted;
+				dest15[index] = adjusted.as_rgb15();
+				changed = true;
+			}
+		}
+
+		if (changed)
+		{
+			if (runstart == end)
+				runstart = index;
+		}
+		else if (runstart != end)
+		{
+			for (palette_client *client = m_client_list; client != nullptr; client = client->next())
+				client->mark_dirty_range(base + runstart, base + index - 1);
+			runstart = end;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  update_all_adjusted - recompute every adjusted
+//  color after a global adjustment changes
+//-------------------------------------------------
+
+void palette_t::update_all_adjusted()
+{
+	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
+		update_adjusted_range(groupnum, 0, m_numcolors);
+}
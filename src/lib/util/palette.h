@@ -106,6 +106,7 @@ public:
 
 	// dirty marking
 	void mark_dirty(uint32_t index) { m_live->mark_dirty(index); }
+	void mark_dirty_range(uint32_t start, uint32_t end) { m_live->mark_dirty_range(start, end); }
 
 private:
 	// internal object to track dirty states
@@ -119,6 +120,7 @@ private:
 		const uint32_t *dirty_list(uint32_t &mindirty, uint32_t &maxdirty);
 		void resize(uint32_t colors);
 		void mark_dirty(uint32_t index);
+		void mark_dirty_range(uint32_t start, uint32_t end);
 		void reset();
 
 	private:
@@ -175,6 +177,7 @@ public:
 	void entry_set_green_level(uint32_t index, uint8_t level);
 	void entry_set_blue_level(uint32_t index, uint8_t level);
 	void entry_set_contrast(uint32_t index, float contrast);
+	void entry_set_colors(uint32_t start, const rgb_t *colors, uint32_t count);
 
 	// entry list getters
 	const rgb_t *entry_list_raw() const { return &m_entry_color[0]; }
@@ -196,6 +199,8 @@ private:
 	// internal helpers
 	rgb_t adjust_palette_entry(rgb_t entry, float brightness, float contrast, const uint8_t *gamma_map);
 	void update_adjusted_color(uint32_t group, uint32_t index);
+	void update_adjusted_range(uint32_t group, uint32_t start, uint32_t end);
+	void update_all_adjusted();
 
 	// internal state
 	uint32_t          m_refcount;                   // reference count on the palette
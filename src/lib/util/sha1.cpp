@@ -31,6 +31,22 @@
 #include <cstdlib>
 #include <cstring>
 
+/* Use the x86 SHA extensions when the CPU has them; the check is made once at
+   run time, so builds for older CPUs still get the fast path */
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SHA1_X86_SHA 1
+#define SHA1_TARGET_SHA __attribute__((target("sha,ssse3,sse4.1")))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define SHA1_X86_SHA 1
+#define SHA1_TARGET_SHA
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#define SHA1_X86_SHA 0
+#endif
+
 static unsigned int READ_UINT32(const uint8_t* data)
 {
 	return ((uint32_t)data[0] << 24) |
@@ -267,6 +283,134 @@ sha1_transform(uint32_t *state, uint32_t *data)
 	state[4] += E;
 }
 
+#if SHA1_X86_SHA
+
+/* Four rounds of the SHA extension schedule; the message words rotate
+   through m0..m3 and the E values alternate between ecur and enext */
+#define shaniRounds(ecur, enext, m0, m1, m2, m3, f) \
+	( ecur = _mm_sha1nexte_epu32( ecur, m0 ), enext = abcd, \
+		m1 = _mm_sha1msg2_epu32( m1, m0 ), abcd = _mm_sha1rnds4_epu32( abcd, ecur, f ), \
+		m3 = _mm_sha1msg1_epu32( m3, m0 ), m2 = _mm_xor_si128( m2, m0 ) )
+
+/**
+ * @fn  static bool sha1_have_shani()
+ *
+ * @brief   Check whether the CPU supports the SHA extensions.
+ */
+
+static bool
+sha1_have_shani()
+{
+#if defined(_MSC_VER)
+	int regs[4];
+	__cpuid(regs, 0);
+	if (regs[0] < 7)
+		return false;
+	__cpuidex(regs, 1, 0);
+	bool const sse41 = (regs[2] >> 19) & 1;
+	__cpuidex(regs, 7, 0);
+	return sse41 && ((regs[1] >> 29) & 1);
+#else
+	unsigned int eax, ebx, ecx, edx;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !((ecx >> 19) & 1))
+		return false;
+	if (__get_cpuid_max(0, nullptr) < 7)
+		return false;
+	__cpuid_count(7, 0, eax, ebx, ecx, edx);
+	return (ebx >> 29) & 1;
+#endif
+}
+
+/**
+ * @fn  static void sha1_transform_shani(uint32_t *state, const uint8_t *data, size_t blocks)
+ *
+ * @brief   Sha 1 transform of consecutive blocks using the SHA extensions.
+ *
+ * @param [in,out]  state   The state.
+ * @param   data            The blocks, in message byte order.
+ * @param   blocks          Number of 64-byte blocks.
+ */
+
+SHA1_TARGET_SHA static void
+sha1_transform_shani(uint32_t *state, const uint8_t *data, size_t blocks)
+{
+	__m128i const mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+	__m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)state), 0x1b);
+	__m128i e0 = _mm_set_epi32(state[4], 0, 0, 0);
+	__m128i e1;
+
+	for ( ; blocks; blocks--, data += SHA1_DATA_SIZE)
+	{
+		__m128i const abcd_save = abcd;
+		__m128i const e0_save = e0;
+		__m128i msg0, msg1, msg2, msg3;
+
+		/* Rounds 0-15 consume the block itself */
+		msg0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 0)), mask);
+		e0 = _mm_add_epi32(e0, msg0);
+		e1 = abcd;
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+		msg1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), mask);
+		e1 = _mm_sha1nexte_epu32(e1, msg1);
+		e0 = abcd;
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+		msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+
+		msg2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), mask);
+		e0 = _mm_sha1nexte_epu32(e0, msg2);
+		e1 = abcd;
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+		msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+		msg0 = _mm_xor_si128(msg0, msg2);
+
+		msg3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), mask);
+		shaniRounds( e1, e0, msg3, msg0, msg1, msg2, 0 );
+
+		/* Rounds 16-67 expand the schedule as they go */
+		shaniRounds( e0, e1, msg0, msg1, msg2, msg3, 0 );
+		shaniRounds( e1, e0, msg1, msg2, msg3, msg0, 1 );
+		shaniRounds( e0, e1, msg2, msg3, msg0, msg1, 1 );
+		shaniRounds( e1, e0, msg3, msg0, msg1, msg2, 1 );
+		shaniRounds( e0, e1, msg0, msg1, msg2, msg3, 1 );
+		shaniRounds( e1, e0, msg1, msg2, msg3, msg0, 1 );
+		shaniRounds( e0, e1, msg2, msg3, msg0, msg1, 2 );
+		shaniRounds( e1, e0, msg3, msg0, msg1, msg2, 2 );
+		shaniRounds( e0, e1, msg0, msg1, msg2, msg3, 2 );
+		shaniRounds( e1, e0, msg1, msg2, msg3, msg0, 2 );
+		shaniRounds( e0, e1, msg2, msg3, msg0, msg1, 2 );
+		shaniRounds( e1, e0, msg3, msg0, msg1, msg2, 3 );
+		shaniRounds( e0, e1, msg0, msg1, msg2, msg3, 3 );
+
+		/* Rounds 68-79 wind the schedule down */
+		e1 = _mm_sha1nexte_epu32(e1, msg1);
+		e0 = abcd;
+		msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+		msg3 = _mm_xor_si128(msg3, msg1);
+
+		e0 = _mm_sha1nexte_epu32(e0, msg2);
+		e1 = abcd;
+		msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+
+		e1 = _mm_sha1nexte_epu32(e1, msg3);
+		e0 = abcd;
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+		/* Add this block's hash to the running state */
+		e0 = _mm_sha1nexte_epu32(e0, e0_save);
+		abcd = _mm_add_epi32(abcd, abcd_save);
+	}
+
+	_mm_storeu_si128((__m128i *)state, _mm_shuffle_epi32(abcd, 0x1b));
+	state[4] = _mm_extract_epi32(e0, 3);
+}
+
+static bool const sha1_use_shani = sha1_have_shani();
+
+#endif
+
 /**
  * @fn  static void sha1_block(struct sha1_ctx *ctx, const uint8_t *block)
  *
@@ -293,6 +437,34 @@ sha1_block(struct sha1_ctx *ctx, const uint8_t *block)
 	sha1_transform(ctx->digest, data);
 }
 
+/**
+ * @fn  static void sha1_blocks(struct sha1_ctx *ctx, const uint8_t *blocks, unsigned count)
+ *
+ * @brief   Sha 1 of consecutive blocks, using the SHA extensions if available.
+ *
+ * @param [in,out]  ctx If non-null, the context.
+ * @param   blocks      The blocks.
+ * @param   count       Number of blocks.
+ */
+
+static void
+sha1_blocks(struct sha1_ctx *ctx, const uint8_t *blocks, unsigned count)
+{
+#if SHA1_X86_SHA
+	if (sha1_use_shani)
+	{
+		uint32_t const low = ctx->count_low;
+		ctx->count_low += count;
+		if (ctx->count_low < low)
+			++ctx->count_high;
+		sha1_transform_shani(ctx->digest, blocks, count);
+		return;
+	}
+#endif
+	for ( ; count; count--, blocks += SHA1_DATA_SIZE)
+		sha1_block(ctx, blocks);
+}
+
 /**
  * @fn  void sha1_update(struct sha1_ctx *ctx, unsigned length, const uint8_t *buffer)
  *
@@ -324,11 +496,11 @@ sha1_update(struct sha1_ctx *ctx,
 		length -= left;
 	}
 	}
-	while (length >= SHA1_DATA_SIZE)
+	if (length >= SHA1_DATA_SIZE)
 	{
-		sha1_block(ctx, buffer);
-		buffer += SHA1_DATA_SIZE;
-		length -= SHA1_DATA_SIZE;
+		sha1_blocks(ctx, buffer, length / SHA1_DATA_SIZE);
+		buffer += length & ~(SHA1_DATA_SIZE - 1);
+		length &= SHA1_DATA_SIZE - 1;
 	}
 	ctx->index = length;
 	if (length)
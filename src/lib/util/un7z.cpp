@@ -357,6 +357,17 @@ void m7z_file_impl::close(ptr &&archive)
 		if (!s_cache[cachenum])
 			break;
 
+	// if another copy of this archive was opened concurrently, drop the older one so it doesn't push other archives out
+	for (std::size_t dupnum = 0; dupnum < cachenum; dupnum++)
+	{
+		if (s_cache[dupnum]->m_filename == archive->m_filename)
+		{
+			s_cache[dupnum].reset();
+			cachenum = dupnum;
+			break;
+		}
+	}
+
 	// if no room left in the cache, free the bottommost entry
 	if (cachenum == s_cache.size())
 	{
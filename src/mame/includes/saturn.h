@@ -262,6 +262,17 @@ protected:
 	int      stv_sprite_priorities_usage_valid;
 	uint8_t    stv_sprite_priorities_in_fb_line[512][8];
 
+	/* sprite compositing bands for the work queue */
+	static constexpr int SPRITE_BANDS = 8;
+	struct sprite_band
+	{
+		saturn_state *state;
+		bitmap_rgb32 *bitmap;
+		rectangle clip;
+		uint8_t pri;
+	};
+	osd_work_queue *m_sprite_queue = nullptr;
+
 
 	/* VDP2 */
 
@@ -328,6 +339,8 @@ protected:
 	void stv_vdp2_draw_NBG3(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void stv_vdp2_draw_RBG0(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect, uint8_t pri);
+	bool draw_sprites_band(bitmap_rgb32 &bitmap, const rectangle &cliprect, uint8_t pri);
+	static void *draw_sprites_callback(void *param, int threadid);
 	int true_vcount[263][4];
 
 	void stv_vdp2_state_save_postload( void );
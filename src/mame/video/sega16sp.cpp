@@ -1034,6 +1034,7 @@ sega_outrun_sprite_device::sega_outrun_sprite_device(const machine_config &mconf
 	, m_sprite_region_ptr(*this, DEVICE_SELF)
 {
 	set_local_origin(xboard_variant ? 190 : 189, 0x00);
+	set_draw_bands(4);
 }
 
 
@@ -1122,7 +1123,8 @@ void sega_outrun_sprite_device::draw(bitmap_ind16 &bitmap, const rectangle &clip
 		if (xpos < 0x80 && xdelta < 0)
 			xpos += 0x200;
 
-		// initialize the end address to the start address
+		// initialize the end address to the start address; every band stores
+		// the same value, the per-row scratch address is kept locally
 		data[7] = addr;
 
 		// if hidden, punt
@@ -1145,6 +1147,7 @@ void sega_outrun_sprite_device::draw(bitmap_ind16 &bitmap, const rectangle &clip
 		int maxy = cliprect.min_y - 1;
 		int yacc = 0;
 		int ytarget = top + ydelta * height;
+		uint16_t curaddr;
 		for (int y = top; y != ytarget; y += ydelta)
 		{
 			// skip drawing if not within the cliprect
@@ -1158,10 +1161,10 @@ void sega_outrun_sprite_device::draw(bitmap_ind16 &bitmap, const rectangle &clip
 				if (!flip)
 				{
 					// start at the word before because we preincrement below
-					data[7] = addr - 1;
+					curaddr = addr - 1;
 					for (x = xpos; (xdelta > 0 && x <= cliprect.max_x) || (xdelta < 0 && x >= cliprect.min_x); )
 					{
-						uint32_t pixels = spritedata[++data[7]];
+						uint32_t pixels = spritedata[++curaddr];
 
 						// draw four pixels
 						int pix;
@@ -1184,10 +1187,10 @@ void sega_outrun_sprite_device::draw(bitmap_ind16 &bitmap, const rectangle &clip
 				else
 				{
 					// start at the word after because we predecrement below
-					data[7] = addr + 1;
+					curaddr = addr + 1;
 					for (x = xpos; (xdelta > 0 && x <= cliprect.max_x) || (xdelta < 0 && x >= cliprect.min_x); )
 					{
-						uint32_t pixels = spritedata[--data[7]];
+						uint32_t pixels = spritedata[--curaddr];
 
 						// draw four pixels
 						int pix;
@@ -1240,6 +1243,7 @@ sega_yboard_sprite_device::sega_yboard_sprite_device(const machine_config &mconf
 	, m_sprite_region_ptr(*this, DEVICE_SELF)
 {
 	set_local_origin(0x600, 0x600);
+	set_draw_bands(4);
 }
 
 
@@ -538,4 +538,24 @@ _count_leading_ones(uint32_t value)
 	return 31U - result;
 }
 
+
+
+/***************************************************************************
+    INLINE TIMING FUNCTIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    get_profile_ticks - return a tick counter
+    from the processor that can be used for
+    profiling; the time stamp counter is far
+    cheaper to read than the OS clock
+-------------------------------------------------*/
+
+#define get_profile_ticks _get_profile_ticks
+inline int64_t ATTR_FORCE_INLINE
+_get_profile_ticks()
+{
+	return int64_t(__builtin_ia32_rdtsc());
+}
+
 #endif // MAME_OSD_EIGCCX86_H
@@ -423,4 +423,20 @@ static inline float _recip_approx(float z)
 #define mulu_64x64 _umul128
 #endif
 
+
+
+/***************************************************************************
+    INLINE TIMING FUNCTIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    get_profile_ticks - return a tick counter
+    from the processor that can be used for
+    profiling
+-------------------------------------------------*/
+
+#ifdef PTR64
+#define get_profile_ticks() int64_t(__rdtsc())
+#endif
+
 #endif // MAME_OSD_EIVCX86_H
@@ -226,6 +226,11 @@ void mac_osd_interface::extract_video_config()
 	video_config.switchres     = options().switch_res();
 	video_config.waitvsync     = options().wait_vsync();
 	video_config.syncrefresh   = options().sync_refresh();
+	if (options().vrr())
+	{
+		// the display follows our presents, so don't wait for vblank
+		video_config.waitvsync = video_config.syncrefresh = 0;
+	}
 	if (!video_config.waitvsync && video_config.syncrefresh)
 	{
 		osd_printf_warning("-syncrefresh specified without -waitvsync. Reverting to -nosyncrefresh\n");
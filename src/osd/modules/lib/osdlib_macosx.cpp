@@ -87,6 +87,31 @@ void osd_free_executable(void *ptr, size_t size)
 #endif
 }
 
+//============================================================
+//  osd_alloc_large
+//
+//  allocates "size" bytes of zero-filled memory, backed by
+//  large pages where the host allows it.
+//============================================================
+
+void *osd_alloc_large(size_t size, bool &huge)
+{
+	huge = false;
+	void *const block = mmap(nullptr, size, PROT_READ|PROT_WRITE, MAP_ANON|MAP_PRIVATE, -1, 0);
+	return (block != MAP_FAILED) ? block : nullptr;
+}
+
+//============================================================
+//  osd_free_large
+//
+//  frees memory allocated with osd_alloc_large
+//============================================================
+
+void osd_free_large(void *ptr, size_t size)
+{
+	munmap(ptr, size);
+}
+
 //============================================================
 //  osd_break_into_debugger
 //============================================================
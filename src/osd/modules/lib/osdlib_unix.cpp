@@ -84,6 +84,55 @@ void osd_free_executable(void *ptr, size_t size)
 #endif
 }
 
+//============================================================
+//  osd_alloc_large
+//
+//  allocates "size" bytes of zero-filled memory, backed by
+//  large pages where the host allows it.
+//============================================================
+
+void *osd_alloc_large(size_t size, bool &huge)
+{
+	huge = false;
+#if defined(MADV_HUGEPAGE)
+	// over-allocate so the block can be aligned to a huge page boundary
+	size_t const align = size_t(2) << 20;
+	size_t const pagesize = sysconf(_SC_PAGESIZE);
+	size = (size + pagesize - 1) & ~(pagesize - 1);
+	void *const block = mmap(nullptr, size + align, PROT_READ|PROT_WRITE, MAP_ANON|MAP_PRIVATE, -1, 0);
+	if (block == MAP_FAILED)
+		return nullptr;
+
+	uintptr_t const base = uintptr_t(block);
+	uintptr_t const aligned = (base + align - 1) & ~uintptr_t(align - 1);
+	if (aligned != base)
+		munmap(block, aligned - base);
+	if ((base + align) != aligned)
+		munmap(reinterpret_cast<void *>(aligned + size), base + align - aligned);
+
+	huge = !madvise(reinterpret_cast<void *>(aligned), size, MADV_HUGEPAGE);
+	return reinterpret_cast<void *>(aligned);
+#else
+	void *const block = mmap(nullptr, size, PROT_READ|PROT_WRITE, MAP_ANON|MAP_PRIVATE, -1, 0);
+	return (block != MAP_FAILED) ? block : nullptr;
+#endif
+}
+
+//============================================================
+//  osd_free_large
+//
+//  frees memory allocated with osd_alloc_large
+//============================================================
+
+void osd_free_large(void *ptr, size_t size)
+{
+#if defined(MADV_HUGEPAGE)
+	size_t const pagesize = sysconf(_SC_PAGESIZE);
+	size = (size + pagesize - 1) & ~(pagesize - 1);
+#endif
+	munmap(ptr, size);
+}
+
 //============================================================
 //  osd_break_into_debugger
 //============================================================
@@ -112,6 +112,31 @@ void osd_free_executable(void *ptr, size_t size)
 }
 
 
+//============================================================
+//  osd_alloc_large
+//
+//  allocates "size" bytes of zero-filled memory, backed by
+//  large pages where the host allows it.
+//============================================================
+
+void *osd_alloc_large(size_t size, bool &huge)
+{
+	huge = false;
+	return nullptr;
+}
+
+
+//============================================================
+//  osd_free_large
+//
+//  frees memory allocated with osd_alloc_large
+//============================================================
+
+void osd_free_large(void *ptr, size_t size)
+{
+}
+
+
 //============================================================
 //  osd_break_into_debugger
 //============================================================
@@ -107,6 +107,43 @@ void osd_free_executable(void *ptr, size_t size)
 }
 
 
+//============================================================
+//  osd_alloc_large
+//
+//  allocates "size" bytes of zero-filled memory, backed by
+//  large pages where the host allows it.
+//============================================================
+
+void *osd_alloc_large(size_t size, bool &huge)
+{
+	// large pages need SeLockMemoryPrivilege, so this usually falls through
+	size_t const large = GetLargePageMinimum();
+	if (large)
+	{
+		void *const block = VirtualAlloc(nullptr, (size + large - 1) & ~(large - 1), MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE);
+		if (block)
+		{
+			huge = true;
+			return block;
+		}
+	}
+	huge = false;
+	return VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+}
+
+
+//============================================================
+//  osd_free_large
+//
+//  frees memory allocated with osd_alloc_large
+//============================================================
+
+void osd_free_large(void *ptr, size_t size)
+{
+	VirtualFree(ptr, 0, MEM_RELEASE);
+}
+
+
 //============================================================
 //  osd_break_into_debugger
 //============================================================
@@ -93,15 +93,21 @@ public:
 static pcap_module *module = nullptr;
 
 #ifdef SDLMAME_MACOSX
+// frames are captured on a separate thread into this ring; the slot handed
+// out by recv_dev stays valid until the next call, so no copy is needed
+static constexpr int PCAP_RING_SIZE = 256;
+static constexpr int PCAP_FRAME_SIZE = 1600;
+
 struct netdev_pcap_context {
 	uint8_t *pkt;
 	int len;
 	pcap_t *p;
 
-	uint8_t packets[32][1600];
-	int packetlens[32];
+	uint8_t packets[PCAP_RING_SIZE][PCAP_FRAME_SIZE];
+	int packetlens[PCAP_RING_SIZE];
 	int head;
 	int tail;
+	bool busy;
 };
 #endif
 
@@ -129,13 +135,14 @@ static void netdev_pcap_handler(u_char *user, const struct pcap_pkthdr *h, const
 
 	if(!ctx->p) return;
 
-	if(OSAtomicCompareAndSwapInt((ctx->head+1) & 0x1F, ctx->tail, &ctx->tail)) {
-		printf("buffer full, dropping packet\n");
+	if(OSAtomicCompareAndSwapInt((ctx->head+1) & (PCAP_RING_SIZE - 1), ctx->tail, &ctx->tail)) {
+		osd_printf_verbose("pcap: buffer full, dropping packet\n");
 		return;
 	}
-	memcpy(ctx->packets[ctx->head], bytes, h->len);
-	ctx->packetlens[ctx->head] = h->len;
-	OSAtomicCompareAndSwapInt(ctx->head, (ctx->head+1) & 0x1F, &ctx->head);
+	int const len = std::min<int>(h->caplen, PCAP_FRAME_SIZE);
+	memcpy(ctx->packets[ctx->head], bytes, len);
+	ctx->packetlens[ctx->head] = len;
+	OSAtomicCompareAndSwapInt(ctx->head, (ctx->head+1) & (PCAP_RING_SIZE - 1), &ctx->head);
 }
 
 static void *netdev_pcap_blocker(void *arg) {
@@ -175,6 +182,7 @@ netdev_pcap::netdev_pcap(const char *name, class device_network_interface *ifdev
 #ifdef SDLMAME_MACOSX
 	m_ctx.head = 0;
 	m_ctx.tail = 0;
+	m_ctx.busy = false;
 	m_ctx.p = m_p;
 	pthread_create(&m_thread, nullptr, netdev_pcap_blocker, &m_ctx);
 #endif
@@ -206,7 +214,6 @@ int netdev_pcap::send(uint8_t *buf, int len)
 		return 0;
 	}
 	ret = (*module->pcap_sendpacket_dl)(m_p, buf, len);
-	printf("sent packet length %d, returned %d\n", len, ret);
 	return ret ? len : 0;
 	//return (!pcap_sendpacket_dl(m_p, buf, len))?len:0;
 }
@@ -214,22 +221,24 @@ int netdev_pcap::send(uint8_t *buf, int len)
 int netdev_pcap::recv_dev(uint8_t **buf)
 {
 #ifdef SDLMAME_MACOSX
-	uint8_t pktbuf[2048];
-	int ret;
-
 	// no device open?
 	if(!m_p) return 0;
 
+	// release the slot handed out last time
+	if(m_ctx.busy) {
+		OSAtomicCompareAndSwapInt(m_ctx.tail, (m_ctx.tail+1) & (PCAP_RING_SIZE - 1), &m_ctx.tail);
+		m_ctx.busy = false;
+	}
+
 	// Empty
 	if(OSAtomicCompareAndSwapInt(m_ctx.head, m_ctx.tail, &m_ctx.tail)) {
 		return 0;
 	}
 
-	memcpy(pktbuf, m_ctx.packets[m_ctx.tail], m_ctx.packetlens[m_ctx.tail]);
-	ret = m_ctx.packetlens[m_ctx.tail];
-	OSAtomicCompareAndSwapInt(m_ctx.tail, (m_ctx.tail+1) & 0x1F, &m_ctx.tail);
-	*buf = pktbuf;
-	return ret;
+	// hand out the slot in place; it's released on the next call
+	m_ctx.busy = true;
+	*buf = m_ctx.packets[m_ctx.tail];
+	return m_ctx.packetlens[m_ctx.tail];
 #else
 	struct pcap_pkthdr *header;
 	if(!m_p) return 0;
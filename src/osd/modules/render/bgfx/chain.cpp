@@ -37,6 +37,8 @@ bgfx_chain::bgfx_chain(std::string name, std::string author, bool transform, tar
 	, m_current_time(0)
 	, m_screen_index(screen_index)
 	, m_has_converter(false)
+	, m_has_adjuster(false)
+	, m_last_blend(0)
 {
 	for (bgfx_target* target : m_target_list)
 	{
@@ -105,12 +107,19 @@ void bgfx_chain::process(chain_manager::screen_prim &prim, int view, int screen,
 		screen_offset_y = -screen_container.yoffset();
 	}
 
+	// when the screen hasn't been redrawn and nothing else moved, passes whose inputs haven't
+	// been redrawn either can keep last frame's output (paused or static screens)
+	const bool redraw_all = state_changed(prim, screen_count, screen_scale_x, screen_scale_y, screen_offset_x, screen_offset_y, rotation_type, swap_xy, blend) || prim.m_source_changed;
+
 	int current_view = view;
 	for (bgfx_chain_entry* entry : m_entries)
 	{
 		if (!entry->skip())
 		{
-			entry->submit(current_view, prim, textures, screen_count, screen_width, screen_height, screen_scale_x, screen_scale_y, screen_offset_x, screen_offset_y, rotation_type, swap_xy, blend, screen);
+			if (redraw_all || !entry->up_to_date(screen, textures))
+			{
+				entry->submit(current_view, prim, textures, screen_count, screen_width, screen_height, screen_scale_x, screen_scale_y, screen_offset_x, screen_offset_y, rotation_type, swap_xy, blend, screen);
+			}
 			current_view++;
 		}
 	}
@@ -129,6 +138,37 @@ void bgfx_chain::process(chain_manager::screen_prim &prim, int view, int screen,
 	}
 }
 
+bool bgfx_chain::state_changed(chain_manager::screen_prim &prim, uint16_t screen_count, float screen_scale_x, float screen_scale_y, float screen_offset_x, float screen_offset_y, uint32_t rotation_type, bool swap_xy, uint64_t blend)
+{
+	m_state.clear();
+	m_state.push_back(float(screen_count));
+	m_state.push_back(float(prim.m_screen_width));
+	m_state.push_back(float(prim.m_screen_height));
+	m_state.push_back(float(prim.m_quad_width));
+	m_state.push_back(float(prim.m_quad_height));
+	m_state.push_back(prim.m_tex_width);
+	m_state.push_back(prim.m_tex_height);
+	m_state.push_back(screen_scale_x);
+	m_state.push_back(screen_scale_y);
+	m_state.push_back(screen_offset_x);
+	m_state.push_back(screen_offset_y);
+	m_state.push_back(float(rotation_type));
+	m_state.push_back(swap_xy ? 1.0f : 0.0f);
+	m_state.push_back(prim.m_prim->color.a);
+	m_state.push_back(prim.m_prim->color.r);
+	m_state.push_back(prim.m_prim->color.g);
+	m_state.push_back(prim.m_prim->color.b);
+	for (bgfx_slider* slider : m_sliders)
+	{
+		m_state.push_back(slider->value());
+	}
+
+	const bool changed = m_state != m_last_state || blend != m_last_blend;
+	m_state.swap(m_last_state);
+	m_last_blend = blend;
+	return changed;
+}
+
 uint32_t bgfx_chain::applicable_passes()
 {
 	int applicable_passes = 0;
@@ -47,6 +47,8 @@ public:
 	void insert_effect(uint32_t index, bgfx_effect *effect, std::string name, std::string source, chain_manager &chains);
 
 private:
+	bool state_changed(chain_manager::screen_prim &prim, uint16_t screen_count, float screen_scale_x, float screen_scale_y, float screen_offset_x, float screen_offset_y, uint32_t rotation_type, bool swap_xy, uint64_t blend);
+
 	std::string                         m_name;
 	std::string                         m_author;
 	bool                                m_transform;
@@ -61,6 +63,9 @@ private:
 	uint32_t                            m_screen_index;
 	bool                                m_has_converter;
 	bool                                m_has_adjuster;
+	std::vector<float>                  m_state;            // everything besides the inputs that every pass may depend on
+	std::vector<float>                  m_last_state;
+	uint64_t                            m_last_blend;
 };
 
 #endif // __DRAWBGFX_CHAIN__
@@ -40,7 +40,16 @@ bgfx_chain_entry::bgfx_chain_entry(std::string name, bgfx_effect* effect, clear_
 	, m_targets(targets)
 	, m_output(output)
 	, m_apply_tint(apply_tint)
+	, m_cacheable(true)
+	, m_output_serial(0)
 {
+	for (bgfx_entry_uniform* uniform : m_uniforms)
+	{
+		if (uniform->animated())
+		{
+			m_cacheable = false;
+		}
+	}
 }
 
 bgfx_chain_entry::~bgfx_chain_entry()
@@ -60,6 +69,7 @@ bgfx_chain_entry::~bgfx_chain_entry()
 
 void bgfx_chain_entry::submit(int view, chain_manager::screen_prim &prim, texture_manager& textures, uint16_t screen_count, uint16_t screen_width, uint16_t screen_height, float screen_scale_x, float screen_scale_y, float screen_offset_x, float screen_offset_y, uint32_t rotation_type, bool swap_xy, uint64_t blend, int32_t screen)
 {
+	m_input_state.clear();
 	if (!setup_view(view, screen_width, screen_height, screen))
 	{
 		return;
@@ -68,6 +78,9 @@ void bgfx_chain_entry::submit(int view, chain_manager::screen_prim &prim, textur
 	for (bgfx_input_pair* input : m_inputs)
 	{
 		input->bind(m_effect, screen);
+
+		bgfx_texture_handle_provider* provider = textures.provider(input->texture() + std::to_string(screen));
+		m_input_state.push_back({ provider, input_serial(provider) });
 	}
 
 	uint32_t tint = 0xffffffff;
@@ -96,12 +109,52 @@ void bgfx_chain_entry::submit(int view, chain_manager::screen_prim &prim, textur
 
 	m_effect->submit(view, blend);
 
-	if (m_targets.target(screen, m_output) != nullptr)
+	bgfx_target* output = m_targets.target(screen, m_output);
+	if (output != nullptr)
+	{
+		output->page_flip();
+		m_output_serial = output->serial();
+	}
+	else
 	{
-		m_targets.target(screen, m_output)->page_flip();
+		m_input_state.clear();
 	}
 }
 
+uint64_t bgfx_chain_entry::input_serial(bgfx_texture_handle_provider* provider) const
+{
+	// plain textures only change along with the screen, which the chain checks for itself
+	return (provider != nullptr && provider->is_target()) ? static_cast<bgfx_target*>(provider)->serial() : 0;
+}
+
+bool bgfx_chain_entry::up_to_date(int32_t screen, texture_manager& textures)
+{
+	// nothing rendered yet, or the output depends on time
+	if (!m_cacheable || m_input_state.size() != m_inputs.size())
+	{
+		return false;
+	}
+
+	// the output was rebuilt or drawn over since
+	bgfx_target* output = m_targets.target(screen, m_output);
+	if (output == nullptr || output->serial() != m_output_serial)
+	{
+		return false;
+	}
+
+	// an input was redrawn, including feedback from later passes in the previous frame
+	for (size_t i = 0; i < m_inputs.size(); i++)
+	{
+		bgfx_texture_handle_provider* provider = textures.provider(m_inputs[i]->texture() + std::to_string(screen));
+		if (provider != m_input_state[i].provider || input_serial(provider) != m_input_state[i].serial)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 void bgfx_chain_entry::setup_screensize_uniforms(texture_manager& textures, uint16_t screen_width, uint16_t screen_height, int32_t screen)
 {
 	float width = screen_width;
@@ -189,7 +242,8 @@ void bgfx_chain_entry::setup_targetscale_uniform(int32_t screen) const
 		bgfx_target* output = m_targets.target(screen, m_output);
 		if (output != nullptr)
 		{
-			float values[2] = { float(output->scale()), float(output->scale()) };
+			const float scale = float(output->scale()) / float(output->divisor());
+			float values[2] = { scale, scale };
 			target_scale->set(values, sizeof(float) * 2);
 		}
 	}
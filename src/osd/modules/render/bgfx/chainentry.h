@@ -27,6 +27,7 @@ class bgfx_effect;
 class bgfx_target;
 class bgfx_entry_uniform;
 class bgfx_suppressor;
+class bgfx_texture_handle_provider;
 class clear_state;
 class texture_manager;
 class target_manager;
@@ -43,6 +44,7 @@ public:
 	std::string name() const { return m_name; }
 	std::vector<bgfx_input_pair*>& inputs() { return m_inputs; }
 	bool skip();
+	bool up_to_date(int32_t screen, texture_manager& textures);
 
 private:
 	void setup_auto_uniforms(chain_manager::screen_prim &prim, texture_manager& textures, uint16_t screen_count, uint16_t screen_width, uint16_t screen_height, float screen_scale_x, float screen_scale_y, float screen_offset_x, float screen_offset_y, uint32_t rotation_type, bool swap_xy, int32_t screen);
@@ -60,6 +62,13 @@ private:
 
 	bool setup_view(int view, uint16_t screen_width, uint16_t screen_height, int32_t screen) const;
 	void put_screen_buffer(uint16_t screen_width, uint16_t screen_height, uint32_t screen_tint, bgfx::TransientVertexBuffer* buffer) const;
+	uint64_t input_serial(bgfx_texture_handle_provider* provider) const;
+
+	struct input_state
+	{
+		bgfx_texture_handle_provider* provider;
+		uint64_t serial;
+	};
 
 	std::string                         m_name;
 	bgfx_effect*                        m_effect;
@@ -70,6 +79,9 @@ private:
 	target_manager&                     m_targets;
 	std::string                         m_output;
 	bool                                m_apply_tint;
+	bool                                m_cacheable;
+	std::vector<input_state>            m_input_state;      // inputs as they were when the output was last rendered
+	uint64_t                            m_output_serial;
 };
 
 #endif // __DRAWBGFX_CHAIN_ENTRY__
@@ -450,82 +450,88 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 		std::string screen_name = "screen" + screen_index;
 		std::string palette_name = "palette" + screen_index;
 		std::string full_name = (needs_conversion || needs_adjust) ? source_name : screen_name;
-		if (texture && (texture->width() != tex_width || texture->height() != tex_height))
-		{
-			m_textures.add_provider(full_name, nullptr);
-			delete texture;
-			texture = nullptr;
-
-			if (palette)
-			{
-				m_textures.add_provider(palette_name, nullptr);
-				delete palette;
-				palette = nullptr;
-			}
-		}
 
-		bgfx::TextureFormat::Enum dst_format = bgfx::TextureFormat::RGBA8;
-		uint16_t pitch = tex_width;
-		const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
-			tex_width, tex_height, prim.m_rowpixels, prim.m_prim->texture.palette, prim.m_prim->texture.base, &pitch);
-
-		if (texture == nullptr)
+		// a screen that wasn't redrawn still has last frame's image uploaded
+		prim.m_source_changed = texture == nullptr || screen >= m_last_screen_prims.size() || !prim.same_source(m_last_screen_prims[screen]);
+		if (prim.m_source_changed)
 		{
-			bgfx_texture *texture = new bgfx_texture(full_name, dst_format, tex_width, tex_height, mem, BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP | BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT, pitch);
-			m_textures.add_provider(full_name, texture);
-
-			if (prim.m_prim->texture.palette)
+			if (texture && (texture->width() != tex_width || texture->height() != tex_height))
 			{
-				uint16_t palette_width = (uint16_t)std::min(prim.m_palette_length, 256U);
-				uint16_t palette_height = (uint16_t)std::max((prim.m_palette_length + 255) / 256, 1U);
-				m_palette_temp.resize(palette_width * palette_height * 4);
-				memcpy(&m_palette_temp[0], prim.m_prim->texture.palette, prim.m_palette_length * 4);
-				const bgfx::Memory *palmem = bgfx::copy(&m_palette_temp[0], palette_width * palette_height * 4);
-				palette = new bgfx_texture(palette_name, bgfx::TextureFormat::BGRA8, palette_width, palette_height, palmem, BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP | BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT, palette_width * 4);
-				m_textures.add_provider(palette_name, palette);
-			}
+				m_textures.add_provider(full_name, nullptr);
+				delete texture;
+				texture = nullptr;
 
-			while (screen >= m_screen_textures.size())
-			{
-				m_screen_textures.push_back(nullptr);
+				if (palette)
+				{
+					m_textures.add_provider(palette_name, nullptr);
+					delete palette;
+					palette = nullptr;
+				}
 			}
-			m_screen_textures[screen] = texture;
 
-			while (screen >= m_screen_palettes.size())
-			{
-				m_screen_palettes.push_back(nullptr);
-			}
-			if (palette)
-			{
-				m_screen_palettes[screen] = palette;
-			}
-		}
-		else
-		{
-			texture->update(mem, pitch);
+			bgfx::TextureFormat::Enum dst_format = bgfx::TextureFormat::RGBA8;
+			uint16_t pitch = tex_width;
+			const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
+				tex_width, tex_height, prim.m_rowpixels, prim.m_prim->texture.palette, prim.m_prim->texture.base, &pitch);
 
-			if (prim.m_prim->texture.palette)
+			if (texture == nullptr)
 			{
-				uint16_t palette_width = (uint16_t)std::min(prim.m_palette_length, 256U);
-				uint16_t palette_height = (uint16_t)std::max((prim.m_palette_length + 255) / 256, 1U);
-				const uint32_t palette_size = palette_width * palette_height * 4;
-				m_palette_temp.resize(palette_size);
-				memcpy(&m_palette_temp[0], prim.m_prim->texture.palette, prim.m_palette_length * 4);
-				const bgfx::Memory *palmem = bgfx::copy(&m_palette_temp[0], palette_size);
+				bgfx_texture *texture = new bgfx_texture(full_name, dst_format, tex_width, tex_height, mem, BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP | BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT, pitch);
+				m_textures.add_provider(full_name, texture);
 
+				if (prim.m_prim->texture.palette)
+				{
+					uint16_t palette_width = (uint16_t)std::min(prim.m_palette_length, 256U);
+					uint16_t palette_height = (uint16_t)std::max((prim.m_palette_length + 255) / 256, 1U);
+					m_palette_temp.resize(palette_width * palette_height * 4);
+					memcpy(&m_palette_temp[0], prim.m_prim->texture.palette, prim.m_palette_length * 4);
+					const bgfx::Memory *palmem = bgfx::copy(&m_palette_temp[0], palette_width * palette_height * 4);
+					palette = new bgfx_texture(palette_name, bgfx::TextureFormat::BGRA8, palette_width, palette_height, palmem, BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP | BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT, palette_width * 4);
+					m_textures.add_provider(palette_name, palette);
+				}
+
+				while (screen >= m_screen_textures.size())
+				{
+					m_screen_textures.push_back(nullptr);
+				}
+				m_screen_textures[screen] = texture;
+
+				while (screen >= m_screen_palettes.size())
+				{
+					m_screen_palettes.push_back(nullptr);
+				}
 				if (palette)
 				{
-					palette->update(palmem);
+					m_screen_palettes[screen] = palette;
 				}
-				else
+			}
+			else
+			{
+				texture->update(mem, pitch);
+
+				if (prim.m_prim->texture.palette)
 				{
-					palette = new bgfx_texture(palette_name, bgfx::TextureFormat::BGRA8, palette_width, palette_height, palmem, BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP | BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT, palette_width * 4);
-					m_textures.add_provider(palette_name, palette);
-					while (screen >= m_screen_palettes.size())
+					uint16_t palette_width = (uint16_t)std::min(prim.m_palette_length, 256U);
+					uint16_t palette_height = (uint16_t)std::max((prim.m_palette_length + 255) / 256, 1U);
+					const uint32_t palette_size = palette_width * palette_height * 4;
+					m_palette_temp.resize(palette_size);
+					memcpy(&m_palette_temp[0], prim.m_prim->texture.palette, prim.m_palette_length * 4);
+					const bgfx::Memory *palmem = bgfx::copy(&m_palette_temp[0], palette_size);
+
+					if (palette)
 					{
-						m_screen_palettes.push_back(nullptr);
+						palette->update(palmem);
+					}
+					else
+					{
+						palette = new bgfx_texture(palette_name, bgfx::TextureFormat::BGRA8, palette_width, palette_height, palmem, BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP | BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT, palette_width * 4);
+						m_textures.add_provider(palette_name, palette);
+						while (screen >= m_screen_palettes.size())
+						{
+							m_screen_palettes.push_back(nullptr);
+						}
+						m_screen_palettes[screen] = palette;
 					}
-					m_screen_palettes[screen] = palette;
 				}
 			}
 		}
@@ -543,6 +549,7 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 		}
 	}
 
+	m_last_screen_prims = m_screen_prims;
 	return m_screen_prims.size();
 }
 
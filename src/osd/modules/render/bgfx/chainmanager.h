@@ -78,7 +78,7 @@ public:
 	{
 	public:
 		screen_prim() : m_prim(nullptr), m_screen_width(0), m_screen_height(0), m_quad_width(0), m_quad_height(0)
-			, m_tex_width(0), m_tex_height(0), m_rowpixels(0), m_palette_length(0), m_flags(0)
+			, m_tex_width(0), m_tex_height(0), m_rowpixels(0), m_palette_length(0), m_flags(0), m_base(nullptr), m_source_changed(true)
 		{
 		}
 
@@ -94,6 +94,15 @@ public:
 			m_rowpixels = prim->texture.rowpixels;
 			m_palette_length = prim->texture.palette_length;
 			m_flags = prim->flags;
+			m_base = prim->texture.base;
+			m_source_changed = true;
+		}
+
+		// screens only switch bitmaps when they are redrawn, so the same bitmap means the same image
+		bool same_source(const screen_prim &prev) const
+		{
+			return m_base == prev.m_base && m_prim->texture.palette == nullptr && m_rowpixels == prev.m_rowpixels
+				&& m_tex_width == prev.m_tex_width && m_tex_height == prev.m_tex_height && m_flags == prev.m_flags;
 		}
 
 		render_primitive *m_prim;
@@ -106,6 +115,8 @@ public:
 		int m_rowpixels;
 		uint32_t m_palette_length;
 		uint32_t m_flags;
+		void *m_base;
+		bool m_source_changed;
 	};
 
 private:
@@ -149,6 +160,7 @@ private:
 	std::vector<bgfx_effect*>   m_converters;
 	bgfx_effect *               m_adjuster;
 	std::vector<screen_prim>    m_screen_prims;
+	std::vector<screen_prim>    m_last_screen_prims;
 	std::vector<uint8_t>        m_palette_temp;
 
 	static const uint32_t       CHAIN_NONE;
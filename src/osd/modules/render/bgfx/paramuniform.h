@@ -21,6 +21,7 @@ public:
 	bgfx_param_uniform(bgfx_uniform* uniform, bgfx_parameter* param);
 
 	virtual void bind() override;
+	virtual bool animated() const override { return true; }
 
 private:
 	bgfx_parameter* m_param;
@@ -10,7 +10,9 @@
 
 #include "target.h"
 
-bgfx_target::bgfx_target(std::string name, bgfx::TextureFormat::Enum format, uint16_t width, uint16_t height, uint32_t style, bool double_buffer, bool filter, uint16_t scale, uint32_t screen)
+uint64_t bgfx_target::s_next_serial = 0;
+
+bgfx_target::bgfx_target(std::string name, bgfx::TextureFormat::Enum format, uint16_t width, uint16_t height, uint32_t style, bool double_buffer, bool filter, uint16_t scale, uint32_t screen, uint16_t divisor)
 	: m_name(name)
 	, m_format(format)
 	, m_targets(nullptr)
@@ -21,15 +23,17 @@ bgfx_target::bgfx_target(std::string name, bgfx::TextureFormat::Enum format, uin
 	, m_style(style)
 	, m_filter(filter)
 	, m_scale(scale)
+	, m_divisor(divisor ? divisor : 1)
 	, m_screen(screen)
 	, m_current_page(0)
+	, m_serial(++s_next_serial)
 	, m_initialized(false)
 	, m_page_count(double_buffer ? 2 : 1)
 {
 	if (m_width > 0 && m_height > 0)
 	{
-		m_width *= m_scale;
-		m_height *= m_scale;
+		m_width = std::max(m_width * m_scale / m_divisor, 1);
+		m_height = std::max(m_height * m_scale / m_divisor, 1);
 		uint32_t wrap_mode = BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP;
 		uint32_t filter_mode = filter ? (BGFX_SAMPLER_MIN_ANISOTROPIC | BGFX_SAMPLER_MAG_ANISOTROPIC) : (BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT);
 
@@ -58,8 +62,10 @@ bgfx_target::bgfx_target(void *handle, uint16_t width, uint16_t height)
 	, m_style(TARGET_STYLE_CUSTOM)
 	, m_filter(false)
 	, m_scale(0)
+	, m_divisor(1)
 	, m_screen(-1)
 	, m_current_page(0)
+	, m_serial(++s_next_serial)
 	, m_initialized(true)
 	, m_page_count(0)
 {
@@ -97,6 +103,7 @@ void bgfx_target::page_flip()
 {
 	if (!m_initialized) return;
 
+	m_serial = ++s_next_serial;
 	if (m_double_buffer)
 	{
 		m_current_page = 1 - m_current_page;
@@ -27,7 +27,7 @@ enum
 class bgfx_target : public bgfx_texture_handle_provider
 {
 public:
-	bgfx_target(std::string name, bgfx::TextureFormat::Enum format, uint16_t width, uint16_t height, uint32_t style, bool double_buffer, bool filter, uint16_t scale, uint32_t screen);
+	bgfx_target(std::string name, bgfx::TextureFormat::Enum format, uint16_t width, uint16_t height, uint32_t style, bool double_buffer, bool filter, uint16_t scale, uint32_t screen, uint16_t divisor = 1);
 	bgfx_target(void *handle, uint16_t width, uint16_t height);
 	virtual ~bgfx_target();
 
@@ -41,6 +41,8 @@ public:
 	uint32_t                    style() const { return m_style; }
 	bool                        filter() const { return m_filter; }
 	uint16_t                    scale() const { return m_scale; }
+	uint16_t                    divisor() const { return m_divisor; }
+	uint64_t                    serial() const { return m_serial; }
 	uint32_t                    screen_index() const { return m_screen; }
 
 	// bgfx_texture_handle_provider
@@ -64,14 +66,18 @@ private:
 	uint32_t                    m_style;
 	bool                        m_filter;
 	uint16_t                    m_scale;
+	uint16_t                    m_divisor;
 
 	int32_t                     m_screen;
 
 	uint32_t                    m_current_page;
+	uint64_t                    m_serial;           // changes whenever new contents are flipped in
 
 	bool                        m_initialized;
 
 	const uint32_t              m_page_count;
+
+	static uint64_t             s_next_serial;
 };
 
 #endif // __DRAWBGFX_TARGET__
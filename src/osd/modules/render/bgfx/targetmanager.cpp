@@ -45,9 +45,9 @@ target_manager::~target_manager()
 	}
 }
 
-bgfx_target* target_manager::create_target(std::string name, bgfx::TextureFormat::Enum format, uint16_t width, uint16_t height, uint32_t style, bool double_buffer, bool filter, uint16_t scale, uint32_t screen)
+bgfx_target* target_manager::create_target(std::string name, bgfx::TextureFormat::Enum format, uint16_t width, uint16_t height, uint32_t style, bool double_buffer, bool filter, uint16_t scale, uint32_t screen, uint16_t divisor)
 {
-	bgfx_target* target = new bgfx_target(name, format, width, height, style, double_buffer, filter, scale, screen);
+	bgfx_target* target = new bgfx_target(name, format, width, height, style, double_buffer, filter, scale, screen, divisor);
 	std::string full_name = name + std::to_string(screen);
 
 	m_targets[full_name] = target;
@@ -131,11 +131,12 @@ void target_manager::rebuild_targets(uint32_t screen, uint32_t style)
 		const bool double_buffered = target->double_buffered();
 		const bool filter = target->filter();
 		const uint16_t scale = target->scale();
+		const uint16_t divisor = target->divisor();
 		const uint16_t width(sizes[screen].width());
 		const uint16_t height(sizes[screen].height());
 		delete target;
 
-		create_target(name, format, width, height, style, double_buffered, filter, scale, screen);
+		create_target(name, format, width, height, style, double_buffered, filter, scale, screen, divisor);
 	}
 }
 
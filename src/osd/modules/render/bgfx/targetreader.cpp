@@ -33,9 +33,19 @@ bgfx_target* target_reader::read_from_value(const Value& value, std::string pref
 	bool bilinear = get_bool(value, "bilinear", true);
 	bool double_buffer = get_bool(value, "doublebuffer", true);
 	int scale = 1;
+	int divisor = 1;
 	if (value.HasMember("scale"))
 	{
-		scale = int(floor(value["scale"].GetDouble() + 0.5));
+		// fractional scales give reduced resolution targets, e.g. 0.5 for a half size blur pass
+		const double scale_value = value["scale"].GetDouble();
+		if (scale_value < 1.0)
+		{
+			divisor = int(floor(1.0 / scale_value + 0.5));
+		}
+		else
+		{
+			scale = int(floor(scale_value + 0.5));
+		}
 	}
 
 	uint16_t width = 0;
@@ -60,7 +70,7 @@ bgfx_target* target_reader::read_from_value(const Value& value, std::string pref
 			break;
 	}
 
-	return chains.targets().create_target(target_name, bgfx::TextureFormat::RGBA8, width, height, mode, double_buffer, bilinear, scale, screen_index);
+	return chains.targets().create_target(target_name, bgfx::TextureFormat::RGBA8, width, height, mode, double_buffer, bilinear, scale, screen_index, divisor);
 }
 
 bool target_reader::validate_parameters(const Value& value, std::string prefix)
@@ -72,5 +82,6 @@ bool target_reader::validate_parameters(const Value& value, std::string prefix)
 	if (!READER_CHECK(!value.HasMember("bilinear") || value["bilinear"].IsBool(), (prefix + "Value 'bilinear' must be a boolean\n").c_str())) return false;
 	if (!READER_CHECK(!value.HasMember("doublebuffer") || value["doublebuffer"].IsBool(), (prefix + "Value 'doublebuffer' must be a boolean\n").c_str())) return false;
 	if (!READER_CHECK(!value.HasMember("scale") || value["scale"].IsNumber(), (prefix + "Value 'scale' must be a numeric value\n").c_str())) return false;
+	if (!READER_CHECK(!value.HasMember("scale") || value["scale"].GetDouble() > 0.0, (prefix + "Value 'scale' must be greater than zero\n").c_str())) return false;
 	return true;
 }
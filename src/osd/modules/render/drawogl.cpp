@@ -2373,6 +2373,14 @@ static void texture_set_data(ogl_texture_info *texture, const render_texinfo *te
 			{
 				dst = (uint8_t *)(texture->data + (y * texture->yprescale + texture->borderpix + y2) * texture->rawwidth);
 
+				// prescaled rows are identical, so duplicate the line we just converted
+				// rather than converting it again; a write-only mapped PBO can't be read back
+				if (y2 != 0 && texture->type != TEXTURE_TYPE_DYNAMIC)
+				{
+					memcpy(dst, dst - texture->rawwidth * sizeof(uint32_t), texture->rawwidth * sizeof(uint32_t));
+					continue;
+				}
+
 				switch (PRIMFLAG_GET_TEXFORMAT(flags))
 				{
 					case TEXFORMAT_PALETTE16:
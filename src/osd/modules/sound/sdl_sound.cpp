@@ -46,7 +46,7 @@ public:
 	sound_sdl() :
 		osd_module(OSD_SOUND_PROVIDER, "sdl"), sound_module(),
 		stream_in_initialized(0),
-		attenuation(0), buf_locked(0), stream_buffer(nullptr), stream_buffer_size(0), buffer_underflows(0), buffer_overflows(0)
+		attenuation(0), buf_locked(0), stream_buffer(nullptr), stream_buffer_size(0), adaptive_latency(false), seen_underflows(0), buffer_underflows(0), buffer_overflows(0)
 {
 		sdl_xfer_samples = SDL_XFER_SAMPLES;
 	}
@@ -94,6 +94,10 @@ private:
 	std::unique_ptr<ring_buffer> stream_buffer;
 	uint32_t         stream_buffer_size;
 
+	// adaptive latency: start with one transfer queued, add one per underrun
+	bool             adaptive_latency;
+	int              seen_underflows;
+
 
 	// diagnostics
 	int              buffer_underflows;
@@ -247,7 +251,7 @@ void sound_sdl::update_audio_stream(bool is_throttled, const int16_t *buffer, in
 	{
 		// Fill in some zeros to prevent an initial buffer underflow
 		int8_t zero = 0;
-		size_t zsize = stream_buffer->free_size() / 2;
+		size_t zsize = adaptive_latency ? (sdl_xfer_samples * sizeof(*buffer) * 2) : (stream_buffer->free_size() / 2);
 		while (zsize--)
 			stream_buffer->append(&zero, 1);
 
@@ -257,6 +261,27 @@ void sound_sdl::update_audio_stream(bool is_throttled, const int16_t *buffer, in
 	}
 
 	size_t bytes_this_frame = samples_this_frame * sizeof(*buffer) * 2;
+
+	if (adaptive_latency)
+	{
+		// the callback ran dry since the last frame: queue another transfer's worth of silence
+		lock_buffer();
+		if (buffer_underflows != seen_underflows)
+		{
+			seen_underflows = buffer_underflows;
+			size_t const xfer_bytes = sdl_xfer_samples * sizeof(*buffer) * 2;
+			if (stream_buffer->data_size() + xfer_bytes <= stream_buffer->free_size())
+			{
+				int8_t zero = 0;
+				for (size_t zsize = xfer_bytes; zsize > 0; zsize--)
+					stream_buffer->append(&zero, 1);
+				if (LOG_SOUND)
+					util::stream_format(*sound_log, "Underflow: raising latency, DS=%u\n", stream_buffer->data_size());
+			}
+		}
+		unlock_buffer();
+	}
+
 	size_t free_size = stream_buffer->free_size();
 	size_t data_size = stream_buffer->data_size();
 
@@ -372,8 +397,10 @@ int sound_sdl::init(const osd_options &options)
 
 		sdl_xfer_samples = obtained.samples;
 
-		// pin audio latency
-		audio_latency = std::max(std::min(m_audio_latency, MAX_AUDIO_LATENCY), 1);
+		// pin audio latency; in adaptive mode size for the worst case and let it grow into it
+		adaptive_latency = m_audio_latency == 0;
+		seen_underflows = buffer_underflows;
+		audio_latency = adaptive_latency ? MAX_AUDIO_LATENCY : std::max(std::min(m_audio_latency, MAX_AUDIO_LATENCY), 1);
 
 		// compute the buffer sizes
 		stream_buffer_size = (sample_rate() * 2 * sizeof(int16_t) * (2 + audio_latency)) / 30;
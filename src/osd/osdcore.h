@@ -683,6 +683,31 @@ void *osd_alloc_executable(size_t size);
 void osd_free_executable(void *ptr, size_t size);
 
 
+/// \brief Allocate a large block of zero-filled memory
+///
+/// Intended for big emulated RAM and ROM regions.  Where the host
+/// supports it, the block is backed by large pages to reduce TLB
+/// pressure.  Allocated memory must be freed by calling
+/// #osd_free_large passing the same size.
+/// \param [in] size Number of bytes to allocate.
+/// \param [out] huge Set to true if the block is backed by large
+///   pages.
+/// \return Pointer to allocated memory, or nullptr if allocation
+///   failed or is not supported, in which case the caller should fall
+///   back to an ordinary heap allocation.
+/// \sa osd_free_large
+void *osd_alloc_large(size_t size, bool &huge);
+
+
+/// \brief Free memory allocated by osd_alloc_large
+///
+/// \param [in] ptr Pointer returned by #osd_alloc_large.
+/// \param [in] size Number of bytes originally requested.  Must match
+///   the value passed to #osd_alloc_large.
+/// \sa osd_alloc_large
+void osd_free_large(void *ptr, size_t size);
+
+
 /// \brief Break into host debugger if attached
 ///
 /// This function is called when a fatal error occurs.  If a debugger is
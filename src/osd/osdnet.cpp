@@ -38,8 +38,9 @@ class osd_netdev *open_netdev(int id, class device_network_interface *ifdev, int
 osd_netdev::osd_netdev(class device_network_interface *ifdev, int rate)
 {
 	m_dev = ifdev;
+	m_period = attotime::from_hz(rate);
 	m_timer = ifdev->device().machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(osd_netdev::recv), this));
-	m_timer->adjust(attotime::from_hz(rate), 0, attotime::from_hz(rate));
+	m_timer->adjust(m_period, 0, m_period);
 }
 
 osd_netdev::~osd_netdev()
@@ -48,7 +49,10 @@ osd_netdev::~osd_netdev()
 
 void osd_netdev::start()
 {
-	m_timer->enable(true);
+	// deliver anything that queued up while receive was paused right away,
+	// rather than waiting for the next poll
+	if (!m_timer->enabled())
+		m_timer->adjust(attotime::zero, 0, m_period);
 }
 
 void osd_netdev::stop()
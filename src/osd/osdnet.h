@@ -40,6 +40,7 @@ private:
 
 	class device_network_interface *m_dev;
 	emu_timer *m_timer;
+	attotime m_period;
 };
 
 class osd_netdev *open_netdev(int id, class device_network_interface *ifdev, int rate);
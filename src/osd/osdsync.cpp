@@ -72,6 +72,9 @@ static void spin_while(const volatile _AtomType * volatile atom, const _MainType
 			if ((*atom != val) ^ invert)
 				return;
 		}
+
+		// let other threads have the core between bursts
+		std::this_thread::yield();
 	} while (((*atom == val) ^ invert) && osd_ticks() < stopspin);
 }
 
@@ -480,21 +483,30 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 {
 	osd_work_item *itemlist = nullptr, *lastitem = nullptr;
 	osd_work_item **item_tailptr = &itemlist;
+	osd_work_item *freeitems;
 	int itemnum;
 
+	// grab as many recycled items as we need from the free list in one go
+	{
+		std::lock_guard<std::mutex> lock(queue->lock);
+		freeitems = (osd_work_item *)queue->free;
+		osd_work_item *lastfree = freeitems;
+		for (itemnum = 1; lastfree != nullptr && itemnum < numitems; itemnum++)
+			lastfree = lastfree->next;
+		queue->free = (lastfree != nullptr) ? lastfree->next : nullptr;
+		if (lastfree != nullptr)
+			lastfree->next = nullptr;
+	}
+
 	// loop over items, building up a local list of work
 	for (itemnum = 0; itemnum < numitems; itemnum++)
 	{
 		osd_work_item *item;
 
-		// first allocate a new work item; try the free list first
-		{
-			std::lock_guard<std::mutex> lock(queue->lock);
-			do
-			{
-				item = (osd_work_item *)queue->free;
-			} while (item != nullptr && !queue->free.compare_exchange_weak(item, item->next, std::memory_order_release, std::memory_order_relaxed));
-		}
+		// first allocate a new work item; try the recycled items first
+		item = freeitems;
+		if (item != nullptr)
+			freeitems = item->next;
 
 		// if nothing, allocate something new
 		if (item == nullptr)
@@ -795,9 +807,11 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 				}
 			}
 
+#if KEEP_STATISTICS
 			// if we removed an item and there's still work to do, bump the stats
 			if (queue_has_list_items(queue))
 				add_to_stat(queue->extraitems, 1);
+#endif
 		}
 	}
 
@@ -594,6 +594,10 @@ void sdl_window_info::update()
 		else
 			event_wait_ticks = 0;
 
+		// with -video none there's nothing to draw, so don't build primitives either
+		if (video_config.novideo && !video_config.perftest)
+			return;
+
 		if (m_rendered_event.wait(event_wait_ticks))
 		{
 			const int update = 1;
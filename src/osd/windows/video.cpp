@@ -193,6 +193,11 @@ void windows_osd_interface::extract_video_config()
 	video_config.syncrefresh   = options().sync_refresh();
 	video_config.triplebuf     = options().triple_buffer();
 	video_config.switchres     = options().switch_res();
+	if (options().vrr())
+	{
+		// the display follows our presents, so don't wait for or queue behind vblank
+		video_config.waitvsync = video_config.syncrefresh = video_config.triplebuf = 0;
+	}
 
 	if (video_config.prescale < 1 || video_config.prescale > 8)
 	{
@@ -29,6 +29,7 @@
 #include <limits>
 #include <memory>
 #include <new>
+#include <thread>
 #include <unordered_map>
 
 
@@ -282,7 +283,32 @@ public:
 		: m_toc(nullptr),
 			m_file(file),
 			m_offset(offset),
-			m_maxoffset(std::min(maxoffset, file.logical_bytes())) { }
+			m_maxoffset(std::min(maxoffset, file.logical_bytes())),
+			m_reader_queue(nullptr) { }
+
+	virtual ~chd_chdfile_compressor()
+	{
+		if (m_reader_queue != nullptr)
+			osd_work_queue_free(m_reader_queue);
+	}
+
+	// open additional handles on the input so its hunks can be decompressed in parallel
+	void add_readers(const char *filename, const char *parentname, int count)
+	{
+		for (int index = 0; index < count; index++)
+		{
+			auto reader = std::make_unique<chd_reader>();
+			if (parentname != nullptr && reader->m_parent.open(parentname) != CHDERR_NONE)
+				break;
+			if (reader->m_file.open(filename, false, reader->m_parent.opened() ? &reader->m_parent : nullptr) != CHDERR_NONE)
+				break;
+			m_readers.push_back(std::move(reader));
+		}
+		if (!m_readers.empty() && m_reader_queue == nullptr)
+			m_reader_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+		if (m_reader_queue == nullptr)
+			m_readers.clear();
+	}
 
 	// read interface
 	virtual uint32_t read_data(void *dest, uint64_t offset, uint32_t length)
@@ -292,7 +318,7 @@ public:
 			return 0;
 		if (offset + length > m_maxoffset)
 			length = m_maxoffset - offset;
-		chd_error err = m_file.read_bytes(offset, dest, length);
+		chd_error err = m_readers.empty() ? m_file.read_bytes(offset, dest, length) : read_parallel(offset, dest, length);
 		if (err != CHDERR_NONE)
 			throw err;
 
@@ -336,10 +362,66 @@ public:
 const cdrom_toc *   m_toc;
 
 private:
+	// an extra handle on the input CHD, with its own parent and codecs
+	struct chd_reader
+	{
+		chd_file        m_parent;
+		chd_file        m_file;
+	};
+
+	// one piece of a parallel read
+	struct read_slice
+	{
+		chd_file *      m_file;
+		uint64_t        m_offset;
+		uint8_t *       m_dest;
+		uint32_t        m_length;
+		chd_error       m_err;
+	};
+
+	static void *read_slice_callback(void *param, int threadid)
+	{
+		read_slice &slice = *reinterpret_cast<read_slice *>(param);
+		slice.m_err = slice.m_file->read_bytes(slice.m_offset, slice.m_dest, slice.m_length);
+		return nullptr;
+	}
+
+	// split a read into whole-hunk slices and decompress them on all handles at once
+	chd_error read_parallel(uint64_t offset, void *dest, uint32_t length)
+	{
+		uint32_t const hunkbytes = m_file.hunk_bytes();
+		uint32_t const numslices = m_readers.size() + 1;
+		uint32_t slicebytes = (length / numslices + hunkbytes - 1) / hunkbytes * hunkbytes;
+		if (slicebytes == 0)
+			slicebytes = hunkbytes;
+
+		std::vector<read_slice> slices;
+		for (uint32_t curoffs = 0; curoffs < length; curoffs += slicebytes)
+		{
+			read_slice slice;
+			slice.m_file = slices.empty() ? &m_file : &m_readers[slices.size() - 1]->m_file;
+			slice.m_offset = offset + curoffs;
+			slice.m_dest = reinterpret_cast<uint8_t *>(dest) + curoffs;
+			slice.m_length = std::min(slicebytes, length - curoffs);
+			slice.m_err = CHDERR_NONE;
+			slices.push_back(slice);
+		}
+
+		osd_work_item_queue_multiple(m_reader_queue, read_slice_callback, slices.size(), &slices[0], sizeof(slices[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(m_reader_queue, osd_ticks_per_second())) { }
+
+		for (read_slice const &slice : slices)
+			if (slice.m_err != CHDERR_NONE)
+				return slice.m_err;
+		return CHDERR_NONE;
+	}
+
 	// internal state
 	chd_file &      m_file;
 	uint64_t          m_offset;
 	uint64_t          m_maxoffset;
+	std::vector<std::unique_ptr<chd_reader>> m_readers;
+	osd_work_queue *  m_reader_queue;
 };
 
 
@@ -2210,6 +2292,15 @@ static void do_copy(parameters_t &params)
 	{
 		// create the new CHD
 		chd = new chd_chdfile_compressor(input_chd, input_start, input_end);
+
+		// decompressing the input is the bottleneck when recompressing, so spread it over the processors too
+		if (input_chd.compressed())
+		{
+			extern int osd_num_processors;
+			int const numreaders = std::min((osd_num_processors > 0) ? osd_num_processors : int(std::thread::hardware_concurrency()), 8) - 1;
+			auto const input_parent_str = params.find(OPTION_INPUT_PARENT);
+			chd->add_readers(params.find(OPTION_INPUT)->second->c_str(), (input_parent_str != params.end()) ? input_parent_str->second->c_str() : nullptr, numreaders);
+		}
 		chd_error err;
 		if (output_parent.opened())
 			err = chd->create(output_chd_str->c_str(), input_end - input_start, hunk_size, compression, output_parent);
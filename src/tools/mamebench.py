@@ -0,0 +1,149 @@
+#!/usr/bin/python
+##
+## license:BSD-3-Clause
+## copyright-holders:MAMEdev Team
+
+# Boot a list of systems headless for a fixed emulated time and report
+# emulation speed, profiler breakdown and peak memory use as JSON.
+# For Python 2 and 3
+#
+# Input playback files are picked up from the -playback directory as
+# <system>.inp when present, so runs are repeatable.  The profiler
+# breakdown is only available when MAME was built with PROFILER=1.
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+
+DEFAULT_SYSTEMS = [
+    'pacman',       # Z80, simple tile/sprite hardware
+    'galaga',       # multiple Z80s, namco custom I/O
+    'dkong',        # Z80 + MCS48 sound, discrete audio
+    'sf2',          # 68000 + Z80, CPS1 video
+    'outrun',       # dual 68000, sprite scaling
+    'mslug',        # 68000 + Z80, Neo Geo
+    'nbajam',       # TMS34010 + DCS audio
+    'ridgerac'      # DRC, 3D rendering
+]
+
+LUA_SCRIPT = '''
+emu.profiler_enable(true)
+emu.register_stop(function()
+    local file = io.open(%s, "w")
+    if file then
+        local data = emu.profiler_snapshot()
+        if data then
+            for name, seconds in pairs(data) do
+                file:write(name, "\\t", seconds, "\\n")
+            end
+        end
+        file:close()
+    end
+end)
+'''
+
+SPEED_RE = re.compile(r'Average speed: ([0-9.]+)% \(([0-9]+) seconds\)')
+
+
+def run_system(options, system, scriptpath, profilepath):
+    args = [options.mame, system,
+            '-video', 'none', '-sound', 'none', '-nothrottle',
+            '-skip_gameinfo', '-seconds_to_run', str(options.seconds),
+            '-autoboot_script', scriptpath, '-autoboot_delay', '0']
+    if options.playback:
+        inp = os.path.join(options.playback, system + '.inp')
+        if os.path.isfile(inp):
+            args += ['-input_directory', options.playback, '-playback', system + '.inp']
+    args += options.extra
+
+    if os.path.exists(profilepath):
+        os.remove(profilepath)
+
+    result = { 'system': system }
+    with tempfile.TemporaryFile() as output:
+        start = time.time()
+        process = subprocess.Popen(args, stdout=output, stderr=subprocess.STDOUT)
+        peak = None
+        if hasattr(os, 'wait4'):
+            # ru_maxrss is kilobytes on Linux and bytes on macOS
+            status, usage = os.wait4(process.pid, 0)[1:]
+            process.returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1
+            peak = usage.ru_maxrss // 1024 if sys.platform == 'darwin' else usage.ru_maxrss
+        else:
+            process.wait()
+        result['wall_seconds'] = round(time.time() - start, 3)
+        result['returncode'] = process.returncode
+        result['peak_rss_kb'] = peak
+
+        output.seek(0)
+        text = output.read().decode('utf-8', 'replace')
+
+    match = SPEED_RE.search(text)
+    if match:
+        result['speed_percent'] = float(match.group(1))
+        result['emulated_seconds'] = int(match.group(2))
+    else:
+        result['speed_percent'] = None
+        result['emulated_seconds'] = None
+        result['log'] = text[-2000:]
+
+    profile = None
+    if os.path.exists(profilepath):
+        profile = { }
+        with open(profilepath) as f:
+            for line in f:
+                name, sep, seconds = line.rstrip('\n').rpartition('\t')
+                if sep:
+                    profile[name] = float(seconds)
+        os.remove(profilepath)
+    result['profiler'] = profile or None
+    return result
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Benchmark MAME systems headless for a fixed emulated time.')
+    parser.add_argument('mame', help='path to the MAME executable')
+    parser.add_argument('systems', nargs='*', help='systems to run (default: a curated set covering common CPU and video cores)')
+    parser.add_argument('-seconds', type=int, default=60, help='emulated seconds to run each system (default: 60)')
+    parser.add_argument('-playback', metavar='DIR', help='directory containing <system>.inp input recordings')
+    parser.add_argument('-output', metavar='FILE', help='write JSON results to FILE instead of stdout')
+    parser.add_argument('-extra', nargs=argparse.REMAINDER, default=[], help='additional arguments passed to MAME')
+    options = parser.parse_args()
+
+    systems = options.systems or DEFAULT_SYSTEMS
+    workdir = tempfile.mkdtemp(prefix='mamebench')
+    scriptpath = os.path.join(workdir, 'bench.lua')
+    profilepath = os.path.join(workdir, 'profile.txt')
+    with open(scriptpath, 'w') as f:
+        f.write(LUA_SCRIPT % json.dumps(profilepath))
+
+    results = [ ]
+    try:
+        for system in systems:
+            sys.stderr.write('%s...' % system)
+            sys.stderr.flush()
+            result = run_system(options, system, scriptpath, profilepath)
+            results.append(result)
+            if result['speed_percent'] is not None:
+                sys.stderr.write(' %.2f%%\n' % result['speed_percent'])
+            else:
+                sys.stderr.write(' failed (%d)\n' % result['returncode'])
+    finally:
+        os.remove(scriptpath)
+        os.rmdir(workdir)
+
+    report = { 'mame': options.mame, 'seconds': options.seconds, 'results': results }
+    if options.output:
+        with open(options.output, 'w') as f:
+            json.dump(report, f, indent=2, sort_keys=True)
+    else:
+        json.dump(report, sys.stdout, indent=2, sort_keys=True)
+        sys.stdout.write('\n')
+
+    sys.exit(0 if all(r['speed_percent'] is not None for r in results) else 1)
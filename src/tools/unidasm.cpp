@@ -314,6 +314,7 @@ struct options
 	const dasm_table_entry *dasm;
 	uint32_t                skip;
 	uint32_t                count;
+	uint8_t                 trace;
 };
 
 static const dasm_table_entry dasm_table[] =
@@ -1012,6 +1013,8 @@ static int parse_options(int argc, char *argv[], options *opts)
 				opts->upper = true;
 			else if(tolower((uint8_t)curarg[1]) == 'x')
 				opts->xchbytes = true;
+			else if(tolower((uint8_t)curarg[1]) == 't')
+				opts->trace = true;
 			else
 				goto usage;
 		}
@@ -1091,7 +1094,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 usage:
 	printf("Usage: %s <filename> -arch <architecture> [-basepc <pc>] \n", argv[0]);
 	printf("   [-mode <n>] [-norawbytes] [-xchbytes] [-flipped] [-upper] [-lower]\n");
-	printf("   [-skip <n>] [-count <n>]\n");
+	printf("   [-skip <n>] [-count <n>] [-trace]\n");
 	printf("\n");
 	printf("Supported architectures:");
 	const int colwidth = 1 + std::strlen(std::max_element(std::begin(dasm_table), std::end(dasm_table), [](const dasm_table_entry &a, const dasm_table_entry &b) { return std::strlen(a.name) < std::strlen(b.name); })->name);
@@ -1111,6 +1114,69 @@ usage:
 };
 
 
+static int disassemble_trace(const options &opts, util::disasm_interface *disasm, const u8 *data, uint32_t length)
+{
+	// Check the header written by the debugger's binary trace mode
+	static const char signature[] = "MAMETRC\x01";
+	if(length < 9 || memcmp(data, signature, 8) != 0) {
+		fprintf(stderr, "'%s' is not a binary trace file\n", opts.filename);
+		return 1;
+	}
+	int pc_chars = data[8];
+
+	// The debugger stores each opcode unit least significant byte first
+	uint32_t unit = opts.dasm->pcshift < 0 ? 1 << -opts.dasm->pcshift : opts.dasm->pcshift == 3 ? 2 : 1;
+	bool swap = opts.dasm->endian == be && unit > 1;
+
+	unidasm_data_buffer buffer(disasm, opts.dasm);
+	uint32_t offset = 9;
+	uint32_t record = offset;
+	for(; offset < length; record = offset) {
+		u8 type = data[offset++];
+		if(type == 'T' && length - offset >= 4) {
+			uint32_t size = data[offset] | (data[offset + 1] << 8) | (data[offset + 2] << 16) | (uint32_t(data[offset + 3]) << 24);
+			offset += 4;
+			if(size > length - offset)
+				break;
+			fwrite(data + offset, 1, size, stdout);
+			offset += size;
+
+		} else if(type == 'I' && length - offset >= 6) {
+			offs_t pc = data[offset] | (data[offset + 1] << 8) | (data[offset + 2] << 16) | (offs_t(data[offset + 3]) << 24);
+			uint32_t size = data[offset + 4] | (data[offset + 5] << 8);
+			offset += 6;
+			if(size > length - offset)
+				break;
+
+			buffer.data.assign(size + 8, 0x00);
+			for(uint32_t i = 0; i != size; i++)
+				buffer.data[swap ? (i ^ (unit - 1)) : i] = data[offset + i];
+			buffer.size = size;
+			buffer.base_pc = pc;
+			offset += size;
+
+			std::ostringstream stream;
+			disasm->disassemble(stream, pc, buffer, buffer);
+			std::string text = stream.str();
+			if(opts.lower)
+				std::transform(text.begin(), text.end(), text.begin(), [](char c) { return tolower(c); });
+			else if(opts.upper)
+				std::transform(text.begin(), text.end(), text.begin(), [](char c) { return toupper(c); });
+			printf("%0*X: %s\n", pc_chars, pc, text.c_str());
+
+		} else {
+			break;
+		}
+	}
+
+	if(offset < length || record < length) {
+		fprintf(stderr, "Truncated or corrupt record at offset %u\n", record);
+		return 1;
+	}
+	return 0;
+}
+
+
 int main(int argc, char *argv[])
 {
 	// Parse options first
@@ -1132,6 +1198,10 @@ int main(int argc, char *argv[])
 	std::unique_ptr<util::disasm_interface> disasm(opts.dasm->alloc());
 	u32 flags = disasm->interface_flags();
 
+	// Binary trace files carry their own PCs and opcode bytes
+	if(opts.trace)
+		return disassemble_trace(opts, disasm.get(), (const u8 *)data, length);
+
 	// Compute the granularity in bytes (1-8)
 	offs_t granularity = opts.dasm->pcshift < 0 ? disasm->opcode_alignment() << -opts.dasm->pcshift : disasm->opcode_alignment() >> opts.dasm->pcshift;
 